@@ -18,6 +18,8 @@
 #  MAGNUM_PLUGINS_IMAGECONVERTER_DIR - Directory with dynamic image converter
 #   plugins
 #  MAGNUM_PLUGINS_IMPORTER_DIR  - Directory with dynamic importer plugins
+#  MAGNUM_PLUGINS_MESHCONVERTER_DIR - Directory with dynamic mesh converter
+#   plugins
 #  MAGNUM_PLUGINS_AUDIOIMPORTER_DIR - Directory with dynamic audio importer
 #   plugins
 # This command will try to find only the base library, not the optional
@@ -34,11 +36,18 @@
 #  Shapes           - Shapes library (depends on SceneGraph component)
 #  Text             - Text library (depends on TextureTools component)
 #  TextureTools     - TextureTools library
+#  KtxImageConverter - KTX image converter plugin (depends on TextureTools
+#                     component)
 #  MagnumFont       - Magnum bitmap font plugin (depends on Text component
 #                     and TgaImporter plugin)
 #  MagnumFontConverter - Magnum bitmap font converter plugin (depends on Text
 #                     component and TgaImageConverter plugin)
+#  MagnumMeshConverter - Magnum mesh converter plugin (depends on
+#                     MagnumMeshImporter plugin)
+#  MagnumMeshImporter - Magnum mesh importer plugin
 #  ObjImporter      - OBJ importer plugin
+#  ObjMeshConverter - OBJ mesh converter plugin
+#  PlyMeshConverter - PLY mesh converter plugin
 #  TgaImageConverter - TGA image converter plugin
 #  TgaImporter      - TGA importer plugin
 #  WavAudioImporter - WAV audio importer plugin (depends on Audio component)
@@ -77,6 +86,8 @@
 #  MAGNUM_BUILD_DEPRECATED      - Defined if compiled with deprecated APIs
 #   included
 #  MAGNUM_BUILD_STATIC          - Defined if compiled as static libraries
+#  MAGNUM_BUILD_SIMD            - Defined if compiled with SIMD math
+#   specializations
 #  MAGNUM_TARGET_GLES           - Defined if compiled for OpenGL ES
 #  MAGNUM_TARGET_GLES2          - Defined if compiled for OpenGL ES 2.0
 #  MAGNUM_TARGET_GLES3          - Defined if compiled for OpenGL ES 3.0
@@ -107,6 +118,8 @@
 #   plugin installation directory
 #  MAGNUM_PLUGINS_IMPORTER_[DEBUG|RELEASE]_INSTALL_DIR  - Importer plugin
 #   installation directory
+#  MAGNUM_PLUGINS_MESHCONVERTER_[DEBUG|RELEASE]_INSTALL_DIR - Mesh converter
+#   plugin installation directory
 #  MAGNUM_PLUGINS_AUDIOIMPORTER_[DEBUG|RELEASE]_INSTALL_DIR - Audio importer
 #   plugin installation directory
 #  MAGNUM_CMAKE_FIND_MODULE_INSTALL_DIR - Installation dir for CMake Find*
@@ -182,6 +195,10 @@ string(FIND "${_magnumConfigure}" "#define MAGNUM_BUILD_STATIC" _BUILD_STATIC)
 if(NOT _BUILD_STATIC EQUAL -1)
     set(MAGNUM_BUILD_STATIC 1)
 endif()
+string(FIND "${_magnumConfigure}" "#define MAGNUM_BUILD_SIMD" _BUILD_SIMD)
+if(NOT _BUILD_SIMD EQUAL -1)
+    set(MAGNUM_BUILD_SIMD 1)
+endif()
 string(FIND "${_magnumConfigure}" "#define MAGNUM_TARGET_GLES" _TARGET_GLES)
 if(NOT _TARGET_GLES EQUAL -1)
     set(MAGNUM_TARGET_GLES 1)
@@ -258,6 +275,11 @@ foreach(component ${Magnum_FIND_COMPONENTS})
     elseif(${component} MATCHES ".+FontConverter$")
         set(_MAGNUM_${_COMPONENT}_IS_PLUGIN 1)
         set(_MAGNUM_${_COMPONENT}_PATH_SUFFIX fontconverters)
+
+    # MeshConverter plugin specific name suffixes
+    elseif(${component} MATCHES ".+MeshConverter$")
+        set(_MAGNUM_${_COMPONENT}_IS_PLUGIN 1)
+        set(_MAGNUM_${_COMPONENT}_PATH_SUFFIX meshconverters)
     endif()
 
     # Set plugin defaults, find the plugin
@@ -471,6 +493,8 @@ set(MAGNUM_PLUGINS_FONTCONVERTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTAL
 set(MAGNUM_PLUGINS_FONTCONVERTER_RELEASE_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_INSTALL_DIR}/fontconverters)
 set(MAGNUM_PLUGINS_IMAGECONVERTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}/imageconverters)
 set(MAGNUM_PLUGINS_IMAGECONVERTER_RELEASE_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_INSTALL_DIR}/imageconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_RELEASE_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_INSTALL_DIR}/meshconverters)
 set(MAGNUM_PLUGINS_IMPORTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}/importers)
 set(MAGNUM_PLUGINS_IMPORTER_RELEASE_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_INSTALL_DIR}/importers)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_DEBUG_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}/audioimporters)
@@ -495,6 +519,8 @@ mark_as_advanced(FORCE
     MAGNUM_PLUGINS_IMAGECONVERTER_RELEASE_INSTALL_DIR
     MAGNUM_PLUGINS_IMPORTER_DEBUG_INSTALL_DIR
     MAGNUM_PLUGINS_IMPORTER_RELEASE_INSTALL_DIR
+    MAGNUM_PLUGINS_MESHCONVERTER_DEBUG_INSTALL_DIR
+    MAGNUM_PLUGINS_MESHCONVERTER_RELEASE_INSTALL_DIR
     MAGNUM_PLUGINS_AUDIOIMPORTER_DEBUG_INSTALL_DIR
     MAGNUM_PLUGINS_AUDIOIMPORTER_RELEASE_INSTALL_DIR
     MAGNUM_CMAKE_MODULE_INSTALL_DIR
@@ -519,4 +545,5 @@ set(MAGNUM_PLUGINS_FONT_DIR ${MAGNUM_PLUGINS_DIR}/fonts)
 set(MAGNUM_PLUGINS_FONTCONVERTER_DIR ${MAGNUM_PLUGINS_DIR}/fontconverters)
 set(MAGNUM_PLUGINS_IMAGECONVERTER_DIR ${MAGNUM_PLUGINS_DIR}/imageconverters)
 set(MAGNUM_PLUGINS_IMPORTER_DIR ${MAGNUM_PLUGINS_DIR}/importers)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DIR ${MAGNUM_PLUGINS_DIR}/meshconverters)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_DIR ${MAGNUM_PLUGINS_DIR}/audioimporters)
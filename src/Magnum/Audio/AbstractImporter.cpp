@@ -29,18 +29,33 @@
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Implementation/MappedFile.h"
+
 namespace Magnum { namespace Audio {
 
-AbstractImporter::AbstractImporter() = default;
+AbstractImporter::AbstractImporter(): _dataPosition(0), _persistentData(false) {}
+
+AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin): PluginManager::AbstractPlugin(manager, std::move(plugin)), _dataPosition(0), _persistentData(false) {}
 
-AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin): PluginManager::AbstractPlugin(manager, std::move(plugin)) {}
+AbstractImporter::~AbstractImporter() = default;
 
 bool AbstractImporter::openData(Containers::ArrayReference<const unsigned char> data) {
     CORRADE_ASSERT(features() & Feature::OpenData,
-        "Audio::AbstractImporter::openData(): feature not supported", nullptr);
+        "Audio::AbstractImporter::openData(): feature not supported", false);
+
+    close();
+    doOpenData(data);
+    return isOpened();
+}
+
+bool AbstractImporter::openPersistentData(Containers::ArrayReference<const unsigned char> data) {
+    CORRADE_ASSERT(features() & Feature::OpenData,
+        "Audio::AbstractImporter::openPersistentData(): feature not supported", false);
 
     close();
+    _persistentData = true;
     doOpenData(data);
+    if(!isOpened()) _persistentData = false;
     return isOpened();
 }
 
@@ -51,6 +66,12 @@ void AbstractImporter::doOpenData(Containers::ArrayReference<const unsigned char
 bool AbstractImporter::openFile(const std::string& filename) {
     close();
     doOpenFile(filename);
+
+    /* Release the mapping right away if opening failed */
+    if(!isOpened()) {
+        _mappedFile.reset();
+        _persistentData = false;
+    }
     return isOpened();
 }
 
@@ -59,11 +80,20 @@ void AbstractImporter::doOpenFile(const std::string& filename) {
 
     /* Open file */
     if(!Utility::Directory::fileExists(filename)) {
-        Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
+        Error() << "Audio::AbstractImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    /* Map the file and keep it until the file is closed */
+    std::unique_ptr<Implementation::MappedFile> mappedFile{new Implementation::MappedFile{filename}};
+    if(!mappedFile->isValid()) {
+        Error() << "Audio::AbstractImporter::openFile(): cannot map file" << filename;
         return;
     }
 
-    doOpenData(Utility::Directory::read(filename));
+    _mappedFile = std::move(mappedFile);
+    _persistentData = true;
+    doOpenData(_mappedFile->data());
 }
 
 void AbstractImporter::close() {
@@ -71,6 +101,11 @@ void AbstractImporter::close() {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    /* Data are released only after the plugin doesn't reference them */
+    _mappedFile.reset();
+    _persistentData = false;
+    _dataPosition = 0;
 }
 
 Buffer::Format AbstractImporter::format() const {
@@ -83,9 +118,62 @@ UnsignedInt AbstractImporter::frequency() const {
     return doFrequency();
 }
 
+std::size_t AbstractImporter::frameSize() const {
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::frameSize(): no file opened", 0);
+
+    switch(doFormat()) {
+        case Buffer::Format::Mono8: return 1;
+        case Buffer::Format::Mono16:
+        case Buffer::Format::Stereo8: return 2;
+        case Buffer::Format::Stereo16: return 4;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
 Containers::Array<unsigned char> AbstractImporter::data() {
     CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::data(): no file opened", nullptr);
     return doData();
 }
 
+std::size_t AbstractImporter::dataSize() const {
+    CORRADE_ASSERT(features() & Feature::Streaming,
+        "Audio::AbstractImporter::dataSize(): feature not supported", 0);
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::dataSize(): no file opened", 0);
+    return doDataSize();
+}
+
+std::size_t AbstractImporter::doDataSize() const {
+    CORRADE_ASSERT(false, "Audio::AbstractImporter::dataSize(): feature advertised but not implemented", 0);
+}
+
+std::size_t AbstractImporter::readData(Containers::ArrayReference<unsigned char> destination) {
+    CORRADE_ASSERT(features() & Feature::Streaming,
+        "Audio::AbstractImporter::readData(): feature not supported", 0);
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::readData(): no file opened", 0);
+    CORRADE_ASSERT(destination.size() >= frameSize(),
+        "Audio::AbstractImporter::readData(): destination of" << destination.size() << "bytes is smaller than frame size" << frameSize(), 0);
+
+    const std::size_t size = doReadData(_dataPosition, destination);
+    CORRADE_INTERNAL_ASSERT(size <= destination.size());
+    _dataPosition += size;
+    return size;
+}
+
+std::size_t AbstractImporter::doReadData(std::size_t, Containers::ArrayReference<unsigned char>) {
+    CORRADE_ASSERT(false, "Audio::AbstractImporter::readData(): feature advertised but not implemented", 0);
+}
+
+void AbstractImporter::seekData(const std::size_t position) {
+    CORRADE_ASSERT(features() & Feature::Streaming,
+        "Audio::AbstractImporter::seekData(): feature not supported", );
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::seekData(): no file opened", );
+    CORRADE_ASSERT(position <= doDataSize(),
+        "Audio::AbstractImporter::seekData(): position" << position << "out of range for" << doDataSize() << "bytes", );
+    CORRADE_ASSERT(position % frameSize() == 0,
+        "Audio::AbstractImporter::seekData(): position" << position << "is not a multiple of frame size" << frameSize(), );
+
+    _dataPosition = position;
+}
+
 }}
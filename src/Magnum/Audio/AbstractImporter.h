@@ -29,12 +29,18 @@
  * @brief Class Magnum::Audio::AbstractImporter
  */
 
+#include <memory>
+#include <Corrade/Containers/EnumSet.h>
 #include <Corrade/PluginManager/AbstractPlugin.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Audio/Buffer.h"
 
-namespace Magnum { namespace Audio {
+namespace Magnum {
+
+namespace Implementation { class MappedFile; }
+
+namespace Audio {
 
 /**
 @brief Base for audio importer plugins
@@ -47,7 +53,15 @@ importer plugins.
 
 Plugin implements function doFeatures(), doIsOpened(), one of or both
 doOpenData() and doOpenFile() functions, function doClose() and data access
-functions doFormat(), doFrequency() and doData().
+functions doFormat(), doFrequency() and doData(). If the plugin supports
+@ref Feature::Streaming, it implements also doDataSize() and doReadData().
+
+If the plugin doesn't implement @ref doOpenFile(), the default implementation
+memory-maps the file and passes the mapped memory to @ref doOpenData(). The
+mapping is kept until the file is closed, so if @ref isDataPersistent()
+returns `true`, the plugin can reference the data directly instead of copying
+them. Together with streaming this allows playing long files with memory
+usage bounded by the size of the decoded blocks.
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -56,11 +70,15 @@ checked by the implementation:
     was closed, function doClose() is called only if there is any file opened.
 -   Function doOpenData() is called only if @ref Feature::OpenData is
     supported.
+-   Functions doDataSize() and doReadData() are called only if
+    @ref Feature::Streaming is supported.
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
+-   Function doReadData() is called only with offset not larger than value
+    returned from doDataSize().
 */
 class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
-    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Audio.AbstractImporter/0.1")
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Audio.AbstractImporter/0.2")
 
     public:
         /**
@@ -70,7 +88,13 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
          */
         enum class Feature: UnsignedByte {
             /** Opening files from raw data using openData() */
-            OpenData = 1 << 0
+            OpenData = 1 << 0,
+
+            /**
+             * Decoding the data in blocks using readData() and
+             * seekData()
+             */
+            Streaming = 1 << 1
         };
 
         /**
@@ -86,6 +110,8 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
         /** @brief Plugin manager constructor */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin);
 
+        ~AbstractImporter();
+
         /** @brief Features supported by this importer */
         Features features() const { return doFeatures(); }
 
@@ -102,11 +128,27 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
          */
         bool openData(Containers::ArrayReference<const unsigned char> data);
 
+        /**
+         * @brief Open raw data which stay valid until the file is closed
+         *
+         * Same as @ref openData(), but the caller guarantees that @p data
+         * stay valid and unchanged until @ref close() is called or another
+         * file is opened, e.g. when they are a region of memory-mapped
+         * file. The plugin can then reference the data directly instead of
+         * copying them, see @ref isDataPersistent(). Available only if
+         * @ref Feature::OpenData is supported.
+         * @see features(), openFile()
+         */
+        bool openPersistentData(Containers::ArrayReference<const unsigned char> data);
+
         /**
          * @brief Open file
          *
          * Closes previous file, if it was opened, and tries to open given
-         * file. Returns `true` on success, `false` otherwise.
+         * file. Returns `true` on success, `false` otherwise. If the plugin
+         * supports @ref Feature::OpenData, the file is memory-mapped instead
+         * of being read into memory, see @ref Audio-AbstractImporter-subclassing
+         * for more information.
          * @see features(), openData()
          */
         bool openFile(const std::string& filename);
@@ -122,11 +164,83 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
         /** @brief Sample frequency */
         UnsignedInt frequency() const;
 
-        /** @brief Sample data */
+        /**
+         * @brief Sample frame size
+         *
+         * Size of samples for all channels in bytes, derived from
+         * @ref format().
+         * @see @ref readData(), @ref seekData()
+         */
+        std::size_t frameSize() const;
+
+        /**
+         * @brief Sample data
+         *
+         * Decodes all sample data at once.
+         * @see @ref readData()
+         */
         Containers::Array<unsigned char> data();
 
         /*@}*/
 
+        /** @{ @name Streaming */
+
+        /**
+         * @brief Size of decoded sample data
+         *
+         * Size of data returned by @ref data() in bytes. Available only if
+         * @ref Feature::Streaming is supported.
+         */
+        std::size_t dataSize() const;
+
+        /**
+         * @brief Position in decoded sample data
+         *
+         * Offset in bytes at which next call to @ref readData() starts
+         * decoding. Reset to `0` when a file is opened.
+         */
+        std::size_t dataPosition() const { return _dataPosition; }
+
+        /**
+         * @brief Decode next block of sample data
+         *
+         * Decodes data from current @ref dataPosition() into @p destination
+         * and advances the position. Only whole sample frames (i.e. samples
+         * for all channels) are decoded, so less than `destination.size()`
+         * bytes might be written even if the end of data was not reached yet.
+         * The @p destination must be at least @ref frameSize() bytes large.
+         * Returns count of bytes written, `0` at the end of data. Available
+         * only if @ref Feature::Streaming is supported. The concatenated
+         * blocks are equivalent to output of @ref data().
+         * @see @ref dataSize(), @ref seekData()
+         */
+        std::size_t readData(Containers::ArrayReference<unsigned char> destination);
+
+        /**
+         * @brief Seek in decoded sample data
+         *
+         * Sets position for next @ref readData() call. The @p position must
+         * not be larger than @ref dataSize() and must be a multiple of
+         * @ref frameSize(). Available only if @ref Feature::Streaming is
+         * supported.
+         */
+        void seekData(std::size_t position);
+
+        /*@}*/
+
+    protected:
+        /**
+         * @brief Whether data passed to @ref doOpenData() stay valid
+         *
+         * Returns `true` if the data passed to @ref doOpenData() are
+         * guaranteed to stay valid until @ref doClose() is called, i.e. when
+         * the file was memory-mapped by default @ref doOpenFile()
+         * implementation or opened with @ref openPersistentData(). The
+         * plugin can then reference the data directly instead of copying
+         * them. Meaningful only inside @ref doOpenData().
+         */
+        bool isDataPersistent() const { return _persistentData; }
+
     #ifndef DOXYGEN_GENERATING_OUTPUT
     private:
     #else
@@ -144,8 +258,12 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
         /**
          * @brief Implementation for openFile()
          *
-         * If @ref Feature::OpenData is supported, default implementation opens
-         * the file and calls @ref doOpenData() with its contents.
+         * If @ref Feature::OpenData is supported, default implementation
+         * memory-maps the file and calls @ref doOpenData() with its contents.
+         * On platforms without memory mapping support the file is read into
+         * memory instead. In both cases the data are kept until the file is
+         * closed.
+         * @see @ref isDataPersistent()
          */
         virtual void doOpenFile(const std::string& filename);
 
@@ -160,8 +278,28 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
 
         /** @brief Implementation for data() */
         virtual Containers::Array<unsigned char> doData() = 0;
+
+        /** @brief Implementation for dataSize() */
+        virtual std::size_t doDataSize() const;
+
+        /**
+         * @brief Implementation for readData()
+         *
+         * Decodes data starting at @p offset into @p destination and returns
+         * count of bytes written. The position is tracked by the base class,
+         * so the implementation doesn't need to keep any state between
+         * calls.
+         */
+        virtual std::size_t doReadData(std::size_t offset, Containers::ArrayReference<unsigned char> destination);
+
+    private:
+        std::unique_ptr<Implementation::MappedFile> _mappedFile;
+        std::size_t _dataPosition;
+        bool _persistentData;
 };
 
+CORRADE_ENUMSET_OPERATORS(AbstractImporter::Features)
+
 }}
 
 #endif
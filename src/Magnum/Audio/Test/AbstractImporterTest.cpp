@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <sstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
@@ -38,10 +40,18 @@ class AbstractImporterTest: public TestSuite::Tester {
         explicit AbstractImporterTest();
 
         void openFile();
+        void openFileMapped();
+        void streaming();
+        void streamingFrameSize();
+        void streamingNotSupported();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::openFileMapped,
+              &AbstractImporterTest::streaming,
+              &AbstractImporterTest::streamingFrameSize,
+              &AbstractImporterTest::streamingNotSupported});
 }
 
 void AbstractImporterTest::openFile() {
@@ -72,6 +82,170 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+void AbstractImporterTest::openFileMapped() {
+    class DataImporter: public Audio::AbstractImporter {
+        public:
+            explicit DataImporter(): persistent(false) {}
+
+            Containers::ArrayReference<const unsigned char> data;
+            bool persistent;
+
+        private:
+            Features doFeatures() const override { return Feature::OpenData; }
+            bool doIsOpened() const override { return data; }
+            void doClose() override { data = nullptr; }
+
+            void doOpenData(Containers::ArrayReference<const unsigned char> data) override {
+                this->data = data;
+                persistent = isDataPersistent();
+            }
+
+            Buffer::Format doFormat() const override { return {}; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<unsigned char> doData() override { return nullptr; }
+    };
+
+    /* Data from doOpenFile() should stay valid until the file is closed */
+    DataImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(AUDIO_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.persistent);
+    CORRADE_COMPARE(importer.data.size(), 1);
+    CORRADE_COMPARE(importer.data[0], 0xa5);
+
+    /* Data passed to openData() are not persistent */
+    const unsigned char data[] = { 0xa5 };
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_VERIFY(!importer.persistent);
+
+    /* Data passed to openPersistentData() are */
+    CORRADE_VERIFY(importer.openPersistentData(data));
+    CORRADE_VERIFY(importer.persistent);
+    CORRADE_VERIFY(importer.data.data() == data);
+}
+
+void AbstractImporterTest::streaming() {
+    class StreamingImporter: public Audio::AbstractImporter {
+        public:
+            explicit StreamingImporter(): opened(false) {}
+
+        private:
+            Features doFeatures() const override { return Feature::OpenData|Feature::Streaming; }
+            bool doIsOpened() const override { return opened; }
+            void doClose() override { opened = false; }
+            void doOpenData(Containers::ArrayReference<const unsigned char>) override { opened = true; }
+
+            Buffer::Format doFormat() const override { return Buffer::Format::Mono8; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<unsigned char> doData() override { return nullptr; }
+
+            std::size_t doDataSize() const override { return 10; }
+            std::size_t doReadData(std::size_t offset, Containers::ArrayReference<unsigned char> destination) override {
+                const std::size_t size = std::min(destination.size(), 10 - offset);
+                for(std::size_t i = 0; i != size; ++i) destination[i] = offset + i;
+                return size;
+            }
+
+            bool opened;
+    };
+
+    StreamingImporter importer;
+    const unsigned char data[] = { 0 };
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_COMPARE(importer.frameSize(), 1);
+    CORRADE_COMPARE(importer.dataSize(), 10);
+    CORRADE_COMPARE(importer.dataPosition(), 0);
+
+    /* Position should be advanced after each read */
+    unsigned char block[4];
+    CORRADE_COMPARE(importer.readData(block), 4);
+    CORRADE_COMPARE(block[3], 3);
+    CORRADE_COMPARE(importer.dataPosition(), 4);
+    CORRADE_COMPARE(importer.readData(block), 4);
+    CORRADE_COMPARE(block[0], 4);
+    CORRADE_COMPARE(importer.readData(block), 2);
+    CORRADE_COMPARE(block[1], 9);
+    CORRADE_COMPARE(importer.readData(block), 0);
+    CORRADE_COMPARE(importer.dataPosition(), 10);
+
+    /* Seeking */
+    importer.seekData(7);
+    CORRADE_COMPARE(importer.readData(block), 3);
+    CORRADE_COMPARE(block[0], 7);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    importer.seekData(11);
+    CORRADE_COMPARE(importer.dataPosition(), 10);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::seekData(): position 11 out of range for 10 bytes\n");
+
+    /* Position should be reset on reopening */
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_COMPARE(importer.dataPosition(), 0);
+}
+
+void AbstractImporterTest::streamingFrameSize() {
+    class StreamingImporter: public Audio::AbstractImporter {
+        public:
+            explicit StreamingImporter(): readCount(0) {}
+
+            std::size_t readCount;
+
+        private:
+            Features doFeatures() const override { return Feature::OpenData|Feature::Streaming; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            Buffer::Format doFormat() const override { return Buffer::Format::Stereo16; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<unsigned char> doData() override { return nullptr; }
+
+            std::size_t doDataSize() const override { return 16; }
+            std::size_t doReadData(std::size_t, Containers::ArrayReference<unsigned char>) override {
+                ++readCount;
+                return 0;
+            }
+    };
+
+    StreamingImporter importer;
+    CORRADE_COMPARE(importer.frameSize(), 4);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    /* Destination smaller than a frame would return 0 as if at the end */
+    unsigned char block[3];
+    CORRADE_COMPARE(importer.readData(block), 0);
+    CORRADE_COMPARE(importer.readCount, 0);
+
+    /* Position not aligned to a frame */
+    importer.seekData(6);
+    CORRADE_COMPARE(importer.dataPosition(), 0);
+    CORRADE_COMPARE(out.str(),
+        "Audio::AbstractImporter::readData(): destination of 3 bytes is smaller than frame size 4\n"
+        "Audio::AbstractImporter::seekData(): position 6 is not a multiple of frame size 4\n");
+}
+
+void AbstractImporterTest::streamingNotSupported() {
+    class DataImporter: public Audio::AbstractImporter {
+        private:
+            Features doFeatures() const override { return Feature::OpenData; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            Buffer::Format doFormat() const override { return {}; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<unsigned char> doData() override { return nullptr; }
+    };
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    DataImporter importer;
+    unsigned char block[4];
+    CORRADE_COMPARE(importer.readData(block), 0);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::readData(): feature not supported\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::AbstractImporterTest)
@@ -0,0 +1,97 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MappedFile.h"
+
+#ifdef MAGNUM_MAPPEDFILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(CORRADE_TARGET_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <Corrade/Utility/Directory.h>
+#endif
+
+namespace Magnum { namespace Implementation {
+
+#ifdef MAGNUM_MAPPEDFILE_MMAP
+MappedFile::MappedFile(const std::string& filename): _fd{::open(filename.data(), O_RDONLY)}, _valid{} {
+    struct stat info;
+    if(_fd == -1 || fstat(_fd, &info) == -1) return;
+
+    /* Mapping zero-sized file fails, leave the view empty in that case */
+    const std::size_t size = info.st_size;
+    if(!size) {
+        _valid = true;
+        return;
+    }
+
+    void* const mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if(mapped == MAP_FAILED) return;
+
+    _data = {static_cast<const unsigned char*>(mapped), size};
+    _valid = true;
+}
+
+MappedFile::~MappedFile() {
+    if(_data) munmap(const_cast<unsigned char*>(_data.data()), _data.size());
+    if(_fd != -1) ::close(_fd);
+}
+#elif defined(CORRADE_TARGET_WINDOWS)
+MappedFile::MappedFile(const std::string& filename): _file{CreateFileA(filename.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)}, _mapping{}, _valid{} {
+    LARGE_INTEGER size;
+    if(_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(_file, &size)) return;
+
+    /* Mapping zero-sized file fails, leave the view empty in that case */
+    if(!size.QuadPart) {
+        _valid = true;
+        return;
+    }
+
+    _mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(!_mapping) return;
+
+    const void* const mapped = MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+    if(!mapped) return;
+
+    _data = {static_cast<const unsigned char*>(mapped), std::size_t(size.QuadPart)};
+    _valid = true;
+}
+
+MappedFile::~MappedFile() {
+    if(_data) UnmapViewOfFile(_data.data());
+    if(_mapping) CloseHandle(_mapping);
+    if(_file != INVALID_HANDLE_VALUE) CloseHandle(_file);
+}
+#else
+MappedFile::MappedFile(const std::string& filename): _storage{Utility::Directory::read(filename)}, _data{_storage}, _valid{true} {}
+
+MappedFile::~MappedFile() = default;
+#endif
+
+}}
@@ -0,0 +1,75 @@
+#ifndef Magnum_Implementation_MappedFile_h
+#define Magnum_Implementation_MappedFile_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_NACL) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#define MAGNUM_MAPPEDFILE_MMAP
+#endif
+
+namespace Magnum { namespace Implementation {
+
+/* Read-only view on file contents, either memory-mapped or, where mapping is
+   not available, read into memory. Shared by default openFile()
+   implementations of Trade and Audio importers. Not exported, the source is
+   compiled into both the main and the audio library instead. */
+class MappedFile {
+    public:
+        explicit MappedFile(const std::string& filename);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile(MappedFile&&) = delete;
+
+        ~MappedFile();
+
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile& operator=(MappedFile&&) = delete;
+
+        /* Whether the file was opened successfully. Empty files are valid
+           with empty data. */
+        bool isValid() const { return _valid; }
+
+        Containers::ArrayReference<const unsigned char> data() const { return _data; }
+
+    private:
+        #ifdef MAGNUM_MAPPEDFILE_MMAP
+        int _fd;
+        #elif defined(CORRADE_TARGET_WINDOWS)
+        void *_file, *_mapping;
+        #else
+        Containers::Array<unsigned char> _storage;
+        #endif
+        Containers::ArrayReference<const unsigned char> _data;
+        bool _valid;
+};
+
+}}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef Magnum_Implementation_parallelRows_h
+#define Magnum_Implementation_parallelRows_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <functional>
+#if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <thread>
+#include <vector>
+#endif
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Calls the function on ranges of rows (or any other independent items),
+   split across hardware threads if the processed data are large enough to be
+   worth it */
+inline void parallelRows(const Int rows, const std::size_t dataSize, const bool parallel, const std::function<void(Int, Int)>& function) {
+    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    const Int threadCount = Math::min(Int(std::thread::hardware_concurrency()), rows);
+    if(parallel && threadCount > 1 && dataSize >= 1024*1024) {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for(Int i = 1; i != threadCount; ++i)
+            threads.emplace_back(function, rows*i/threadCount, rows*(i + 1)/threadCount);
+        function(0, rows/threadCount);
+        for(std::thread& thread: threads) thread.join();
+        return;
+    }
+    #else
+    static_cast<void>(dataSize);
+    static_cast<void>(parallel);
+    #endif
+
+    function(0, rows);
+}
+
+}}
+
+#endif
@@ -89,6 +89,20 @@ Defined if built as static libraries. Default are shared libraries.
 #define MAGNUM_BUILD_STATIC
 #undef MAGNUM_BUILD_STATIC
 
+/**
+@brief SIMD math build
+
+Defined if built with SSE2 or NEON implementation of the most frequently used
+@ref Math::Matrix4 "Matrix4" and @ref Math::Vector4 "Vector4" operations on
+@ref Float. The specializations are used only if the compiler targets
+instruction set supporting them, otherwise the generic implementation is used.
+Results may differ from the generic implementation in the last bits due to
+different order of operations. Disabled by default.
+@see @ref building
+*/
+#define MAGNUM_BUILD_SIMD
+#undef MAGNUM_BUILD_SIMD
+
 /**
 @brief OpenGL ES target
 
@@ -334,6 +348,9 @@ typedef Math::Range2D<Float> Range2D;
 /** @brief Float 3D range */
 typedef Math::Range3D<Float> Range3D;
 
+/** @brief Float frustum */
+typedef Math::Frustum<Float> Frustum;
+
 /** @brief Signed integer 1D range */
 #ifndef CORRADE_GCC46_COMPATIBILITY
 typedef Math::Range1D<Int> Range1Di;
@@ -503,6 +520,9 @@ typedef Math::Range2D<Double> Range2Dd;
 /** @brief Double 3D range */
 typedef Math::Range3D<Double> Range3Dd;
 
+/** @brief Double frustum */
+typedef Math::Frustum<Double> Frustumd;
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @copybrief Range2Dd
@@ -0,0 +1,194 @@
+#ifndef Magnum_Math_Algorithms_Cramer_h
+#define Magnum_Math_Algorithms_Cramer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function Magnum::Math::Algorithms::cramerInverted(), Magnum::Math::Algorithms::cramerSolve()
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+/**
+@brief Inverted 3x3 matrix using Cramer's rule
+
+Closed-form alternative to @ref Matrix::inverted() and @ref gaussJordanInPlace().
+Rows of the inverse are cross products of the columns: @f[
+    A^{-1} = \frac{1}{\boldsymbol a_0 \cdot (\boldsymbol a_1 \times \boldsymbol a_2)} \begin{pmatrix}
+        (\boldsymbol a_1 \times \boldsymbol a_2)^T \\
+        (\boldsymbol a_2 \times \boldsymbol a_0)^T \\
+        (\boldsymbol a_0 \times \boldsymbol a_1)^T
+    \end{pmatrix}
+@f]
+The matrix is expected to be regular, otherwise the result contains
+infinities or NaNs. Unlike @ref gaussJordanInPlace() there is no pivoting, so
+the precision is lower for badly conditioned matrices.
+@see @ref Matrix::determinant()
+*/
+template<class T> Matrix<3, T> cramerInverted(const Matrix<3, T>& matrix) {
+    const Vector3<T> r0 = Vector3<T>::cross(matrix[1], matrix[2]);
+    const Vector3<T> r1 = Vector3<T>::cross(matrix[2], matrix[0]);
+    const Vector3<T> r2 = Vector3<T>::cross(matrix[0], matrix[1]);
+    const T inverseDeterminant = T(1)/Vector<3, T>::dot(matrix[0], r0);
+    return {Vector<3, T>(r0[0], r1[0], r2[0])*inverseDeterminant,
+            Vector<3, T>(r0[1], r1[1], r2[1])*inverseDeterminant,
+            Vector<3, T>(r0[2], r1[2], r2[2])*inverseDeterminant};
+}
+
+/**
+@brief Inverted 4x4 matrix using Cramer's rule
+
+Closed-form alternative to @ref Matrix::inverted() and @ref gaussJordanInPlace().
+The adjugate and determinant are computed from twelve shared 2x2
+subdeterminants of the upper and lower half of the matrix, using Laplace
+expansion. If built with @ref MAGNUM_BUILD_SIMD on SSE2, @ref Float matrices
+are inverted with the same code as @ref Matrix4::inverted(). The matrix is
+expected to be regular, otherwise the result contains infinities or NaNs.
+@see @ref Matrix::determinant()
+*/
+template<class T> Matrix<4, T> cramerInverted(const Matrix<4, T>& matrix) {
+    /* The formulas are for row-major matrices, but inverse of transposed
+       matrix is transposed inverse, so they work on columns as well */
+    const Matrix<4, T>& m = matrix;
+    const T s0 = m[0][0]*m[1][1] - m[1][0]*m[0][1];
+    const T s1 = m[0][0]*m[1][2] - m[1][0]*m[0][2];
+    const T s2 = m[0][0]*m[1][3] - m[1][0]*m[0][3];
+    const T s3 = m[0][1]*m[1][2] - m[1][1]*m[0][2];
+    const T s4 = m[0][1]*m[1][3] - m[1][1]*m[0][3];
+    const T s5 = m[0][2]*m[1][3] - m[1][2]*m[0][3];
+    const T c5 = m[2][2]*m[3][3] - m[3][2]*m[2][3];
+    const T c4 = m[2][1]*m[3][3] - m[3][1]*m[2][3];
+    const T c3 = m[2][1]*m[3][2] - m[3][1]*m[2][2];
+    const T c2 = m[2][0]*m[3][3] - m[3][0]*m[2][3];
+    const T c1 = m[2][0]*m[3][2] - m[3][0]*m[2][2];
+    const T c0 = m[2][0]*m[3][1] - m[3][0]*m[2][1];
+
+    const T inverseDeterminant = T(1)/(s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0);
+
+    return {Vector<4, T>( m[1][1]*c5 - m[1][2]*c4 + m[1][3]*c3,
+                         -m[0][1]*c5 + m[0][2]*c4 - m[0][3]*c3,
+                          m[3][1]*s5 - m[3][2]*s4 + m[3][3]*s3,
+                         -m[2][1]*s5 + m[2][2]*s4 - m[2][3]*s3)*inverseDeterminant,
+            Vector<4, T>(-m[1][0]*c5 + m[1][2]*c2 - m[1][3]*c1,
+                          m[0][0]*c5 - m[0][2]*c2 + m[0][3]*c1,
+                         -m[3][0]*s5 + m[3][2]*s2 - m[3][3]*s1,
+                          m[2][0]*s5 - m[2][2]*s2 + m[2][3]*s1)*inverseDeterminant,
+            Vector<4, T>( m[1][0]*c4 - m[1][1]*c2 + m[1][3]*c0,
+                         -m[0][0]*c4 + m[0][1]*c2 - m[0][3]*c0,
+                          m[3][0]*s4 - m[3][1]*s2 + m[3][3]*s0,
+                         -m[2][0]*s4 + m[2][1]*s2 - m[2][3]*s0)*inverseDeterminant,
+            Vector<4, T>(-m[1][0]*c3 + m[1][1]*c1 - m[1][2]*c0,
+                          m[0][0]*c3 - m[0][1]*c1 + m[0][2]*c0,
+                         -m[3][0]*s3 + m[3][1]*s1 - m[3][2]*s0,
+                          m[2][0]*s3 - m[2][1]*s1 + m[2][2]*s0)*inverseDeterminant};
+}
+
+#ifdef MAGNUM_MATH_SIMD_SSE2
+template<> inline Matrix<4, Float> cramerInverted(const Matrix<4, Float>& matrix) {
+    return matrix.inverted();
+}
+#endif
+
+/**
+@brief Solve 3x3 linear system using Cramer's rule
+@param a        Matrix of the system
+@param b        Right side of the system
+@return Solution @f$ \boldsymbol x @f$ of @f$ A \boldsymbol x = \boldsymbol b @f$
+
+Closed-form alternative to @ref gaussJordanInPlace() with one-column right
+side, computed as product of @ref cramerInverted(const Matrix<3, T>&) and
+@p b, without forming the whole inverse. Same limitations as for
+@ref cramerInverted(const Matrix<3, T>&) apply.
+*/
+template<class T> Vector<3, T> cramerSolve(const Matrix<3, T>& a, const Vector<3, T>& b) {
+    const Vector3<T> r0 = Vector3<T>::cross(a[1], a[2]);
+    const Vector3<T> r1 = Vector3<T>::cross(a[2], a[0]);
+    const Vector3<T> r2 = Vector3<T>::cross(a[0], a[1]);
+    const T inverseDeterminant = T(1)/Vector<3, T>::dot(a[0], r0);
+    return Vector<3, T>(Vector<3, T>::dot(r0, b),
+                        Vector<3, T>::dot(r1, b),
+                        Vector<3, T>::dot(r2, b))*inverseDeterminant;
+}
+
+/**
+@brief Solve 4x4 linear system using Cramer's rule
+@param a        Matrix of the system
+@param b        Right side of the system
+@return Solution @f$ \boldsymbol x @f$ of @f$ A \boldsymbol x = \boldsymbol b @f$
+
+Closed-form alternative to @ref gaussJordanInPlace() with one-column right
+side, computed as product of @ref cramerInverted(const Matrix<4, T>&) and
+@p b. Same limitations as for @ref cramerInverted(const Matrix<4, T>&) apply.
+*/
+template<class T> Vector<4, T> cramerSolve(const Matrix<4, T>& a, const Vector<4, T>& b) {
+    return cramerInverted(a)*b;
+}
+
+/**
+@brief Invert many matrices using Cramer's rule
+@param matrices Input matrices
+@param out      Where to put the inverted matrices
+
+Batch version of @ref cramerInverted(const Matrix<3, T>&) and
+@ref cramerInverted(const Matrix<4, T>&), only 3x3 and 4x4 matrices are
+supported. @p out has to have the same size as @p matrices and can point to
+the same memory.
+*/
+template<std::size_t size, class T> void cramerInverted(Corrade::Containers::ArrayReference<const Matrix<size, T>> matrices, Corrade::Containers::ArrayReference<Matrix<size, T>> out) {
+    static_assert(size == 3 || size == 4, "Only 3x3 and 4x4 matrices are supported");
+    CORRADE_ASSERT(matrices.size() == out.size(),
+        "Math::Algorithms::cramerInverted(): expected output array of size" << matrices.size() << "but got" << out.size(), );
+    for(std::size_t i = 0; i != matrices.size(); ++i)
+        out[i] = cramerInverted(matrices[i]);
+}
+
+/**
+@brief Solve many linear systems using Cramer's rule
+@param a        Matrices of the systems
+@param b        Right sides of the systems
+@param out      Where to put the solutions
+
+Batch version of @ref cramerSolve(const Matrix<3, T>&, const Vector<3, T>&)
+and @ref cramerSolve(const Matrix<4, T>&, const Vector<4, T>&), only 3x3 and
+4x4 matrices are supported. All arrays have to have the same size, @p out can
+point to the same memory as @p b.
+*/
+template<std::size_t size, class T> void cramerSolve(Corrade::Containers::ArrayReference<const Matrix<size, T>> a, Corrade::Containers::ArrayReference<const Vector<size, T>> b, Corrade::Containers::ArrayReference<Vector<size, T>> out) {
+    static_assert(size == 3 || size == 4, "Only 3x3 and 4x4 matrices are supported");
+    CORRADE_ASSERT(b.size() == a.size() && out.size() == a.size(),
+        "Math::Algorithms::cramerSolve(): array sizes don't match", );
+    for(std::size_t i = 0; i != a.size(); ++i)
+        out[i] = cramerSolve(a[i], b[i]);
+}
+
+}}}
+
+#endif
@@ -26,13 +26,17 @@
 */
 
 /** @file
- * @brief Function Magnum::Math::Algorithms::svd()
+ * @brief Function Magnum::Math::Algorithms::svd(), Magnum::Math::Algorithms::svd3x3()
  */
 
+#include <limits>
 #include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Math { namespace Algorithms {
 
@@ -55,6 +59,72 @@ template<> constexpr Float smallestDelta<Float>() { return 1.0e-32f; }
 template<> constexpr Double smallestDelta<Double>() { return 1.0e-64; }
 #endif
 
+/* Maximal count of Jacobi sweeps in svd3x3(), enough to converge to full
+   precision */
+template<class T> constexpr std::size_t jacobiSweeps();
+template<> constexpr std::size_t jacobiSweeps<Float>() { return 4; }
+#ifndef MAGNUM_TARGET_GLES
+template<> constexpr std::size_t jacobiSweeps<Double>() { return 5; }
+#endif
+
+/* Jacobi rotation zeroing element (p, q) of symmetric matrix `s`, accumulated
+   into `v`. `r` is the remaining index, the indices are template parameters
+   so the matrices can be kept in registers. Returns `false` if the element is
+   already negligible and no rotation was done. */
+template<std::size_t p, std::size_t q, std::size_t r, class T> bool jacobiRotation(Matrix<3, T>& s, Matrix<3, T>& v) {
+    const T spq = s[q][p];
+
+    /* Negligible compared to the diagonal (or zero, in which case the
+       rotation would be NaN) */
+    if(std::abs(spq) <= std::numeric_limits<T>::epsilon()*(std::abs(s[p][p]) + std::abs(s[q][q])))
+        return false;
+
+    /* Equivalent to the usual tan(phi) = sgn(theta)/(|theta| + sqrt(theta^2 + 1))
+       with theta = (s_qq - s_pp)/(2 s_pq), but rearranged so both the sine
+       and cosine need just one more square root and one division */
+    const T d = s[q][q] - s[p][p];
+    const T absD = std::abs(d);
+    const T twoSpq = d < T(0) ? -T(2)*spq : T(2)*spq;
+    const T h = std::sqrt(d*d + twoSpq*twoSpq);
+    const T k = T(1)/std::sqrt(T(2)*h*(h + absD));
+    const T c = (h + absD)*k;
+    const T sn = twoSpq*k;
+    const T tspq = twoSpq*spq/(h + absD);
+
+    s[p][p] -= tspq;
+    s[q][q] += tspq;
+    s[q][p] = s[p][q] = T(0);
+    const T srp = s[p][r];
+    const T srq = s[q][r];
+    s[p][r] = s[r][p] = c*srp - sn*srq;
+    s[q][r] = s[r][q] = sn*srp + c*srq;
+
+    for(std::size_t i = 0; i != 3; ++i) {
+        const T vp = v[p][i];
+        const T vq = v[q][i];
+        v[p][i] = c*vp - sn*vq;
+        v[q][i] = sn*vp + c*vq;
+    }
+
+    return true;
+}
+
+/* Sorts columns `i` and `j` by descending length */
+template<class T> void svdSortColumns(Matrix<3, T>& b, Matrix<3, T>& v, Vector<3, T>& lengths, const std::size_t i, const std::size_t j) {
+    if(lengths[i] >= lengths[j]) return;
+    std::swap(lengths[i], lengths[j]);
+    std::swap(b[i], b[j]);
+    std::swap(v[i], v[j]);
+}
+
+/* Unit vector perpendicular to given normalized vector */
+template<class T> Vector3<T> perpendicular(const Vector3<T>& a) {
+    const Vector3<T> absolute = Math::abs(a);
+    const Vector3<T> axis = absolute.x() <= absolute.y() && absolute.x() <= absolute.z() ? Vector3<T>::xAxis() :
+        absolute.y() <= absolute.z() ? Vector3<T>::yAxis() : Vector3<T>::zAxis();
+    return Vector3<T>::cross(a, axis).normalized();
+}
+
 }
 
 /**
@@ -333,6 +403,91 @@ template<std::size_t cols, std::size_t rows, class T> std::tuple<RectangularMatr
     return std::make_tuple(m, q, v);
 }
 
+/**
+@brief Singular Value Decomposition of 3x3 matrix
+
+Faster alternative to @ref svd() for 3x3 matrices, useful e.g. for polar
+decomposition of many small matrices. Returns @f$ U @f$, diagonal of
+@f$ \Sigma @f$ and non-transposed @f$ V @f$ so that
+@f[
+    M = U \Sigma V^T
+@f]
+Unlike @ref svd(), the singular values are sorted in descending order. Both
+@f$ U @f$ and @f$ V @f$ are orthogonal, but they can contain reflection. The
+decomposition always succeeds.
+
+The right singular vectors are computed as eigenvectors of @f$ M^T M @f$
+using cyclic Jacobi sweeps (at most a small fixed number of them, stopping
+once the off-diagonal elements are negligible), the left singular vectors and
+singular values then come from QR decomposition of @f$ M V @f$, which keeps
+precision of the small singular values. Based on *McAdams, A.; Selle, A.;
+Tamstorf, R.; Teran, J.; Sifakis, E. (2011). "Computing the Singular Value
+Decomposition of 3x3 matrices with minimal branching and elementary floating
+point operations"*, but with exact Jacobi rotations.
+*/
+template<class T> std::tuple<Matrix<3, T>, Vector<3, T>, Matrix<3, T>> svd3x3(const Matrix<3, T>& m) {
+    Matrix<3, T> s = m.transposed()*m;
+    Matrix<3, T> v{Matrix<3, T>::Identity};
+    for(std::size_t sweep = 0; sweep != Implementation::jacobiSweeps<T>(); ++sweep) {
+        /* No short-circuiting, all three rotations have to be done */
+        const bool rotated01 = Implementation::jacobiRotation<0, 1, 2>(s, v);
+        const bool rotated02 = Implementation::jacobiRotation<0, 2, 1>(s, v);
+        const bool rotated12 = Implementation::jacobiRotation<1, 2, 0>(s, v);
+        if(!rotated01 && !rotated02 && !rotated12) break;
+    }
+
+    /* Columns of MV are orthogonal, their lengths are the singular values */
+    Matrix<3, T> b = m*v;
+    Vector<3, T> lengths{b[0].dot(), b[1].dot(), b[2].dot()};
+    Implementation::svdSortColumns(b, v, lengths, 0, 1);
+    Implementation::svdSortColumns(b, v, lengths, 0, 2);
+    Implementation::svdSortColumns(b, v, lengths, 1, 2);
+
+    /* Zero matrix */
+    Vector<3, T> w;
+    w[0] = b[0].length();
+    if(w[0] == T(0))
+        return std::make_tuple(Matrix<3, T>{Matrix<3, T>::Identity}, w, v);
+
+    /* QR decomposition of MV using Gram-Schmidt, with the third column
+       calculated directly so U is always orthogonal. If MV has rank one, an
+       arbitrary perpendicular vector is used as the second column. */
+    const Vector3<T> u0 = b[0]/w[0];
+    Vector3<T> u1 = b[1] - u0*Vector<3, T>::dot(u0, b[1]);
+    w[1] = u1.length();
+    if(w[1] > TypeTraits<T>::epsilon()*w[0])
+        u1 /= w[1];
+    else {
+        u1 = Implementation::perpendicular(u0);
+        w[1] = std::abs(Vector<3, T>::dot(u1, b[1]));
+    }
+    Vector3<T> u2 = Vector3<T>::cross(u0, u1);
+    w[2] = Vector<3, T>::dot(u2, b[2]);
+    if(w[2] < T(0)) {
+        w[2] = -w[2];
+        u2 = -u2;
+    }
+
+    return std::make_tuple(Matrix<3, T>{u0, u1, u2}, w, v);
+}
+
+/**
+@brief Singular Value Decomposition of many 3x3 matrices
+@param m        Input matrices
+@param u        Where to put @f$ U @f$ matrices
+@param w        Where to put diagonals of @f$ \Sigma @f$
+@param v        Where to put @f$ V @f$ matrices
+
+Batch version of @ref svd3x3(const Matrix<3, T>&), all arrays have to have the
+same size.
+*/
+template<class T> void svd3x3(Corrade::Containers::ArrayReference<const Matrix<3, T>> m, Corrade::Containers::ArrayReference<Matrix<3, T>> u, Corrade::Containers::ArrayReference<Vector<3, T>> w, Corrade::Containers::ArrayReference<Matrix<3, T>> v) {
+    CORRADE_ASSERT(u.size() == m.size() && w.size() == m.size() && v.size() == m.size(),
+        "Math::Algorithms::svd3x3(): expected output arrays of size" << m.size() << "but got" << u.size() << w.size() << "and" << v.size(), );
+    for(std::size_t i = 0; i != m.size(); ++i)
+        std::tie(u[i], w[i], v[i]) = svd3x3(m[i]);
+}
+
 }}}
 
 #endif
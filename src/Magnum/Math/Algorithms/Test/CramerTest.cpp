@@ -0,0 +1,197 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Algorithms/Cramer.h"
+#include "Magnum/Math/Algorithms/GaussJordan.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+class CramerTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit CramerTest();
+
+        template<class T> void invert3();
+        template<class T> void invert4();
+        template<class T> void solve3();
+        template<class T> void solve4();
+        void invertBatch();
+        void solveBatch();
+        void batchSizeMismatch();
+};
+
+CramerTest::CramerTest() {
+    addTests<CramerTest>({&CramerTest::invert3<Float>,
+                          #ifndef MAGNUM_TARGET_GLES
+                          &CramerTest::invert3<Double>,
+                          #endif
+                          &CramerTest::invert4<Float>,
+                          #ifndef MAGNUM_TARGET_GLES
+                          &CramerTest::invert4<Double>,
+                          #endif
+                          &CramerTest::solve3<Float>,
+                          #ifndef MAGNUM_TARGET_GLES
+                          &CramerTest::solve3<Double>,
+                          #endif
+                          &CramerTest::solve4<Float>,
+                          #ifndef MAGNUM_TARGET_GLES
+                          &CramerTest::solve4<Double>,
+                          #endif
+                          &CramerTest::invertBatch,
+                          &CramerTest::solveBatch,
+                          &CramerTest::batchSizeMismatch});
+}
+
+template<class T> void CramerTest::invert3() {
+    typedef Matrix<3, T> Matrix3x3;
+    typedef Vector<3, T> Vector3;
+
+    const Matrix3x3 a(Vector3(T(3.0),  T(5.0), T(8.0)),
+                      Vector3(T(4.0),  T(4.0), T(7.0)),
+                      Vector3(T(7.0), T(-1.0), T(8.0)));
+
+    Matrix3x3 a2(a);
+    Matrix3x3 expected{Matrix3x3::Identity};
+    CORRADE_VERIFY(gaussJordanInPlace(a2, expected));
+
+    const Matrix3x3 inverse = cramerInverted(a);
+    CORRADE_COMPARE(inverse, expected);
+    CORRADE_COMPARE(inverse, a.inverted());
+    CORRADE_COMPARE(a*inverse, Matrix3x3(Matrix3x3::Identity));
+}
+
+template<class T> void CramerTest::invert4() {
+    typedef Matrix<4, T> Matrix4x4;
+    typedef Vector<4, T> Vector4;
+
+    const Matrix4x4 a(Vector4(T(3.0),  T(5.0), T(8.0), T(4.0)),
+                      Vector4(T(4.0),  T(4.0), T(7.0), T(3.0)),
+                      Vector4(T(7.0), T(-1.0), T(8.0), T(0.0)),
+                      Vector4(T(9.0),  T(4.0), T(5.0), T(9.0)));
+
+    const Matrix4x4 expected(Vector4(T(-60)/T(103),   T(71)/T(103),  T(-4)/T(103),  T(3)/T(103)),
+                             Vector4(T(-66)/T(103),  T(109)/T(103), T(-25)/T(103), T(-7)/T(103)),
+                             Vector4(T(177)/T(412),  T(-97)/T(206),  T(53)/T(412), T(-7)/T(206)),
+                             Vector4(T(259)/T(412), T(-185)/T(206),  T(31)/T(412), T(27)/T(206)));
+
+    const Matrix4x4 inverse = cramerInverted(a);
+    CORRADE_COMPARE(inverse, expected);
+    CORRADE_COMPARE(inverse, a.inverted());
+    CORRADE_COMPARE(a*inverse, Matrix4x4(Matrix4x4::Identity));
+}
+
+template<class T> void CramerTest::solve3() {
+    typedef Matrix<3, T> Matrix3x3;
+    typedef Vector<3, T> Vector3;
+
+    const Matrix3x3 a(Vector3(T(3.0),  T(5.0), T(8.0)),
+                      Vector3(T(4.0),  T(4.0), T(7.0)),
+                      Vector3(T(7.0), T(-1.0), T(8.0)));
+    const Vector3 x(T(1.0), T(-2.0), T(0.5));
+
+    CORRADE_COMPARE(cramerSolve(a, a*x), x);
+}
+
+template<class T> void CramerTest::solve4() {
+    typedef Matrix<4, T> Matrix4x4;
+    typedef Vector<4, T> Vector4;
+
+    const Matrix4x4 a(Vector4(T(3.0),  T(5.0), T(8.0), T(4.0)),
+                      Vector4(T(4.0),  T(4.0), T(7.0), T(3.0)),
+                      Vector4(T(7.0), T(-1.0), T(8.0), T(0.0)),
+                      Vector4(T(9.0),  T(4.0), T(5.0), T(9.0)));
+    const Vector4 x(T(1.0), T(-2.0), T(0.5), T(3.0));
+
+    CORRADE_COMPARE(cramerSolve(a, a*x), x);
+}
+
+namespace {
+
+template<std::size_t size> std::vector<Matrix<size, Float>> matrices() {
+    std::vector<Matrix<size, Float>> out;
+    for(std::size_t i = 0; i != 5; ++i) {
+        Matrix<size, Float> m{Matrix<size, Float>::Identity};
+        for(std::size_t col = 0; col != size; ++col)
+            for(std::size_t row = 0; row != size; ++row)
+                m[col][row] += Float((col*7 + row*3 + i) % 5)*0.25f;
+        out.push_back(m);
+    }
+    return out;
+}
+
+}
+
+void CramerTest::invertBatch() {
+    const std::vector<Matrix<3, Float>> a3 = matrices<3>();
+    std::vector<Matrix<3, Float>> out3(a3.size());
+    cramerInverted(Corrade::Containers::ArrayReference<const Matrix<3, Float>>{a3.data(), a3.size()},
+        Corrade::Containers::ArrayReference<Matrix<3, Float>>{out3.data(), out3.size()});
+    for(std::size_t i = 0; i != a3.size(); ++i)
+        CORRADE_COMPARE(out3[i], cramerInverted(a3[i]));
+
+    const std::vector<Matrix<4, Float>> a4 = matrices<4>();
+    std::vector<Matrix<4, Float>> out4(a4.size());
+    cramerInverted(Corrade::Containers::ArrayReference<const Matrix<4, Float>>{a4.data(), a4.size()},
+        Corrade::Containers::ArrayReference<Matrix<4, Float>>{out4.data(), out4.size()});
+    for(std::size_t i = 0; i != a4.size(); ++i)
+        CORRADE_COMPARE(out4[i], cramerInverted(a4[i]));
+}
+
+void CramerTest::solveBatch() {
+    const std::vector<Matrix<4, Float>> a = matrices<4>();
+    std::vector<Vector<4, Float>> b, out(a.size());
+    for(std::size_t i = 0; i != a.size(); ++i)
+        b.emplace_back(Float(i), 1.0f, -2.0f, 0.5f);
+
+    cramerSolve(Corrade::Containers::ArrayReference<const Matrix<4, Float>>{a.data(), a.size()},
+        Corrade::Containers::ArrayReference<const Vector<4, Float>>{b.data(), b.size()},
+        Corrade::Containers::ArrayReference<Vector<4, Float>>{out.data(), out.size()});
+    for(std::size_t i = 0; i != a.size(); ++i)
+        CORRADE_COMPARE(out[i], cramerSolve(a[i], b[i]));
+}
+
+void CramerTest::batchSizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const std::vector<Matrix<3, Float>> a(5);
+    const std::vector<Vector<3, Float>> b(5);
+    std::vector<Matrix<3, Float>> inverted(4);
+    std::vector<Vector<3, Float>> solved(4);
+    cramerInverted(Corrade::Containers::ArrayReference<const Matrix<3, Float>>{a.data(), a.size()},
+        Corrade::Containers::ArrayReference<Matrix<3, Float>>{inverted.data(), inverted.size()});
+    cramerSolve(Corrade::Containers::ArrayReference<const Matrix<3, Float>>{a.data(), a.size()},
+        Corrade::Containers::ArrayReference<const Vector<3, Float>>{b.data(), b.size()},
+        Corrade::Containers::ArrayReference<Vector<3, Float>>{solved.data(), solved.size()});
+    CORRADE_COMPARE(o.str(), "Math::Algorithms::cramerInverted(): expected output array of size 5 but got 4\n"
+                             "Math::Algorithms::cramerSolve(): array sizes don't match\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::CramerTest)
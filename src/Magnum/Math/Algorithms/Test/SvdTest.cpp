@@ -23,6 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Algorithms/Svd.h"
@@ -35,6 +38,14 @@ class SvdTest: public Corrade::TestSuite::Tester {
 
         void testDouble();
         void testFloat();
+
+        template<class T> void svd3x3();
+        template<class T> void svd3x3Random();
+        void svd3x3Batch();
+        void svd3x3BatchSizeMismatch();
+
+    private:
+        template<class T> void verifySvd3x3(const Matrix<3, T>& m, bool compareToGeneric = true);
 };
 
 #ifndef MAGNUM_TARGET_GLES
@@ -72,8 +83,19 @@ constexpr static Matrix5x8f af(
 static const Vector5f expectedf(std::sqrt(1248.0f), 0.0f, 20.0f, std::sqrt(384.0f), 0.0f);
 
 SvdTest::SvdTest() {
-    addTests({&SvdTest::testDouble,
-              &SvdTest::testFloat});
+    addTests<SvdTest>({&SvdTest::testDouble,
+                       &SvdTest::testFloat,
+
+                       &SvdTest::svd3x3<Float>,
+                       #ifndef MAGNUM_TARGET_GLES
+                       &SvdTest::svd3x3<Double>,
+                       #endif
+                       &SvdTest::svd3x3Random<Float>,
+                       #ifndef MAGNUM_TARGET_GLES
+                       &SvdTest::svd3x3Random<Double>,
+                       #endif
+                       &SvdTest::svd3x3Batch,
+                       &SvdTest::svd3x3BatchSizeMismatch});
 }
 
 void SvdTest::testDouble() {
@@ -118,6 +140,134 @@ void SvdTest::testFloat() {
     CORRADE_VERIFY(Math::abs(w-expectedf).max() < 1.0e-5f);
 }
 
+namespace {
+
+template<class> struct Tolerance;
+template<> struct Tolerance<Float> { constexpr static Float value() { return 1.0e-5f; } };
+#ifndef MAGNUM_TARGET_GLES
+template<> struct Tolerance<Double> { constexpr static Double value() { return 1.0e-13; } };
+#endif
+
+}
+
+/* Verifies the decomposition and optionally compares the singular values to
+   the generic implementation */
+template<class T> void SvdTest::verifySvd3x3(const Matrix<3, T>& m, const bool compareToGeneric) {
+    Matrix<3, T> u, v;
+    Vector<3, T> w;
+    std::tie(u, w, v) = Algorithms::svd3x3(m);
+
+    const T scale = std::max(Math::abs(m.toVector()).max(), T(1));
+    const T tolerance = Tolerance<T>::value();
+    const Matrix<3, T> identity{Matrix<3, T>::Identity};
+
+    CORRADE_VERIFY(Math::abs((u*Matrix<3, T>::fromDiagonal(w)*v.transposed() - m).toVector()).max() < tolerance*scale);
+    CORRADE_VERIFY(Math::abs((u.transposed()*u - identity).toVector()).max() < tolerance);
+    CORRADE_VERIFY(Math::abs((v.transposed()*v - identity).toVector()).max() < tolerance);
+    CORRADE_VERIFY(w[0] >= w[1] && w[1] >= w[2] && w[2] >= T(0));
+    if(!compareToGeneric) return;
+
+    /* The generic implementation returns the values unsorted */
+    Vector<3, T> expected = std::get<1>(Algorithms::svd(RectangularMatrix<3, 3, T>(m)));
+    std::sort(expected.data(), expected.data() + 3, [](T a, T b) { return a > b; });
+    CORRADE_VERIFY(Math::abs(w - expected).max() < tolerance*scale);
+}
+
+template<class T> void SvdTest::svd3x3() {
+    typedef Matrix<3, T> Matrix3x3;
+    typedef Vector<3, T> Vector3;
+
+    /* General */
+    const Matrix3x3 a(Vector3(T(2.0), T(-1.0), T(3.0)),
+                      Vector3(T(0.5), T(4.0), T(-2.0)),
+                      Vector3(T(1.0), T(1.0), T(5.0)));
+    verifySvd3x3(a);
+
+    /* Rank two and rank one */
+    verifySvd3x3(Matrix3x3(a[0], a[1], a[0] + a[1]));
+
+    /* The generic implementation produces NaNs for rank one matrices in
+       double precision, compare to the analytic result instead */
+    const Matrix3x3 b(a[0], a[0]*T(-2.0), a[0]*T(0.5));
+    verifySvd3x3(b, false);
+    Matrix3x3 u, v;
+    Vector3 w;
+    std::tie(u, w, v) = Algorithms::svd3x3(b);
+    CORRADE_COMPARE(w[0], a[0].length()*Math::sqrt(T(5.25)));
+    CORRADE_VERIFY(w[1] < Tolerance<T>::value());
+    CORRADE_VERIFY(w[2] < Tolerance<T>::value());
+
+    /* Diagonal with negative value, the singular values are sorted */
+    std::tie(u, w, v) = Algorithms::svd3x3(Matrix3x3::fromDiagonal(Vector3(T(3.0), T(-5.0), T(0.5))));
+    CORRADE_COMPARE(w, Vector3(T(5.0), T(3.0), T(0.5)));
+    verifySvd3x3(Matrix3x3::fromDiagonal(Vector3(T(3.0), T(-5.0), T(0.5))));
+
+    /* Uniform scaling, all singular values are the same */
+    std::tie(u, w, v) = Algorithms::svd3x3(Matrix3x3(Vector3(T(0.0), T(2.0), T(0.0)),
+                                                     Vector3(T(-2.0), T(0.0), T(0.0)),
+                                                     Vector3(T(0.0), T(0.0), T(2.0))));
+    CORRADE_COMPARE(w, Vector3(T(2.0)));
+
+    /* Zero matrix */
+    std::tie(u, w, v) = Algorithms::svd3x3(Matrix3x3(Matrix3x3::Zero));
+    CORRADE_COMPARE(u, Matrix3x3(Matrix3x3::Identity));
+    CORRADE_COMPARE(w, Vector3());
+    CORRADE_COMPARE(v, Matrix3x3(Matrix3x3::Identity));
+}
+
+template<class T> void SvdTest::svd3x3Random() {
+    UnsignedInt state = 0x12345678;
+    auto random = [&state]() {
+        state = state*1664525 + 1013904223;
+        return T(state >> 8)/T(1 << 22) - T(2);
+    };
+
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const Matrix<3, T> m(Vector<3, T>(random(), random(), random()),
+                             Vector<3, T>(random(), random(), random()),
+                             Vector<3, T>(random(), random(), random()));
+        verifySvd3x3(m);
+    }
+}
+
+void SvdTest::svd3x3Batch() {
+    std::vector<Matrix<3, Float>> m;
+    for(std::size_t i = 0; i != 5; ++i)
+        m.emplace_back(Vector<3, Float>(Float(i), 1.0f, -2.0f),
+                       Vector<3, Float>(0.5f, Float(i*i), 3.0f),
+                       Vector<3, Float>(-1.0f, 2.0f, 1.0f/Float(i + 1)));
+
+    std::vector<Matrix<3, Float>> u(5), v(5);
+    std::vector<Vector<3, Float>> w(5);
+    Algorithms::svd3x3(Corrade::Containers::ArrayReference<const Matrix<3, Float>>{m.data(), m.size()},
+        Corrade::Containers::ArrayReference<Matrix<3, Float>>{u.data(), u.size()},
+        Corrade::Containers::ArrayReference<Vector<3, Float>>{w.data(), w.size()},
+        Corrade::Containers::ArrayReference<Matrix<3, Float>>{v.data(), v.size()});
+
+    for(std::size_t i = 0; i != m.size(); ++i) {
+        Matrix<3, Float> expectedU, expectedV;
+        Vector<3, Float> expectedW;
+        std::tie(expectedU, expectedW, expectedV) = Algorithms::svd3x3(m[i]);
+        CORRADE_COMPARE(u[i], expectedU);
+        CORRADE_COMPARE(w[i], expectedW);
+        CORRADE_COMPARE(v[i], expectedV);
+    }
+}
+
+void SvdTest::svd3x3BatchSizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const std::vector<Matrix<3, Float>> m(5);
+    std::vector<Matrix<3, Float>> u(5), v(4);
+    std::vector<Vector<3, Float>> w(5);
+    Algorithms::svd3x3(Corrade::Containers::ArrayReference<const Matrix<3, Float>>{m.data(), m.size()},
+        Corrade::Containers::ArrayReference<Matrix<3, Float>>{u.data(), u.size()},
+        Corrade::Containers::ArrayReference<Vector<3, Float>>{w.data(), w.size()},
+        Corrade::Containers::ArrayReference<Matrix<3, Float>>{v.data(), v.size()});
+    CORRADE_COMPARE(o.str(), "Math::Algorithms::svd3x3(): expected output arrays of size 5 but got 5 5 and 4\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdTest)
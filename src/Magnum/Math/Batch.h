@@ -0,0 +1,375 @@
+#ifndef Magnum_Math_Batch_h
+#define Magnum_Math_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::transformPoints(), @ref Magnum::Math::transformVectors(), @ref Magnum::Math::transformPointsNormalized(), @ref Magnum::Math::transformVectorsNormalized()
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+
+/* Scalar kernels. The `w` parameter is 1 for points and 0 for vectors. Used
+   directly for all types except Float with SIMD enabled, where they serve as
+   a reference and process the remaining elements. */
+template<class T> struct BatchTransformScalar {
+    static void transform(const Matrix4<T>& m, const T w, const Vector3<T>* const in, Vector3<T>* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i) {
+            const Vector3<T> v = in[i];
+            out[i] = {m[0][0]*v[0] + m[1][0]*v[1] + m[2][0]*v[2] + m[3][0]*w,
+                      m[0][1]*v[0] + m[1][1]*v[1] + m[2][1]*v[2] + m[3][1]*w,
+                      m[0][2]*v[0] + m[1][2]*v[1] + m[2][2]*v[2] + m[3][2]*w};
+        }
+    }
+
+    static void transform(const Matrix3<T>& m, const T w, const Vector2<T>* const in, Vector2<T>* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i) {
+            const Vector2<T> v = in[i];
+            out[i] = {m[0][0]*v[0] + m[1][0]*v[1] + m[2][0]*w,
+                      m[0][1]*v[0] + m[1][1]*v[1] + m[2][1]*w};
+        }
+    }
+
+    static void transform(const Matrix4<T>& m, const T w, const T* const x, const T* const y, const T* const z, T* const outX, T* const outY, T* const outZ, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i) {
+            const T vx = x[i], vy = y[i], vz = z[i];
+            outX[i] = m[0][0]*vx + m[1][0]*vy + m[2][0]*vz + m[3][0]*w;
+            outY[i] = m[0][1]*vx + m[1][1]*vy + m[2][1]*vz + m[3][1]*w;
+            outZ[i] = m[0][2]*vx + m[1][2]*vy + m[2][2]*vz + m[3][2]*w;
+        }
+    }
+
+    static void transform(const Matrix3<T>& m, const T w, const T* const x, const T* const y, T* const outX, T* const outY, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i) {
+            const T vx = x[i], vy = y[i];
+            outX[i] = m[0][0]*vx + m[1][0]*vy + m[2][0]*w;
+            outY[i] = m[0][1]*vx + m[1][1]*vy + m[2][1]*w;
+        }
+    }
+
+    static void transform(const Matrix4<T>* const matrices, const UnsignedInt* const matrixIds, const T w, const Vector3<T>* const in, Vector3<T>* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i)
+            transform(matrices[matrixIds[i]], w, in + i, out + i, 1);
+    }
+};
+
+template<class T> struct BatchTransform: BatchTransformScalar<T> {};
+
+#ifdef MAGNUM_MATH_SIMD
+/* Four elements at a time, the rest is done with the scalar code. Matrix
+   elements are splatted once outside of the loop. */
+template<> struct BatchTransform<Float>: BatchTransformScalar<Float> {
+    static void transform(const Matrix4<Float>& m, const Float w, const Vector3<Float>* const in, Vector3<Float>* const out, const std::size_t count) {
+        const Splatted4 s(m, w);
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            SimdFloat4 x, y, z;
+            simdLoadInterleaved3(in[i].data(), x, y, z);
+            s.transform(x, y, z);
+            simdStoreInterleaved3(out[i].data(), x, y, z);
+        }
+        BatchTransformScalar<Float>::transform(m, w, in + i, out + i, count - i);
+    }
+
+    static void transform(const Matrix3<Float>& m, const Float w, const Vector2<Float>* const in, Vector2<Float>* const out, const std::size_t count) {
+        const Splatted3 s(m, w);
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            SimdFloat4 x, y;
+            simdLoadInterleaved2(in[i].data(), x, y);
+            s.transform(x, y);
+            simdStoreInterleaved2(out[i].data(), x, y);
+        }
+        BatchTransformScalar<Float>::transform(m, w, in + i, out + i, count - i);
+    }
+
+    static void transform(const Matrix4<Float>& m, const Float w, const Float* const x, const Float* const y, const Float* const z, Float* const outX, Float* const outY, Float* const outZ, const std::size_t count) {
+        const Splatted4 s(m, w);
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            SimdFloat4 vx = simdLoad(x + i), vy = simdLoad(y + i), vz = simdLoad(z + i);
+            s.transform(vx, vy, vz);
+            simdStore(outX + i, vx);
+            simdStore(outY + i, vy);
+            simdStore(outZ + i, vz);
+        }
+        BatchTransformScalar<Float>::transform(m, w, x + i, y + i, z + i, outX + i, outY + i, outZ + i, count - i);
+    }
+
+    static void transform(const Matrix3<Float>& m, const Float w, const Float* const x, const Float* const y, Float* const outX, Float* const outY, const std::size_t count) {
+        const Splatted3 s(m, w);
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            SimdFloat4 vx = simdLoad(x + i), vy = simdLoad(y + i);
+            s.transform(vx, vy);
+            simdStore(outX + i, vx);
+            simdStore(outY + i, vy);
+        }
+        BatchTransformScalar<Float>::transform(m, w, x + i, y + i, outX + i, outY + i, count - i);
+    }
+
+    /* Each element has a different matrix, so the matrix columns are
+       multiplied by splatted vector components instead. The result can't be
+       stored with a four-component store, as it would overwrite the next
+       element, so it goes through a temporary. */
+    static void transform(const Matrix4<Float>* const matrices, const UnsignedInt* const matrixIds, const Float w, const Vector3<Float>* const in, Vector3<Float>* const out, const std::size_t count) {
+        const SimdFloat4 sw = simdSplat(w);
+        for(std::size_t i = 0; i != count; ++i) {
+            const Float* const m = matrices[matrixIds[i]].data();
+            const Float* const v = in[i].data();
+            const SimdFloat4 result = simdAdd(
+                simdAdd(simdMul(simdLoad(m + 0), simdSplat(v[0])),
+                        simdMul(simdLoad(m + 4), simdSplat(v[1]))),
+                simdAdd(simdMul(simdLoad(m + 8), simdSplat(v[2])),
+                        simdMul(simdLoad(m + 12), sw)));
+            Float data[4];
+            simdStore(data, result);
+            out[i] = {data[0], data[1], data[2]};
+        }
+    }
+
+    private:
+        struct Splatted4 {
+            explicit Splatted4(const Matrix4<Float>& m, const Float w): m00{simdSplat(m[0][0])}, m01{simdSplat(m[0][1])}, m02{simdSplat(m[0][2])}, m10{simdSplat(m[1][0])}, m11{simdSplat(m[1][1])}, m12{simdSplat(m[1][2])}, m20{simdSplat(m[2][0])}, m21{simdSplat(m[2][1])}, m22{simdSplat(m[2][2])}, t0{simdSplat(m[3][0]*w)}, t1{simdSplat(m[3][1]*w)}, t2{simdSplat(m[3][2]*w)} {}
+
+            void transform(SimdFloat4& x, SimdFloat4& y, SimdFloat4& z) const {
+                const SimdFloat4 ox = simdAdd(simdAdd(simdAdd(simdMul(m00, x), simdMul(m10, y)), simdMul(m20, z)), t0);
+                const SimdFloat4 oy = simdAdd(simdAdd(simdAdd(simdMul(m01, x), simdMul(m11, y)), simdMul(m21, z)), t1);
+                const SimdFloat4 oz = simdAdd(simdAdd(simdAdd(simdMul(m02, x), simdMul(m12, y)), simdMul(m22, z)), t2);
+                x = ox;
+                y = oy;
+                z = oz;
+            }
+
+            SimdFloat4 m00, m01, m02, m10, m11, m12, m20, m21, m22, t0, t1, t2;
+        };
+
+        struct Splatted3 {
+            explicit Splatted3(const Matrix3<Float>& m, const Float w): m00{simdSplat(m[0][0])}, m01{simdSplat(m[0][1])}, m10{simdSplat(m[1][0])}, m11{simdSplat(m[1][1])}, t0{simdSplat(m[2][0]*w)}, t1{simdSplat(m[2][1]*w)} {}
+
+            void transform(SimdFloat4& x, SimdFloat4& y) const {
+                const SimdFloat4 ox = simdAdd(simdAdd(simdMul(m00, x), simdMul(m10, y)), t0);
+                const SimdFloat4 oy = simdAdd(simdAdd(simdMul(m01, x), simdMul(m11, y)), t1);
+                x = ox;
+                y = oy;
+            }
+
+            SimdFloat4 m00, m01, m10, m11, t0, t1;
+        };
+};
+#endif
+
+}
+
+/**
+@brief Transform points with a matrix
+@param matrix       Transformation matrix
+@param points       Input points
+@param out          Where to put the transformed points
+
+Batch equivalent of calling @ref Matrix4::transformPoint() on each element of
+@p points, @p out has to have the same size as @p points and can point to the
+same memory. If built with @ref MAGNUM_BUILD_SIMD, @ref Float batches are
+processed four elements at a time.
+@see @ref transformVectors(), @ref transformPointsNormalized()
+*/
+template<class T> void transformPoints(const Matrix4<T>& matrix, Corrade::Containers::ArrayReference<const Vector3<T>> points, Corrade::Containers::ArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(points.size() == out.size(),
+        "Math::transformPoints(): expected output array of size" << points.size() << "but got" << out.size(), );
+    Implementation::BatchTransform<T>::transform(matrix, T(1), points, out, points.size());
+}
+
+/**
+@brief Transform points in structure-of-arrays layout with a matrix
+
+Same as @ref transformPoints(const Matrix4<T>&, Corrade::Containers::ArrayReference<const Vector3<T>>, Corrade::Containers::ArrayReference<Vector3<T>>),
+but with separate arrays for each component. All arrays have to have the same
+size, output arrays can point to the same memory as input arrays.
+*/
+template<class T> void transformPoints(const Matrix4<T>& matrix, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<const T> z, Corrade::Containers::ArrayReference<T> outX, Corrade::Containers::ArrayReference<T> outY, Corrade::Containers::ArrayReference<T> outZ) {
+    CORRADE_ASSERT(y.size() == x.size() && z.size() == x.size() && outX.size() == x.size() && outY.size() == x.size() && outZ.size() == x.size(),
+        "Math::transformPoints(): array sizes don't match", );
+    Implementation::BatchTransform<T>::transform(matrix, T(1), x, y, z, outX, outY, outZ, x.size());
+}
+
+/**
+@brief Transform 2D points with a matrix
+
+Batch equivalent of calling @ref Matrix3::transformPoint() on each element of
+@p points, @p out has to have the same size as @p points and can point to the
+same memory.
+*/
+template<class T> void transformPoints(const Matrix3<T>& matrix, Corrade::Containers::ArrayReference<const Vector2<T>> points, Corrade::Containers::ArrayReference<Vector2<T>> out) {
+    CORRADE_ASSERT(points.size() == out.size(),
+        "Math::transformPoints(): expected output array of size" << points.size() << "but got" << out.size(), );
+    Implementation::BatchTransform<T>::transform(matrix, T(1), points, out, points.size());
+}
+
+/**
+@brief Transform 2D points in structure-of-arrays layout with a matrix
+
+All arrays have to have the same size, output arrays can point to the same
+memory as input arrays.
+*/
+template<class T> void transformPoints(const Matrix3<T>& matrix, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<T> outX, Corrade::Containers::ArrayReference<T> outY) {
+    CORRADE_ASSERT(y.size() == x.size() && outX.size() == x.size() && outY.size() == x.size(),
+        "Math::transformPoints(): array sizes don't match", );
+    Implementation::BatchTransform<T>::transform(matrix, T(1), x, y, outX, outY, x.size());
+}
+
+/**
+@brief Transform points with many matrices
+@param matrices     Matrix palette
+@param matrixIds    Index into @p matrices for each point
+@param points       Input points
+@param out          Where to put the transformed points
+
+Each point is transformed with matrix selected by corresponding element of
+@p matrixIds, useful e.g. for rigid skinning. @p matrixIds and @p out have to
+have the same size as @p points, indices are not range-checked.
+*/
+template<class T> void transformPoints(Corrade::Containers::ArrayReference<const Matrix4<T>> matrices, Corrade::Containers::ArrayReference<const UnsignedInt> matrixIds, Corrade::Containers::ArrayReference<const Vector3<T>> points, Corrade::Containers::ArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(matrixIds.size() == points.size() && out.size() == points.size(),
+        "Math::transformPoints(): array sizes don't match", );
+    Implementation::BatchTransform<T>::transform(matrices, matrixIds, T(1), points, out, points.size());
+}
+
+/**
+@brief Transform vectors with a matrix
+
+Batch equivalent of calling @ref Matrix4::transformVector() on each element
+of @p vectors, @p out has to have the same size as @p vectors and can point to
+the same memory.
+@see @ref transformPoints(), @ref transformVectorsNormalized()
+*/
+template<class T> void transformVectors(const Matrix4<T>& matrix, Corrade::Containers::ArrayReference<const Vector3<T>> vectors, Corrade::Containers::ArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(),
+        "Math::transformVectors(): expected output array of size" << vectors.size() << "but got" << out.size(), );
+    Implementation::BatchTransform<T>::transform(matrix, T(0), vectors, out, vectors.size());
+}
+
+/**
+@brief Transform vectors in structure-of-arrays layout with a matrix
+
+All arrays have to have the same size, output arrays can point to the same
+memory as input arrays.
+*/
+template<class T> void transformVectors(const Matrix4<T>& matrix, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<const T> z, Corrade::Containers::ArrayReference<T> outX, Corrade::Containers::ArrayReference<T> outY, Corrade::Containers::ArrayReference<T> outZ) {
+    CORRADE_ASSERT(y.size() == x.size() && z.size() == x.size() && outX.size() == x.size() && outY.size() == x.size() && outZ.size() == x.size(),
+        "Math::transformVectors(): array sizes don't match", );
+    Implementation::BatchTransform<T>::transform(matrix, T(0), x, y, z, outX, outY, outZ, x.size());
+}
+
+/**
+@brief Transform 2D vectors with a matrix
+
+Batch equivalent of calling @ref Matrix3::transformVector() on each element
+of @p vectors, @p out has to have the same size as @p vectors and can point to
+the same memory.
+*/
+template<class T> void transformVectors(const Matrix3<T>& matrix, Corrade::Containers::ArrayReference<const Vector2<T>> vectors, Corrade::Containers::ArrayReference<Vector2<T>> out) {
+    CORRADE_ASSERT(vectors.size() == out.size(),
+        "Math::transformVectors(): expected output array of size" << vectors.size() << "but got" << out.size(), );
+    Implementation::BatchTransform<T>::transform(matrix, T(0), vectors, out, vectors.size());
+}
+
+/**
+@brief Transform 2D vectors in structure-of-arrays layout with a matrix
+
+All arrays have to have the same size, output arrays can point to the same
+memory as input arrays.
+*/
+template<class T> void transformVectors(const Matrix3<T>& matrix, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<T> outX, Corrade::Containers::ArrayReference<T> outY) {
+    CORRADE_ASSERT(y.size() == x.size() && outX.size() == x.size() && outY.size() == x.size(),
+        "Math::transformVectors(): array sizes don't match", );
+    Implementation::BatchTransform<T>::transform(matrix, T(0), x, y, outX, outY, x.size());
+}
+
+/**
+@brief Rotate vectors with a normalized quaternion
+
+Batch equivalent of calling @ref Quaternion::transformVectorNormalized() on
+each element of @p vectors, @p out has to have the same size as @p vectors and
+can point to the same memory. The quaternion is converted to a rotation matrix
+first, which is then applied to the vectors.
+@see @ref Quaternion::isNormalized()
+*/
+template<class T> void transformVectorsNormalized(const Quaternion<T>& normalized, Corrade::Containers::ArrayReference<const Vector3<T>> vectors, Corrade::Containers::ArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(normalized.isNormalized(),
+        "Math::transformVectorsNormalized(): quaternion must be normalized", );
+    transformVectors(Matrix4<T>::from(normalized.toMatrix(), {}), vectors, out);
+}
+
+/**
+@brief Rotate vectors in structure-of-arrays layout with a normalized quaternion
+
+All arrays have to have the same size, output arrays can point to the same
+memory as input arrays.
+*/
+template<class T> void transformVectorsNormalized(const Quaternion<T>& normalized, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<const T> z, Corrade::Containers::ArrayReference<T> outX, Corrade::Containers::ArrayReference<T> outY, Corrade::Containers::ArrayReference<T> outZ) {
+    CORRADE_ASSERT(normalized.isNormalized(),
+        "Math::transformVectorsNormalized(): quaternion must be normalized", );
+    transformVectors(Matrix4<T>::from(normalized.toMatrix(), {}), x, y, z, outX, outY, outZ);
+}
+
+/**
+@brief Rotate and translate points with a normalized dual quaternion
+
+Batch equivalent of calling @ref DualQuaternion::transformPointNormalized() on
+each element of @p points, @p out has to have the same size as @p points and
+can point to the same memory. The dual quaternion is converted to a
+transformation matrix first, which is then applied to the points.
+@see @ref DualQuaternion::isNormalized()
+*/
+template<class T> void transformPointsNormalized(const DualQuaternion<T>& normalized, Corrade::Containers::ArrayReference<const Vector3<T>> points, Corrade::Containers::ArrayReference<Vector3<T>> out) {
+    CORRADE_ASSERT(normalized.isNormalized(),
+        "Math::transformPointsNormalized(): dual quaternion must be normalized", );
+    transformPoints(normalized.toMatrix(), points, out);
+}
+
+/**
+@brief Rotate and translate points in structure-of-arrays layout with a normalized dual quaternion
+
+All arrays have to have the same size, output arrays can point to the same
+memory as input arrays.
+*/
+template<class T> void transformPointsNormalized(const DualQuaternion<T>& normalized, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<const T> z, Corrade::Containers::ArrayReference<T> outX, Corrade::Containers::ArrayReference<T> outY, Corrade::Containers::ArrayReference<T> outZ) {
+    CORRADE_ASSERT(normalized.isNormalized(),
+        "Math::transformPointsNormalized(): dual quaternion must be normalized", );
+    transformPoints(normalized.toMatrix(), x, y, z, outX, outY, outZ);
+}
+
+}}
+
+#endif
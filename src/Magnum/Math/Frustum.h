@@ -0,0 +1,392 @@
+#ifndef Magnum_Math_Frustum_h
+#define Magnum_Math_Frustum_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Frustum, enum @ref Magnum::Math::FrustumCulling, function @ref Magnum::Math::cullSpheres(), @ref Magnum::Math::cullBoxes()
+ */
+
+#include <cmath>
+#include <limits>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+
+#ifdef CORRADE_TARGET_WINDOWS /* I so HATE windef.h */
+#undef near
+#undef far
+#endif
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Camera frustum
+
+Represented by six planes in form @f$ ax + by + cz + d = 0 @f$ with normals
+pointing inside the frustum and normalized, so @f$ ax + by + cz + d @f$ is
+signed distance of point @f$ (x, y, z) @f$ from the plane. Usually created
+from a projection or combined projection and camera matrix with
+@ref fromMatrix(), the frustum then is in the same space as the matrix input
+(e.g. world space for projection-view matrix).
+@see @ref Frustum, @ref Frustumd, @ref cullSpheres(), @ref cullBoxes(),
+    @ref Geometry::Intersection::sphereFrustum(),
+    @ref Geometry::Intersection::boxFrustum()
+*/
+template<class T> class Frustum {
+    public:
+        /**
+         * @brief Create frustum from projection matrix
+         *
+         * Extracts the planes from rows of the matrix as described in
+         * *Gribb, Hartmann: Fast Extraction of Viewing Frustum Planes from
+         * the World-View-Projection Matrix*. For projection matrix alone the
+         * frustum is in camera space, for projection matrix multiplied by
+         * camera matrix it's in world space. Planes with zero normal (such
+         * as the far plane of infinite projection) are kept unnormalized
+         * and don't cull anything.
+         */
+        static Frustum<T> fromMatrix(const Matrix4<T>& matrix);
+
+        /**
+         * @brief Default constructor
+         *
+         * Equivalent to frustum of identity projection matrix, i.e. the
+         * @f$ [-1; 1]^3 @f$ cube.
+         */
+        constexpr /*implicit*/ Frustum(): _data{
+            {T(1), T(0), T(0), T(1)}, {T(-1), T(0), T(0), T(1)},
+            {T(0), T(1), T(0), T(1)}, {T(0), T(-1), T(0), T(1)},
+            {T(0), T(0), T(1), T(1)}, {T(0), T(0), T(-1), T(1)}} {}
+
+        /** @brief Construct frustum from six planes */
+        constexpr /*implicit*/ Frustum(const Vector4<T>& left, const Vector4<T>& right, const Vector4<T>& bottom, const Vector4<T>& top, const Vector4<T>& near, const Vector4<T>& far): _data{left, right, bottom, top, near, far} {}
+
+        /** @brief Equality comparison */
+        bool operator==(const Frustum<T>& other) const {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(_data[i] != other._data[i]) return false;
+            return true;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const Frustum<T>& other) const {
+            return !operator==(other);
+        }
+
+        /**
+         * @brief Raw data
+         * @return One-dimensional array of 24 elements, planes in order left,
+         *      right, bottom, top, near, far.
+         */
+        T* data() { return _data[0].data(); }
+        const T* data() const { return _data[0].data(); } /**< @overload */
+
+        /** @brief Plane at given index */
+        constexpr Vector4<T> operator[](std::size_t i) const { return _data[i]; }
+
+        /** @brief Left plane */
+        constexpr Vector4<T> left() const { return _data[0]; }
+
+        /** @brief Right plane */
+        constexpr Vector4<T> right() const { return _data[1]; }
+
+        /** @brief Bottom plane */
+        constexpr Vector4<T> bottom() const { return _data[2]; }
+
+        /** @brief Top plane */
+        constexpr Vector4<T> top() const { return _data[3]; }
+
+        /** @brief Near plane */
+        constexpr Vector4<T> near() const { return _data[4]; }
+
+        /** @brief Far plane */
+        constexpr Vector4<T> far() const { return _data[5]; }
+
+    private:
+        Vector4<T> _data[6];
+};
+
+/**
+@brief Frustum culling mode
+
+@see @ref cullSpheres(), @ref cullBoxes()
+*/
+enum class FrustumCulling: UnsignedByte {
+    /**
+     * Test only against the six frustum planes. Never culls visible object,
+     * but large objects near frustum edges and corners might be reported as
+     * visible even if they are outside.
+     */
+    Conservative,
+
+    /**
+     * Additionally test the objects against bounding box of frustum
+     * corners, which removes most of the false positives near the corners.
+     * Slightly slower than @ref FrustumCulling::Conservative.
+     */
+    Precise
+};
+
+/** @debugoperator{Magnum::Math::Frustum} */
+template<class T> Corrade::Utility::Debug operator<<(Corrade::Utility::Debug debug, const Frustum<T>& value) {
+    debug << "Frustum({";
+    debug.setFlag(Corrade::Utility::Debug::SpaceAfterEachValue, false);
+    for(std::size_t i = 0; i != 6; ++i) {
+        if(i) debug << "}, {";
+        debug << value[i][0] << ", " << value[i][1] << ", " << value[i][2] << ", " << value[i][3];
+    }
+    debug << "})";
+    debug.setFlag(Corrade::Utility::Debug::SpaceAfterEachValue, true);
+    return debug;
+}
+
+template<class T> Frustum<T> Frustum<T>::fromMatrix(const Matrix4<T>& matrix) {
+    const Vector4<T> x = matrix.row(0);
+    const Vector4<T> y = matrix.row(1);
+    const Vector4<T> z = matrix.row(2);
+    const Vector4<T> w = matrix.row(3);
+
+    Frustum<T> out{w + x, w - x, w + y, w - y, w + z, w - z};
+    for(Vector4<T>& plane: out._data) {
+        const T length = plane.xyz().length();
+        if(length != T(0)) plane /= length;
+    }
+
+    return out;
+}
+
+namespace Implementation {
+
+/* Bounding box of the eight frustum corners, each being intersection of
+   three planes. If some corner is at infinity (or the planes are degenerate),
+   the box is infinite so it doesn't cull anything. */
+template<class T> Range3D<T> frustumCornerBounds(const Frustum<T>& frustum) {
+    Vector3<T> min{std::numeric_limits<T>::infinity()};
+    Vector3<T> max{-std::numeric_limits<T>::infinity()};
+    for(std::size_t x: {0, 1}) for(std::size_t y: {2, 3}) for(std::size_t z: {4, 5}) {
+        const Vector4<T> a = frustum[x], b = frustum[y], c = frustum[z];
+        const Vector3<T> bc = Vector3<T>::cross(b.xyz(), c.xyz());
+        const Vector3<T> ca = Vector3<T>::cross(c.xyz(), a.xyz());
+        const Vector3<T> ab = Vector3<T>::cross(a.xyz(), b.xyz());
+        const Vector3<T> corner = -(a.w()*bc + b.w()*ca + c.w()*ab)/Vector3<T>::dot(a.xyz(), bc);
+
+        for(std::size_t i = 0; i != 3; ++i) {
+            if(!std::isfinite(corner[i])) return {Vector3<T>{-std::numeric_limits<T>::infinity()}, Vector3<T>{std::numeric_limits<T>::infinity()}};
+            if(corner[i] < min[i]) min[i] = corner[i];
+            if(corner[i] > max[i]) max[i] = corner[i];
+        }
+    }
+
+    return {min, max};
+}
+
+/* The object is visible if the minimum of its signed distances from all
+   planes (and, for precise culling, of its overlaps with corner bounding
+   box) is not negative. The SIMD kernels do exactly the same operations in
+   the same order, so the results are identical. */
+template<class T> struct FrustumCullScalar {
+    static T min(const T a, const T b) { return a < b ? a : b; }
+    static T max(const T a, const T b) { return a > b ? a : b; }
+
+    /* Returns early once the element is known to be outside, the sign of
+       the result is the same as with the full computation */
+    static T sphere(const Frustum<T>& frustum, const Range3D<T>* const bounds, const Vector4<T>& sphere) {
+        T distance = std::numeric_limits<T>::infinity();
+        for(std::size_t i = 0; i != 6; ++i) {
+            const Vector4<T> p = frustum[i];
+            distance = min(distance, p[0]*sphere[0] + p[1]*sphere[1] + p[2]*sphere[2] + p[3] + sphere[3]);
+            if(std::signbit(distance)) return distance;
+        }
+        if(bounds) for(std::size_t i = 0; i != 3; ++i) {
+            distance = min(distance, bounds->max()[i] - (sphere[i] - sphere[3]));
+            distance = min(distance, (sphere[i] + sphere[3]) - bounds->min()[i]);
+        }
+        return distance;
+    }
+
+    static T box(const Frustum<T>& frustum, const Range3D<T>* const bounds, const Range3D<T>& box) {
+        const Vector3<T> a = box.min(), b = box.max();
+        T distance = std::numeric_limits<T>::infinity();
+        for(std::size_t i = 0; i != 6; ++i) {
+            /* Distance of the box corner farthest in direction of the plane
+               normal */
+            const Vector4<T> p = frustum[i];
+            distance = min(distance, max(p[0]*a[0], p[0]*b[0]) + max(p[1]*a[1], p[1]*b[1]) + max(p[2]*a[2], p[2]*b[2]) + p[3]);
+            if(std::signbit(distance)) return distance;
+        }
+        if(bounds) for(std::size_t i = 0; i != 3; ++i) {
+            distance = min(distance, bounds->max()[i] - a[i]);
+            distance = min(distance, b[i] - bounds->min()[i]);
+        }
+        return distance;
+    }
+
+    static void spheres(const Frustum<T>& frustum, const Range3D<T>* const bounds, const Vector4<T>* const spheres, UnsignedByte* const visibility, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i) {
+            if(i % 8 == 0) visibility[i/8] = 0;
+            if(!std::signbit(sphere(frustum, bounds, spheres[i]))) visibility[i/8] |= 1 << i%8;
+        }
+    }
+
+    static void boxes(const Frustum<T>& frustum, const Range3D<T>* const bounds, const Range3D<T>* const boxes, UnsignedByte* const visibility, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i) {
+            if(i % 8 == 0) visibility[i/8] = 0;
+            if(!std::signbit(box(frustum, bounds, boxes[i]))) visibility[i/8] |= 1 << i%8;
+        }
+    }
+};
+
+template<class T> struct FrustumCull: FrustumCullScalar<T> {};
+
+#ifdef MAGNUM_MATH_SIMD
+/* Eight elements at a time so each iteration writes a whole byte of the
+   mask, the rest is done with the scalar code. Plane components are splatted
+   once outside of the loop. */
+template<> struct FrustumCull<Float>: FrustumCullScalar<Float> {
+    static void spheres(const Frustum<Float>& frustum, const Range3D<Float>* const bounds, const Vector4<Float>* const spheres, UnsignedByte* const visibility, std::size_t, const std::size_t count) {
+        const Splatted s{frustum, bounds};
+        const std::size_t end = count & ~std::size_t(7);
+        for(std::size_t i = 0; i != end; i += 8)
+            visibility[i/8] = ~(s.spheres(spheres[i].data())|s.spheres(spheres[i + 4].data()) << 4);
+        FrustumCullScalar<Float>::spheres(frustum, bounds, spheres, visibility, end, count);
+    }
+
+    static void boxes(const Frustum<Float>& frustum, const Range3D<Float>* const bounds, const Range3D<Float>* const boxes, UnsignedByte* const visibility, std::size_t, const std::size_t count) {
+        const Splatted s{frustum, bounds};
+        const std::size_t end = count & ~std::size_t(7);
+        for(std::size_t i = 0; i != end; i += 8)
+            visibility[i/8] = ~(s.boxes(reinterpret_cast<const Float*>(boxes + i))|s.boxes(reinterpret_cast<const Float*>(boxes + i + 4)) << 4);
+        FrustumCullScalar<Float>::boxes(frustum, bounds, boxes, visibility, end, count);
+    }
+
+    private:
+        struct Splatted {
+            explicit Splatted(const Frustum<Float>& frustum, const Range3D<Float>* const bounds): precise{bounds != nullptr} {
+                for(std::size_t i = 0; i != 6; ++i)
+                    for(std::size_t j = 0; j != 4; ++j)
+                        planes[i][j] = simdSplat(frustum[i][j]);
+                if(bounds) for(std::size_t i = 0; i != 3; ++i) {
+                    min[i] = simdSplat(bounds->min()[i]);
+                    max[i] = simdSplat(bounds->max()[i]);
+                }
+            }
+
+            /* Returns sign bits of the distances, i.e. set bit for culled
+               element */
+            UnsignedInt spheres(const Float* const data) const {
+                SimdFloat4 c[3], r;
+                simdLoadInterleaved4(data, c[0], c[1], c[2], r);
+                SimdFloat4 distance = simdSplat(std::numeric_limits<Float>::infinity());
+                for(std::size_t i = 0; i != 6; ++i)
+                    distance = simdMin(distance, simdAdd(simdAdd(simdAdd(simdAdd(simdMul(planes[i][0], c[0]), simdMul(planes[i][1], c[1])), simdMul(planes[i][2], c[2])), planes[i][3]), r));
+                if(precise) for(std::size_t i = 0; i != 3; ++i) {
+                    distance = simdMin(distance, simdSub(max[i], simdSub(c[i], r)));
+                    distance = simdMin(distance, simdSub(simdAdd(c[i], r), min[i]));
+                }
+                return simdSignMask(distance);
+            }
+
+            /* Range3D is min and max vector after each other, so the data
+               are loaded as eight three-component vectors and then split to
+               even (min) and odd (max) ones */
+            UnsignedInt boxes(const Float* const data) const {
+                SimdFloat4 a[3], b[3], first[3], second[3];
+                simdLoadInterleaved3(data, first[0], first[1], first[2]);
+                simdLoadInterleaved3(data + 12, second[0], second[1], second[2]);
+                for(std::size_t i = 0; i != 3; ++i)
+                    simdDeinterleave(first[i], second[i], a[i], b[i]);
+
+                SimdFloat4 distance = simdSplat(std::numeric_limits<Float>::infinity());
+                for(std::size_t i = 0; i != 6; ++i)
+                    distance = simdMin(distance, simdAdd(simdAdd(simdAdd(
+                        simdMax(simdMul(planes[i][0], a[0]), simdMul(planes[i][0], b[0])),
+                        simdMax(simdMul(planes[i][1], a[1]), simdMul(planes[i][1], b[1]))),
+                        simdMax(simdMul(planes[i][2], a[2]), simdMul(planes[i][2], b[2]))), planes[i][3]));
+                if(precise) for(std::size_t i = 0; i != 3; ++i) {
+                    distance = simdMin(distance, simdSub(max[i], a[i]));
+                    distance = simdMin(distance, simdSub(b[i], min[i]));
+                }
+                return simdSignMask(distance);
+            }
+
+            SimdFloat4 planes[6][4];
+            SimdFloat4 min[3], max[3];
+            bool precise;
+        };
+};
+#endif
+
+}
+
+/**
+@brief Cull spheres against frustum
+@param frustum      Frustum
+@param spheres      Spheres, center in first three components and radius in
+    the fourth
+@param visibility   Where to put the visibility mask
+@param culling      Culling mode
+
+Bit `i % 8` of byte `i / 8` of @p visibility is set if sphere `i` is (possibly)
+visible, unused bits of the last byte are set to zero. The mask has to have
+`(spheres.size() + 7)/8` bytes. If built with @ref MAGNUM_BUILD_SIMD,
+@ref Float batches are processed four elements at a time, with exactly the
+same results as the scalar code.
+@see @ref Geometry::Intersection::sphereFrustum()
+*/
+template<class T> void cullSpheres(const Frustum<T>& frustum, Corrade::Containers::ArrayReference<const Vector4<T>> spheres, Corrade::Containers::ArrayReference<UnsignedByte> visibility, const FrustumCulling culling = FrustumCulling::Precise) {
+    CORRADE_ASSERT(visibility.size() == (spheres.size() + 7)/8,
+        "Math::cullSpheres(): expected visibility mask of size" << (spheres.size() + 7)/8 << "but got" << visibility.size(), );
+    const Range3D<T> bounds = culling == FrustumCulling::Precise ? Implementation::frustumCornerBounds(frustum) : Range3D<T>{};
+    Implementation::FrustumCull<T>::spheres(frustum, culling == FrustumCulling::Precise ? &bounds : nullptr, spheres, visibility, 0, spheres.size());
+}
+
+/**
+@brief Cull axis-aligned boxes against frustum
+@param frustum      Frustum
+@param boxes        Axis-aligned boxes
+@param visibility   Where to put the visibility mask
+@param culling      Culling mode
+
+Bit `i % 8` of byte `i / 8` of @p visibility is set if box `i` is (possibly)
+visible, unused bits of the last byte are set to zero. The mask has to have
+`(boxes.size() + 7)/8` bytes. If built with @ref MAGNUM_BUILD_SIMD,
+@ref Float batches are processed four elements at a time, with exactly the
+same results as the scalar code.
+@see @ref Geometry::Intersection::boxFrustum()
+*/
+template<class T> void cullBoxes(const Frustum<T>& frustum, Corrade::Containers::ArrayReference<const Range3D<T>> boxes, Corrade::Containers::ArrayReference<UnsignedByte> visibility, const FrustumCulling culling = FrustumCulling::Precise) {
+    CORRADE_ASSERT(visibility.size() == (boxes.size() + 7)/8,
+        "Math::cullBoxes(): expected visibility mask of size" << (boxes.size() + 7)/8 << "but got" << visibility.size(), );
+    const Range3D<T> bounds = culling == FrustumCulling::Precise ? Implementation::frustumCornerBounds(frustum) : Range3D<T>{};
+    Implementation::FrustumCull<T>::boxes(frustum, culling == FrustumCulling::Precise ? &bounds : nullptr, boxes, visibility, 0, boxes.size());
+}
+
+}}
+
+#endif
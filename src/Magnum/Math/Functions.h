@@ -40,6 +40,22 @@
 namespace Magnum { namespace Math {
 
 namespace Implementation {
+    template<class T, class U, class = void> struct Lerp {
+        static T lerp(const T& a, const T& b, U t) {
+            return T((U(1) - t)*a + t*b);
+        }
+    };
+
+    #ifdef MAGNUM_MATH_SIMD
+    template<class T> struct Lerp<T, Float, typename std::enable_if<std::is_base_of<Vector<4, Float>, T>::value>::type> {
+        static T lerp(const T& a, const T& b, Float t) {
+            T out;
+            simdLerp(a.data(), b.data(), t, out.data());
+            return out;
+        }
+    };
+    #endif
+
     template<UnsignedInt exponent> struct Pow {
         Pow() = delete;
 
@@ -359,10 +375,10 @@ The interpolation for vectors is done as in following, similarly for scalars: @f
 template<class T, class U> inline T lerp(const T& a, const T& b, U t);
 #else
 template<class T, class U> inline T lerp(T a, T b, U t) {
-    return T((U(1) - t)*a + t*b);
+    return Implementation::Lerp<T, U>::lerp(a, b, t);
 }
 template<std::size_t size, class T, class U> inline Vector<size, T> lerp(const Vector<size, T>& a, const Vector<size, T>& b, U t) {
-    return (U(1) - t)*a + t*b;
+    return Implementation::Lerp<Vector<size, T>, U>::lerp(a, b, t);
 }
 #endif
 
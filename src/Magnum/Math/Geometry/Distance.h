@@ -29,8 +29,14 @@
  * @brief Class Magnum::Math::Geometry::Distance
  */
 
+#include <limits>
+#include <utility>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Implementation/simd.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
 
@@ -101,6 +107,47 @@ class Distance {
             return Vector3<T>::cross(point - a, point - b).dot()/(b - a).dot();
         }
 
+        /**
+         * @brief %Distance of line and points in 2D, squared
+         * @param a         First point of the line
+         * @param b         Second point of the line
+         * @param points    Points
+         * @param out       Where to put the squared distances
+         *
+         * Batch version of linePointSquared(const Vector2&, const Vector2&, const Vector2&),
+         * @p out has to have the same size as @p points. If built with
+         * @ref MAGNUM_BUILD_SIMD, @ref Float points are processed four at a
+         * time, the results are the same as with the single-point version.
+         */
+        template<class T> static void linePointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const Vector2<T>> points, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief %Distance of line and points in 2D in structure-of-arrays layout, squared
+         *
+         * Same as linePointSquared(const Vector2&, const Vector2&, Corrade::Containers::ArrayReference<const Vector2>, Corrade::Containers::ArrayReference<T>),
+         * but with separate arrays for each point component. All arrays have
+         * to have the same size.
+         */
+        template<class T> static void linePointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief %Distance of line and points in 3D, squared
+         *
+         * Batch version of linePointSquared(const Vector3&, const Vector3&, const Vector3&),
+         * see linePointSquared(const Vector2&, const Vector2&, Corrade::Containers::ArrayReference<const Vector2>, Corrade::Containers::ArrayReference<T>)
+         * for more information.
+         */
+        template<class T> static void linePointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const Vector3<T>> points, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief %Distance of line and points in 3D in structure-of-arrays layout, squared
+         *
+         * Same as linePointSquared(const Vector3&, const Vector3&, Corrade::Containers::ArrayReference<const Vector3>, Corrade::Containers::ArrayReference<T>),
+         * but with separate arrays for each point component. All arrays have
+         * to have the same size.
+         */
+        template<class T> static void linePointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<const T> z, Corrade::Containers::ArrayReference<T> out);
+
         /**
          * @brief %Dístance of point from line segment in 2D
          * @param a         Starting point of the line
@@ -159,6 +206,99 @@ class Distance {
          * other values, because it doesn't compute the square root.
          */
         template<class T> static T lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& point);
+
+        /**
+         * @brief %Distance of points from line segment in 2D, squared
+         * @param a         Starting point of the line
+         * @param b         Ending point of the line
+         * @param points    Points
+         * @param out       Where to put the squared distances
+         *
+         * Batch version of lineSegmentPointSquared(const Vector2&, const Vector2&, const Vector2&),
+         * @p out has to have the same size as @p points. If built with
+         * @ref MAGNUM_BUILD_SIMD, @ref Float points are processed four at a
+         * time, all three cases are computed and the right one is selected
+         * afterwards. The results are the same as with the single-point
+         * version.
+         */
+        template<class T> static void lineSegmentPointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const Vector2<T>> points, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief %Distance of points from line segment in 2D in structure-of-arrays layout, squared
+         *
+         * Same as lineSegmentPointSquared(const Vector2&, const Vector2&, Corrade::Containers::ArrayReference<const Vector2>, Corrade::Containers::ArrayReference<T>),
+         * but with separate arrays for each point component. All arrays have
+         * to have the same size.
+         */
+        template<class T> static void lineSegmentPointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief %Distance of points from line segment in 3D, squared
+         *
+         * Batch version of lineSegmentPointSquared(const Vector3&, const Vector3&, const Vector3&),
+         * see lineSegmentPointSquared(const Vector2&, const Vector2&, Corrade::Containers::ArrayReference<const Vector2>, Corrade::Containers::ArrayReference<T>)
+         * for more information.
+         */
+        template<class T> static void lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const Vector3<T>> points, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief %Distance of points from line segment in 3D in structure-of-arrays layout, squared
+         *
+         * Same as lineSegmentPointSquared(const Vector3&, const Vector3&, Corrade::Containers::ArrayReference<const Vector3>, Corrade::Containers::ArrayReference<T>),
+         * but with separate arrays for each point component. All arrays have
+         * to have the same size.
+         */
+        template<class T> static void lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<const T> z, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief %Distance of point from line segments in 2D, squared
+         * @param a         Starting points of the lines
+         * @param b         Ending points of the lines
+         * @param point     Point
+         * @param out       Where to put the squared distances
+         *
+         * Batch version of lineSegmentPointSquared(const Vector2&, const Vector2&, const Vector2&)
+         * for e.g. all segments of a polyline. All arrays have to have the
+         * same size. If built with @ref MAGNUM_BUILD_SIMD, @ref Float
+         * segments are processed four at a time, the results are the same as
+         * with the single-segment version.
+         * @see closestLineSegment()
+         */
+        template<class T> static void lineSegmentPointSquared(Corrade::Containers::ArrayReference<const Vector2<T>> a, Corrade::Containers::ArrayReference<const Vector2<T>> b, const Vector2<T>& point, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief %Distance of point from line segments in 3D, squared
+         *
+         * See lineSegmentPointSquared(Corrade::Containers::ArrayReference<const Vector2>, Corrade::Containers::ArrayReference<const Vector2>, const Vector2&, Corrade::Containers::ArrayReference<T>)
+         * for more information.
+         */
+        template<class T> static void lineSegmentPointSquared(Corrade::Containers::ArrayReference<const Vector3<T>> a, Corrade::Containers::ArrayReference<const Vector3<T>> b, const Vector3<T>& point, Corrade::Containers::ArrayReference<T> out);
+
+        /**
+         * @brief Line segment closest to a point in 2D
+         * @param a         Starting points of the lines
+         * @param b         Ending points of the lines
+         * @param point     Point
+         * @return Index of the closest line segment and squared distance of
+         *      the point from it
+         *
+         * Equivalent to finding the minimum of distances calculated with
+         * lineSegmentPointSquared(Corrade::Containers::ArrayReference<const Vector2>, Corrade::Containers::ArrayReference<const Vector2>, const Vector2&, Corrade::Containers::ArrayReference<T>),
+         * but without storing them. The arrays have to have the same size.
+         * If more segments have the same distance, the first one is
+         * returned. Degenerate segments with both points the same are
+         * skipped, if there is no suitable segment, returns `0` and
+         * infinity.
+         */
+        template<class T> static std::pair<std::size_t, T> closestLineSegment(Corrade::Containers::ArrayReference<const Vector2<T>> a, Corrade::Containers::ArrayReference<const Vector2<T>> b, const Vector2<T>& point);
+
+        /**
+         * @brief Line segment closest to a point in 3D
+         *
+         * See closestLineSegment(Corrade::Containers::ArrayReference<const Vector2>, Corrade::Containers::ArrayReference<const Vector2>, const Vector2&)
+         * for more information.
+         */
+        template<class T> static std::pair<std::size_t, T> closestLineSegment(Corrade::Containers::ArrayReference<const Vector3<T>> a, Corrade::Containers::ArrayReference<const Vector3<T>> b, const Vector3<T>& point);
 };
 
 /** @todoc Remove workaround when Doxygen is sane */
@@ -238,6 +378,404 @@ T Distance::lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, co
     return Vector3<T>::cross(pointMinusA, pointMinusB).dot()/bDistanceA;
 }
 
+namespace Implementation {
+
+/* Scalar batch kernels, calling the single-point functions. Used directly for
+   all types except Float with SIMD enabled, where they process the remaining
+   elements. */
+template<class T> struct DistanceBatchScalar {
+    template<class VectorType> static void linePointSquared(const VectorType& a, const VectorType& b, const VectorType* const points, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = Distance::linePointSquared(a, b, points[i]);
+    }
+
+    static void linePointSquared(const Vector2<T>& a, const Vector2<T>& b, const T* const x, const T* const y, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = Distance::linePointSquared(a, b, Vector2<T>{x[i], y[i]});
+    }
+
+    static void linePointSquared(const Vector3<T>& a, const Vector3<T>& b, const T* const x, const T* const y, const T* const z, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = Distance::linePointSquared(a, b, Vector3<T>{x[i], y[i], z[i]});
+    }
+
+    template<class VectorType> static void lineSegmentPointSquared(const VectorType& a, const VectorType& b, const VectorType* const points, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = Distance::lineSegmentPointSquared(a, b, points[i]);
+    }
+
+    static void lineSegmentPointSquared(const Vector2<T>& a, const Vector2<T>& b, const T* const x, const T* const y, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = Distance::lineSegmentPointSquared(a, b, Vector2<T>{x[i], y[i]});
+    }
+
+    static void lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, const T* const x, const T* const y, const T* const z, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = Distance::lineSegmentPointSquared(a, b, Vector3<T>{x[i], y[i], z[i]});
+    }
+
+    template<class VectorType> static void lineSegmentsPointSquared(const VectorType* const a, const VectorType* const b, const VectorType& point, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = Distance::lineSegmentPointSquared(a[i], b[i], point);
+    }
+
+    /* NaN distances of degenerate segments fail the comparison */
+    template<class VectorType> static std::pair<std::size_t, T> closestLineSegment(const VectorType* const a, const VectorType* const b, const VectorType& point, std::pair<std::size_t, T> closest, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i) {
+            const T distance = Distance::lineSegmentPointSquared(a[i], b[i], point);
+            if(distance < closest.second) closest = {i, distance};
+        }
+        return closest;
+    }
+};
+
+template<class T> struct DistanceBatch: DistanceBatchScalar<T> {};
+
+#ifdef MAGNUM_MATH_SIMD
+/* Four points or segments at a time, split into components. The single point
+   or segment is splatted once outside of the loop. The math is done in the
+   same order as in the single-point functions, so the results are the
+   same. */
+template<> struct DistanceBatch<Float>: DistanceBatchScalar<Float> {
+    template<class VectorType> static void linePointSquared(const VectorType& a, const VectorType& b, const VectorType* const points, Float* const out, std::size_t, const std::size_t count) {
+        SimdFloat4 sa[VectorType::Size], sb[VectorType::Size];
+        splat(a, sa);
+        splat(b, sb);
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            SimdFloat4 p[VectorType::Size];
+            load(points + i, p);
+            Math::Implementation::simdStore(out + i, simdLinePointSquared(sa, sb, p));
+        }
+        DistanceBatchScalar<Float>::linePointSquared(a, b, points, out, end, count);
+    }
+
+    static void linePointSquared(const Vector2<Float>& a, const Vector2<Float>& b, const Float* const x, const Float* const y, Float* const out, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        SimdFloat4 sa[2], sb[2];
+        splat(a, sa);
+        splat(b, sb);
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            const SimdFloat4 p[]{simdLoad(x + i), simdLoad(y + i)};
+            simdStore(out + i, simdLinePointSquared(sa, sb, p));
+        }
+        DistanceBatchScalar<Float>::linePointSquared(a, b, x, y, out, end, count);
+    }
+
+    static void linePointSquared(const Vector3<Float>& a, const Vector3<Float>& b, const Float* const x, const Float* const y, const Float* const z, Float* const out, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        SimdFloat4 sa[3], sb[3];
+        splat(a, sa);
+        splat(b, sb);
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            const SimdFloat4 p[]{simdLoad(x + i), simdLoad(y + i), simdLoad(z + i)};
+            simdStore(out + i, simdLinePointSquared(sa, sb, p));
+        }
+        DistanceBatchScalar<Float>::linePointSquared(a, b, x, y, z, out, end, count);
+    }
+
+    template<class VectorType> static void lineSegmentPointSquared(const VectorType& a, const VectorType& b, const VectorType* const points, Float* const out, std::size_t, const std::size_t count) {
+        SimdFloat4 sa[VectorType::Size], sb[VectorType::Size];
+        splat(a, sa);
+        splat(b, sb);
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            SimdFloat4 p[VectorType::Size];
+            load(points + i, p);
+            Math::Implementation::simdStore(out + i, simdLineSegmentPointSquared(sa, sb, p));
+        }
+        DistanceBatchScalar<Float>::lineSegmentPointSquared(a, b, points, out, end, count);
+    }
+
+    static void lineSegmentPointSquared(const Vector2<Float>& a, const Vector2<Float>& b, const Float* const x, const Float* const y, Float* const out, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        SimdFloat4 sa[2], sb[2];
+        splat(a, sa);
+        splat(b, sb);
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            const SimdFloat4 p[]{simdLoad(x + i), simdLoad(y + i)};
+            simdStore(out + i, simdLineSegmentPointSquared(sa, sb, p));
+        }
+        DistanceBatchScalar<Float>::lineSegmentPointSquared(a, b, x, y, out, end, count);
+    }
+
+    static void lineSegmentPointSquared(const Vector3<Float>& a, const Vector3<Float>& b, const Float* const x, const Float* const y, const Float* const z, Float* const out, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        SimdFloat4 sa[3], sb[3];
+        splat(a, sa);
+        splat(b, sb);
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            const SimdFloat4 p[]{simdLoad(x + i), simdLoad(y + i), simdLoad(z + i)};
+            simdStore(out + i, simdLineSegmentPointSquared(sa, sb, p));
+        }
+        DistanceBatchScalar<Float>::lineSegmentPointSquared(a, b, x, y, z, out, end, count);
+    }
+
+    template<class VectorType> static void lineSegmentsPointSquared(const VectorType* const a, const VectorType* const b, const VectorType& point, Float* const out, std::size_t, const std::size_t count) {
+        SimdFloat4 p[VectorType::Size];
+        splat(point, p);
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            SimdFloat4 sa[VectorType::Size], sb[VectorType::Size];
+            load(a + i, sa);
+            load(b + i, sb);
+            Math::Implementation::simdStore(out + i, simdLineSegmentPointSquared(sa, sb, p));
+        }
+        DistanceBatchScalar<Float>::lineSegmentsPointSquared(a, b, point, out, end, count);
+    }
+
+    /* The lanes are checked one by one only if any of them is closer than
+       the current minimum, which after the first few iterations happens
+       rarely */
+    template<class VectorType> static std::pair<std::size_t, Float> closestLineSegment(const VectorType* const a, const VectorType* const b, const VectorType& point, std::pair<std::size_t, Float> closest, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        SimdFloat4 p[VectorType::Size];
+        splat(point, p);
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            SimdFloat4 sa[VectorType::Size], sb[VectorType::Size];
+            load(a + i, sa);
+            load(b + i, sb);
+            const SimdFloat4 distance = simdLineSegmentPointSquared(sa, sb, p);
+            if(!simdMaskBits(simdLess(distance, simdSplat(closest.second)))) continue;
+
+            Float distances[4];
+            simdStore(distances, distance);
+            for(std::size_t j = 0; j != 4; ++j)
+                if(distances[j] < closest.second) closest = {i + j, distances[j]};
+        }
+        return DistanceBatchScalar<Float>::closestLineSegment(a, b, point, closest, end, count);
+    }
+
+    private:
+        typedef Math::Implementation::SimdFloat4 SimdFloat4;
+
+        template<std::size_t size> static void splat(const Vector<size, Float>& vector, SimdFloat4(&out)[size]) {
+            for(std::size_t i = 0; i != size; ++i)
+                out[i] = Math::Implementation::simdSplat(vector[i]);
+        }
+
+        static void load(const Vector2<Float>* const data, SimdFloat4(&out)[2]) {
+            Math::Implementation::simdLoadInterleaved2(data->data(), out[0], out[1]);
+        }
+
+        static void load(const Vector3<Float>* const data, SimdFloat4(&out)[3]) {
+            Math::Implementation::simdLoadInterleaved3(data->data(), out[0], out[1], out[2]);
+        }
+
+        static SimdFloat4 simdLinePointSquared(const SimdFloat4(&a)[2], const SimdFloat4(&b)[2], const SimdFloat4(&p)[2]) {
+            using namespace Math::Implementation;
+            const SimdFloat4 bMinusA[]{simdSub(b[0], a[0]), simdSub(b[1], a[1])};
+            const SimdFloat4 cross = simdSub(simdMul(bMinusA[0], simdSub(a[1], p[1])), simdMul(bMinusA[1], simdSub(a[0], p[0])));
+            return simdDiv(simdMul(cross, cross), dot(bMinusA));
+        }
+
+        static SimdFloat4 simdLinePointSquared(const SimdFloat4(&a)[3], const SimdFloat4(&b)[3], const SimdFloat4(&p)[3]) {
+            using namespace Math::Implementation;
+            const SimdFloat4 pointMinusA[]{simdSub(p[0], a[0]), simdSub(p[1], a[1]), simdSub(p[2], a[2])};
+            const SimdFloat4 pointMinusB[]{simdSub(p[0], b[0]), simdSub(p[1], b[1]), simdSub(p[2], b[2])};
+            const SimdFloat4 bMinusA[]{simdSub(b[0], a[0]), simdSub(b[1], a[1]), simdSub(b[2], a[2])};
+            return simdDiv(crossDot(pointMinusA, pointMinusB), dot(bMinusA));
+        }
+
+        static SimdFloat4 simdLineSegmentPointSquared(const SimdFloat4(&a)[2], const SimdFloat4(&b)[2], const SimdFloat4(&p)[2]) {
+            using namespace Math::Implementation;
+            const SimdFloat4 pointMinusA[]{simdSub(p[0], a[0]), simdSub(p[1], a[1])};
+            const SimdFloat4 pointMinusB[]{simdSub(p[0], b[0]), simdSub(p[1], b[1])};
+            const SimdFloat4 bMinusA[]{simdSub(b[0], a[0]), simdSub(b[1], a[1])};
+            const SimdFloat4 cross = simdSub(simdMul(bMinusA[0], pointMinusA[1]), simdMul(bMinusA[1], pointMinusA[0]));
+            return select(dot(pointMinusA), dot(pointMinusB), dot(bMinusA), simdMul(cross, cross));
+        }
+
+        static SimdFloat4 simdLineSegmentPointSquared(const SimdFloat4(&a)[3], const SimdFloat4(&b)[3], const SimdFloat4(&p)[3]) {
+            using namespace Math::Implementation;
+            const SimdFloat4 pointMinusA[]{simdSub(p[0], a[0]), simdSub(p[1], a[1]), simdSub(p[2], a[2])};
+            const SimdFloat4 pointMinusB[]{simdSub(p[0], b[0]), simdSub(p[1], b[1]), simdSub(p[2], b[2])};
+            const SimdFloat4 bMinusA[]{simdSub(b[0], a[0]), simdSub(b[1], a[1]), simdSub(b[2], a[2])};
+            return select(dot(pointMinusA), dot(pointMinusB), dot(bMinusA), crossDot(pointMinusA, pointMinusB));
+        }
+
+        static SimdFloat4 dot(const SimdFloat4(&a)[2]) {
+            using namespace Math::Implementation;
+            return simdAdd(simdMul(a[0], a[0]), simdMul(a[1], a[1]));
+        }
+
+        static SimdFloat4 dot(const SimdFloat4(&a)[3]) {
+            using namespace Math::Implementation;
+            return simdAdd(simdAdd(simdMul(a[0], a[0]), simdMul(a[1], a[1])), simdMul(a[2], a[2]));
+        }
+
+        /* Squared length of cross product */
+        static SimdFloat4 crossDot(const SimdFloat4(&a)[3], const SimdFloat4(&b)[3]) {
+            using namespace Math::Implementation;
+            const SimdFloat4 cross[]{
+                simdSub(simdMul(a[1], b[2]), simdMul(a[2], b[1])),
+                simdSub(simdMul(a[2], b[0]), simdMul(a[0], b[2])),
+                simdSub(simdMul(a[0], b[1]), simdMul(a[1], b[0]))};
+            return dot(cross);
+        }
+
+        /* All three cases of the segment distance, selected based on where
+           the point lies */
+        static SimdFloat4 select(const SimdFloat4 pointDistanceA, const SimdFloat4 pointDistanceB, const SimdFloat4 bDistanceA, const SimdFloat4 crossDistance) {
+            using namespace Math::Implementation;
+            const SimdFloat4 between = simdDiv(crossDistance, bDistanceA);
+            return simdSelect(simdGreater(pointDistanceB, simdAdd(bDistanceA, pointDistanceA)), pointDistanceA,
+                simdSelect(simdGreater(pointDistanceA, simdAdd(bDistanceA, pointDistanceB)), pointDistanceB, between));
+        }
+};
+#endif
+
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::linePointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const Vector2<T>> points, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(points.size() == out.size(),
+        "Math::Geometry::Distance::linePointSquared(): expected output array of size" << points.size() << "but got" << out.size(), );
+    Implementation::DistanceBatch<T>::linePointSquared(a, b, points.data(), out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::linePointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(y.size() == x.size() && out.size() == x.size(),
+        "Math::Geometry::Distance::linePointSquared(): array sizes don't match", );
+    Implementation::DistanceBatch<T>::linePointSquared(a, b, x, y, out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::linePointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const Vector3<T>> points, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(points.size() == out.size(),
+        "Math::Geometry::Distance::linePointSquared(): expected output array of size" << points.size() << "but got" << out.size(), );
+    Implementation::DistanceBatch<T>::linePointSquared(a, b, points.data(), out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::linePointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<const T> z, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(y.size() == x.size() && z.size() == x.size() && out.size() == x.size(),
+        "Math::Geometry::Distance::linePointSquared(): array sizes don't match", );
+    Implementation::DistanceBatch<T>::linePointSquared(a, b, x, y, z, out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::lineSegmentPointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const Vector2<T>> points, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(points.size() == out.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): expected output array of size" << points.size() << "but got" << out.size(), );
+    Implementation::DistanceBatch<T>::lineSegmentPointSquared(a, b, points.data(), out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::lineSegmentPointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(y.size() == x.size() && out.size() == x.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): array sizes don't match", );
+    Implementation::DistanceBatch<T>::lineSegmentPointSquared(a, b, x, y, out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const Vector3<T>> points, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(points.size() == out.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): expected output array of size" << points.size() << "but got" << out.size(), );
+    Implementation::DistanceBatch<T>::lineSegmentPointSquared(a, b, points.data(), out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const T> x, Corrade::Containers::ArrayReference<const T> y, Corrade::Containers::ArrayReference<const T> z, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(y.size() == x.size() && z.size() == x.size() && out.size() == x.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): array sizes don't match", );
+    Implementation::DistanceBatch<T>::lineSegmentPointSquared(a, b, x, y, z, out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::lineSegmentPointSquared(Corrade::Containers::ArrayReference<const Vector2<T>> a, Corrade::Containers::ArrayReference<const Vector2<T>> b, const Vector2<T>& point, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(b.size() == a.size() && out.size() == a.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): array sizes don't match", );
+    Implementation::DistanceBatch<T>::lineSegmentsPointSquared(a.data(), b.data(), point, out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+void Distance::lineSegmentPointSquared(Corrade::Containers::ArrayReference<const Vector3<T>> a, Corrade::Containers::ArrayReference<const Vector3<T>> b, const Vector3<T>& point, Corrade::Containers::ArrayReference<T> out) {
+    CORRADE_ASSERT(b.size() == a.size() && out.size() == a.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): array sizes don't match", );
+    Implementation::DistanceBatch<T>::lineSegmentsPointSquared(a.data(), b.data(), point, out, 0, out.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+std::pair<std::size_t, T> Distance::closestLineSegment(Corrade::Containers::ArrayReference<const Vector2<T>> a, Corrade::Containers::ArrayReference<const Vector2<T>> b, const Vector2<T>& point) {
+    CORRADE_ASSERT(b.size() == a.size(),
+        "Math::Geometry::Distance::closestLineSegment(): array sizes don't match", {});
+    return Implementation::DistanceBatch<T>::closestLineSegment(a.data(), b.data(), point, {0, std::numeric_limits<T>::infinity()}, 0, a.size());
+}
+
+/** @todoc Remove workaround when Doxygen is sane */
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> static
+#else
+template<class T>
+#endif
+std::pair<std::size_t, T> Distance::closestLineSegment(Corrade::Containers::ArrayReference<const Vector3<T>> a, Corrade::Containers::ArrayReference<const Vector3<T>> b, const Vector3<T>& point) {
+    CORRADE_ASSERT(b.size() == a.size(),
+        "Math::Geometry::Distance::closestLineSegment(): array sizes don't match", {});
+    return Implementation::DistanceBatch<T>::closestLineSegment(a.data(), b.data(), point, {0, std::numeric_limits<T>::infinity()}, 0, a.size());
+}
+
 }}}
 
 #endif
@@ -29,10 +29,205 @@
  * @brief Class Magnum::Math::Geometry::Intersection
  */
 
+#include <limits>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Implementation/simd.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
 
+namespace Implementation {
+
+/* Scalar ray intersection kernels, written component-wise with the same
+   order of operations as the SIMD code, so both give the same results. Used
+   directly for all types except Float with SIMD enabled, where they process
+   the remaining elements. */
+template<class T> struct RayIntersectionScalar {
+    static T min(const T a, const T b) { return a < b ? a : b; }
+    static T max(const T a, const T b) { return a > b ? a : b; }
+
+    /* Möller-Trumbore, with the triangle given by vertex and two edges */
+    static T triangle(const Vector3<T>& o, const Vector3<T>& d, const Vector3<T>& a, const Vector3<T>& e1, const Vector3<T>& e2) {
+        const T px = d[1]*e2[2] - d[2]*e2[1];
+        const T py = d[2]*e2[0] - d[0]*e2[2];
+        const T pz = d[0]*e2[1] - d[1]*e2[0];
+        const T inverseDeterminant = T(1)/(e1[0]*px + e1[1]*py + e1[2]*pz);
+
+        const T sx = o[0] - a[0];
+        const T sy = o[1] - a[1];
+        const T sz = o[2] - a[2];
+        const T u = (sx*px + sy*py + sz*pz)*inverseDeterminant;
+
+        const T qx = sy*e1[2] - sz*e1[1];
+        const T qy = sz*e1[0] - sx*e1[2];
+        const T qz = sx*e1[1] - sy*e1[0];
+        const T v = (d[0]*qx + d[1]*qy + d[2]*qz)*inverseDeterminant;
+        const T t = (e2[0]*qx + e2[1]*qy + e2[2]*qz)*inverseDeterminant;
+
+        /* Parallel ray gives NaN or infinite u, v, failing the tests */
+        return u >= T(0) && v >= T(0) && u + v <= T(1) && t >= T(0) ? t : std::numeric_limits<T>::infinity();
+    }
+
+    /* Slab test. If the ray is parallel to a slab and starts on its
+       boundary, the distances are NaN and the min/max operations ignore
+       them. */
+    static T box(const Vector3<T>& o, const Vector3<T>& inverseDirection, const Vector3<T>& boxMin, const Vector3<T>& boxMax) {
+        T tMin = T(0);
+        T tMax = std::numeric_limits<T>::infinity();
+        for(std::size_t i = 0; i != 3; ++i) {
+            const T t1 = (boxMin[i] - o[i])*inverseDirection[i];
+            const T t2 = (boxMax[i] - o[i])*inverseDirection[i];
+            tMin = max(min(t1, t2), tMin);
+            tMax = min(max(t1, t2), tMax);
+        }
+        return tMin <= tMax ? tMin : std::numeric_limits<T>::infinity();
+    }
+
+    static void triangles(const Vector3<T>& origin, const Vector3<T>& direction, const Vector3<T>* const a, const Vector3<T>* const b, const Vector3<T>* const c, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = triangle(origin, direction, a[i], b[i] - a[i], c[i] - a[i]);
+    }
+
+    static void raysTriangle(const Vector3<T>* const origins, const Vector3<T>* const directions, const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, T* const out, const std::size_t begin, const std::size_t count) {
+        const Vector3<T> e1 = b - a, e2 = c - a;
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = triangle(origins[i], directions[i], a, e1, e2);
+    }
+
+    static void boxes(const Vector3<T>& origin, const Vector3<T>& inverseDirection, const Range3D<T>* const boxes, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = box(origin, inverseDirection, boxes[i].min(), boxes[i].max());
+    }
+
+    static void raysBox(const Vector3<T>* const origins, const Vector3<T>* const inverseDirections, const Range3D<T>& box, T* const out, const std::size_t begin, const std::size_t count) {
+        for(std::size_t i = begin; i < count; ++i)
+            out[i] = RayIntersectionScalar<T>::box(origins[i], inverseDirections[i], box.min(), box.max());
+    }
+};
+
+template<class T> struct RayIntersection: RayIntersectionScalar<T> {};
+
+#ifdef MAGNUM_MATH_SIMD
+/* Four rays or primitives at a time, loaded from the arrays and split into
+   components. The single ray or primitive is splatted once outside of the
+   loop. */
+template<> struct RayIntersection<Float>: RayIntersectionScalar<Float> {
+    static void triangles(const Vector3<Float>& origin, const Vector3<Float>& direction, const Vector3<Float>* const a, const Vector3<Float>* const b, const Vector3<Float>* const c, Float* const out, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        const SimdFloat4 o[]{simdSplat(origin[0]), simdSplat(origin[1]), simdSplat(origin[2])};
+        const SimdFloat4 d[]{simdSplat(direction[0]), simdSplat(direction[1]), simdSplat(direction[2])};
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            SimdFloat4 va[3], vb[3], vc[3];
+            simdLoadInterleaved3(a[i].data(), va[0], va[1], va[2]);
+            simdLoadInterleaved3(b[i].data(), vb[0], vb[1], vb[2]);
+            simdLoadInterleaved3(c[i].data(), vc[0], vc[1], vc[2]);
+            const SimdFloat4 e1[]{simdSub(vb[0], va[0]), simdSub(vb[1], va[1]), simdSub(vb[2], va[2])};
+            const SimdFloat4 e2[]{simdSub(vc[0], va[0]), simdSub(vc[1], va[1]), simdSub(vc[2], va[2])};
+            simdStore(out + i, simdTriangle(o, d, va, e1, e2));
+        }
+        RayIntersectionScalar<Float>::triangles(origin, direction, a, b, c, out, end, count);
+    }
+
+    static void raysTriangle(const Vector3<Float>* const origins, const Vector3<Float>* const directions, const Vector3<Float>& a, const Vector3<Float>& b, const Vector3<Float>& c, Float* const out, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        const Vector3<Float> edge1 = b - a, edge2 = c - a;
+        const SimdFloat4 va[]{simdSplat(a[0]), simdSplat(a[1]), simdSplat(a[2])};
+        const SimdFloat4 e1[]{simdSplat(edge1[0]), simdSplat(edge1[1]), simdSplat(edge1[2])};
+        const SimdFloat4 e2[]{simdSplat(edge2[0]), simdSplat(edge2[1]), simdSplat(edge2[2])};
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            SimdFloat4 o[3], d[3];
+            simdLoadInterleaved3(origins[i].data(), o[0], o[1], o[2]);
+            simdLoadInterleaved3(directions[i].data(), d[0], d[1], d[2]);
+            simdStore(out + i, simdTriangle(o, d, va, e1, e2));
+        }
+        RayIntersectionScalar<Float>::raysTriangle(origins, directions, a, b, c, out, end, count);
+    }
+
+    static void boxes(const Vector3<Float>& origin, const Vector3<Float>& inverseDirection, const Range3D<Float>* const boxes, Float* const out, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        const SimdFloat4 o[]{simdSplat(origin[0]), simdSplat(origin[1]), simdSplat(origin[2])};
+        const SimdFloat4 id[]{simdSplat(inverseDirection[0]), simdSplat(inverseDirection[1]), simdSplat(inverseDirection[2])};
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            /* Range3D is min and max vector after each other, so the data
+               are loaded as eight three-component vectors and then split to
+               even (min) and odd (max) ones */
+            SimdFloat4 first[3], second[3], boxMin[3], boxMax[3];
+            const Float* const data = reinterpret_cast<const Float*>(boxes + i);
+            simdLoadInterleaved3(data, first[0], first[1], first[2]);
+            simdLoadInterleaved3(data + 12, second[0], second[1], second[2]);
+            for(std::size_t j = 0; j != 3; ++j)
+                simdDeinterleave(first[j], second[j], boxMin[j], boxMax[j]);
+            simdStore(out + i, simdBox(o, id, boxMin, boxMax));
+        }
+        RayIntersectionScalar<Float>::boxes(origin, inverseDirection, boxes, out, end, count);
+    }
+
+    static void raysBox(const Vector3<Float>* const origins, const Vector3<Float>* const inverseDirections, const Range3D<Float>& box, Float* const out, std::size_t, const std::size_t count) {
+        using namespace Math::Implementation;
+        const Vector3<Float> min = box.min(), max = box.max();
+        const SimdFloat4 boxMin[]{simdSplat(min[0]), simdSplat(min[1]), simdSplat(min[2])};
+        const SimdFloat4 boxMax[]{simdSplat(max[0]), simdSplat(max[1]), simdSplat(max[2])};
+        const std::size_t end = count & ~std::size_t(3);
+        for(std::size_t i = 0; i != end; i += 4) {
+            SimdFloat4 o[3], id[3];
+            simdLoadInterleaved3(origins[i].data(), o[0], o[1], o[2]);
+            simdLoadInterleaved3(inverseDirections[i].data(), id[0], id[1], id[2]);
+            simdStore(out + i, simdBox(o, id, boxMin, boxMax));
+        }
+        RayIntersectionScalar<Float>::raysBox(origins, inverseDirections, box, out, end, count);
+    }
+
+    private:
+        typedef Math::Implementation::SimdFloat4 SimdFloat4;
+
+        static SimdFloat4 simdTriangle(const SimdFloat4* const o, const SimdFloat4* const d, const SimdFloat4* const a, const SimdFloat4* const e1, const SimdFloat4* const e2) {
+            using namespace Math::Implementation;
+            const SimdFloat4 px = simdSub(simdMul(d[1], e2[2]), simdMul(d[2], e2[1]));
+            const SimdFloat4 py = simdSub(simdMul(d[2], e2[0]), simdMul(d[0], e2[2]));
+            const SimdFloat4 pz = simdSub(simdMul(d[0], e2[1]), simdMul(d[1], e2[0]));
+            const SimdFloat4 inverseDeterminant = simdDiv(simdSplat(1.0f), simdAdd(simdAdd(simdMul(e1[0], px), simdMul(e1[1], py)), simdMul(e1[2], pz)));
+
+            const SimdFloat4 sx = simdSub(o[0], a[0]);
+            const SimdFloat4 sy = simdSub(o[1], a[1]);
+            const SimdFloat4 sz = simdSub(o[2], a[2]);
+            const SimdFloat4 u = simdMul(simdAdd(simdAdd(simdMul(sx, px), simdMul(sy, py)), simdMul(sz, pz)), inverseDeterminant);
+
+            const SimdFloat4 qx = simdSub(simdMul(sy, e1[2]), simdMul(sz, e1[1]));
+            const SimdFloat4 qy = simdSub(simdMul(sz, e1[0]), simdMul(sx, e1[2]));
+            const SimdFloat4 qz = simdSub(simdMul(sx, e1[1]), simdMul(sy, e1[0]));
+            const SimdFloat4 v = simdMul(simdAdd(simdAdd(simdMul(d[0], qx), simdMul(d[1], qy)), simdMul(d[2], qz)), inverseDeterminant);
+            const SimdFloat4 t = simdMul(simdAdd(simdAdd(simdMul(e2[0], qx), simdMul(e2[1], qy)), simdMul(e2[2], qz)), inverseDeterminant);
+
+            const SimdFloat4 zero = simdSplat(0.0f);
+            const auto hit = simdAnd(simdAnd(simdGreaterEqual(u, zero), simdGreaterEqual(v, zero)),
+                                     simdAnd(simdLessEqual(simdAdd(u, v), simdSplat(1.0f)), simdGreaterEqual(t, zero)));
+            return simdSelect(hit, t, simdSplat(std::numeric_limits<Float>::infinity()));
+        }
+
+        static SimdFloat4 simdBox(const SimdFloat4* const o, const SimdFloat4* const inverseDirection, const SimdFloat4* const boxMin, const SimdFloat4* const boxMax) {
+            using namespace Math::Implementation;
+            SimdFloat4 tMin = simdSplat(0.0f);
+            SimdFloat4 tMax = simdSplat(std::numeric_limits<Float>::infinity());
+            for(std::size_t i = 0; i != 3; ++i) {
+                const SimdFloat4 t1 = simdMul(simdSub(boxMin[i], o[i]), inverseDirection[i]);
+                const SimdFloat4 t2 = simdMul(simdSub(boxMax[i], o[i]), inverseDirection[i]);
+                tMin = simdMax(simdMin(t1, t2), tMin);
+                tMax = simdMin(simdMax(t1, t2), tMax);
+            }
+            return simdSelect(simdLessEqual(tMin, tMax), tMin, simdSplat(std::numeric_limits<Float>::infinity()));
+        }
+};
+#endif
+
+}
+
 /** @brief Functions for computing intersections */
 class Intersection {
     public:
@@ -124,6 +319,193 @@ class Intersection {
             const T f = Vector3<T>::dot(planePosition, planeNormal);
             return (f-Vector3<T>::dot(planeNormal, p))/Vector3<T>::dot(planeNormal, r);
         }
+
+        /**
+         * @brief Intersection of a point and a frustum
+         * @param point     Point
+         * @param frustum   Frustum
+         * @return `true` if the point is on or inside the frustum, `false`
+         *      otherwise
+         *
+         * Checks for each plane of the frustum whether the point is on the
+         * side opposite to the normal.
+         */
+        template<class T> static bool pointFrustum(const Vector3<T>& point, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(Vector3<T>::dot(frustum[i].xyz(), point) + frustum[i].w() < T(0)) return false;
+            return true;
+        }
+
+        /**
+         * @brief Intersection of a sphere and a frustum
+         * @param center    Sphere center
+         * @param radius    Sphere radius
+         * @param frustum   Frustum
+         * @return `true` if the sphere intersects the frustum, `false`
+         *      otherwise
+         *
+         * Checks the sphere against each plane of the frustum. Large spheres
+         * near frustum edges and corners may be reported as intersecting
+         * even if they are outside, see @ref cullSpheres() for precise
+         * batch version.
+         */
+        template<class T> static bool sphereFrustum(const Vector3<T>& center, T radius, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(Vector3<T>::dot(frustum[i].xyz(), center) + frustum[i].w() < -radius) return false;
+            return true;
+        }
+
+        /**
+         * @brief Intersection of an axis-aligned box and a frustum
+         * @param box       Axis-aligned box
+         * @param frustum   Frustum
+         * @return `true` if the box intersects the frustum, `false`
+         *      otherwise
+         *
+         * For each plane of the frustum checks the corner of the box
+         * farthest in direction of plane normal. Large boxes near frustum
+         * edges and corners may be reported as intersecting even if they
+         * are outside, see @ref cullBoxes() for precise batch version.
+         */
+        template<class T> static bool boxFrustum(const Range3D<T>& box, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector4<T> plane = frustum[i];
+                const Vector3<T> corner{
+                    plane.x() >= T(0) ? box.max().x() : box.min().x(),
+                    plane.y() >= T(0) ? box.max().y() : box.min().y(),
+                    plane.z() >= T(0) ? box.max().z() : box.min().z()};
+                if(Vector3<T>::dot(plane.xyz(), corner) + plane.w() < T(0)) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief %Intersection of a ray and a triangle
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param a             First triangle vertex
+         * @param b             Second triangle vertex
+         * @param c             Third triangle vertex
+         * @return %Intersection point position `t` on the ray or infinity
+         *      if the ray doesn't hit the triangle. %Intersection point can
+         *      be then computed with `origin + t*direction`.
+         *
+         * Uses the Möller-Trumbore algorithm, which computes barycentric
+         * coordinates @f$ (u, v) @f$ of the intersection with the triangle
+         * plane using Cramer's rule. The ray hits the triangle if
+         * @f$ u \ge 0 @f$, @f$ v \ge 0 @f$, @f$ u + v \le 1 @f$ and
+         * @f$ t \ge 0 @f$. Both sides of the triangle are hit, rays parallel
+         * to the triangle plane are treated as not intersecting.
+         */
+        template<class T> static T rayTriangle(const Vector3<T>& origin, const Vector3<T>& direction, const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c) {
+            return Implementation::RayIntersectionScalar<T>::triangle(origin, direction, a, b - a, c - a);
+        }
+
+        /**
+         * @brief %Intersection of a ray and triangles
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param a             First vertices of the triangles
+         * @param b             Second vertices of the triangles
+         * @param c             Third vertices of the triangles
+         * @param out           Where to put intersection point positions
+         *
+         * Batch version of @ref rayTriangle(), with each triangle vertex in
+         * a separate array. All arrays have to have the same size. If built
+         * with @ref MAGNUM_BUILD_SIMD, @ref Float triangles are split into
+         * components and tested four at a time, the results are the same as
+         * with the single-triangle version.
+         */
+        template<class T> static void rayTriangle(const Vector3<T>& origin, const Vector3<T>& direction, Corrade::Containers::ArrayReference<const Vector3<T>> a, Corrade::Containers::ArrayReference<const Vector3<T>> b, Corrade::Containers::ArrayReference<const Vector3<T>> c, Corrade::Containers::ArrayReference<T> out) {
+            CORRADE_ASSERT(a.size() == b.size() && a.size() == c.size(),
+                "Math::Geometry::Intersection::rayTriangle(): expected vertex arrays of the same size, got" << a.size() << b.size() << "and" << c.size(), );
+            CORRADE_ASSERT(a.size() == out.size(),
+                "Math::Geometry::Intersection::rayTriangle(): expected output array of size" << a.size() << "but got" << out.size(), );
+            Implementation::RayIntersection<T>::triangles(origin, direction, a, b, c, out, 0, out.size());
+        }
+
+        /**
+         * @brief %Intersection of rays and a triangle
+         * @param origins       Ray origins
+         * @param directions    Ray directions
+         * @param a             First triangle vertex
+         * @param b             Second triangle vertex
+         * @param c             Third triangle vertex
+         * @param out           Where to put intersection point positions
+         *
+         * Batch version of @ref rayTriangle(). All arrays have to have the
+         * same size. If built with @ref MAGNUM_BUILD_SIMD, @ref Float rays are
+         * split into components and tested four at a time, the results are
+         * the same as with the single-ray version.
+         */
+        template<class T> static void rayTriangle(Corrade::Containers::ArrayReference<const Vector3<T>> origins, Corrade::Containers::ArrayReference<const Vector3<T>> directions, const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, Corrade::Containers::ArrayReference<T> out) {
+            CORRADE_ASSERT(origins.size() == directions.size(),
+                "Math::Geometry::Intersection::rayTriangle(): expected origin and direction arrays of the same size, got" << origins.size() << "and" << directions.size(), );
+            CORRADE_ASSERT(origins.size() == out.size(),
+                "Math::Geometry::Intersection::rayTriangle(): expected output array of size" << origins.size() << "but got" << out.size(), );
+            Implementation::RayIntersection<T>::raysTriangle(origins, directions, a, b, c, out, 0, out.size());
+        }
+
+        /**
+         * @brief %Intersection of a ray and an axis-aligned box
+         * @param origin            Ray origin
+         * @param inverseDirection  Inverted ray direction, i.e.
+         *      @f$ (\frac{1}{d_x}, \frac{1}{d_y}, \frac{1}{d_z}) @f$
+         * @param box               Axis-aligned box
+         * @return Position `t` of the point where the ray enters the box,
+         *      zero if the origin is inside the box or infinity if the ray
+         *      doesn't hit the box. The point can be then computed with
+         *      `origin + t*direction`.
+         *
+         * Uses the slab test, i.e. intersects the ray with pairs of planes
+         * bounding the box on each axis. The inverted direction is passed
+         * so it can be calculated once for many boxes. Zero direction
+         * components give infinite inverted components, which are handled
+         * correctly.
+         */
+        template<class T> static T rayBox(const Vector3<T>& origin, const Vector3<T>& inverseDirection, const Range3D<T>& box) {
+            return Implementation::RayIntersectionScalar<T>::box(origin, inverseDirection, box.min(), box.max());
+        }
+
+        /**
+         * @brief %Intersection of a ray and axis-aligned boxes
+         * @param origin            Ray origin
+         * @param inverseDirection  Inverted ray direction
+         * @param boxes             Axis-aligned boxes
+         * @param out               Where to put positions of points where
+         *      the ray enters the boxes
+         *
+         * Batch version of @ref rayBox(). The arrays have to have the same
+         * size. If built with @ref MAGNUM_BUILD_SIMD, @ref Float boxes are
+         * split into components and tested four at a time, the results are
+         * the same as with the single-box version.
+         */
+        template<class T> static void rayBox(const Vector3<T>& origin, const Vector3<T>& inverseDirection, Corrade::Containers::ArrayReference<const Range3D<T>> boxes, Corrade::Containers::ArrayReference<T> out) {
+            CORRADE_ASSERT(boxes.size() == out.size(),
+                "Math::Geometry::Intersection::rayBox(): expected output array of size" << boxes.size() << "but got" << out.size(), );
+            Implementation::RayIntersection<T>::boxes(origin, inverseDirection, boxes, out, 0, out.size());
+        }
+
+        /**
+         * @brief %Intersection of rays and an axis-aligned box
+         * @param origins           Ray origins
+         * @param inverseDirections Inverted ray directions
+         * @param box               Axis-aligned box
+         * @param out               Where to put positions of points where
+         *      the rays enter the box
+         *
+         * Batch version of @ref rayBox(). All arrays have to have the same
+         * size. If built with @ref MAGNUM_BUILD_SIMD, @ref Float rays are
+         * split into components and tested four at a time, the results are
+         * the same as with the single-ray version.
+         */
+        template<class T> static void rayBox(Corrade::Containers::ArrayReference<const Vector3<T>> origins, Corrade::Containers::ArrayReference<const Vector3<T>> inverseDirections, const Range3D<T>& box, Corrade::Containers::ArrayReference<T> out) {
+            CORRADE_ASSERT(origins.size() == inverseDirections.size(),
+                "Math::Geometry::Intersection::rayBox(): expected origin and direction arrays of the same size, got" << origins.size() << "and" << inverseDirections.size(), );
+            CORRADE_ASSERT(origins.size() == out.size(),
+                "Math::Geometry::Intersection::rayBox(): expected output array of size" << origins.size() << "but got" << out.size(), );
+            Implementation::RayIntersection<T>::raysBox(origins, inverseDirections, box, out, 0, out.size());
+        }
 };
 
 }}}
@@ -24,6 +24,8 @@
 */
 
 #include <limits>
+#include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Constants.h"
@@ -39,6 +41,12 @@ class DistanceTest: public Corrade::TestSuite::Tester {
         void linePoint3D();
         void lineSegmentPoint2D();
         void lineSegmentPoint3D();
+
+        template<class T> void linePointBatch();
+        template<class T> void lineSegmentPointBatch();
+        template<class T> void lineSegmentsPointBatch();
+        template<class T> void closestLineSegment();
+        void batchSizeMismatch();
 };
 
 typedef Math::Vector2<Float> Vector2;
@@ -46,10 +54,42 @@ typedef Math::Vector3<Float> Vector3;
 typedef Math::Constants<Float> Constants;
 
 DistanceTest::DistanceTest() {
-    addTests({&DistanceTest::linePoint2D,
-              &DistanceTest::linePoint3D,
-              &DistanceTest::lineSegmentPoint2D,
-              &DistanceTest::lineSegmentPoint3D});
+    addTests<DistanceTest>({&DistanceTest::linePoint2D,
+                            &DistanceTest::linePoint3D,
+                            &DistanceTest::lineSegmentPoint2D,
+                            &DistanceTest::lineSegmentPoint3D,
+
+                            &DistanceTest::linePointBatch<Float>,
+                            &DistanceTest::linePointBatch<Double>,
+                            &DistanceTest::lineSegmentPointBatch<Float>,
+                            &DistanceTest::lineSegmentPointBatch<Double>,
+                            &DistanceTest::lineSegmentsPointBatch<Float>,
+                            &DistanceTest::lineSegmentsPointBatch<Double>,
+                            &DistanceTest::closestLineSegment<Float>,
+                            &DistanceTest::closestLineSegment<Double>,
+                            &DistanceTest::batchSizeMismatch});
+}
+
+namespace {
+
+template<class T> Corrade::Containers::ArrayReference<const T> input(const std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+template<class T> Corrade::Containers::ArrayReference<T> output(std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+/* Points around the segments in the tests, covering all three cases of the
+   segment distance. The count isn't divisible by four to test also the
+   remainder after SIMD batches. */
+template<class T> std::vector<Math::Vector3<T>> points() {
+    std::vector<Math::Vector3<T>> out;
+    for(std::size_t i = 0; i != 23; ++i)
+        out.emplace_back(T((i*37) % 23)/T(5) - T(2), T((i*11) % 23)/T(7) - T(1.5), T((i*5) % 23)/T(9) - T(1));
+    return out;
+}
+
 }
 
 void DistanceTest::linePoint2D() {
@@ -158,6 +198,161 @@ void DistanceTest::lineSegmentPoint3D() {
                     Constants::sqrt2());
 }
 
+template<class T> void DistanceTest::linePointBatch() {
+    const Math::Vector3<T> a(T(0.5), T(-0.25), T(0.125));
+    const Math::Vector3<T> b(T(1.5), T(0.75), T(-1.0));
+    const std::vector<Math::Vector3<T>> points3D = points<T>();
+    std::vector<Math::Vector2<T>> points2D;
+    std::vector<T> x, y, z;
+    for(const Math::Vector3<T>& p: points3D) {
+        points2D.push_back(p.xy());
+        x.push_back(p.x());
+        y.push_back(p.y());
+        z.push_back(p.z());
+    }
+
+    std::vector<T> out2D(points3D.size()), out2DSoA(points3D.size()), out3D(points3D.size()), out3DSoA(points3D.size());
+    Distance::linePointSquared(a.xy(), b.xy(), input(points2D), output(out2D));
+    Distance::linePointSquared(a.xy(), b.xy(), input(x), input(y), output(out2DSoA));
+    Distance::linePointSquared(a, b, input(points3D), output(out3D));
+    Distance::linePointSquared(a, b, input(x), input(y), input(z), output(out3DSoA));
+
+    for(std::size_t i = 0; i != points3D.size(); ++i) {
+        CORRADE_COMPARE(out2D[i], Distance::linePointSquared(a.xy(), b.xy(), points2D[i]));
+        CORRADE_COMPARE(out2DSoA[i], out2D[i]);
+        CORRADE_COMPARE(out3D[i], Distance::linePointSquared(a, b, points3D[i]));
+        CORRADE_COMPARE(out3DSoA[i], out3D[i]);
+    }
+}
+
+template<class T> void DistanceTest::lineSegmentPointBatch() {
+    const Math::Vector3<T> a(T(-0.5), T(-0.25), T(0.125));
+    const Math::Vector3<T> b(T(1.0), T(0.75), T(-0.5));
+    const std::vector<Math::Vector3<T>> points3D = points<T>();
+    std::vector<Math::Vector2<T>> points2D;
+    std::vector<T> x, y, z;
+    for(const Math::Vector3<T>& p: points3D) {
+        points2D.push_back(p.xy());
+        x.push_back(p.x());
+        y.push_back(p.y());
+        z.push_back(p.z());
+    }
+
+    std::vector<T> out2D(points3D.size()), out2DSoA(points3D.size()), out3D(points3D.size()), out3DSoA(points3D.size());
+    Distance::lineSegmentPointSquared(a.xy(), b.xy(), input(points2D), output(out2D));
+    Distance::lineSegmentPointSquared(a.xy(), b.xy(), input(x), input(y), output(out2DSoA));
+    Distance::lineSegmentPointSquared(a, b, input(points3D), output(out3D));
+    Distance::lineSegmentPointSquared(a, b, input(x), input(y), input(z), output(out3DSoA));
+
+    /* Verify that the points are before A, after B and next to the segment */
+    std::size_t beforeA = 0, afterB = 0;
+    for(std::size_t i = 0; i != points3D.size(); ++i) {
+        CORRADE_COMPARE(out2D[i], Distance::lineSegmentPointSquared(a.xy(), b.xy(), points2D[i]));
+        CORRADE_COMPARE(out2DSoA[i], out2D[i]);
+        CORRADE_COMPARE(out3D[i], Distance::lineSegmentPointSquared(a, b, points3D[i]));
+        CORRADE_COMPARE(out3DSoA[i], out3D[i]);
+
+        if(out3D[i] == (points3D[i] - a).dot()) ++beforeA;
+        else if(out3D[i] == (points3D[i] - b).dot()) ++afterB;
+    }
+    CORRADE_VERIFY(beforeA > 0);
+    CORRADE_VERIFY(afterB > 0);
+    CORRADE_VERIFY(beforeA + afterB < points3D.size());
+}
+
+template<class T> void DistanceTest::lineSegmentsPointBatch() {
+    /* Polyline through the points */
+    const std::vector<Math::Vector3<T>> points3D = points<T>();
+    std::vector<Math::Vector3<T>> a3D(points3D.begin(), points3D.end() - 1), b3D(points3D.begin() + 1, points3D.end());
+    std::vector<Math::Vector2<T>> a2D, b2D;
+    for(std::size_t i = 0; i != a3D.size(); ++i) {
+        a2D.push_back(a3D[i].xy());
+        b2D.push_back(b3D[i].xy());
+    }
+
+    const Math::Vector3<T> point(T(0.25), T(-0.5), T(0.75));
+    std::vector<T> out2D(a3D.size()), out3D(a3D.size());
+    Distance::lineSegmentPointSquared(input(a2D), input(b2D), point.xy(), output(out2D));
+    Distance::lineSegmentPointSquared(input(a3D), input(b3D), point, output(out3D));
+
+    for(std::size_t i = 0; i != a3D.size(); ++i) {
+        CORRADE_COMPARE(out2D[i], Distance::lineSegmentPointSquared(a2D[i], b2D[i], point.xy()));
+        CORRADE_COMPARE(out3D[i], Distance::lineSegmentPointSquared(a3D[i], b3D[i], point));
+    }
+}
+
+template<class T> void DistanceTest::closestLineSegment() {
+    const std::vector<Math::Vector3<T>> points3D = points<T>();
+    std::vector<Math::Vector3<T>> a3D(points3D.begin(), points3D.end() - 1), b3D(points3D.begin() + 1, points3D.end());
+    std::vector<Math::Vector2<T>> a2D, b2D;
+    for(std::size_t i = 0; i != a3D.size(); ++i) {
+        a2D.push_back(a3D[i].xy());
+        b2D.push_back(b3D[i].xy());
+    }
+
+    /* Points on different segments, the last one in the scalar remainder */
+    for(const std::size_t segment: {std::size_t(2), std::size_t(9), std::size_t(21)}) {
+        const Math::Vector3<T> point = (a3D[segment] + b3D[segment])*T(0.5) + Math::Vector3<T>(T(0.0), T(0.0), T(0.001));
+
+        const std::pair<std::size_t, T> closest3D = Distance::closestLineSegment(input(a3D), input(b3D), point);
+        CORRADE_COMPARE(closest3D.first, segment);
+        CORRADE_COMPARE(closest3D.second, Distance::lineSegmentPointSquared(a3D[segment], b3D[segment], point));
+
+        const std::pair<std::size_t, T> closest2D = Distance::closestLineSegment(input(a2D), input(b2D), point.xy());
+        CORRADE_COMPARE(closest2D.second, Distance::lineSegmentPointSquared(a2D[closest2D.first], b2D[closest2D.first], point.xy()));
+        for(std::size_t i = 0; i != a2D.size(); ++i)
+            CORRADE_VERIFY(!(Distance::lineSegmentPointSquared(a2D[i], b2D[i], point.xy()) < closest2D.second));
+    }
+
+    /* The first of equally distant segments is returned, degenerate
+       segments are skipped */
+    const std::vector<Math::Vector2<T>> a{
+        {T(0.0), T(0.0)}, {T(0.0), T(-1.0)}, {T(5.0), T(5.0)},
+        {T(-1.0), T(1.0)}, {T(-1.0), T(-1.0)}};
+    const std::vector<Math::Vector2<T>> b{
+        {T(0.0), T(0.0)}, {T(1.0), T(-1.0)}, {T(6.0), T(6.0)},
+        {T(1.0), T(1.0)}, {T(1.0), T(-1.0)}};
+    CORRADE_COMPARE(Distance::closestLineSegment(input(a), input(b), Math::Vector2<T>{}),
+        std::make_pair(std::size_t(1), T(1.0)));
+
+    /* No segments */
+    CORRADE_COMPARE(Distance::closestLineSegment(input(std::vector<Math::Vector2<T>>{}), input(std::vector<Math::Vector2<T>>{}), Math::Vector2<T>{}),
+        std::make_pair(std::size_t(0), std::numeric_limits<T>::infinity()));
+}
+
+void DistanceTest::batchSizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const std::vector<Vector2> points(5);
+    const std::vector<Float> components(5);
+    const std::vector<Float> componentsShorter(4);
+    std::vector<Float> out(4);
+
+    Distance::linePointSquared({}, {}, input(points), output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Distance::linePointSquared(): expected output array of size 5 but got 4\n");
+
+    o.str({});
+    Distance::linePointSquared(Vector3{}, Vector3{}, input(components), input(components), input(componentsShorter), output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Distance::linePointSquared(): array sizes don't match\n");
+
+    o.str({});
+    Distance::lineSegmentPointSquared({}, {}, input(points), output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Distance::lineSegmentPointSquared(): expected output array of size 5 but got 4\n");
+
+    o.str({});
+    Distance::lineSegmentPointSquared(Vector2{}, Vector2{}, input(components), input(componentsShorter), output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Distance::lineSegmentPointSquared(): array sizes don't match\n");
+
+    o.str({});
+    Distance::lineSegmentPointSquared(input(points), input(points), {}, output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Distance::lineSegmentPointSquared(): array sizes don't match\n");
+
+    o.str({});
+    Distance::closestLineSegment(input(points), input(std::vector<Vector2>(4)), {});
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Distance::closestLineSegment(): array sizes don't match\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::DistanceTest)
@@ -24,6 +24,8 @@
 */
 
 #include <limits>
+#include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Geometry/Intersection.h"
@@ -36,14 +38,60 @@ class IntersectionTest: public Corrade::TestSuite::Tester {
 
         void planeLine();
         void lineLine();
+
+        void pointFrustum();
+        void sphereFrustum();
+        void boxFrustum();
+
+        void rayTriangle();
+        void rayTriangleBatch();
+        void raysTriangleBatch();
+        void rayBox();
+        void rayBoxBatch();
+        void raysBoxBatch();
+        void rayBatchSizeMismatch();
 };
 
 typedef Math::Vector2<Float> Vector2;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Range3D<Float> Range3D;
+typedef Math::Frustum<Float> Frustum;
 
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
-              &IntersectionTest::lineLine});
+              &IntersectionTest::lineLine,
+
+              &IntersectionTest::pointFrustum,
+              &IntersectionTest::sphereFrustum,
+              &IntersectionTest::boxFrustum,
+
+              &IntersectionTest::rayTriangle,
+              &IntersectionTest::rayTriangleBatch,
+              &IntersectionTest::raysTriangleBatch,
+              &IntersectionTest::rayBox,
+              &IntersectionTest::rayBoxBatch,
+              &IntersectionTest::raysBoxBatch,
+              &IntersectionTest::rayBatchSizeMismatch});
+}
+
+namespace {
+
+template<class T> Corrade::Containers::ArrayReference<const T> input(const std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+template<class T> Corrade::Containers::ArrayReference<T> output(std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+/* Generates values that aren't nice round numbers, with a hit or miss
+   depending on the index */
+Float value(const std::size_t i, const Float scale) {
+    return Float((i*7919) % 113)/113.0f*scale - scale*0.5f;
+}
+
 }
 
 void IntersectionTest::planeLine() {
@@ -99,6 +147,220 @@ void IntersectionTest::lineLine() {
         {0.0f, 0.0f}, {1.0f, 2.0f}), std::numeric_limits<Float>::infinity());
 }
 
+void IntersectionTest::pointFrustum() {
+    /* Box from -1 to 1 in X and Y, from -2 to -10 in Z */
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::orthographicProjection({2.0f, 2.0f}, 2.0f, 10.0f));
+
+    CORRADE_VERIFY(Intersection::pointFrustum({0.0f, 0.0f, -5.0f}, frustum));
+    CORRADE_VERIFY(Intersection::pointFrustum({1.0f, -1.0f, -2.0f}, frustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 0.0f, 0.0f}, frustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({1.5f, 0.0f, -5.0f}, frustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 0.0f, -11.0f}, frustum));
+}
+
+void IntersectionTest::sphereFrustum() {
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::orthographicProjection({2.0f, 2.0f}, 2.0f, 10.0f));
+
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, -5.0f}, 0.5f, frustum));
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, -5.0f}, 100.0f, frustum));
+    CORRADE_VERIFY(Intersection::sphereFrustum({1.5f, 0.0f, -5.0f}, 0.75f, frustum));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({1.5f, 0.0f, -5.0f}, 0.25f, frustum));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, 0.0f}, 1.5f, frustum));
+
+    /* Near the corner the plane test gives false positive */
+    CORRADE_VERIFY(Intersection::sphereFrustum({1.6f, 1.6f, -5.0f}, 0.7f, frustum));
+}
+
+void IntersectionTest::boxFrustum() {
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::orthographicProjection({2.0f, 2.0f}, 2.0f, 10.0f));
+
+    CORRADE_VERIFY(Intersection::boxFrustum({{-0.5f, -0.5f, -6.0f}, {0.5f, 0.5f, -4.0f}}, frustum));
+    CORRADE_VERIFY(Intersection::boxFrustum({{-50.0f, -50.0f, -60.0f}, {50.0f, 50.0f, 40.0f}}, frustum));
+    CORRADE_VERIFY(Intersection::boxFrustum({{0.5f, 0.5f, -1.0f}, {2.0f, 2.0f, 4.0f}}, frustum) == false);
+    CORRADE_VERIFY(Intersection::boxFrustum({{0.5f, 0.5f, -3.0f}, {2.0f, 2.0f, 4.0f}}, frustum));
+    CORRADE_VERIFY(!Intersection::boxFrustum({{1.5f, -0.5f, -6.0f}, {2.5f, 0.5f, -4.0f}}, frustum));
+}
+
+void IntersectionTest::rayTriangle() {
+    const Vector3 a(-1.0f, -1.0f, -5.0f);
+    const Vector3 b(1.0f, -1.0f, -5.0f);
+    const Vector3 c(-1.0f, 1.0f, -5.0f);
+    const Float infinity = std::numeric_limits<Float>::infinity();
+
+    /* Hit in the middle, from both sides */
+    CORRADE_COMPARE(Intersection::rayTriangle({-0.5f, -0.5f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), 5.0f);
+    CORRADE_COMPARE(Intersection::rayTriangle({-0.5f, -0.5f, -10.0f}, {0.0f, 0.0f, 2.0f}, a, b, c), 2.5f);
+
+    /* Hit on the edge and the vertex */
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), 5.0f);
+    CORRADE_COMPARE(Intersection::rayTriangle({-1.0f, -1.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), 5.0f);
+
+    /* Miss outside of the triangle */
+    CORRADE_COMPARE(Intersection::rayTriangle({0.5f, 0.5f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), infinity);
+    CORRADE_COMPARE(Intersection::rayTriangle({-1.5f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), infinity);
+
+    /* Triangle is behind the ray origin */
+    CORRADE_COMPARE(Intersection::rayTriangle({-0.5f, -0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}, a, b, c), infinity);
+
+    /* Ray is parallel to the triangle, both outside and in its plane */
+    CORRADE_COMPARE(Intersection::rayTriangle({-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f}, a, b, c), infinity);
+    CORRADE_COMPARE(Intersection::rayTriangle({-2.0f, -0.5f, -5.0f}, {1.0f, 0.0f, 0.0f}, a, b, c), infinity);
+}
+
+void IntersectionTest::rayTriangleBatch() {
+    /* 19 triangles to test also the remainder after SIMD batches */
+    std::vector<Vector3> a, b, c;
+    for(std::size_t i = 0; i != 19; ++i) {
+        a.emplace_back(value(i, 4.0f) - 1.0f, value(i + 1, 4.0f) - 1.0f, value(i + 2, 10.0f));
+        b.push_back(a.back() + Vector3{4.0f, value(i + 3, 1.0f), value(i + 4, 1.0f)});
+        c.push_back(a.back() + Vector3{value(i + 5, 1.0f), 4.0f, value(i + 6, 1.0f)});
+    }
+
+    const Vector3 origin(0.1f, -0.2f, 10.0f);
+    const Vector3 direction(0.05f, 0.02f, -1.0f);
+    std::vector<Float> out(19);
+    Intersection::rayTriangle(origin, direction, input(a), input(b), input(c), output(out));
+
+    std::size_t hits = 0;
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_COMPARE(out[i], Intersection::rayTriangle(origin, direction, a[i], b[i], c[i]));
+        if(out[i] != std::numeric_limits<Float>::infinity()) ++hits;
+    }
+
+    /* Verify that the data test both hits and misses */
+    CORRADE_VERIFY(hits > 0);
+    CORRADE_VERIFY(hits < out.size());
+}
+
+void IntersectionTest::raysTriangleBatch() {
+    const Vector3 a(-1.0f, -1.0f, -5.0f);
+    const Vector3 b(1.0f, -1.0f, -4.0f);
+    const Vector3 c(-1.0f, 1.0f, -6.0f);
+
+    std::vector<Vector3> origins, directions;
+    for(std::size_t i = 0; i != 18; ++i) {
+        origins.emplace_back(value(i, 3.0f), value(i + 1, 3.0f), value(i + 2, 2.0f));
+        directions.emplace_back(value(i + 3, 0.5f), value(i + 4, 0.5f), i % 5 ? -1.0f : 1.0f);
+    }
+
+    /* Parallel ray */
+    origins.emplace_back(-0.5f, -0.5f, 0.0f);
+    directions.emplace_back(1.0f, 0.0f, 0.5f);
+
+    std::vector<Float> out(19);
+    Intersection::rayTriangle(input(origins), input(directions), a, b, c, output(out));
+
+    std::size_t hits = 0;
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_COMPARE(out[i], Intersection::rayTriangle(origins[i], directions[i], a, b, c));
+        if(out[i] != std::numeric_limits<Float>::infinity()) ++hits;
+    }
+
+    CORRADE_VERIFY(hits > 0);
+    CORRADE_VERIFY(hits < out.size());
+    CORRADE_COMPARE(out.back(), std::numeric_limits<Float>::infinity());
+}
+
+void IntersectionTest::rayBox() {
+    const Range3D box({-1.0f, -1.0f, -6.0f}, {1.0f, 1.0f, -4.0f});
+    const Float infinity = std::numeric_limits<Float>::infinity();
+
+    /* Hit from the front and from the side */
+    CORRADE_COMPARE(Intersection::rayBox({0.0f, 0.0f, 0.0f}, {infinity, infinity, -1.0f}, box), 4.0f);
+    CORRADE_COMPARE(Intersection::rayBox({-5.0f, 0.5f, -5.0f}, {0.5f, infinity, infinity}, box), 2.0f);
+
+    /* Origin inside the box */
+    CORRADE_COMPARE(Intersection::rayBox({0.0f, 0.0f, -5.0f}, {1.0f, 1.0f, 1.0f}, box), 0.0f);
+
+    /* Hit on the edge */
+    CORRADE_COMPARE(Intersection::rayBox({1.0f, 0.0f, 0.0f}, {infinity, infinity, -1.0f}, box), 4.0f);
+
+    /* Miss next to the box and box behind the origin */
+    CORRADE_COMPARE(Intersection::rayBox({1.5f, 0.0f, 0.0f}, {infinity, infinity, -1.0f}, box), infinity);
+    CORRADE_COMPARE(Intersection::rayBox({0.0f, 0.0f, 0.0f}, {infinity, infinity, 1.0f}, box), infinity);
+
+    /* Diagonal ray missing the box corner */
+    CORRADE_COMPARE(Intersection::rayBox({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, -1.0f}, box), infinity);
+}
+
+void IntersectionTest::rayBoxBatch() {
+    std::vector<Range3D> boxes;
+    for(std::size_t i = 0; i != 21; ++i) {
+        const Vector3 min(value(i, 4.0f) - 1.0f, value(i + 1, 4.0f) - 1.0f, value(i + 2, 4.0f) - 5.0f);
+        boxes.emplace_back(min, min + Vector3{value(i + 3, 1.0f) + 2.0f});
+    }
+
+    const Vector3 origin(0.1f, 0.2f, 0.0f);
+    const Vector3 inverseDirection = Vector3{1.0f}/Vector3{0.1f, -0.2f, -1.0f};
+    std::vector<Float> out(21);
+    Intersection::rayBox(origin, inverseDirection, input(boxes), output(out));
+
+    std::size_t hits = 0;
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_COMPARE(out[i], Intersection::rayBox(origin, inverseDirection, boxes[i]));
+        if(out[i] != std::numeric_limits<Float>::infinity()) ++hits;
+    }
+
+    CORRADE_VERIFY(hits > 0);
+    CORRADE_VERIFY(hits < out.size());
+}
+
+void IntersectionTest::raysBoxBatch() {
+    const Range3D box({-1.0f, -1.0f, -6.0f}, {1.0f, 1.0f, -4.0f});
+
+    std::vector<Vector3> origins, inverseDirections;
+    for(std::size_t i = 0; i != 17; ++i) {
+        origins.emplace_back(value(i, 4.0f), value(i + 1, 4.0f), value(i + 2, 4.0f));
+        inverseDirections.push_back(Vector3{1.0f}/Vector3{value(i + 3, 0.5f), value(i + 4, 0.5f), -1.0f});
+    }
+
+    /* Axis-aligned ray with infinite inverted components */
+    origins.emplace_back(0.5f, 0.5f, 0.0f);
+    inverseDirections.emplace_back(std::numeric_limits<Float>::infinity(), -std::numeric_limits<Float>::infinity(), -1.0f);
+
+    std::vector<Float> out(18);
+    Intersection::rayBox(input(origins), input(inverseDirections), box, output(out));
+
+    std::size_t hits = 0;
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_COMPARE(out[i], Intersection::rayBox(origins[i], inverseDirections[i], box));
+        if(out[i] != std::numeric_limits<Float>::infinity()) ++hits;
+    }
+
+    CORRADE_VERIFY(hits > 0);
+    CORRADE_VERIFY(hits < out.size());
+    CORRADE_COMPARE(out.back(), 4.0f);
+}
+
+void IntersectionTest::rayBatchSizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const std::vector<Vector3> vectors(5);
+    const std::vector<Vector3> vectorsShorter(4);
+    const std::vector<Range3D> boxes(5);
+    std::vector<Float> out(4);
+
+    Intersection::rayTriangle({}, {}, input(vectors), input(vectors), input(vectorsShorter), output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Intersection::rayTriangle(): expected vertex arrays of the same size, got 5 5 and 4\n");
+
+    o.str({});
+    Intersection::rayTriangle({}, {}, input(vectors), input(vectors), input(vectors), output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Intersection::rayTriangle(): expected output array of size 5 but got 4\n");
+
+    o.str({});
+    Intersection::rayTriangle(input(vectors), input(vectorsShorter), {}, {}, {}, output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Intersection::rayTriangle(): expected origin and direction arrays of the same size, got 5 and 4\n");
+
+    o.str({});
+    Intersection::rayBox({}, {}, input(boxes), output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Intersection::rayBox(): expected output array of size 5 but got 4\n");
+
+    o.str({});
+    Intersection::rayBox(input(vectors), input(vectors), {}, output(out));
+    CORRADE_COMPARE(o.str(), "Math::Geometry::Intersection::rayBox(): expected output array of size 5 but got 4\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionTest)
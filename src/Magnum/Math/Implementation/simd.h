@@ -0,0 +1,390 @@
+#ifndef Magnum_Math_Implementation_simd_h
+#define Magnum_Math_Implementation_simd_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/configure.h"
+#include "Magnum/Types.h"
+
+/* SIMD specializations are opt-in, enabled with MAGNUM_BUILD_SIMD and only
+   if the target instruction set is enabled in the compiler. AVX builds use
+   the same code, the compiler just emits VEX-encoded instructions. */
+#ifdef MAGNUM_BUILD_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGNUM_MATH_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MAGNUM_MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(MAGNUM_MATH_SIMD_SSE2) || defined(MAGNUM_MATH_SIMD_NEON)
+#define MAGNUM_MATH_SIMD
+#endif
+
+#ifdef MAGNUM_MATH_SIMD
+namespace Magnum { namespace Math { namespace Implementation {
+
+/* All functions operate on column-major 4x4 matrices and four-component
+   vectors, unaligned */
+
+#ifdef MAGNUM_MATH_SIMD_SSE2
+/* Four-wide primitives for batch kernels, which are then written only once
+   for both SSE2 and NEON */
+typedef __m128 SimdFloat4;
+
+inline SimdFloat4 simdLoad(const Float* const data) { return _mm_loadu_ps(data); }
+inline void simdStore(Float* const data, const SimdFloat4 a) { _mm_storeu_ps(data, a); }
+inline SimdFloat4 simdSplat(const Float value) { return _mm_set1_ps(value); }
+inline SimdFloat4 simdAdd(const SimdFloat4 a, const SimdFloat4 b) { return _mm_add_ps(a, b); }
+inline SimdFloat4 simdSub(const SimdFloat4 a, const SimdFloat4 b) { return _mm_sub_ps(a, b); }
+inline SimdFloat4 simdMul(const SimdFloat4 a, const SimdFloat4 b) { return _mm_mul_ps(a, b); }
+inline SimdFloat4 simdDiv(const SimdFloat4 a, const SimdFloat4 b) { return _mm_div_ps(a, b); }
+
+/* Same as `a < b ? a : b` and `a > b ? a : b` in scalar code, i.e. the
+   second argument is returned if any of them is NaN */
+inline SimdFloat4 simdMin(const SimdFloat4 a, const SimdFloat4 b) { return _mm_min_ps(a, b); }
+inline SimdFloat4 simdMax(const SimdFloat4 a, const SimdFloat4 b) { return _mm_max_ps(a, b); }
+
+/* Comparison masks and selection based on them */
+typedef __m128 SimdMask4;
+inline SimdMask4 simdLess(const SimdFloat4 a, const SimdFloat4 b) { return _mm_cmplt_ps(a, b); }
+inline SimdMask4 simdLessEqual(const SimdFloat4 a, const SimdFloat4 b) { return _mm_cmple_ps(a, b); }
+inline SimdMask4 simdGreater(const SimdFloat4 a, const SimdFloat4 b) { return _mm_cmpgt_ps(a, b); }
+inline SimdMask4 simdGreaterEqual(const SimdFloat4 a, const SimdFloat4 b) { return _mm_cmpge_ps(a, b); }
+inline SimdMask4 simdAnd(const SimdMask4 a, const SimdMask4 b) { return _mm_and_ps(a, b); }
+inline SimdFloat4 simdSelect(const SimdMask4 mask, const SimdFloat4 a, const SimdFloat4 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/* Bits of the mask in the lowest four bits */
+inline UnsignedInt simdMaskBits(const SimdMask4 a) { return _mm_movemask_ps(a); }
+
+/* Sign bits of all four components in the lowest four bits */
+inline UnsignedInt simdSignMask(const SimdFloat4 a) { return _mm_movemask_ps(a); }
+
+/* Even components of both inputs in the first output, odd in the second */
+inline void simdDeinterleave(const SimdFloat4 a, const SimdFloat4 b, SimdFloat4& even, SimdFloat4& odd) {
+    even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    odd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+/* Loads four two-component vectors and splits them into components */
+inline void simdLoadInterleaved2(const Float* const data, SimdFloat4& x, SimdFloat4& y) {
+    const __m128 a = _mm_loadu_ps(data + 0);
+    const __m128 b = _mm_loadu_ps(data + 4);
+    x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+inline void simdStoreInterleaved2(Float* const data, const SimdFloat4 x, const SimdFloat4 y) {
+    _mm_storeu_ps(data + 0, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(data + 4, _mm_unpackhi_ps(x, y));
+}
+
+/* Loads four four-component vectors and splits them into components */
+inline void simdLoadInterleaved4(const Float* const data, SimdFloat4& x, SimdFloat4& y, SimdFloat4& z, SimdFloat4& w) {
+    __m128 a = _mm_loadu_ps(data + 0);
+    __m128 b = _mm_loadu_ps(data + 4);
+    __m128 c = _mm_loadu_ps(data + 8);
+    __m128 d = _mm_loadu_ps(data + 12);
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    x = a;
+    y = b;
+    z = c;
+    w = d;
+}
+
+/* Loads four three-component vectors and splits them into components */
+inline void simdLoadInterleaved3(const Float* const data, SimdFloat4& x, SimdFloat4& y, SimdFloat4& z) {
+    const __m128 a = _mm_loadu_ps(data + 0); /* x0 y0 z0 x1 */
+    const __m128 b = _mm_loadu_ps(data + 4); /* y1 z1 x2 y2 */
+    const __m128 c = _mm_loadu_ps(data + 8); /* z2 x3 y3 z3 */
+    x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+inline void simdStoreInterleaved3(Float* const data, const SimdFloat4 x, const SimdFloat4 y, const SimdFloat4 z) {
+    _mm_storeu_ps(data + 0, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(data + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(data + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+/* Product of 4x4 matrix with `count` columns of the other matrix */
+inline void simdMultiply(const Float* const a, const Float* const b, Float* const out, const std::size_t count) {
+    const __m128 a0 = _mm_loadu_ps(a + 0);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+    /* The components are broadcast directly from memory instead of loading
+       the whole column and shuffling it, as the column is often just written
+       component-wise and the wide load would stall on store forwarding */
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float* const col = b + i*4;
+        const __m128 result = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(col[0])),
+                       _mm_mul_ps(a1, _mm_set1_ps(col[1]))),
+            _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(col[2])),
+                       _mm_mul_ps(a3, _mm_set1_ps(col[3]))));
+        _mm_storeu_ps(out + i*4, result);
+    }
+}
+
+inline Float simdDot(const Float* const a, const Float* const b) {
+    const __m128 product = _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b));
+    const __m128 pairs = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+/* Computed the same way as the scalar code, so the results are the same */
+inline void simdLerp(const Float* const a, const Float* const b, const Float t, Float* const out) {
+    _mm_storeu_ps(out, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(1.0f - t), _mm_loadu_ps(a)),
+                                  _mm_mul_ps(_mm_set1_ps(t), _mm_loadu_ps(b))));
+}
+
+/* Inverse of rigid transformation, the rotation part is transposed and the
+   translation is rotated by it and negated */
+inline void simdInvertRigid(const Float* const m, Float* const out) {
+    __m128 c0 = _mm_loadu_ps(m + 0);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    const __m128 t = _mm_loadu_ps(m + 12);
+    const __m128 translation = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0))),
+                   _mm_mul_ps(c1, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)))),
+                   _mm_mul_ps(c2, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2))));
+
+    _mm_storeu_ps(out + 0, c0);
+    _mm_storeu_ps(out + 4, c1);
+    _mm_storeu_ps(out + 8, c2);
+    _mm_storeu_ps(out + 12, _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation));
+}
+
+/* 2x2 matrices stored in one register as (m00, m01, m10, m11). Product,
+   adjugate times matrix and matrix times adjugate. */
+inline __m128 simdMultiply2x2(const __m128 a, const __m128 b) {
+    return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+inline __m128 simdAdjugateMultiply2x2(const __m128 a, const __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+inline __m128 simdMultiplyAdjugate2x2(const __m128 a, const __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+/* General inverse using 2x2 blocks. Inverse of transposed matrix is
+   transposed inverse, so the block formulas work on columns the same way as
+   on rows. */
+inline void simdInvert(const Float* const m, Float* const out) {
+    const __m128 c0 = _mm_loadu_ps(m + 0);
+    const __m128 c1 = _mm_loadu_ps(m + 4);
+    const __m128 c2 = _mm_loadu_ps(m + 8);
+    const __m128 c3 = _mm_loadu_ps(m + 12);
+
+    const __m128 a = _mm_movelh_ps(c0, c1);
+    const __m128 b = _mm_movehl_ps(c1, c0);
+    const __m128 c = _mm_movelh_ps(c2, c3);
+    const __m128 d = _mm_movehl_ps(c3, c2);
+
+    /* Determinants of the blocks as (|A|, |B|, |C|, |D|) */
+    const __m128 determinants = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(3, 1, 3, 1))),
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(c1, c3, _MM_SHUFFLE(2, 0, 2, 0))));
+    const __m128 detA = _mm_shuffle_ps(determinants, determinants, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 detB = _mm_shuffle_ps(determinants, determinants, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 detC = _mm_shuffle_ps(determinants, determinants, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 detD = _mm_shuffle_ps(determinants, determinants, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m128 dc = simdAdjugateMultiply2x2(d, c);
+    const __m128 ab = simdAdjugateMultiply2x2(a, b);
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), simdMultiply2x2(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), simdMultiply2x2(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), simdMultiplyAdjugate2x2(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), simdMultiplyAdjugate2x2(a, dc));
+
+    /* |M| = |A||D| + |B||C| - tr((A#B)(D#C)) */
+    __m128 trace = _mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 1, 2, 0)));
+    trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+    trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+    const __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+    const __m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+    x = _mm_mul_ps(x, inverseDeterminant);
+    y = _mm_mul_ps(y, inverseDeterminant);
+    z = _mm_mul_ps(z, inverseDeterminant);
+    w = _mm_mul_ps(w, inverseDeterminant);
+
+    /* Adjugate of the blocks combined with the store shuffle */
+    _mm_storeu_ps(out + 0, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(out + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(out + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(out + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+}
+#endif
+
+#ifdef MAGNUM_MATH_SIMD_NEON
+typedef float32x4_t SimdFloat4;
+
+inline SimdFloat4 simdLoad(const Float* const data) { return vld1q_f32(data); }
+inline void simdStore(Float* const data, const SimdFloat4 a) { vst1q_f32(data, a); }
+inline SimdFloat4 simdSplat(const Float value) { return vdupq_n_f32(value); }
+inline SimdFloat4 simdAdd(const SimdFloat4 a, const SimdFloat4 b) { return vaddq_f32(a, b); }
+inline SimdFloat4 simdSub(const SimdFloat4 a, const SimdFloat4 b) { return vsubq_f32(a, b); }
+inline SimdFloat4 simdMul(const SimdFloat4 a, const SimdFloat4 b) { return vmulq_f32(a, b); }
+#ifdef __aarch64__
+inline SimdFloat4 simdDiv(const SimdFloat4 a, const SimdFloat4 b) { return vdivq_f32(a, b); }
+#else
+/* ARMv7 NEON has only reciprocal estimate, which is not exact */
+inline SimdFloat4 simdDiv(const SimdFloat4 a, const SimdFloat4 b) {
+    float32x4_t out = a;
+    out = vsetq_lane_f32(vgetq_lane_f32(a, 0)/vgetq_lane_f32(b, 0), out, 0);
+    out = vsetq_lane_f32(vgetq_lane_f32(a, 1)/vgetq_lane_f32(b, 1), out, 1);
+    out = vsetq_lane_f32(vgetq_lane_f32(a, 2)/vgetq_lane_f32(b, 2), out, 2);
+    out = vsetq_lane_f32(vgetq_lane_f32(a, 3)/vgetq_lane_f32(b, 3), out, 3);
+    return out;
+}
+#endif
+
+/* vminq_f32() and vmaxq_f32() propagate NaNs, these have the same semantics
+   as the SSE2 instructions and the scalar code instead */
+inline SimdFloat4 simdMin(const SimdFloat4 a, const SimdFloat4 b) { return vbslq_f32(vcltq_f32(a, b), a, b); }
+inline SimdFloat4 simdMax(const SimdFloat4 a, const SimdFloat4 b) { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+
+typedef uint32x4_t SimdMask4;
+inline SimdMask4 simdLess(const SimdFloat4 a, const SimdFloat4 b) { return vcltq_f32(a, b); }
+inline SimdMask4 simdLessEqual(const SimdFloat4 a, const SimdFloat4 b) { return vcleq_f32(a, b); }
+inline SimdMask4 simdGreater(const SimdFloat4 a, const SimdFloat4 b) { return vcgtq_f32(a, b); }
+inline SimdMask4 simdGreaterEqual(const SimdFloat4 a, const SimdFloat4 b) { return vcgeq_f32(a, b); }
+inline SimdMask4 simdAnd(const SimdMask4 a, const SimdMask4 b) { return vandq_u32(a, b); }
+inline SimdFloat4 simdSelect(const SimdMask4 mask, const SimdFloat4 a, const SimdFloat4 b) { return vbslq_f32(mask, a, b); }
+
+inline UnsignedInt simdSignMask(const SimdFloat4 a) {
+    const int32_t shifts[]{0, 1, 2, 3};
+    const uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(a), 31), vld1q_s32(shifts));
+    return vgetq_lane_u32(bits, 0)|vgetq_lane_u32(bits, 1)|vgetq_lane_u32(bits, 2)|vgetq_lane_u32(bits, 3);
+}
+
+/* Mask components have all bits set, so the sign bit is enough */
+inline UnsignedInt simdMaskBits(const SimdMask4 a) { return simdSignMask(vreinterpretq_f32_u32(a)); }
+
+inline void simdDeinterleave(const SimdFloat4 a, const SimdFloat4 b, SimdFloat4& even, SimdFloat4& odd) {
+    const float32x4x2_t v = vuzpq_f32(a, b);
+    even = v.val[0];
+    odd = v.val[1];
+}
+
+inline void simdLoadInterleaved2(const Float* const data, SimdFloat4& x, SimdFloat4& y) {
+    const float32x4x2_t v = vld2q_f32(data);
+    x = v.val[0];
+    y = v.val[1];
+}
+
+inline void simdStoreInterleaved2(Float* const data, const SimdFloat4 x, const SimdFloat4 y) {
+    float32x4x2_t v;
+    v.val[0] = x;
+    v.val[1] = y;
+    vst2q_f32(data, v);
+}
+
+inline void simdLoadInterleaved4(const Float* const data, SimdFloat4& x, SimdFloat4& y, SimdFloat4& z, SimdFloat4& w) {
+    const float32x4x4_t v = vld4q_f32(data);
+    x = v.val[0];
+    y = v.val[1];
+    z = v.val[2];
+    w = v.val[3];
+}
+
+inline void simdLoadInterleaved3(const Float* const data, SimdFloat4& x, SimdFloat4& y, SimdFloat4& z) {
+    const float32x4x3_t v = vld3q_f32(data);
+    x = v.val[0];
+    y = v.val[1];
+    z = v.val[2];
+}
+
+inline void simdStoreInterleaved3(Float* const data, const SimdFloat4 x, const SimdFloat4 y, const SimdFloat4 z) {
+    float32x4x3_t v;
+    v.val[0] = x;
+    v.val[1] = y;
+    v.val[2] = z;
+    vst3q_f32(data, v);
+}
+
+inline void simdMultiply(const Float* const a, const Float* const b, Float* const out, const std::size_t count) {
+    const float32x4_t a0 = vld1q_f32(a + 0);
+    const float32x4_t a1 = vld1q_f32(a + 4);
+    const float32x4_t a2 = vld1q_f32(a + 8);
+    const float32x4_t a3 = vld1q_f32(a + 12);
+    for(std::size_t i = 0; i != count; ++i) {
+        const float32x4_t col = vld1q_f32(b + i*4);
+        float32x4_t result = vmulq_lane_f32(a0, vget_low_f32(col), 0);
+        result = vmlaq_lane_f32(result, a1, vget_low_f32(col), 1);
+        result = vmlaq_lane_f32(result, a2, vget_high_f32(col), 0);
+        result = vmlaq_lane_f32(result, a3, vget_high_f32(col), 1);
+        vst1q_f32(out + i*4, result);
+    }
+}
+
+inline Float simdDot(const Float* const a, const Float* const b) {
+    const float32x4_t product = vmulq_f32(vld1q_f32(a), vld1q_f32(b));
+    const float32x2_t pairs = vadd_f32(vget_low_f32(product), vget_high_f32(product));
+    return vget_lane_f32(vpadd_f32(pairs, pairs), 0);
+}
+
+inline void simdLerp(const Float* const a, const Float* const b, const Float t, Float* const out) {
+    vst1q_f32(out, vaddq_f32(vmulq_n_f32(vld1q_f32(a), 1.0f - t), vmulq_n_f32(vld1q_f32(b), t)));
+}
+
+inline void simdInvertRigid(const Float* const m, Float* const out) {
+    /* Transpose the upper 3x3 part via 4x4 transpose with zero last row */
+    const float32x4x2_t t01 = vtrnq_f32(vld1q_f32(m + 0), vld1q_f32(m + 4));
+    const float32x4x2_t t23 = vtrnq_f32(vld1q_f32(m + 8), vdupq_n_f32(0.0f));
+    const float32x4_t c0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    const float32x4_t c1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    const float32x4_t c2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+
+    const float32x4_t t = vld1q_f32(m + 12);
+    float32x4_t translation = vmulq_lane_f32(c0, vget_low_f32(t), 0);
+    translation = vmlaq_lane_f32(translation, c1, vget_low_f32(t), 1);
+    translation = vmlaq_lane_f32(translation, c2, vget_high_f32(t), 0);
+
+    vst1q_f32(out + 0, c0);
+    vst1q_f32(out + 4, c1);
+    vst1q_f32(out + 8, c2);
+    vst1q_f32(out + 12, vsetq_lane_f32(1.0f, vnegq_f32(translation), 3));
+}
+#endif
+
+}}}
+#endif
+
+#endif
@@ -45,6 +45,8 @@ template<class> class Dual;
 template<class> class DualComplex;
 template<class> class DualQuaternion;
 
+template<class> class Frustum;
+
 template<std::size_t, class> class Matrix;
 #ifndef CORRADE_GCC46_COMPATIBILITY
 template<class T> using Matrix2x2 = Matrix<2, T>;
@@ -324,6 +324,14 @@ template<std::size_t size, class T> Matrix<size, T> Matrix<size, T>::inverted()
     return out;
 }
 
+#ifdef MAGNUM_MATH_SIMD_SSE2
+template<> inline Matrix<4, Float> Matrix<4, Float>::inverted() const {
+    Matrix<4, Float> out(Zero);
+    Implementation::simdInvert(data(), out.data());
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
@@ -485,6 +485,17 @@ template<class T> Matrix4<T> Matrix4<T>::invertedRigid() const {
     return from(inverseRotation, inverseRotation*-translation());
 }
 
+#ifdef MAGNUM_MATH_SIMD
+template<> inline Matrix4<Float> Matrix4<Float>::invertedRigid() const {
+    CORRADE_ASSERT(isRigidTransformation(),
+        "Math::Matrix4::invertedRigid(): the matrix doesn't represent rigid transformation", {});
+
+    Matrix4<Float> out;
+    Implementation::simdInvertRigid(data(), out.data());
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
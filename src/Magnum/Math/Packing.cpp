@@ -0,0 +1,468 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Packing.h"
+
+#include <cstring>
+#include <limits>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Implementation/simd.h"
+
+#if defined(MAGNUM_MATH_SIMD_SSE2) && defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+UnsignedShort packHalf(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+    const UnsignedShort sign = (bits >> 16) & 0x8000;
+    const Int exponent = Int((bits >> 23) & 0xff) - 127 + 15;
+    UnsignedInt mantissa = bits & 0x7fffff;
+
+    /* Infinity and NaN, NaN is made quiet and keeps upper bits of the
+       payload */
+    if(((bits >> 23) & 0xff) == 0xff)
+        return sign|0x7c00|(mantissa ? 0x200|(mantissa >> 13) : 0);
+
+    /* Overflow */
+    if(exponent >= 31) return sign|0x7c00;
+
+    /* Denormals or underflow to zero */
+    if(exponent <= 0) {
+        const Int shift = 14 - exponent;
+        if(shift > 24) return sign;
+        mantissa |= 0x800000;
+        UnsignedInt half = mantissa >> shift;
+        const UnsignedInt remainder = mantissa & ((1u << shift) - 1);
+        const UnsignedInt halfway = 1u << (shift - 1);
+        if(remainder > halfway || (remainder == halfway && (half & 1))) ++half;
+        return sign|half;
+    }
+
+    /* Normal numbers, rounding carry propagates correctly into exponent */
+    UnsignedInt half = (UnsignedInt(exponent) << 10)|(mantissa >> 13);
+    const UnsignedInt remainder = mantissa & 0x1fff;
+    if(remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) ++half;
+    return sign|half;
+}
+
+Float unpackHalf(const UnsignedShort value) {
+    const UnsignedInt sign = UnsignedInt(value & 0x8000) << 16;
+    const UnsignedInt exponent = (value >> 10) & 0x1f;
+    const UnsignedInt mantissa = value & 0x3ff;
+
+    /* Denormals */
+    if(!exponent) {
+        const Float result = mantissa*(1.0f/16777216.0f);
+        return sign ? -result : result;
+    }
+
+    const UnsignedInt bits = exponent == 31 ?
+        sign|0x7f800000|(mantissa ? 0x400000|(mantissa << 13) : 0) :
+        sign|((exponent + 112) << 23)|(mantissa << 13);
+    Float result;
+    std::memcpy(&result, &bits, 4);
+    return result;
+}
+
+namespace {
+
+/* Scalar kernels, processing the elements which don't fill a whole SIMD
+   batch or everything if SIMD is not available. Out-of-range values are
+   saturated the same way as in the SIMD code. */
+template<class Integral> void normalizeScalar(const Integral* const input, Float* const output, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i < end; ++i)
+        output[i] = normalize<Float, Integral>(input[i]);
+}
+
+template<class Integral> void denormalizeScalar(const Float* const input, Integral* const output, const std::size_t begin, const std::size_t end) {
+    constexpr Float min = std::numeric_limits<Integral>::min();
+    constexpr Float max = std::numeric_limits<Integral>::max();
+    for(std::size_t i = begin; i < end; ++i)
+        output[i] = Integral(clamp(input[i]*max, min, max));
+}
+
+#ifdef MAGNUM_MATH_SIMD_SSE2
+inline __m128i sse2Select(const __m128i mask, const __m128i a, const __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/* Packs 32-bit integers in range [0, 65535] into 16-bit ones, SSE2 has only
+   signed saturating pack */
+inline __m128i sse2PackUnsigned(const __m128i a, const __m128i b) {
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+                           _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+}
+
+#ifndef __F16C__
+/* Same as the scalar packHalf(), but with integer arithmetic. Denormals are
+   rounded by adding 0.5, which has the same precision as half-float
+   denormals, so the FPU does the rounding to nearest even. */
+__m128i sse2PackHalf(const __m128 value) {
+    const __m128i bits = _mm_castps_si128(value);
+    const __m128i f = _mm_and_si128(bits, _mm_set1_epi32(0x7fffffff));
+    const __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+
+    /* Rebias the exponent, round mantissa to nearest even */
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(1));
+    const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(f, _mm_set1_epi32(Int(0xc8000fff))), odd), 13);
+
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(0x3f000000));
+    const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(f), magic)), _mm_castps_si128(magic));
+
+    const __m128i nan = _mm_or_si128(_mm_set1_epi32(0x7e00), _mm_and_si128(_mm_srli_epi32(f, 13), _mm_set1_epi32(0x3ff)));
+    const __m128i infinityOrNan = sse2Select(_mm_cmpgt_epi32(f, _mm_set1_epi32(0x7f800000)), nan, _mm_set1_epi32(0x7c00));
+
+    return _mm_or_si128(sign,
+        sse2Select(_mm_cmpgt_epi32(f, _mm_set1_epi32(0x477fffff)), infinityOrNan,
+        sse2Select(_mm_cmplt_epi32(f, _mm_set1_epi32(0x38800000)), denormal, normal)));
+}
+
+/* Same as the scalar unpackHalf(). Denormals are converted by constructing a
+   float with the same mantissa and exponent of the smallest normal half-float
+   and subtracting it, which is exact. */
+__m128 sse2UnpackHalf(const __m128i value) {
+    const __m128i shifted = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x7fff)), 13);
+    const __m128i exponent = _mm_and_si128(shifted, _mm_set1_epi32(0x0f800000));
+    __m128i out = _mm_add_epi32(shifted, _mm_set1_epi32(112 << 23));
+
+    /* Infinity and NaN, NaN is made quiet */
+    out = _mm_add_epi32(out, _mm_and_si128(_mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x0f800000)), _mm_set1_epi32(112 << 23)));
+    out = _mm_or_si128(out, _mm_and_si128(_mm_cmpgt_epi32(shifted, _mm_set1_epi32(0x0f800000)), _mm_set1_epi32(0x400000)));
+
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+    const __m128i denormal = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(out, _mm_set1_epi32(1 << 23))), magic));
+    out = sse2Select(_mm_cmpeq_epi32(exponent, _mm_setzero_si128()), denormal, out);
+
+    return _mm_castsi128_ps(_mm_or_si128(out, _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x8000)), 16)));
+}
+#endif
+
+/* Scales and clamps eight floats to range of the integral type and converts
+   them to 32-bit integers with truncation */
+inline void sse2Denormalize(const Float* const input, const Float min, const Float max, __m128i& a, __m128i& b) {
+    const __m128 scale = _mm_set1_ps(max);
+    const __m128 lower = _mm_set1_ps(min);
+    a = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(input + 0), scale), lower), scale));
+    b = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(input + 4), scale), lower), scale));
+}
+
+/* Converts eight 32-bit integers to floats and divides them by the maximum
+   of the integral type, the same as in the scalar normalize() */
+inline void sse2Normalize(const __m128i a, const __m128i b, const Float max, const bool isSigned, Float* const output) {
+    const __m128 scale = _mm_set1_ps(max);
+    __m128 outA = _mm_div_ps(_mm_cvtepi32_ps(a), scale);
+    __m128 outB = _mm_div_ps(_mm_cvtepi32_ps(b), scale);
+    if(isSigned) {
+        outA = _mm_max_ps(outA, _mm_set1_ps(-1.0f));
+        outB = _mm_max_ps(outB, _mm_set1_ps(-1.0f));
+    }
+    _mm_storeu_ps(output + 0, outA);
+    _mm_storeu_ps(output + 4, outB);
+}
+#endif
+
+#if defined(MAGNUM_MATH_SIMD_NEON) && defined(__aarch64__)
+/* Converts eight 32-bit integers to floats and divides them by the maximum
+   of the integral type, the same as in the scalar normalize(). Division is
+   available only on AArch64. */
+inline void neonNormalize(const float32x4_t a, const float32x4_t b, const Float max, const bool isSigned, Float* const output) {
+    const float32x4_t scale = vdupq_n_f32(max);
+    float32x4_t outA = vdivq_f32(a, scale);
+    float32x4_t outB = vdivq_f32(b, scale);
+    if(isSigned) {
+        outA = vmaxq_f32(outA, vdupq_n_f32(-1.0f));
+        outB = vmaxq_f32(outB, vdupq_n_f32(-1.0f));
+    }
+    vst1q_f32(output + 0, outA);
+    vst1q_f32(output + 4, outB);
+}
+#endif
+
+#ifdef MAGNUM_MATH_SIMD_NEON
+inline float32x4_t neonDenormalize(const Float* const input, const Float min, const Float max) {
+    return vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(input), vdupq_n_f32(max)), vdupq_n_f32(min)), vdupq_n_f32(max));
+}
+#endif
+
+}
+
+void packHalf(const Corrade::Containers::ArrayReference<const Float> input, const Corrade::Containers::ArrayReference<UnsignedShort> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::packHalf(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2) && defined(__F16C__)
+    for(; i != end; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_unpacklo_epi64(
+            _mm_cvtps_ph(_mm_loadu_ps(input + i + 0), _MM_FROUND_TO_NEAREST_INT),
+            _mm_cvtps_ph(_mm_loadu_ps(input + i + 4), _MM_FROUND_TO_NEAREST_INT)));
+    #elif defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), sse2PackUnsigned(
+            sse2PackHalf(_mm_loadu_ps(input + i + 0)),
+            sse2PackHalf(_mm_loadu_ps(input + i + 4))));
+    #elif defined(MAGNUM_MATH_SIMD_NEON) && defined(__aarch64__)
+    /* ARMv7 NEON flushes denormals to zero, so it's used only on AArch64 */
+    for(; i != end; i += 8) {
+        vst1_u16(output + i + 0, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(input + i + 0))));
+        vst1_u16(output + i + 4, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(input + i + 4))));
+    }
+    #else
+    static_cast<void>(end);
+    #endif
+
+    for(; i != input.size(); ++i)
+        output[i] = packHalf(input[i]);
+}
+
+void unpackHalf(const Corrade::Containers::ArrayReference<const UnsignedShort> input, const Corrade::Containers::ArrayReference<Float> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::unpackHalf(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2) && defined(__F16C__)
+    for(; i != end; i += 8) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        _mm_storeu_ps(output + i + 0, _mm_cvtph_ps(value));
+        _mm_storeu_ps(output + i + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(value, value)));
+    }
+    #elif defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        _mm_storeu_ps(output + i + 0, sse2UnpackHalf(_mm_unpacklo_epi16(value, _mm_setzero_si128())));
+        _mm_storeu_ps(output + i + 4, sse2UnpackHalf(_mm_unpackhi_epi16(value, _mm_setzero_si128())));
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON) && defined(__aarch64__)
+    for(; i != end; i += 8) {
+        vst1q_f32(output + i + 0, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(input + i + 0))));
+        vst1q_f32(output + i + 4, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(input + i + 4))));
+    }
+    #else
+    static_cast<void>(end);
+    #endif
+
+    for(; i != input.size(); ++i)
+        output[i] = unpackHalf(input[i]);
+}
+
+void normalize(const Corrade::Containers::ArrayReference<const UnsignedByte> input, const Corrade::Containers::ArrayReference<Float> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::normalize(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        const __m128i value = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + i)), _mm_setzero_si128());
+        sse2Normalize(_mm_unpacklo_epi16(value, _mm_setzero_si128()), _mm_unpackhi_epi16(value, _mm_setzero_si128()), 255.0f, false, output + i);
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON) && defined(__aarch64__)
+    for(; i != end; i += 8) {
+        const uint16x8_t value = vmovl_u8(vld1_u8(input + i));
+        neonNormalize(vcvtq_f32_u32(vmovl_u16(vget_low_u16(value))), vcvtq_f32_u32(vmovl_u16(vget_high_u16(value))), 255.0f, false, output + i);
+    }
+    #else
+    static_cast<void>(end);
+    #endif
+
+    normalizeScalar(input.data(), output.data(), i, input.size());
+}
+
+void normalize(const Corrade::Containers::ArrayReference<const Byte> input, const Corrade::Containers::ArrayReference<Float> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::normalize(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        /* Sign extension by unpacking the value with itself and shifting */
+        const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i value = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+        sse2Normalize(_mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16), _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16), 127.0f, true, output + i);
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON) && defined(__aarch64__)
+    for(; i != end; i += 8) {
+        const int16x8_t value = vmovl_s8(vld1_s8(input + i));
+        neonNormalize(vcvtq_f32_s32(vmovl_s16(vget_low_s16(value))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(value))), 127.0f, true, output + i);
+    }
+    #else
+    static_cast<void>(end);
+    #endif
+
+    normalizeScalar(input.data(), output.data(), i, input.size());
+}
+
+void normalize(const Corrade::Containers::ArrayReference<const UnsignedShort> input, const Corrade::Containers::ArrayReference<Float> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::normalize(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        sse2Normalize(_mm_unpacklo_epi16(value, _mm_setzero_si128()), _mm_unpackhi_epi16(value, _mm_setzero_si128()), 65535.0f, false, output + i);
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON) && defined(__aarch64__)
+    for(; i != end; i += 8) {
+        const uint16x8_t value = vld1q_u16(input + i);
+        neonNormalize(vcvtq_f32_u32(vmovl_u16(vget_low_u16(value))), vcvtq_f32_u32(vmovl_u16(vget_high_u16(value))), 65535.0f, false, output + i);
+    }
+    #else
+    static_cast<void>(end);
+    #endif
+
+    normalizeScalar(input.data(), output.data(), i, input.size());
+}
+
+void normalize(const Corrade::Containers::ArrayReference<const Short> input, const Corrade::Containers::ArrayReference<Float> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::normalize(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        sse2Normalize(_mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16), _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16), 32767.0f, true, output + i);
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON) && defined(__aarch64__)
+    for(; i != end; i += 8) {
+        const int16x8_t value = vld1q_s16(input + i);
+        neonNormalize(vcvtq_f32_s32(vmovl_s16(vget_low_s16(value))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(value))), 32767.0f, true, output + i);
+    }
+    #else
+    static_cast<void>(end);
+    #endif
+
+    normalizeScalar(input.data(), output.data(), i, input.size());
+}
+
+void denormalize(const Corrade::Containers::ArrayReference<const Float> input, const Corrade::Containers::ArrayReference<UnsignedByte> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::denormalize(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        __m128i a, b;
+        sse2Denormalize(input + i, 0.0f, 255.0f, a, b);
+        const __m128i value = _mm_packs_epi32(a, b);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(value, value));
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON)
+    for(; i != end; i += 8)
+        vst1_u8(output + i, vmovn_u16(vcombine_u16(
+            vmovn_u32(vcvtq_u32_f32(neonDenormalize(input + i + 0, 0.0f, 255.0f))),
+            vmovn_u32(vcvtq_u32_f32(neonDenormalize(input + i + 4, 0.0f, 255.0f))))));
+    #else
+    static_cast<void>(end);
+    #endif
+
+    denormalizeScalar(input.data(), output.data(), i, input.size());
+}
+
+void denormalize(const Corrade::Containers::ArrayReference<const Float> input, const Corrade::Containers::ArrayReference<Byte> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::denormalize(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        __m128i a, b;
+        sse2Denormalize(input + i, -128.0f, 127.0f, a, b);
+        const __m128i value = _mm_packs_epi32(a, b);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi16(value, value));
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON)
+    for(; i != end; i += 8)
+        vst1_s8(output + i, vmovn_s16(vcombine_s16(
+            vmovn_s32(vcvtq_s32_f32(neonDenormalize(input + i + 0, -128.0f, 127.0f))),
+            vmovn_s32(vcvtq_s32_f32(neonDenormalize(input + i + 4, -128.0f, 127.0f))))));
+    #else
+    static_cast<void>(end);
+    #endif
+
+    denormalizeScalar(input.data(), output.data(), i, input.size());
+}
+
+void denormalize(const Corrade::Containers::ArrayReference<const Float> input, const Corrade::Containers::ArrayReference<UnsignedShort> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::denormalize(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        __m128i a, b;
+        sse2Denormalize(input + i, 0.0f, 65535.0f, a, b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), sse2PackUnsigned(a, b));
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON)
+    for(; i != end; i += 8)
+        vst1q_u16(output + i, vcombine_u16(
+            vmovn_u32(vcvtq_u32_f32(neonDenormalize(input + i + 0, 0.0f, 65535.0f))),
+            vmovn_u32(vcvtq_u32_f32(neonDenormalize(input + i + 4, 0.0f, 65535.0f)))));
+    #else
+    static_cast<void>(end);
+    #endif
+
+    denormalizeScalar(input.data(), output.data(), i, input.size());
+}
+
+void denormalize(const Corrade::Containers::ArrayReference<const Float> input, const Corrade::Containers::ArrayReference<Short> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::denormalize(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    const std::size_t end = input.size() & ~std::size_t(7);
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_SIMD_SSE2)
+    for(; i != end; i += 8) {
+        __m128i a, b;
+        sse2Denormalize(input + i, -32768.0f, 32767.0f, a, b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(a, b));
+    }
+    #elif defined(MAGNUM_MATH_SIMD_NEON)
+    for(; i != end; i += 8)
+        vst1q_s16(output + i, vcombine_s16(
+            vmovn_s32(vcvtq_s32_f32(neonDenormalize(input + i + 0, -32768.0f, 32767.0f))),
+            vmovn_s32(vcvtq_s32_f32(neonDenormalize(input + i + 4, -32768.0f, 32767.0f)))));
+    #else
+    static_cast<void>(end);
+    #endif
+
+    denormalizeScalar(input.data(), output.data(), i, input.size());
+}
+
+}}
@@ -0,0 +1,153 @@
+#ifndef Magnum_Math_Packing_h
+#define Magnum_Math_Packing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf(), batch overloads of @ref Magnum::Math::normalize() and @ref Magnum::Math::denormalize()
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Pack 32-bit float value into 16-bit half-float representation
+
+Rounds to nearest, ties to even. Values too large to be represented are
+converted to infinity, values too small are converted to denormals or zero
+with the same sign. NaN is converted to quiet NaN keeping the sign and upper
+bits of the payload, which is the same what hardware conversion does.
+@see @ref unpackHalf()
+*/
+UnsignedShort MAGNUM_EXPORT packHalf(Float value);
+
+/**
+@brief Pack 32-bit float vector into 16-bit half-float representation
+
+Calls @ref packHalf(Float) on each component.
+*/
+template<std::size_t size> Vector<size, UnsignedShort> packHalf(const Vector<size, Float>& value) {
+    Vector<size, UnsignedShort> out;
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = packHalf(value[i]);
+    return out;
+}
+
+/**
+@brief Unpack 16-bit half-float value into 32-bit float representation
+
+The conversion is exact, signaling NaN is converted to quiet NaN.
+@see @ref packHalf()
+*/
+Float MAGNUM_EXPORT unpackHalf(UnsignedShort value);
+
+/**
+@brief Unpack 16-bit half-float vector into 32-bit float representation
+
+Calls @ref unpackHalf(UnsignedShort) on each component.
+*/
+template<std::size_t size> Vector<size, Float> unpackHalf(const Vector<size, UnsignedShort>& value) {
+    Vector<size, Float> out;
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = unpackHalf(value[i]);
+    return out;
+}
+
+/**
+@brief Pack array of 32-bit float values into 16-bit half-float representation
+@param input        Input values
+@param output       Where to put the packed values
+
+Batch equivalent of calling @ref packHalf(Float) on each element of @p input,
+the result is bit-exact with it. @p output has to have the same size as
+@p input. If built with @ref MAGNUM_BUILD_SIMD, the values are converted
+eight at a time using SSE2 bit manipulation, F16C conversion instructions if
+enabled in the compiler (e.g. with `-mf16c`) or NEON conversion instructions
+on ARM targets with half-float support.
+*/
+void MAGNUM_EXPORT packHalf(Corrade::Containers::ArrayReference<const Float> input, Corrade::Containers::ArrayReference<UnsignedShort> output);
+
+/**
+@brief Unpack array of 16-bit half-float values into 32-bit float representation
+@param input        Input values
+@param output       Where to put the unpacked values
+
+Batch equivalent of calling @ref unpackHalf(UnsignedShort) on each element of
+@p input, the result is bit-exact with it. @p output has to have the same size
+as @p input. See @ref packHalf(Corrade::Containers::ArrayReference<const Float>, Corrade::Containers::ArrayReference<UnsignedShort>)
+for information about SIMD implementation.
+*/
+void MAGNUM_EXPORT unpackHalf(Corrade::Containers::ArrayReference<const UnsignedShort> input, Corrade::Containers::ArrayReference<Float> output);
+
+/**
+@brief Normalize array of integral values
+@param input        Input values
+@param output       Where to put the normalized values
+
+Batch equivalent of calling @ref normalize() on each element of @p input,
+the result is bit-exact with it. @p output has to have the same size as
+@p input. If built with @ref MAGNUM_BUILD_SIMD, the values are converted
+eight at a time on SSE2 and AArch64 NEON targets.
+*/
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayReference<const UnsignedByte> input, Corrade::Containers::ArrayReference<Float> output);
+
+/** @overload */
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayReference<const Byte> input, Corrade::Containers::ArrayReference<Float> output);
+
+/** @overload */
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayReference<const UnsignedShort> input, Corrade::Containers::ArrayReference<Float> output);
+
+/** @overload */
+void MAGNUM_EXPORT normalize(Corrade::Containers::ArrayReference<const Short> input, Corrade::Containers::ArrayReference<Float> output);
+
+/**
+@brief Denormalize array of floating-point values
+@param input        Input values
+@param output       Where to put the denormalized values
+
+Batch equivalent of calling @ref denormalize() on each element of @p input,
+the result is bit-exact with it for values in the normalized range, values
+outside of it are saturated. @p output has to have the same size as
+@p input. If built with @ref MAGNUM_BUILD_SIMD, the values are converted
+eight at a time on SSE2 and NEON targets.
+*/
+void MAGNUM_EXPORT denormalize(Corrade::Containers::ArrayReference<const Float> input, Corrade::Containers::ArrayReference<UnsignedByte> output);
+
+/** @overload */
+void MAGNUM_EXPORT denormalize(Corrade::Containers::ArrayReference<const Float> input, Corrade::Containers::ArrayReference<Byte> output);
+
+/** @overload */
+void MAGNUM_EXPORT denormalize(Corrade::Containers::ArrayReference<const Float> input, Corrade::Containers::ArrayReference<UnsignedShort> output);
+
+/** @overload */
+void MAGNUM_EXPORT denormalize(Corrade::Containers::ArrayReference<const Float> input, Corrade::Containers::ArrayReference<Short> output);
+
+}}
+
+#endif
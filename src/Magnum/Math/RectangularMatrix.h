@@ -647,6 +647,22 @@ template<std::size_t cols, std::size_t rows, class T> template<std::size_t size>
     return out;
 }
 
+#ifdef MAGNUM_MATH_SIMD
+/* Matrix product and matrix-vector product, which is used also by
+   Matrix4::transformPoint() and Matrix4::transformVector() */
+template<> template<> inline RectangularMatrix<4, 4, Float> RectangularMatrix<4, 4, Float>::operator*<4>(const RectangularMatrix<4, 4, Float>& other) const {
+    RectangularMatrix<4, 4, Float> out;
+    Implementation::simdMultiply(data(), other.data(), out.data(), 4);
+    return out;
+}
+
+template<> template<> inline RectangularMatrix<1, 4, Float> RectangularMatrix<4, 4, Float>::operator*<1>(const RectangularMatrix<1, 4, Float>& other) const {
+    RectangularMatrix<1, 4, Float> out;
+    Implementation::simdMultiply(data(), other.data(), out.data(), 1);
+    return out;
+}
+#endif
+
 template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposed() const {
     RectangularMatrix<rows, cols, T> out;
 
@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SpaceFillingCurve.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* Calculates integral grid coordinates of each point inside the range, with
+   `cells` cells in each dimension, and passes them to the encoding function.
+   The clamping is written so NaNs end up in the first cell. */
+template<UnsignedInt dimensions, class VectorType, class F> void calculateKeys(const Range<dimensions, Float>& range, const Corrade::Containers::ArrayReference<const VectorType> points, const Corrade::Containers::ArrayReference<UnsignedInt> keys, const Float cells, F encode) {
+    const Vector<dimensions, Float> min = range.min();
+    const Vector<dimensions, Float> size = range.size();
+    Vector<dimensions, Float> scale;
+    for(std::size_t i = 0; i != dimensions; ++i)
+        scale[i] = size[i] > 0.0f ? cells/size[i] : 0.0f;
+
+    for(std::size_t i = 0; i != points.size(); ++i) {
+        Vector<dimensions, UnsignedShort> cell;
+        for(std::size_t j = 0; j != dimensions; ++j)
+            cell[j] = UnsignedShort(std::min(cells - 1.0f, std::max(0.0f, (points[i][j] - min[j])*scale[j])));
+        keys[i] = encode(cell);
+    }
+}
+
+}
+
+void mortonKeys(const Range2D<Float>& range, const Corrade::Containers::ArrayReference<const Vector2<Float>> points, const Corrade::Containers::ArrayReference<UnsignedInt> keys) {
+    CORRADE_ASSERT(points.size() == keys.size(),
+        "Math::mortonKeys(): expected output array of size" << points.size() << "but got" << keys.size(), );
+    calculateKeys(range, points, keys, 65536.0f, [](const Vector2<UnsignedShort>& cell) {
+        return mortonEncode(cell);
+    });
+}
+
+void mortonKeys(const Range3D<Float>& range, const Corrade::Containers::ArrayReference<const Vector3<Float>> points, const Corrade::Containers::ArrayReference<UnsignedInt> keys) {
+    CORRADE_ASSERT(points.size() == keys.size(),
+        "Math::mortonKeys(): expected output array of size" << points.size() << "but got" << keys.size(), );
+    calculateKeys(range, points, keys, 1024.0f, [](const Vector3<UnsignedShort>& cell) {
+        return mortonEncode(cell);
+    });
+}
+
+void hilbertKeys(const Range2D<Float>& range, const Corrade::Containers::ArrayReference<const Vector2<Float>> points, const Corrade::Containers::ArrayReference<UnsignedInt> keys) {
+    CORRADE_ASSERT(points.size() == keys.size(),
+        "Math::hilbertKeys(): expected output array of size" << points.size() << "but got" << keys.size(), );
+    calculateKeys(range, points, keys, 65536.0f, [](const Vector2<UnsignedShort>& cell) {
+        return hilbertEncode(cell);
+    });
+}
+
+void hilbertKeys(const Range3D<Float>& range, const Corrade::Containers::ArrayReference<const Vector3<Float>> points, const Corrade::Containers::ArrayReference<UnsignedInt> keys) {
+    CORRADE_ASSERT(points.size() == keys.size(),
+        "Math::hilbertKeys(): expected output array of size" << points.size() << "but got" << keys.size(), );
+    calculateKeys(range, points, keys, 1024.0f, [](const Vector3<UnsignedShort>& cell) {
+        return hilbertEncode(cell);
+    });
+}
+
+void radixSortPermutation(const Corrade::Containers::ArrayReference<const UnsignedInt> keys, const Corrade::Containers::ArrayReference<UnsignedInt> permutation) {
+    CORRADE_ASSERT(keys.size() == permutation.size(),
+        "Math::radixSortPermutation(): expected output array of size" << keys.size() << "but got" << permutation.size(), );
+
+    constexpr std::size_t DigitBits = 11;
+    constexpr std::size_t BucketCount = 1 << DigitBits;
+    constexpr UnsignedInt DigitMask = BucketCount - 1;
+    constexpr std::size_t PassCount = 3;
+    const std::size_t count = keys.size();
+    if(!count) return;
+
+    /* Histograms of all digits in a single pass */
+    auto histograms = Corrade::Containers::Array<UnsignedInt>::zeroInitialized(PassCount*BucketCount);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt key = keys[i];
+        ++histograms[key & DigitMask];
+        ++histograms[BucketCount + ((key >> DigitBits) & DigitMask)];
+        ++histograms[2*BucketCount + (key >> 2*DigitBits)];
+    }
+
+    /* Sorted keys and indices are ping-ponged between the output and
+       temporary buffers. Before the first pass the indices are implicit. */
+    Corrade::Containers::Array<UnsignedInt> keyBuffer{2*count};
+    Corrade::Containers::Array<UnsignedInt> indexBuffer{count};
+    UnsignedInt* const keyTargets[]{keyBuffer, keyBuffer + count};
+    UnsignedInt* const indexTargets[]{permutation.data(), indexBuffer};
+    const UnsignedInt* sourceKeys = keys;
+    const UnsignedInt* sourceIndices = nullptr;
+    std::size_t target = 0;
+
+    for(std::size_t pass = 0; pass != PassCount; ++pass) {
+        UnsignedInt* const histogram = histograms + pass*BucketCount;
+        const std::size_t shift = pass*DigitBits;
+
+        /* The digit is the same for all keys, nothing to do */
+        if(histogram[(keys[0] >> shift) & DigitMask] == count) continue;
+
+        /* Convert counts to offsets */
+        UnsignedInt offset = 0;
+        for(std::size_t i = 0; i != BucketCount; ++i) {
+            const UnsignedInt bucketCount = histogram[i];
+            histogram[i] = offset;
+            offset += bucketCount;
+        }
+
+        UnsignedInt* const targetKeys = keyTargets[target];
+        UnsignedInt* const targetIndices = indexTargets[target];
+        for(std::size_t i = 0; i != count; ++i) {
+            const UnsignedInt key = sourceKeys[i];
+            const UnsignedInt position = histogram[(key >> shift) & DigitMask]++;
+            targetKeys[position] = key;
+            targetIndices[position] = sourceIndices ? sourceIndices[i] : UnsignedInt(i);
+        }
+
+        sourceKeys = targetKeys;
+        sourceIndices = targetIndices;
+        target ^= 1;
+    }
+
+    /* All keys are the same, or the result ended up in the temporary buffer */
+    if(!sourceIndices) {
+        for(std::size_t i = 0; i != count; ++i)
+            permutation[i] = UnsignedInt(i);
+    } else if(sourceIndices != permutation.data())
+        std::copy(sourceIndices, sourceIndices + count, permutation.data());
+}
+
+}}
@@ -0,0 +1,331 @@
+#ifndef Magnum_Math_SpaceFillingCurve_h
+#define Magnum_Math_SpaceFillingCurve_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::mortonEncode(), @ref Magnum::Math::mortonDecode2D(), @ref Magnum::Math::mortonDecode3D(), @ref Magnum::Math::hilbertEncode(), @ref Magnum::Math::hilbertDecode2D(), @ref Magnum::Math::hilbertDecode3D(), @ref Magnum::Math::mortonKeys(), @ref Magnum::Math::hilbertKeys(), @ref Magnum::Math::radixSortPermutation()
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector3.h"
+
+#if defined(MAGNUM_MATH_SIMD_SSE2) && defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+
+/* Spreads lower 16 bits of the value into even bits and back */
+inline UnsignedInt mortonSpread2(UnsignedInt value) {
+    value &= 0x0000ffff;
+    value = (value|(value << 8)) & 0x00ff00ff;
+    value = (value|(value << 4)) & 0x0f0f0f0f;
+    value = (value|(value << 2)) & 0x33333333;
+    value = (value|(value << 1)) & 0x55555555;
+    return value;
+}
+
+inline UnsignedInt mortonCompact2(UnsignedInt value) {
+    value &= 0x55555555;
+    value = (value|(value >> 1)) & 0x33333333;
+    value = (value|(value >> 2)) & 0x0f0f0f0f;
+    value = (value|(value >> 4)) & 0x00ff00ff;
+    value = (value|(value >> 8)) & 0x0000ffff;
+    return value;
+}
+
+/* Spreads lower 10 bits of the value into every third bit and back */
+inline UnsignedInt mortonSpread3(UnsignedInt value) {
+    value &= 0x000003ff;
+    value = (value|(value << 16)) & 0x030000ff;
+    value = (value|(value << 8)) & 0x0300f00f;
+    value = (value|(value << 4)) & 0x030c30c3;
+    value = (value|(value << 2)) & 0x09249249;
+    return value;
+}
+
+inline UnsignedInt mortonCompact3(UnsignedInt value) {
+    value &= 0x09249249;
+    value = (value|(value >> 2)) & 0x030c30c3;
+    value = (value|(value >> 4)) & 0x0300f00f;
+    value = (value|(value >> 8)) & 0x030000ff;
+    value = (value|(value >> 16)) & 0x000003ff;
+    return value;
+}
+
+/* Portable implementations, used by the public functions if BMI2 is not
+   available and as a reference in the tests */
+inline UnsignedInt mortonEncode(const Vector2<UnsignedShort>& value) {
+    return mortonSpread2(value[0])|(mortonSpread2(value[1]) << 1);
+}
+
+inline UnsignedInt mortonEncode(const Vector3<UnsignedShort>& value) {
+    return mortonSpread3(value[0])|(mortonSpread3(value[1]) << 1)|(mortonSpread3(value[2]) << 2);
+}
+
+inline Vector2<UnsignedShort> mortonDecode2D(const UnsignedInt key) {
+    return {UnsignedShort(mortonCompact2(key)),
+            UnsignedShort(mortonCompact2(key >> 1))};
+}
+
+inline Vector3<UnsignedShort> mortonDecode3D(const UnsignedInt key) {
+    return {UnsignedShort(mortonCompact3(key)),
+            UnsignedShort(mortonCompact3(key >> 1)),
+            UnsignedShort(mortonCompact3(key >> 2))};
+}
+
+/* Conversion between coordinates and transposed Hilbert index (i.e., the
+   index bits distributed over the coordinates, with the most significant bit
+   in the first one), from J. Skilling (2004), "Programming the Hilbert curve" */
+template<std::size_t dimensions> void hilbertAxesToTranspose(UnsignedInt(&x)[dimensions], const UnsignedInt bits) {
+    /* Inverse undo. Done without branches as they are not predictable:
+       if bit `q` of `x[i]` is set, lower bits of `x[0]` are inverted,
+       otherwise they are exchanged with lower bits of `x[i]`. */
+    for(UnsignedInt q = 1u << (bits - 1); q > 1; q >>= 1) {
+        const UnsignedInt p = q - 1;
+        for(std::size_t i = 0; i != dimensions; ++i) {
+            const UnsignedInt invert = -((x[i] & q) != 0) & p;
+            const UnsignedInt t = (x[0] ^ x[i]) & p & ~invert;
+            x[0] ^= t|invert;
+            x[i] ^= t;
+        }
+    }
+
+    /* Gray encode */
+    for(std::size_t i = 1; i != dimensions; ++i) x[i] ^= x[i - 1];
+    UnsignedInt t = 0;
+    for(UnsignedInt q = 1u << (bits - 1); q > 1; q >>= 1)
+        if(x[dimensions - 1] & q) t ^= q - 1;
+    for(std::size_t i = 0; i != dimensions; ++i) x[i] ^= t;
+}
+
+template<std::size_t dimensions> void hilbertTransposeToAxes(UnsignedInt(&x)[dimensions], const UnsignedInt bits) {
+    /* Gray decode */
+    const UnsignedInt t = x[dimensions - 1] >> 1;
+    for(std::size_t i = dimensions - 1; i != 0; --i) x[i] ^= x[i - 1];
+    x[0] ^= t;
+
+    /* Undo excess work, branchless in the same way as above */
+    for(UnsignedInt q = 2; q != 1u << bits; q <<= 1) {
+        const UnsignedInt p = q - 1;
+        for(std::size_t i = dimensions; i != 0; --i) {
+            const UnsignedInt invert = -((x[i - 1] & q) != 0) & p;
+            const UnsignedInt t = (x[0] ^ x[i - 1]) & p & ~invert;
+            x[0] ^= t|invert;
+            x[i - 1] ^= t;
+        }
+    }
+}
+
+}
+
+/**
+@brief Morton code of 2D coordinates
+
+Interleaves bits of the coordinates into a 32-bit key, with the X coordinate
+in the even bits. Sorting by the key orders the points along the Z-order
+curve, which keeps points that are close to each other in space mostly close
+in memory as well. If compiled with @ref MAGNUM_BUILD_SIMD and BMI2
+instructions are enabled in the compiler (e.g. with `-mbmi2`), the `PDEP`
+instruction is used, otherwise the bits are spread using shifts and masks.
+Note that `PDEP` is microcoded and slow on AMD processors before Zen 3.
+@see @ref mortonDecode2D(), @ref hilbertEncode(), @ref mortonKeys()
+*/
+inline UnsignedInt mortonEncode(const Vector2<UnsignedShort>& value) {
+    #if defined(MAGNUM_MATH_SIMD_SSE2) && defined(__BMI2__)
+    return _pdep_u32(value[0], 0x55555555)|_pdep_u32(value[1], 0xaaaaaaaa);
+    #else
+    return Implementation::mortonEncode(value);
+    #endif
+}
+
+/**
+@brief Morton code of 3D coordinates
+
+Interleaves lower 10 bits of the coordinates into a 30-bit key, with the X
+coordinate in bits 0, 3, 6, ..., upper six bits of each coordinate are
+ignored. See @ref mortonEncode(const Vector2<UnsignedShort>&) for more
+information.
+@see @ref mortonDecode3D(), @ref hilbertEncode(), @ref mortonKeys()
+*/
+inline UnsignedInt mortonEncode(const Vector3<UnsignedShort>& value) {
+    #if defined(MAGNUM_MATH_SIMD_SSE2) && defined(__BMI2__)
+    return _pdep_u32(value[0], 0x09249249)|_pdep_u32(value[1], 0x12492492)|_pdep_u32(value[2], 0x24924924);
+    #else
+    return Implementation::mortonEncode(value);
+    #endif
+}
+
+/**
+@brief 2D coordinates from Morton code
+
+Inverse to @ref mortonEncode(const Vector2<UnsignedShort>&), uses the `PEXT`
+instruction if available.
+*/
+inline Vector2<UnsignedShort> mortonDecode2D(const UnsignedInt key) {
+    #if defined(MAGNUM_MATH_SIMD_SSE2) && defined(__BMI2__)
+    return {UnsignedShort(_pext_u32(key, 0x55555555)),
+            UnsignedShort(_pext_u32(key, 0xaaaaaaaa))};
+    #else
+    return Implementation::mortonDecode2D(key);
+    #endif
+}
+
+/**
+@brief 3D coordinates from Morton code
+
+Inverse to @ref mortonEncode(const Vector3<UnsignedShort>&), uses the `PEXT`
+instruction if available. Upper two bits of the key are ignored.
+*/
+inline Vector3<UnsignedShort> mortonDecode3D(const UnsignedInt key) {
+    #if defined(MAGNUM_MATH_SIMD_SSE2) && defined(__BMI2__)
+    return {UnsignedShort(_pext_u32(key, 0x09249249)),
+            UnsignedShort(_pext_u32(key, 0x12492492)),
+            UnsignedShort(_pext_u32(key, 0x24924924))};
+    #else
+    return Implementation::mortonDecode3D(key);
+    #endif
+}
+
+/**
+@brief Hilbert curve index of 2D coordinates
+
+Returns position of the coordinates along 2D Hilbert curve of order 16,
+starting at the origin. Unlike with @ref mortonEncode(), points with
+successive keys are always neighbors, which gives better locality at the
+cost of slower calculation.
+@see @ref hilbertDecode2D(), @ref hilbertKeys()
+*/
+inline UnsignedInt hilbertEncode(const Vector2<UnsignedShort>& value) {
+    UnsignedInt x[]{value[0], value[1]};
+    Implementation::hilbertAxesToTranspose(x, 16);
+    return mortonEncode(Vector2<UnsignedShort>{UnsignedShort(x[1]), UnsignedShort(x[0])});
+}
+
+/**
+@brief Hilbert curve index of 3D coordinates
+
+Returns position of the coordinates along 3D Hilbert curve of order 10,
+starting at the origin. Upper six bits of each coordinate are ignored. See
+@ref hilbertEncode(const Vector2<UnsignedShort>&) for more information.
+@see @ref hilbertDecode3D(), @ref hilbertKeys()
+*/
+inline UnsignedInt hilbertEncode(const Vector3<UnsignedShort>& value) {
+    UnsignedInt x[]{value[0] & 0x3ffu, value[1] & 0x3ffu, value[2] & 0x3ffu};
+    Implementation::hilbertAxesToTranspose(x, 10);
+    return mortonEncode(Vector3<UnsignedShort>{UnsignedShort(x[2]), UnsignedShort(x[1]), UnsignedShort(x[0])});
+}
+
+/**
+@brief 2D coordinates from Hilbert curve index
+
+Inverse to @ref hilbertEncode(const Vector2<UnsignedShort>&).
+*/
+inline Vector2<UnsignedShort> hilbertDecode2D(const UnsignedInt key) {
+    const Vector2<UnsignedShort> transposed = mortonDecode2D(key);
+    UnsignedInt x[]{transposed[1], transposed[0]};
+    Implementation::hilbertTransposeToAxes(x, 16);
+    return {UnsignedShort(x[0]), UnsignedShort(x[1])};
+}
+
+/**
+@brief 3D coordinates from Hilbert curve index
+
+Inverse to @ref hilbertEncode(const Vector3<UnsignedShort>&). Upper two bits
+of the key are ignored.
+*/
+inline Vector3<UnsignedShort> hilbertDecode3D(const UnsignedInt key) {
+    const Vector3<UnsignedShort> transposed = mortonDecode3D(key);
+    UnsignedInt x[]{transposed[2], transposed[1], transposed[0]};
+    Implementation::hilbertTransposeToAxes(x, 10);
+    return {UnsignedShort(x[0]), UnsignedShort(x[1]), UnsignedShort(x[2])};
+}
+
+/**
+@brief Morton codes of array of 2D points
+@param range        Range containing the points
+@param points       Input points
+@param keys         Where to put the keys
+
+The range is divided into a 65536x65536 grid, points outside of it are
+clamped to the nearest cell, in degenerate dimensions of the range all points
+fall into the first cell. @p keys has to have the same size as @p points.
+Combine with @ref radixSortPermutation() to get spatially sorted order of
+the points.
+@see @ref mortonEncode(const Vector2<UnsignedShort>&)
+*/
+void MAGNUM_EXPORT mortonKeys(const Range2D<Float>& range, Corrade::Containers::ArrayReference<const Vector2<Float>> points, Corrade::Containers::ArrayReference<UnsignedInt> keys);
+
+/**
+@brief Morton codes of array of 3D points
+@param range        Range containing the points
+@param points       Input points
+@param keys         Where to put the keys
+
+Like @ref mortonKeys(const Range2D<Float>&, Corrade::Containers::ArrayReference<const Vector2<Float>>, Corrade::Containers::ArrayReference<UnsignedInt>),
+but the range is divided into a 1024x1024x1024 grid.
+@see @ref mortonEncode(const Vector3<UnsignedShort>&)
+*/
+void MAGNUM_EXPORT mortonKeys(const Range3D<Float>& range, Corrade::Containers::ArrayReference<const Vector3<Float>> points, Corrade::Containers::ArrayReference<UnsignedInt> keys);
+
+/**
+@brief Hilbert curve indices of array of 2D points
+
+Like @ref mortonKeys(const Range2D<Float>&, Corrade::Containers::ArrayReference<const Vector2<Float>>, Corrade::Containers::ArrayReference<UnsignedInt>),
+but calculating @ref hilbertEncode(const Vector2<UnsignedShort>&).
+*/
+void MAGNUM_EXPORT hilbertKeys(const Range2D<Float>& range, Corrade::Containers::ArrayReference<const Vector2<Float>> points, Corrade::Containers::ArrayReference<UnsignedInt> keys);
+
+/**
+@brief Hilbert curve indices of array of 3D points
+
+Like @ref mortonKeys(const Range3D<Float>&, Corrade::Containers::ArrayReference<const Vector3<Float>>, Corrade::Containers::ArrayReference<UnsignedInt>),
+but calculating @ref hilbertEncode(const Vector3<UnsignedShort>&).
+*/
+void MAGNUM_EXPORT hilbertKeys(const Range3D<Float>& range, Corrade::Containers::ArrayReference<const Vector3<Float>> points, Corrade::Containers::ArrayReference<UnsignedInt> keys);
+
+/**
+@brief Permutation sorting given keys
+@param keys         Keys to sort
+@param permutation  Where to put the permutation
+
+Fills @p permutation so that `keys[permutation[i]]` is in ascending order.
+The sort is stable, so elements with the same key keep their original order.
+@p permutation has to have the same size as @p keys. Implemented as LSD radix
+sort with three 11-bit digits, passes over digits that are the same for all
+keys are skipped, which makes it faster for keys from @ref mortonKeys() or
+@ref hilbertKeys() of points occupying only part of the range.
+*/
+void MAGNUM_EXPORT radixSortPermutation(Corrade::Containers::ArrayReference<const UnsignedInt> keys, Corrade::Containers::ArrayReference<UnsignedInt> permutation);
+
+}}
+
+#endif
@@ -0,0 +1,342 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class BatchTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit BatchTest();
+
+        void scalarReference();
+
+        void transformPoints();
+        void transformPointsSoA();
+        void transformPoints2D();
+        void transformPoints2DSoA();
+        void transformPointsMultipleMatrices();
+        void transformVectors();
+        void transformVectorsSoA();
+        void transformVectors2D();
+        void transformVectors2DSoA();
+        void transformVectorsQuaternion();
+        void transformVectorsQuaternionSoA();
+        void transformPointsDualQuaternion();
+        void transformPointsDualQuaternionSoA();
+        void transformPointsDouble();
+        void inPlace();
+
+        void sizeMismatch();
+        void notNormalized();
+};
+
+typedef Math::Rad<Float> Rad;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix3<Float> Matrix3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::DualQuaternion<Float> DualQuaternion;
+typedef Math::Vector3<Double> Vector3d;
+typedef Math::Matrix4<Double> Matrix4d;
+
+namespace {
+
+/* Not a multiple of four to test the remainder handling of SIMD code */
+constexpr std::size_t Count = 11;
+
+const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 3.5f})*
+    Matrix4::rotation(Rad(0.7f), Vector3(1.0f, 2.0f, -3.0f).normalized())*
+    Matrix4::scaling({2.0f, 0.5f, 1.5f});
+const Matrix3 matrix2D = Matrix3::translation({1.0f, -2.0f})*
+    Matrix3::rotation(Rad(0.7f))*Matrix3::scaling({2.0f, 0.5f});
+
+std::vector<Vector3> points() {
+    std::vector<Vector3> out;
+    for(std::size_t i = 0; i != Count; ++i)
+        out.emplace_back(Float(i) - 4.0f, Float(i%3)*0.5f, 2.0f - Float(i%5));
+    return out;
+}
+
+std::vector<Vector2> points2D() {
+    std::vector<Vector2> out;
+    for(std::size_t i = 0; i != Count; ++i)
+        out.emplace_back(Float(i) - 4.0f, 2.0f - Float(i%5));
+    return out;
+}
+
+/* Component-wise copy of the data */
+std::vector<Float> component(const std::vector<Vector3>& data, std::size_t i) {
+    std::vector<Float> out;
+    for(const Vector3& v: data) out.push_back(v[i]);
+    return out;
+}
+std::vector<Float> component(const std::vector<Vector2>& data, std::size_t i) {
+    std::vector<Float> out;
+    for(const Vector2& v: data) out.push_back(v[i]);
+    return out;
+}
+
+template<class T> Corrade::Containers::ArrayReference<const T> input(const std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+template<class T> Corrade::Containers::ArrayReference<T> output(std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+}
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::scalarReference,
+
+              &BatchTest::transformPoints,
+              &BatchTest::transformPointsSoA,
+              &BatchTest::transformPoints2D,
+              &BatchTest::transformPoints2DSoA,
+              &BatchTest::transformPointsMultipleMatrices,
+              &BatchTest::transformVectors,
+              &BatchTest::transformVectorsSoA,
+              &BatchTest::transformVectors2D,
+              &BatchTest::transformVectors2DSoA,
+              &BatchTest::transformVectorsQuaternion,
+              &BatchTest::transformVectorsQuaternionSoA,
+              &BatchTest::transformPointsDualQuaternion,
+              &BatchTest::transformPointsDualQuaternionSoA,
+              &BatchTest::transformPointsDouble,
+              &BatchTest::inPlace,
+
+              &BatchTest::sizeMismatch,
+              &BatchTest::notNormalized});
+}
+
+void BatchTest::scalarReference() {
+    /* The scalar kernels, used as a fallback for the SIMD code, are verified
+       directly against the single-element functions */
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> out(Count);
+
+    Implementation::BatchTransformScalar<Float>::transform(matrix, 1.0f, in.data(), out.data(), Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], matrix.transformPoint(in[i]));
+
+    Implementation::BatchTransformScalar<Float>::transform(matrix, 0.0f, in.data(), out.data(), Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], matrix.transformVector(in[i]));
+}
+
+void BatchTest::transformPoints() {
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> out(Count);
+    Math::transformPoints(matrix, input(in), output(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], matrix.transformPoint(in[i]));
+}
+
+void BatchTest::transformPointsSoA() {
+    const std::vector<Vector3> in = points();
+    const std::vector<Float> x = component(in, 0), y = component(in, 1), z = component(in, 2);
+    std::vector<Float> outX(Count), outY(Count), outZ(Count);
+    Math::transformPoints(matrix, input(x), input(y), input(z), output(outX), output(outY), output(outZ));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(Vector3(outX[i], outY[i], outZ[i]), matrix.transformPoint(in[i]));
+}
+
+void BatchTest::transformPoints2D() {
+    const std::vector<Vector2> in = points2D();
+    std::vector<Vector2> out(Count);
+    Math::transformPoints(matrix2D, input(in), output(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], matrix2D.transformPoint(in[i]));
+}
+
+void BatchTest::transformPoints2DSoA() {
+    const std::vector<Vector2> in = points2D();
+    const std::vector<Float> x = component(in, 0), y = component(in, 1);
+    std::vector<Float> outX(Count), outY(Count);
+    Math::transformPoints(matrix2D, input(x), input(y), output(outX), output(outY));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(Vector2(outX[i], outY[i]), matrix2D.transformPoint(in[i]));
+}
+
+void BatchTest::transformPointsMultipleMatrices() {
+    const std::vector<Matrix4> matrices{matrix,
+        Matrix4::rotationX(Rad(1.2f)),
+        Matrix4::translation({0.5f, 0.0f, -1.0f})};
+    const std::vector<UnsignedInt> ids{0, 2, 1, 1, 0, 2, 2, 0, 1, 0, 2};
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> out(Count);
+    Math::transformPoints(input(matrices), input(ids), input(in), output(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], matrices[ids[i]].transformPoint(in[i]));
+}
+
+void BatchTest::transformVectors() {
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> out(Count);
+    Math::transformVectors(matrix, input(in), output(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], matrix.transformVector(in[i]));
+}
+
+void BatchTest::transformVectorsSoA() {
+    const std::vector<Vector3> in = points();
+    const std::vector<Float> x = component(in, 0), y = component(in, 1), z = component(in, 2);
+    std::vector<Float> outX(Count), outY(Count), outZ(Count);
+    Math::transformVectors(matrix, input(x), input(y), input(z), output(outX), output(outY), output(outZ));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(Vector3(outX[i], outY[i], outZ[i]), matrix.transformVector(in[i]));
+}
+
+void BatchTest::transformVectors2D() {
+    const std::vector<Vector2> in = points2D();
+    std::vector<Vector2> out(Count);
+    Math::transformVectors(matrix2D, input(in), output(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], matrix2D.transformVector(in[i]));
+}
+
+void BatchTest::transformVectors2DSoA() {
+    const std::vector<Vector2> in = points2D();
+    const std::vector<Float> x = component(in, 0), y = component(in, 1);
+    std::vector<Float> outX(Count), outY(Count);
+    Math::transformVectors(matrix2D, input(x), input(y), output(outX), output(outY));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(Vector2(outX[i], outY[i]), matrix2D.transformVector(in[i]));
+}
+
+void BatchTest::transformVectorsQuaternion() {
+    const Quaternion q = Quaternion::rotation(Rad(0.7f), Vector3(1.0f, 2.0f, -3.0f).normalized());
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> out(Count);
+    Math::transformVectorsNormalized(q, input(in), output(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], q.transformVectorNormalized(in[i]));
+}
+
+void BatchTest::transformVectorsQuaternionSoA() {
+    const Quaternion q = Quaternion::rotation(Rad(0.7f), Vector3(1.0f, 2.0f, -3.0f).normalized());
+    const std::vector<Vector3> in = points();
+    const std::vector<Float> x = component(in, 0), y = component(in, 1), z = component(in, 2);
+    std::vector<Float> outX(Count), outY(Count), outZ(Count);
+    Math::transformVectorsNormalized(q, input(x), input(y), input(z), output(outX), output(outY), output(outZ));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(Vector3(outX[i], outY[i], outZ[i]), q.transformVectorNormalized(in[i]));
+}
+
+void BatchTest::transformPointsDualQuaternion() {
+    const DualQuaternion q = DualQuaternion::translation({1.0f, -2.0f, 3.5f})*
+        DualQuaternion::rotation(Rad(0.7f), Vector3(1.0f, 2.0f, -3.0f).normalized());
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> out(Count);
+    Math::transformPointsNormalized(q, input(in), output(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], q.transformPointNormalized(in[i]));
+}
+
+void BatchTest::transformPointsDualQuaternionSoA() {
+    const DualQuaternion q = DualQuaternion::translation({1.0f, -2.0f, 3.5f})*
+        DualQuaternion::rotation(Rad(0.7f), Vector3(1.0f, 2.0f, -3.0f).normalized());
+    const std::vector<Vector3> in = points();
+    const std::vector<Float> x = component(in, 0), y = component(in, 1), z = component(in, 2);
+    std::vector<Float> outX(Count), outY(Count), outZ(Count);
+    Math::transformPointsNormalized(q, input(x), input(y), input(z), output(outX), output(outY), output(outZ));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(Vector3(outX[i], outY[i], outZ[i]), q.transformPointNormalized(in[i]));
+}
+
+void BatchTest::transformPointsDouble() {
+    const Matrix4d m(matrix);
+    std::vector<Vector3d> in;
+    for(const Vector3& v: points()) in.emplace_back(v);
+    std::vector<Vector3d> out(Count);
+    Math::transformPoints(m, input(in), output(out));
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(out[i], m.transformPoint(in[i]));
+}
+
+void BatchTest::inPlace() {
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> data = in;
+    Math::transformPoints(matrix, input(data), output(data));
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(data[i], matrix.transformPoint(in[i]));
+
+    std::vector<Float> x = component(in, 0), y = component(in, 1), z = component(in, 2);
+    Math::transformVectors(matrix, input(x), input(y), input(z), output(x), output(y), output(z));
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(Vector3(x[i], y[i], z[i]), matrix.transformVector(in[i]));
+}
+
+void BatchTest::sizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> out(Count - 1);
+    Math::transformPoints(matrix, input(in), output(out));
+    CORRADE_COMPARE(o.str(), "Math::transformPoints(): expected output array of size 11 but got 10\n");
+
+    o.str({});
+    const std::vector<Float> x(Count), y(Count), z(Count - 1);
+    std::vector<Float> outX(Count), outY(Count), outZ(Count);
+    Math::transformVectors(matrix, input(x), input(y), input(z), output(outX), output(outY), output(outZ));
+    CORRADE_COMPARE(o.str(), "Math::transformVectors(): array sizes don't match\n");
+}
+
+void BatchTest::notNormalized() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const std::vector<Vector3> in = points();
+    std::vector<Vector3> out(Count);
+    Math::transformVectorsNormalized(Quaternion({1.0f, 2.0f, 3.0f}, 4.0f), input(in), output(out));
+    Math::transformPointsNormalized(DualQuaternion({{1.0f, 2.0f, 3.0f}, 4.0f}, {}), input(in), output(out));
+    CORRADE_COMPARE(o.str(), "Math::transformVectorsNormalized(): quaternion must be normalized\n"
+                             "Math::transformPointsNormalized(): dual quaternion must be normalized\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BatchTest)
@@ -0,0 +1,610 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/SpaceFillingCurve.h"
+#include "Magnum/Math/Algorithms/Cramer.h"
+#include "Magnum/Math/Algorithms/GaussJordan.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Geometry/Distance.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Prints time per call of the most commonly used operations. Compare output
+   of builds with and without MAGNUM_BUILD_SIMD to see the difference of the
+   SIMD specializations. */
+class Benchmark: public Corrade::TestSuite::Tester {
+    public:
+        explicit Benchmark();
+
+        template<class T> void vectorDot();
+        template<class T> void vectorLerp();
+        template<class T> void functionsMinMaxClamp();
+
+        template<class T> void matrixMultiply();
+        template<class T> void matrixTransformPoint();
+        template<class T> void matrixInverted();
+        template<class T> void matrixInvertedRigid();
+
+        template<class T> void quaternionNormalized();
+        template<class T> void quaternionSlerp();
+        template<class T> void dualQuaternionMultiply();
+
+        template<class T> void algorithmsSvd();
+        template<class T> void algorithmsGaussJordanInversion();
+        template<class T> void algorithmsCramer();
+
+        template<class T> void geometryIntersection();
+
+        template<class T> void batchTransformPoints();
+        template<class T> void batchTransformPointsMultipleMatrices();
+
+        template<class T> void frustumCulling();
+        template<class T> void rayIntersection();
+        template<class T> void pointDistance();
+
+        void packingHalf();
+        void packingNormalized();
+
+        void spaceFillingCurves();
+};
+
+namespace {
+
+constexpr std::size_t Count = 1024;
+
+template<class> struct TypeName;
+template<> struct TypeName<Float> { static const char* name() { return "Float"; } };
+#ifndef MAGNUM_TARGET_GLES
+template<> struct TypeName<Double> { static const char* name() { return "Double"; } };
+#endif
+
+/* Input data, generated once for each type */
+template<class T> struct Data {
+    Data();
+
+    std::vector<Vector4<T>> vectors;
+    std::vector<Matrix4<T>> rigid;
+    std::vector<Matrix4<T>> general;
+    std::vector<Quaternion<T>> quaternions;
+    std::vector<DualQuaternion<T>> dualQuaternions;
+};
+
+template<class T> Data<T>::Data() {
+    UnsignedInt state = 0x12345678;
+    auto random = [&state]() {
+        state = state*1664525 + 1013904223;
+        return T(state >> 8)/T(1 << 23) - T(1);
+    };
+
+    for(std::size_t i = 0; i != Count; ++i) {
+        const Vector3<T> axis = Vector3<T>(random(), random(), random() + T(2)).normalized();
+        const Vector3<T> translation(random(), random(), random());
+        const Rad<T> angle(random()*T(3));
+
+        vectors.emplace_back(random(), random(), random(), random());
+        rigid.push_back(Matrix4<T>::translation(translation)*Matrix4<T>::rotation(angle, axis));
+        general.emplace_back(Vector4<T>(random() + T(2), random(), random(), random()),
+                             Vector4<T>(random(), random() + T(2), random(), random()),
+                             Vector4<T>(random(), random(), random() + T(2), random()),
+                             Vector4<T>(random(), random(), random(), random() + T(2)));
+        quaternions.push_back(Quaternion<T>::rotation(angle, axis));
+        dualQuaternions.push_back(DualQuaternion<T>::translation(translation)*DualQuaternion<T>::rotation(angle, axis));
+    }
+}
+
+template<class T> const Data<T>& data() {
+    static const Data<T> data;
+    return data;
+}
+
+/* All components of the result are used, otherwise the compiler might
+   calculate only some of them */
+template<std::size_t cols, std::size_t rows, class T> T sum(const RectangularMatrix<cols, rows, T>& m) {
+    T out = m[0].sum();
+    for(std::size_t i = 1; i != cols; ++i)
+        out += m[i].sum();
+    return out;
+}
+template<std::size_t size, class T> T sum(const Vector<size, T>& v) {
+    return v.sum();
+}
+template<class T> T sum(const Quaternion<T>& q) {
+    return q.vector().sum() + q.scalar();
+}
+template<class T> T sum(const DualQuaternion<T>& q) {
+    return sum(q.real()) + sum(q.dual());
+}
+
+/* Calls the function `iterations` times over the input data and prints time
+   per call. The index is different in each iteration and the result is
+   accumulated to prevent the compiler from optimizing the calls out. */
+template<class T, class F> void measure(const char* const name, const std::size_t iterations, F f) {
+    T sink = T(0);
+    std::size_t j = 0;
+    const Double time = Magnum::Test::averageDuration<std::nano>(iterations, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            sink += f(i, (i + j + 1)%Count);
+        ++j;
+    });
+
+    volatile T result = sink;
+    static_cast<void>(result);
+
+    Debug() << name << TypeName<T>::name() << time/Count << "ns per call";
+}
+
+/* Calls the batch function `iterations` times and prints throughput in
+   millions of elements per second, the function processes `count` elements
+   in each call */
+template<class T, class F> void measureBatch(const char* const name, const std::size_t iterations, F f, const std::size_t count = Count) {
+    const Double time = Magnum::Test::averageDuration<std::micro>(iterations, f);
+
+    Debug() << name << TypeName<T>::name() << count/time << "M elements/s";
+}
+
+}
+
+Benchmark::Benchmark() {
+    addTests<Benchmark>({&Benchmark::vectorDot<Float>,
+                         &Benchmark::vectorLerp<Float>,
+                         &Benchmark::functionsMinMaxClamp<Float>,
+                         &Benchmark::matrixMultiply<Float>,
+                         &Benchmark::matrixTransformPoint<Float>,
+                         &Benchmark::matrixInverted<Float>,
+                         &Benchmark::matrixInvertedRigid<Float>,
+                         &Benchmark::quaternionNormalized<Float>,
+                         &Benchmark::quaternionSlerp<Float>,
+                         &Benchmark::dualQuaternionMultiply<Float>,
+                         &Benchmark::algorithmsSvd<Float>,
+                         &Benchmark::algorithmsGaussJordanInversion<Float>,
+                         &Benchmark::algorithmsCramer<Float>,
+                         &Benchmark::geometryIntersection<Float>,
+                         &Benchmark::batchTransformPoints<Float>,
+                         &Benchmark::batchTransformPointsMultipleMatrices<Float>,
+                         &Benchmark::frustumCulling<Float>,
+                         &Benchmark::rayIntersection<Float>,
+                         &Benchmark::pointDistance<Float>,
+                         &Benchmark::packingHalf,
+                         &Benchmark::packingNormalized,
+                         &Benchmark::spaceFillingCurves,
+
+                         #ifndef MAGNUM_TARGET_GLES
+                         &Benchmark::vectorDot<Double>,
+                         &Benchmark::vectorLerp<Double>,
+                         &Benchmark::functionsMinMaxClamp<Double>,
+                         &Benchmark::matrixMultiply<Double>,
+                         &Benchmark::matrixTransformPoint<Double>,
+                         &Benchmark::matrixInverted<Double>,
+                         &Benchmark::matrixInvertedRigid<Double>,
+                         &Benchmark::quaternionNormalized<Double>,
+                         &Benchmark::quaternionSlerp<Double>,
+                         &Benchmark::dualQuaternionMultiply<Double>,
+                         &Benchmark::algorithmsSvd<Double>,
+                         &Benchmark::algorithmsGaussJordanInversion<Double>,
+                         &Benchmark::algorithmsCramer<Double>,
+                         &Benchmark::geometryIntersection<Double>,
+                         &Benchmark::batchTransformPoints<Double>,
+                         &Benchmark::batchTransformPointsMultipleMatrices<Double>,
+                         &Benchmark::frustumCulling<Double>,
+                         &Benchmark::rayIntersection<Double>,
+                         &Benchmark::pointDistance<Double>
+                         #endif
+                         });
+
+    #ifdef MAGNUM_MATH_SIMD
+    Debug() << "Using SIMD specializations";
+    #else
+    Debug() << "Using generic implementation";
+    #endif
+}
+
+template<class T> void Benchmark::vectorDot() {
+    const std::vector<Vector4<T>>& v = data<T>().vectors;
+    measure<T>("Vector4::dot()", 4000, [&](std::size_t i, std::size_t j) {
+        return Vector4<T>::dot(v[i], v[j]);
+    });
+}
+
+template<class T> void Benchmark::vectorLerp() {
+    const std::vector<Vector4<T>>& v = data<T>().vectors;
+    measure<T>("Math::lerp()", 4000, [&](std::size_t i, std::size_t j) {
+        return sum(Math::lerp(v[i], v[j], T(0.25)));
+    });
+}
+
+template<class T> void Benchmark::functionsMinMaxClamp() {
+    const std::vector<Vector4<T>>& v = data<T>().vectors;
+    measure<T>("Math::min()", 4000, [&](std::size_t i, std::size_t j) {
+        return sum(Math::min(v[i], v[j]));
+    });
+    measure<T>("Math::max()", 4000, [&](std::size_t i, std::size_t j) {
+        return sum(Math::max(v[i], v[j]));
+    });
+    measure<T>("Math::clamp()", 4000, [&](std::size_t i, std::size_t) {
+        return sum(Math::clamp(v[i], T(-0.5), T(0.5)));
+    });
+}
+
+template<class T> void Benchmark::matrixMultiply() {
+    const std::vector<Matrix4<T>>& m = data<T>().general;
+    measure<T>("Matrix4::operator*()", 1000, [&](std::size_t i, std::size_t j) {
+        return sum(m[i]*m[j]);
+    });
+}
+
+template<class T> void Benchmark::matrixTransformPoint() {
+    const std::vector<Matrix4<T>>& m = data<T>().rigid;
+    const std::vector<Vector4<T>>& v = data<T>().vectors;
+    measure<T>("Matrix4::transformPoint()", 2000, [&](std::size_t i, std::size_t j) {
+        return sum(m[i].transformPoint(v[j].xyz()));
+    });
+}
+
+template<class T> void Benchmark::matrixInverted() {
+    const std::vector<Matrix4<T>>& m = data<T>().general;
+    measure<T>("Matrix4::inverted()", 100, [&](std::size_t i, std::size_t) {
+        return sum(m[i].inverted());
+    });
+}
+
+template<class T> void Benchmark::matrixInvertedRigid() {
+    const std::vector<Matrix4<T>>& m = data<T>().rigid;
+    measure<T>("Matrix4::invertedRigid()", 500, [&](std::size_t i, std::size_t) {
+        return sum(m[i].invertedRigid());
+    });
+}
+
+template<class T> void Benchmark::quaternionNormalized() {
+    const std::vector<Vector4<T>>& v = data<T>().vectors;
+    measure<T>("Quaternion::normalized()", 2000, [&](std::size_t i, std::size_t) {
+        return sum(Quaternion<T>(v[i].xyz(), v[i].w()).normalized());
+    });
+}
+
+template<class T> void Benchmark::quaternionSlerp() {
+    const std::vector<Quaternion<T>>& q = data<T>().quaternions;
+    measure<T>("Quaternion::slerp()", 500, [&](std::size_t i, std::size_t j) {
+        return sum(Quaternion<T>::slerp(q[i], q[j], T(0.25)));
+    });
+}
+
+template<class T> void Benchmark::dualQuaternionMultiply() {
+    const std::vector<DualQuaternion<T>>& q = data<T>().dualQuaternions;
+    measure<T>("DualQuaternion::operator*()", 1000, [&](std::size_t i, std::size_t j) {
+        return sum(q[i]*q[j]);
+    });
+}
+
+template<class T> void Benchmark::algorithmsSvd() {
+    const std::vector<Matrix4<T>>& m = data<T>().general;
+    measure<T>("Algorithms::svd()", 20, [&](std::size_t i, std::size_t) {
+        return sum(std::get<1>(Algorithms::svd(RectangularMatrix<4, 4, T>(m[i]))));
+    });
+    measure<T>("Algorithms::svd() 3x3", 20, [&](std::size_t i, std::size_t) {
+        return sum(std::get<1>(Algorithms::svd(RectangularMatrix<3, 3, T>(m[i].rotationScaling()))));
+    });
+    measure<T>("Algorithms::svd3x3()", 100, [&](std::size_t i, std::size_t) {
+        return sum(std::get<1>(Algorithms::svd3x3(m[i].rotationScaling())));
+    });
+}
+
+template<class T> void Benchmark::algorithmsGaussJordanInversion() {
+    const std::vector<Matrix4<T>>& m = data<T>().general;
+    measure<T>("Algorithms::gaussJordanInPlace() inversion", 100, [&](std::size_t i, std::size_t) {
+        RectangularMatrix<4, 4, T> a(m[i]);
+        RectangularMatrix<4, 4, T> inverse(Matrix4<T>{});
+        Algorithms::gaussJordanInPlace(a, inverse);
+        return sum(inverse);
+    });
+}
+
+template<class T> void Benchmark::algorithmsCramer() {
+    const std::vector<Matrix4<T>>& m = data<T>().general;
+    measure<T>("Algorithms::cramerInverted() 3x3", 500, [&](std::size_t i, std::size_t) {
+        return sum(Algorithms::cramerInverted(m[i].rotationScaling()));
+    });
+    measure<T>("Algorithms::cramerInverted() 4x4", 200, [&](std::size_t i, std::size_t) {
+        return sum(Algorithms::cramerInverted(m[i]));
+    });
+    measure<T>("Algorithms::gaussJordanInPlace() solve 4x4", 100, [&](std::size_t i, std::size_t j) {
+        RectangularMatrix<4, 4, T> a(m[i]);
+        RectangularMatrix<1, 4, T> b(m[j][3]);
+        Algorithms::gaussJordanInPlace(a, b);
+        return sum(b);
+    });
+    measure<T>("Algorithms::cramerSolve() 4x4", 200, [&](std::size_t i, std::size_t j) {
+        return sum(Algorithms::cramerSolve(m[i], m[j][3]));
+    });
+}
+
+template<class T> void Benchmark::geometryIntersection() {
+    const std::vector<Vector4<T>>& v = data<T>().vectors;
+    measure<T>("Geometry::Intersection::lineSegmentLineSegment()", 2000, [&](std::size_t i, std::size_t j) {
+        const std::pair<T, T> t = Geometry::Intersection::lineSegmentLineSegment(v[i].xy(), v[j].xy(), v[j].xy(), v[i].xy());
+        return t.first + t.second;
+    });
+    measure<T>("Geometry::Intersection::lineSegmentLine()", 2000, [&](std::size_t i, std::size_t j) {
+        return Geometry::Intersection::lineSegmentLine(v[i].xy(), v[j].xy(), v[j].xy(), v[i].xy());
+    });
+    measure<T>("Geometry::Intersection::planeLine()", 2000, [&](std::size_t i, std::size_t j) {
+        return Geometry::Intersection::planeLine(v[i].xyz(), v[j].xyz(), v[j].xyz(), v[i].xyz());
+    });
+}
+
+template<class T> void Benchmark::batchTransformPoints() {
+    const Matrix4<T>& m = data<T>().rigid[0];
+    std::vector<Vector3<T>> points;
+    std::vector<T> x, y, z;
+    for(const Vector4<T>& v: data<T>().vectors) {
+        points.push_back(v.xyz());
+        x.push_back(v.x());
+        y.push_back(v.y());
+        z.push_back(v.z());
+    }
+    std::vector<Vector3<T>> out(Count);
+    std::vector<T> outX(Count), outY(Count), outZ(Count);
+
+    measureBatch<T>("Matrix4::transformPoint() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = m.transformPoint(points[i]);
+    });
+    measureBatch<T>("Math::transformPoints()", 2000, [&]() {
+        transformPoints(m, Corrade::Containers::ArrayReference<const Vector3<T>>{points.data(), Count}, Corrade::Containers::ArrayReference<Vector3<T>>{out.data(), Count});
+    });
+    measureBatch<T>("Math::transformPoints() SoA", 2000, [&]() {
+        transformPoints(m, Corrade::Containers::ArrayReference<const T>{x.data(), Count}, Corrade::Containers::ArrayReference<const T>{y.data(), Count}, Corrade::Containers::ArrayReference<const T>{z.data(), Count}, Corrade::Containers::ArrayReference<T>{outX.data(), Count}, Corrade::Containers::ArrayReference<T>{outY.data(), Count}, Corrade::Containers::ArrayReference<T>{outZ.data(), Count});
+    });
+}
+
+template<class T> void Benchmark::batchTransformPointsMultipleMatrices() {
+    const std::vector<Matrix4<T>>& matrices = data<T>().rigid;
+    std::vector<UnsignedInt> ids;
+    std::vector<Vector3<T>> points;
+    for(std::size_t i = 0; i != Count; ++i) {
+        ids.push_back((i*7)%64);
+        points.push_back(data<T>().vectors[i].xyz());
+    }
+    std::vector<Vector3<T>> out(Count);
+
+    measureBatch<T>("Math::transformPoints() with multiple matrices", 2000, [&]() {
+        transformPoints(Corrade::Containers::ArrayReference<const Matrix4<T>>{matrices.data(), 64}, Corrade::Containers::ArrayReference<const UnsignedInt>{ids.data(), Count}, Corrade::Containers::ArrayReference<const Vector3<T>>{points.data(), Count}, Corrade::Containers::ArrayReference<Vector3<T>>{out.data(), Count});
+    });
+}
+
+template<class T> void Benchmark::frustumCulling() {
+    const Frustum<T> frustum = Frustum<T>::fromMatrix(Matrix4<T>::perspectiveProjection(Deg<T>(T(90)), T(1), T(0.1), T(2))*data<T>().rigid[0]);
+    std::vector<Vector4<T>> spheres;
+    std::vector<Range3D<T>> boxes;
+    for(const Vector4<T>& v: data<T>().vectors) {
+        spheres.emplace_back(v.xyz(), std::abs(v.w())*T(0.25));
+        boxes.emplace_back(v.xyz() - Vector3<T>(std::abs(v.w())*T(0.25)), v.xyz() + Vector3<T>(std::abs(v.w())*T(0.25)));
+    }
+    std::vector<UnsignedByte> visibility((Count + 7)/8);
+
+    measureBatch<T>("Geometry::Intersection::sphereFrustum() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; i += 8) {
+            UnsignedByte mask = 0;
+            for(std::size_t j = 0; j != 8; ++j)
+                if(Geometry::Intersection::sphereFrustum(spheres[i + j].xyz(), spheres[i + j].w(), frustum))
+                    mask |= 1 << j;
+            visibility[i/8] = mask;
+        }
+    });
+    measureBatch<T>("Math::cullSpheres() conservative", 2000, [&]() {
+        cullSpheres(frustum, Corrade::Containers::ArrayReference<const Vector4<T>>{spheres.data(), Count}, Corrade::Containers::ArrayReference<UnsignedByte>{visibility.data(), visibility.size()}, FrustumCulling::Conservative);
+    });
+    measureBatch<T>("Math::cullSpheres() precise", 2000, [&]() {
+        cullSpheres(frustum, Corrade::Containers::ArrayReference<const Vector4<T>>{spheres.data(), Count}, Corrade::Containers::ArrayReference<UnsignedByte>{visibility.data(), visibility.size()});
+    });
+    measureBatch<T>("Geometry::Intersection::boxFrustum() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; i += 8) {
+            UnsignedByte mask = 0;
+            for(std::size_t j = 0; j != 8; ++j)
+                if(Geometry::Intersection::boxFrustum(boxes[i + j], frustum))
+                    mask |= 1 << j;
+            visibility[i/8] = mask;
+        }
+    });
+    measureBatch<T>("Math::cullBoxes() precise", 2000, [&]() {
+        cullBoxes(frustum, Corrade::Containers::ArrayReference<const Range3D<T>>{boxes.data(), Count}, Corrade::Containers::ArrayReference<UnsignedByte>{visibility.data(), visibility.size()});
+    });
+}
+
+template<class T> void Benchmark::rayIntersection() {
+    const std::vector<Vector4<T>>& v = data<T>().vectors;
+    std::vector<Vector3<T>> a, b, c;
+    std::vector<Range3D<T>> boxes;
+    for(std::size_t i = 0; i != Count; ++i) {
+        a.push_back(v[i].xyz() - Vector3<T>::zAxis(T(2)));
+        b.push_back(a.back() + Vector3<T>::xAxis(v[(i + 1)%Count].w() + T(1)));
+        c.push_back(a.back() + Vector3<T>::yAxis(v[(i + 2)%Count].w() + T(1)));
+        boxes.emplace_back(a.back(), a.back() + Vector3<T>(std::abs(v[i].w())));
+    }
+    const Vector3<T> origin(T(0.1), T(-0.2), T(2));
+    const Vector3<T> direction = Vector3<T>(T(0.1), T(0.2), T(-1)).normalized();
+    const Vector3<T> inverseDirection = Vector3<T>(T(1))/direction;
+    std::vector<T> out(Count);
+
+    measureBatch<T>("Geometry::Intersection::rayTriangle() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Geometry::Intersection::rayTriangle(origin, direction, a[i], b[i], c[i]);
+    });
+    measureBatch<T>("Geometry::Intersection::rayTriangle()", 2000, [&]() {
+        Geometry::Intersection::rayTriangle(origin, direction, Corrade::Containers::ArrayReference<const Vector3<T>>{a.data(), Count}, Corrade::Containers::ArrayReference<const Vector3<T>>{b.data(), Count}, Corrade::Containers::ArrayReference<const Vector3<T>>{c.data(), Count}, Corrade::Containers::ArrayReference<T>{out.data(), Count});
+    });
+    measureBatch<T>("Geometry::Intersection::rayBox() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Geometry::Intersection::rayBox(origin, inverseDirection, boxes[i]);
+    });
+    measureBatch<T>("Geometry::Intersection::rayBox()", 2000, [&]() {
+        Geometry::Intersection::rayBox(origin, inverseDirection, Corrade::Containers::ArrayReference<const Range3D<T>>{boxes.data(), Count}, Corrade::Containers::ArrayReference<T>{out.data(), Count});
+    });
+}
+
+template<class T> void Benchmark::pointDistance() {
+    std::vector<Vector2<T>> points;
+    for(const Vector4<T>& v: data<T>().vectors)
+        points.push_back(v.xy());
+    const Vector2<T> a(T(-0.5), T(0.25));
+    const Vector2<T> b(T(0.75), T(-0.125));
+    std::vector<T> out(Count);
+
+    measureBatch<T>("Geometry::Distance::lineSegmentPointSquared() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Geometry::Distance::lineSegmentPointSquared(a, b, points[i]);
+    });
+    measureBatch<T>("Geometry::Distance::lineSegmentPointSquared()", 2000, [&]() {
+        Geometry::Distance::lineSegmentPointSquared(a, b, Corrade::Containers::ArrayReference<const Vector2<T>>{points.data(), Count}, Corrade::Containers::ArrayReference<T>{out.data(), Count});
+    });
+
+    /* Polyline through the points, queried with a different point each
+       time, the results are accumulated */
+    std::size_t closest = 0, query = 0;
+    measureBatch<T>("closest line segment in a loop", 2000, [&]() {
+        const Vector2<T>& point = points[query++ % Count];
+        T minimum = std::numeric_limits<T>::infinity();
+        std::size_t index = 0;
+        for(std::size_t i = 0; i != Count - 1; ++i) {
+            const T distance = Geometry::Distance::lineSegmentPointSquared(points[i], points[i + 1], point);
+            if(distance < minimum) {
+                minimum = distance;
+                index = i;
+            }
+        }
+        closest += index;
+    });
+    measureBatch<T>("Geometry::Distance::closestLineSegment()", 2000, [&]() {
+        closest += Geometry::Distance::closestLineSegment(Corrade::Containers::ArrayReference<const Vector2<T>>{points.data(), Count - 1}, Corrade::Containers::ArrayReference<const Vector2<T>>{points.data() + 1, Count - 1}, points[query++ % Count]).first;
+    });
+
+    volatile std::size_t result = closest;
+    static_cast<void>(result);
+}
+
+void Benchmark::packingHalf() {
+    std::vector<Float> floats;
+    for(const Vector4<Float>& v: data<Float>().vectors)
+        floats.push_back(v.x()*1000.0f);
+    std::vector<UnsignedShort> halves(Count);
+
+    measureBatch<Float>("Math::packHalf() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            halves[i] = packHalf(floats[i]);
+    });
+    measureBatch<Float>("Math::packHalf()", 2000, [&]() {
+        packHalf(Corrade::Containers::ArrayReference<const Float>{floats.data(), Count}, Corrade::Containers::ArrayReference<UnsignedShort>{halves.data(), Count});
+    });
+    measureBatch<Float>("Math::unpackHalf() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            floats[i] = unpackHalf(halves[i]);
+    });
+    measureBatch<Float>("Math::unpackHalf()", 2000, [&]() {
+        unpackHalf(Corrade::Containers::ArrayReference<const UnsignedShort>{halves.data(), Count}, Corrade::Containers::ArrayReference<Float>{floats.data(), Count});
+    });
+}
+
+void Benchmark::packingNormalized() {
+    std::vector<Float> floats;
+    for(const Vector4<Float>& v: data<Float>().vectors)
+        floats.push_back(v.x());
+    std::vector<Short> shorts(Count);
+
+    measureBatch<Float>("Math::denormalize() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            shorts[i] = denormalize<Short>(floats[i]);
+    });
+    measureBatch<Float>("Math::denormalize()", 2000, [&]() {
+        denormalize(Corrade::Containers::ArrayReference<const Float>{floats.data(), Count}, Corrade::Containers::ArrayReference<Short>{shorts.data(), Count});
+    });
+    measureBatch<Float>("Math::normalize() in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            floats[i] = normalize<Float, Short>(shorts[i]);
+    });
+    measureBatch<Float>("Math::normalize()", 2000, [&]() {
+        normalize(Corrade::Containers::ArrayReference<const Short>{shorts.data(), Count}, Corrade::Containers::ArrayReference<Float>{floats.data(), Count});
+    });
+}
+
+void Benchmark::spaceFillingCurves() {
+    std::vector<Vector3<Float>> points;
+    for(const Vector4<Float>& v: data<Float>().vectors)
+        points.push_back(v.xyz());
+    std::vector<Vector3<UnsignedShort>> cells;
+    for(const Vector3<Float>& p: points)
+        cells.push_back(Vector3<UnsignedShort>((p + Vector3<Float>(1.0f))*512.0f));
+    const Range3D<Float> range{Vector3<Float>(-1.0f), Vector3<Float>(1.0f)};
+    std::vector<UnsignedInt> keys(Count), permutation(Count);
+
+    measureBatch<Float>("Math::mortonEncode() 3D in a loop", 2000, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            keys[i] = mortonEncode(cells[i]);
+    });
+    measureBatch<Float>("Math::hilbertEncode() 3D in a loop", 500, [&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            keys[i] = hilbertEncode(cells[i]);
+    });
+    measureBatch<Float>("Math::mortonKeys() 3D", 2000, [&]() {
+        mortonKeys(range, Corrade::Containers::ArrayReference<const Vector3<Float>>{points.data(), Count}, Corrade::Containers::ArrayReference<UnsignedInt>{keys.data(), Count});
+    });
+    measureBatch<Float>("Math::hilbertKeys() 3D", 500, [&]() {
+        hilbertKeys(range, Corrade::Containers::ArrayReference<const Vector3<Float>>{points.data(), Count}, Corrade::Containers::ArrayReference<UnsignedInt>{keys.data(), Count});
+    });
+
+    /* Sorting is measured on a larger array, as that's the typical use case
+       and the fixed overhead of radix sort would dominate otherwise */
+    constexpr std::size_t SortCount = 64*Count;
+    std::vector<Vector3<Float>> sortPoints;
+    for(std::size_t i = 0; i != SortCount; ++i)
+        sortPoints.push_back(points[i%Count]*Float(i/Count + 1)/64.0f);
+    std::vector<UnsignedInt> sortKeys(SortCount), sortPermutation(SortCount);
+    mortonKeys(range, Corrade::Containers::ArrayReference<const Vector3<Float>>{sortPoints.data(), SortCount}, Corrade::Containers::ArrayReference<UnsignedInt>{sortKeys.data(), SortCount});
+
+    measureBatch<Float>("std::stable_sort() permutation", 10, [&]() {
+        for(std::size_t i = 0; i != SortCount; ++i) sortPermutation[i] = UnsignedInt(i);
+        std::stable_sort(sortPermutation.begin(), sortPermutation.end(), [&](UnsignedInt a, UnsignedInt b) {
+            return sortKeys[a] < sortKeys[b];
+        });
+    }, SortCount);
+    measureBatch<Float>("Math::radixSortPermutation()", 10, [&]() {
+        radixSortPermutation(Corrade::Containers::ArrayReference<const UnsignedInt>{sortKeys.data(), SortCount}, Corrade::Containers::ArrayReference<UnsignedInt>{sortPermutation.data(), SortCount});
+    }, SortCount);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::Benchmark)
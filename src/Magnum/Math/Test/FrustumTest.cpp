@@ -0,0 +1,354 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class FrustumTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit FrustumTest();
+
+        void construct();
+        void constructDefault();
+        void constructCopy();
+        void access();
+        void compare();
+
+        void fromMatrixOrthographic();
+        void fromMatrixPerspective();
+        void fromMatrixTransformed();
+
+        void cornerBounds();
+        void cullSpheres();
+        void cullSpheresPrecise();
+        void cullBoxes();
+        void cullBoxesPrecise();
+        void cullDouble();
+        void cullMaskSizeMismatch();
+
+        void debug();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Range3D<Float> Range3D;
+typedef Math::Frustum<Float> Frustum;
+typedef Math::Vector4<Double> Vector4d;
+typedef Math::Matrix4<Double> Matrix4d;
+typedef Math::Range3D<Double> Range3Dd;
+typedef Math::Frustum<Double> Frustumd;
+
+FrustumTest::FrustumTest() {
+    addTests({&FrustumTest::construct,
+              &FrustumTest::constructDefault,
+              &FrustumTest::constructCopy,
+              &FrustumTest::access,
+              &FrustumTest::compare,
+
+              &FrustumTest::fromMatrixOrthographic,
+              &FrustumTest::fromMatrixPerspective,
+              &FrustumTest::fromMatrixTransformed,
+
+              &FrustumTest::cornerBounds,
+              &FrustumTest::cullSpheres,
+              &FrustumTest::cullSpheresPrecise,
+              &FrustumTest::cullBoxes,
+              &FrustumTest::cullBoxesPrecise,
+              &FrustumTest::cullDouble,
+              &FrustumTest::cullMaskSizeMismatch,
+
+              &FrustumTest::debug});
+}
+
+namespace {
+
+/* Not a multiple of eight to test the remainder handling of SIMD code */
+constexpr std::size_t Count = 37;
+
+const Frustum perspective = Frustum::fromMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+
+std::vector<Vector4> spheres() {
+    std::vector<Vector4> out;
+    for(std::size_t i = 0; i != Count; ++i)
+        out.emplace_back(Float(i%7)*8.0f - 24.0f, Float(i%5)*10.0f - 20.0f, -Float(i)*3.0f + 5.0f, Float(i%3) + 0.5f);
+    return out;
+}
+
+std::vector<Range3D> boxes() {
+    std::vector<Range3D> out;
+    for(const Vector4& s: spheres())
+        out.push_back(Range3D{s.xyz() - Vector3{s.w(), s.w()*0.5f, s.w()*2.0f}, s.xyz() + Vector3{s.w()*0.5f, s.w(), s.w()}});
+    return out;
+}
+
+template<class T> Corrade::Containers::ArrayReference<const T> input(const std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+template<class T> Corrade::Containers::ArrayReference<T> output(std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+bool bit(const std::vector<UnsignedByte>& mask, const std::size_t i) {
+    return mask[i/8] & (1 << i%8);
+}
+
+}
+
+void FrustumTest::construct() {
+    constexpr Frustum a = {{1.0f, 0.0f, 0.0f, 2.0f},
+                           {-1.0f, 0.0f, 0.0f, 2.0f},
+                           {0.0f, 1.0f, 0.0f, 3.0f},
+                           {0.0f, -1.0f, 0.0f, 3.0f},
+                           {0.0f, 0.0f, -1.0f, -1.0f},
+                           {0.0f, 0.0f, 1.0f, 10.0f}};
+    CORRADE_COMPARE(a.left(), Vector4(1.0f, 0.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a.far(), Vector4(0.0f, 0.0f, 1.0f, 10.0f));
+}
+
+void FrustumTest::constructDefault() {
+    constexpr Frustum a;
+    CORRADE_COMPARE(a, Frustum::fromMatrix(Matrix4()));
+    CORRADE_COMPARE(a.near(), Vector4(0.0f, 0.0f, 1.0f, 1.0f));
+}
+
+void FrustumTest::constructCopy() {
+    constexpr Frustum a;
+    constexpr Frustum b(a);
+    CORRADE_COMPARE(b, a);
+}
+
+void FrustumTest::access() {
+    Frustum a;
+    CORRADE_COMPARE(a[2], a.bottom());
+    CORRADE_COMPARE(a[3], a.top());
+    CORRADE_COMPARE(a.data()[4], -1.0f);
+    CORRADE_COMPARE(a.data()[23], 1.0f);
+
+    a.data()[3] = 5.0f;
+    CORRADE_COMPARE(a.left(), Vector4(1.0f, 0.0f, 0.0f, 5.0f));
+    CORRADE_COMPARE(a.right(), Vector4(-1.0f, 0.0f, 0.0f, 1.0f));
+}
+
+void FrustumTest::compare() {
+    const Frustum a;
+    Frustum b;
+    CORRADE_VERIFY(a == b);
+    b.data()[19] = 1.0f + TypeTraits<Float>::epsilon()/2.0f;
+    CORRADE_VERIFY(a == b);
+    b.data()[19] = 1.1f;
+    CORRADE_VERIFY(a != b);
+}
+
+void FrustumTest::fromMatrixOrthographic() {
+    CORRADE_COMPARE(Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 10.0f)), Frustum(
+        {1.0f, 0.0f, 0.0f, 2.0f},
+        {-1.0f, 0.0f, 0.0f, 2.0f},
+        {0.0f, 1.0f, 0.0f, 3.0f},
+        {0.0f, -1.0f, 0.0f, 3.0f},
+        {0.0f, 0.0f, -1.0f, -1.0f},
+        {0.0f, 0.0f, 1.0f, 10.0f}));
+}
+
+void FrustumTest::fromMatrixPerspective() {
+    const Float s = Constants<Float>::sqrt2()/2.0f;
+    CORRADE_COMPARE(perspective.left(), Vector4(s, 0.0f, -s, 0.0f));
+    CORRADE_COMPARE(perspective.right(), Vector4(-s, 0.0f, -s, 0.0f));
+    CORRADE_COMPARE(perspective.bottom(), Vector4(0.0f, s, -s, 0.0f));
+    CORRADE_COMPARE(perspective.top(), Vector4(0.0f, -s, -s, 0.0f));
+    CORRADE_COMPARE(perspective.near(), Vector4(0.0f, 0.0f, -1.0f, -1.0f));
+
+    /* Precision of the far plane distance is limited by the projection */
+    CORRADE_COMPARE(perspective.far().xyz(), Vector3(0.0f, 0.0f, 1.0f));
+    CORRADE_VERIFY(std::abs(perspective.far().w() - 100.0f) < 1.0e-3f);
+}
+
+void FrustumTest::fromMatrixTransformed() {
+    /* Camera moved to (0, 0, 10) and rotated to look along -X */
+    const Matrix4 camera = Matrix4::translation({0.0f, 0.0f, 10.0f})*Matrix4::rotationY(Deg(90.0f));
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 10.0f)*camera.invertedRigid());
+
+    CORRADE_COMPARE(frustum.near(), Vector4(-1.0f, 0.0f, 0.0f, -1.0f));
+    CORRADE_COMPARE(frustum.far(), Vector4(1.0f, 0.0f, 0.0f, 10.0f));
+    CORRADE_VERIFY(Geometry::Intersection::pointFrustum({-5.0f, 0.0f, 10.0f}, frustum));
+    CORRADE_VERIFY(!Geometry::Intersection::pointFrustum({5.0f, 0.0f, 10.0f}, frustum));
+    CORRADE_VERIFY(!Geometry::Intersection::pointFrustum({-5.0f, 0.0f, 0.0f}, frustum));
+}
+
+void FrustumTest::cornerBounds() {
+    CORRADE_COMPARE(Implementation::frustumCornerBounds(Frustum()), Range3D({-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(Implementation::frustumCornerBounds(Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 10.0f))), Range3D({-2.0f, -3.0f, -10.0f}, {2.0f, 3.0f, -1.0f}));
+
+    const Range3D bounds = Implementation::frustumCornerBounds(perspective);
+    CORRADE_VERIFY((bounds.min() - Vector3{-100.0f, -100.0f, -100.0f}).dot() < 1.0e-6f);
+    CORRADE_VERIFY((bounds.max() - Vector3{100.0f, 100.0f, -1.0f}).dot() < 1.0e-6f);
+
+    /* Far plane of infinite projection, the bounds don't restrict anything */
+    Frustum infinite = perspective;
+    infinite.data()[20] = infinite.data()[21] = infinite.data()[22] = 0.0f;
+    infinite.data()[23] = 2.0f;
+    const Range3D infiniteBounds = Implementation::frustumCornerBounds(infinite);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_VERIFY(infiniteBounds.min()[i] == -std::numeric_limits<Float>::infinity());
+        CORRADE_VERIFY(infiniteBounds.max()[i] == std::numeric_limits<Float>::infinity());
+    }
+}
+
+void FrustumTest::cullSpheres() {
+    const std::vector<Vector4> in = spheres();
+    std::vector<UnsignedByte> mask((Count + 7)/8, 0xff);
+    Math::cullSpheres(perspective, input(in), output(mask), FrustumCulling::Conservative);
+
+    std::size_t visible = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_COMPARE(bit(mask, i), Geometry::Intersection::sphereFrustum(in[i].xyz(), in[i].w(), perspective));
+        if(bit(mask, i)) ++visible;
+    }
+
+    /* Make sure the data test something and the unused bits are zero */
+    CORRADE_VERIFY(visible > 5 && visible < Count - 5);
+    CORRADE_COMPARE(mask.back() >> (Count % 8), 0);
+}
+
+void FrustumTest::cullSpheresPrecise() {
+    const std::vector<Vector4> in = spheres();
+    std::vector<UnsignedByte> conservative((Count + 7)/8);
+    std::vector<UnsignedByte> precise((Count + 7)/8);
+    Math::cullSpheres(perspective, input(in), output(conservative), FrustumCulling::Conservative);
+    Math::cullSpheres(perspective, input(in), output(precise));
+
+    /* Precise culling is a subset of the conservative one, verified against
+       the scalar code */
+    const Range3D bounds = Implementation::frustumCornerBounds(perspective);
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_VERIFY(!bit(precise, i) || bit(conservative, i));
+        CORRADE_COMPARE(bit(precise, i), !std::signbit(Implementation::FrustumCullScalar<Float>::sphere(perspective, &bounds, in[i])));
+    }
+
+    /* Sphere outside of the right far corner, passes all plane tests */
+    const Vector4 corner[]{{180.0f, 0.0f, -120.0f, 75.0f}};
+    UnsignedByte mask[1];
+    Math::cullSpheres(perspective, Corrade::Containers::ArrayReference<const Vector4>(corner), mask, FrustumCulling::Conservative);
+    CORRADE_COMPARE(mask[0], 1);
+    Math::cullSpheres(perspective, Corrade::Containers::ArrayReference<const Vector4>(corner), mask, FrustumCulling::Precise);
+    CORRADE_COMPARE(mask[0], 0);
+}
+
+void FrustumTest::cullBoxes() {
+    const std::vector<Range3D> in = boxes();
+    std::vector<UnsignedByte> mask((Count + 7)/8, 0xff);
+    Math::cullBoxes(perspective, input(in), output(mask), FrustumCulling::Conservative);
+
+    std::size_t visible = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_COMPARE(bit(mask, i), Geometry::Intersection::boxFrustum(in[i], perspective));
+        if(bit(mask, i)) ++visible;
+    }
+
+    /* Make sure the data test something and the unused bits are zero */
+    CORRADE_VERIFY(visible > 5 && visible < Count - 5);
+    CORRADE_COMPARE(mask.back() >> (Count % 8), 0);
+}
+
+void FrustumTest::cullBoxesPrecise() {
+    const std::vector<Range3D> in = boxes();
+    std::vector<UnsignedByte> conservative((Count + 7)/8);
+    std::vector<UnsignedByte> precise((Count + 7)/8);
+    Math::cullBoxes(perspective, input(in), output(conservative), FrustumCulling::Conservative);
+    Math::cullBoxes(perspective, input(in), output(precise));
+
+    const Range3D bounds = Implementation::frustumCornerBounds(perspective);
+    for(std::size_t i = 0; i != Count; ++i) {
+        CORRADE_VERIFY(!bit(precise, i) || bit(conservative, i));
+        CORRADE_COMPARE(bit(precise, i), !std::signbit(Implementation::FrustumCullScalar<Float>::box(perspective, &bounds, in[i])));
+    }
+
+    /* Box outside of the right far corner, passes all plane tests */
+    const Range3D corner[]{{{101.0f, -1.0f, -200.0f}, {200.0f, 1.0f, -95.0f}}};
+    UnsignedByte mask[1];
+    Math::cullBoxes(perspective, Corrade::Containers::ArrayReference<const Range3D>(corner), mask, FrustumCulling::Conservative);
+    CORRADE_COMPARE(mask[0], 1);
+    Math::cullBoxes(perspective, Corrade::Containers::ArrayReference<const Range3D>(corner), mask, FrustumCulling::Precise);
+    CORRADE_COMPARE(mask[0], 0);
+}
+
+void FrustumTest::cullDouble() {
+    const Frustumd frustum = Frustumd::fromMatrix(Matrix4d::perspectiveProjection(Math::Deg<Double>(90.0), 1.0, 1.0, 100.0));
+    const Vector4d spheres[]{
+        {0.0, 0.0, -50.0, 1.0},
+        {0.0, 0.0, 50.0, 1.0},
+        {180.0, 0.0, -120.0, 75.0}
+    };
+    const Range3Dd boxes[]{
+        {{-1.0, -1.0, -51.0}, {1.0, 1.0, -49.0}},
+        {{101.0, -1.0, -200.0}, {200.0, 1.0, -95.0}},
+        {{-1.0, -1.0, -0.5}, {1.0, 1.0, 0.5}}
+    };
+    UnsignedByte mask[1];
+
+    Math::cullSpheres(frustum, Corrade::Containers::ArrayReference<const Vector4d>(spheres), mask);
+    CORRADE_COMPARE(mask[0], 1);
+    Math::cullSpheres(frustum, Corrade::Containers::ArrayReference<const Vector4d>(spheres), mask, FrustumCulling::Conservative);
+    CORRADE_COMPARE(mask[0], 5);
+    Math::cullBoxes(frustum, Corrade::Containers::ArrayReference<const Range3Dd>(boxes), mask);
+    CORRADE_COMPARE(mask[0], 1);
+    Math::cullBoxes(frustum, Corrade::Containers::ArrayReference<const Range3Dd>(boxes), mask, FrustumCulling::Conservative);
+    CORRADE_COMPARE(mask[0], 3);
+}
+
+void FrustumTest::cullMaskSizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const std::vector<Vector4> s = spheres();
+    const std::vector<Range3D> b = boxes();
+    std::vector<UnsignedByte> mask(Count/8);
+    Math::cullSpheres(perspective, input(s), output(mask));
+    Math::cullBoxes(perspective, input(b), output(mask));
+    CORRADE_COMPARE(o.str(),
+        "Math::cullSpheres(): expected visibility mask of size 5 but got 4\n"
+        "Math::cullBoxes(): expected visibility mask of size 5 but got 4\n");
+}
+
+void FrustumTest::debug() {
+    std::ostringstream o;
+    Debug(&o) << Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 10.0f));
+    CORRADE_COMPARE(o.str(), "Frustum({1, 0, 0, 2}, {-1, 0, 0, 2}, {0, 1, 0, 3}, {0, -1, 0, 3}, {0, 0, -1, -1}, {0, 0, 1, 10})\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FrustumTest)
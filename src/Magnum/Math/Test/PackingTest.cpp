@@ -0,0 +1,322 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class PackingTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit PackingTest();
+
+        void packHalf();
+        void packHalfRounding();
+        void packHalfDenormal();
+        void packHalfInfinityNan();
+        void unpackHalf();
+        void unpackHalfDenormal();
+        void unpackHalfInfinityNan();
+        void halfRoundTrip();
+        void halfVector();
+
+        void packHalfBatch();
+        void unpackHalfBatch();
+        template<class T> void normalizeBatch();
+        template<class T> void denormalizeBatch();
+
+        void sizeMismatch();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<UnsignedShort> Vector3us;
+
+PackingTest::PackingTest() {
+    addTests<PackingTest>({&PackingTest::packHalf,
+                           &PackingTest::packHalfRounding,
+                           &PackingTest::packHalfDenormal,
+                           &PackingTest::packHalfInfinityNan,
+                           &PackingTest::unpackHalf,
+                           &PackingTest::unpackHalfDenormal,
+                           &PackingTest::unpackHalfInfinityNan,
+                           &PackingTest::halfRoundTrip,
+                           &PackingTest::halfVector,
+
+                           &PackingTest::packHalfBatch,
+                           &PackingTest::unpackHalfBatch,
+                           &PackingTest::normalizeBatch<UnsignedByte>,
+                           &PackingTest::normalizeBatch<Byte>,
+                           &PackingTest::normalizeBatch<UnsignedShort>,
+                           &PackingTest::normalizeBatch<Short>,
+                           &PackingTest::denormalizeBatch<UnsignedByte>,
+                           &PackingTest::denormalizeBatch<Byte>,
+                           &PackingTest::denormalizeBatch<UnsignedShort>,
+                           &PackingTest::denormalizeBatch<Short>,
+
+                           &PackingTest::sizeMismatch});
+}
+
+namespace {
+
+Float floatFromBits(const UnsignedInt bits) {
+    Float value;
+    std::memcpy(&value, &bits, 4);
+    return value;
+}
+
+UnsignedInt bitsFromFloat(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+    return bits;
+}
+
+template<class T> Corrade::Containers::ArrayReference<const T> input(const std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+template<class T> Corrade::Containers::ArrayReference<T> output(std::vector<T>& data) {
+    return {data.data(), data.size()};
+}
+
+}
+
+void PackingTest::packHalf() {
+    CORRADE_COMPARE(Math::packHalf(0.0f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(-0.0f), 0x8000);
+    CORRADE_COMPARE(Math::packHalf(1.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(-2.5f), 0xc100);
+    CORRADE_COMPARE(Math::packHalf(0.33325195f), 0x3555);
+    CORRADE_COMPARE(Math::packHalf(6.103515625e-5f), 0x0400);
+    CORRADE_COMPARE(Math::packHalf(65504.0f), 0x7bff);
+    CORRADE_COMPARE(Math::packHalf(-65504.0f), 0xfbff);
+}
+
+void PackingTest::packHalfRounding() {
+    /* Exactly between 1 and the next representable value, ties to even */
+    CORRADE_COMPARE(Math::packHalf(1.0f + 1.0f/2048.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(1.0f + 3.0f/2048.0f), 0x3c02);
+
+    /* Slightly above and below the halfway point */
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(bitsFromFloat(1.0f + 1.0f/2048.0f) + 1)), 0x3c01);
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(bitsFromFloat(1.0f + 3.0f/2048.0f) - 1)), 0x3c01);
+
+    /* Rounding carries into the exponent */
+    CORRADE_COMPARE(Math::packHalf(2.0f - 1.0f/4096.0f), 0x4000);
+
+    /* The largest value that doesn't round to infinity and the smallest
+       one that does */
+    CORRADE_COMPARE(Math::packHalf(65519.996f), 0x7bff);
+    CORRADE_COMPARE(Math::packHalf(65520.0f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(1.0e6f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(-1.0e6f), 0xfc00);
+}
+
+void PackingTest::packHalfDenormal() {
+    /* The smallest denormal */
+    CORRADE_COMPARE(Math::packHalf(5.9604645e-8f), 0x0001);
+    CORRADE_COMPARE(Math::packHalf(-5.9604645e-8f), 0x8001);
+    CORRADE_COMPARE(Math::packHalf(1.0e-7f), 0x0002);
+
+    /* The largest denormal, rounding into the smallest normal value */
+    CORRADE_COMPARE(Math::packHalf(6.0975552e-5f), 0x03ff);
+    CORRADE_COMPARE(Math::packHalf(6.1005353e-5f), 0x0400);
+
+    /* Ties to even, half of the smallest denormal rounds to zero, one and a
+       half of it to two */
+    CORRADE_COMPARE(Math::packHalf(2.9802322e-8f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(bitsFromFloat(2.9802322e-8f) + 1)), 0x0001);
+    CORRADE_COMPARE(Math::packHalf(8.940697e-8f), 0x0002);
+
+    /* Underflow to zero, keeping sign, including float denormals */
+    CORRADE_COMPARE(Math::packHalf(1.0e-9f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(-1.0e-9f), 0x8000);
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(0x00000001)), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(0x807fffff)), 0x8000);
+}
+
+void PackingTest::packHalfInfinityNan() {
+    CORRADE_COMPARE(Math::packHalf(std::numeric_limits<Float>::infinity()), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(-std::numeric_limits<Float>::infinity()), 0xfc00);
+
+    /* NaN is quiet and keeps upper bits of the payload */
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(0x7fc00000)), 0x7e00);
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(0xffc00000)), 0xfe00);
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(0x7f800001)), 0x7e00);
+    CORRADE_COMPARE(Math::packHalf(floatFromBits(0x7f8f0000)), 0x7e78);
+}
+
+void PackingTest::unpackHalf() {
+    CORRADE_COMPARE(Math::unpackHalf(0x0000), 0.0f);
+    CORRADE_COMPARE(bitsFromFloat(Math::unpackHalf(0x8000)), 0x80000000);
+    CORRADE_COMPARE(Math::unpackHalf(0x3c00), 1.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0xc100), -2.5f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3555), 0.33325195f);
+    CORRADE_COMPARE(Math::unpackHalf(0x0400), 6.103515625e-5f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7bff), 65504.0f);
+}
+
+void PackingTest::unpackHalfDenormal() {
+    CORRADE_COMPARE(bitsFromFloat(Math::unpackHalf(0x0001)), bitsFromFloat(5.9604645e-8f));
+    CORRADE_COMPARE(bitsFromFloat(Math::unpackHalf(0x8001)), bitsFromFloat(-5.9604645e-8f));
+    CORRADE_COMPARE(bitsFromFloat(Math::unpackHalf(0x03ff)), bitsFromFloat(6.0975552e-5f));
+}
+
+void PackingTest::unpackHalfInfinityNan() {
+    CORRADE_COMPARE(Math::unpackHalf(0x7c00), std::numeric_limits<Float>::infinity());
+    CORRADE_COMPARE(Math::unpackHalf(0xfc00), -std::numeric_limits<Float>::infinity());
+
+    /* Signaling NaN is made quiet */
+    CORRADE_COMPARE(bitsFromFloat(Math::unpackHalf(0x7e00)), 0x7fc00000);
+    CORRADE_COMPARE(bitsFromFloat(Math::unpackHalf(0xfe00)), 0xffc00000);
+    CORRADE_COMPARE(bitsFromFloat(Math::unpackHalf(0x7c01)), 0x7fc02000);
+}
+
+void PackingTest::halfRoundTrip() {
+    /* Every half-float value survives the round trip, NaNs become quiet */
+    for(UnsignedInt i = 0; i != 65536; ++i) {
+        const UnsignedShort half = UnsignedShort(i);
+        const bool nan = (half & 0x7c00) == 0x7c00 && (half & 0x3ff);
+        const UnsignedShort result = Math::packHalf(Math::unpackHalf(half));
+        if(result != (nan ? half|0x200 : half)) {
+            CORRADE_COMPARE(result, half);
+            return;
+        }
+    }
+}
+
+void PackingTest::halfVector() {
+    CORRADE_COMPARE(Math::packHalf(Vector3(1.0f, -2.5f, 65504.0f)), Vector3us(0x3c00, 0xc100, 0x7bff));
+    CORRADE_COMPARE(Math::unpackHalf(Vector3us(0x3c00, 0xc100, 0x7bff)), Vector3(1.0f, -2.5f, 65504.0f));
+}
+
+void PackingTest::packHalfBatch() {
+    /* Special values and a sweep over the whole float range, not a multiple
+       of eight to test the remainder handling of SIMD code */
+    std::vector<Float> in{0.0f, -0.0f, 1.0f, 65520.0f, 2.9802322e-8f, 8.940697e-8f,
+        6.1005353e-5f, 1.0f + 1.0f/2048.0f, 1.0f + 3.0f/2048.0f,
+        std::numeric_limits<Float>::infinity(), -std::numeric_limits<Float>::infinity(),
+        floatFromBits(0x7f8f0000), floatFromBits(0xffc00001),
+        floatFromBits(0x00000001), floatFromBits(0x807fffff)};
+    for(UnsignedInt bits = 0; bits < 0xffff0000u; bits += 0x1357)
+        in.push_back(floatFromBits(bits));
+    in.push_back(0.5f);
+
+    std::vector<UnsignedShort> out(in.size());
+    Math::packHalf(input(in), output(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i) if(out[i] != Math::packHalf(in[i])) {
+        CORRADE_COMPARE(out[i], Math::packHalf(in[i]));
+        return;
+    }
+}
+
+void PackingTest::unpackHalfBatch() {
+    std::vector<UnsignedShort> in;
+    for(UnsignedInt i = 0; i != 65536; ++i)
+        in.push_back(UnsignedShort(i));
+    in.push_back(0x3c00);
+
+    std::vector<Float> out(in.size());
+    Math::unpackHalf(input(in), output(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i) if(bitsFromFloat(out[i]) != bitsFromFloat(Math::unpackHalf(in[i]))) {
+        CORRADE_COMPARE(bitsFromFloat(out[i]), bitsFromFloat(Math::unpackHalf(in[i])));
+        return;
+    }
+}
+
+template<class T> void PackingTest::normalizeBatch() {
+    std::vector<T> in;
+    for(Int i = std::numeric_limits<T>::min(); i <= std::numeric_limits<T>::max(); ++i)
+        in.push_back(T(i));
+    in.push_back(std::numeric_limits<T>::max());
+
+    std::vector<Float> out(in.size());
+    Math::normalize(input(in), output(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i) if(out[i] != Math::normalize<Float, T>(in[i])) {
+        CORRADE_COMPARE(out[i], (Math::normalize<Float, T>(in[i])));
+        return;
+    }
+}
+
+template<class T> void PackingTest::denormalizeBatch() {
+    std::vector<Float> in;
+    const Float min = std::is_signed<T>::value ? -1.0f : 0.0f;
+    for(Int i = 0; i <= 10000; ++i)
+        in.push_back(min + (1.0f - min)*i/10000.0f);
+    in.push_back(0.5f);
+
+    std::vector<T> out(in.size());
+    Math::denormalize(input(in), output(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i) if(out[i] != Math::denormalize<T>(in[i])) {
+        CORRADE_COMPARE(out[i], Math::denormalize<T>(in[i]));
+        return;
+    }
+
+    /* Values out of range are saturated */
+    const std::vector<Float> outOfRange{-2.0f, 2.0f, -1.0e10f, 1.0e10f, -2.0f, 2.0f, -1.0e10f, 1.0e10f, -2.0f};
+    out.resize(outOfRange.size());
+    Math::denormalize(input(outOfRange), output(out));
+    for(std::size_t i = 0; i != outOfRange.size(); ++i)
+        CORRADE_COMPARE(out[i], outOfRange[i] < 0.0f ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max());
+}
+
+void PackingTest::sizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const std::vector<Float> floats(11);
+    std::vector<UnsignedShort> halves(10);
+    Math::packHalf(input(floats), output(halves));
+    CORRADE_COMPARE(o.str(), "Math::packHalf(): expected output array of size 11 but got 10\n");
+
+    o.str({});
+    std::vector<Float> out(9);
+    Math::unpackHalf(input(halves), output(out));
+    CORRADE_COMPARE(o.str(), "Math::unpackHalf(): expected output array of size 10 but got 9\n");
+
+    o.str({});
+    const std::vector<Short> shorts(3);
+    Math::normalize(input(shorts), output(out));
+    CORRADE_COMPARE(o.str(), "Math::normalize(): expected output array of size 3 but got 9\n");
+
+    o.str({});
+    std::vector<UnsignedByte> bytes(12);
+    Math::denormalize(input(floats), output(bytes));
+    CORRADE_COMPARE(o.str(), "Math::denormalize(): expected output array of size 11 but got 12\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingTest)
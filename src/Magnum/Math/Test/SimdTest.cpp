@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Verifies that the SIMD specializations give the same results as the generic
+   implementation. Reference values are calculated in double precision, which
+   is never specialized. If the SIMD build is not enabled, the tests verify the
+   generic implementation against itself. */
+class SimdTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit SimdTest();
+
+        void multiply();
+        void transformVector();
+        void transformPoint();
+        void inverted();
+        void invertedRigid();
+        void dot();
+        void lerp();
+        void lerpDerived();
+};
+
+typedef Math::Rad<Float> Rad;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector4<Double> Vector4d;
+typedef Math::Matrix4<Double> Matrix4d;
+
+namespace {
+
+const Matrix4 a({ 3.0f,  5.0f, 8.0f,  4.0f},
+                { 4.0f,  4.0f, 7.0f,  3.0f},
+                { 7.0f, -1.0f, 8.0f,  0.0f},
+                { 9.0f,  4.0f, 5.0f,  9.0f});
+const Matrix4 b({-2.5f,  1.5f, 0.5f,  0.0f},
+                { 0.75f, 3.0f, 1.0f, -1.0f},
+                { 2.0f, -0.5f, 4.0f,  2.25f},
+                { 1.0f,  2.0f, 3.0f,  1.0f});
+
+}
+
+SimdTest::SimdTest() {
+    addTests({&SimdTest::multiply,
+              &SimdTest::transformVector,
+              &SimdTest::transformPoint,
+              &SimdTest::inverted,
+              &SimdTest::invertedRigid,
+              &SimdTest::dot,
+              &SimdTest::lerp,
+              &SimdTest::lerpDerived});
+}
+
+void SimdTest::multiply() {
+    CORRADE_COMPARE(a*b, Matrix4(Matrix4d(a)*Matrix4d(b)));
+    CORRADE_COMPARE(b*a, Matrix4(Matrix4d(b)*Matrix4d(a)));
+}
+
+void SimdTest::transformVector() {
+    const Vector4 v(1.5f, -2.0f, 0.25f, 3.0f);
+    CORRADE_COMPARE(a*v, Vector4(Matrix4d(a)*Vector4d(v)));
+    CORRADE_COMPARE(a.transformVector(v.xyz()), Vector4(Matrix4d(a)*Vector4d(Vector4(v.xyz(), 0.0f))).xyz());
+}
+
+void SimdTest::transformPoint() {
+    const Vector3 p(1.5f, -2.0f, 0.25f);
+    CORRADE_COMPARE(b.transformPoint(p), Vector4(Matrix4d(b)*Vector4d(Vector4(p, 1.0f))).xyz());
+}
+
+void SimdTest::inverted() {
+    const Matrix4 inverse = a.inverted();
+    CORRADE_COMPARE(inverse, Matrix4(Matrix4d(a).inverted()));
+    CORRADE_COMPARE(inverse*a, Matrix4());
+    CORRADE_COMPARE(b.inverted(), Matrix4(Matrix4d(b).inverted()));
+}
+
+void SimdTest::invertedRigid() {
+    const Matrix4 rigid = Matrix4::translation({1.0f, -2.0f, 3.5f})*
+        Matrix4::rotation(Rad(0.7f), Vector3(1.0f, 2.0f, -3.0f).normalized());
+    CORRADE_COMPARE(rigid.invertedRigid(), Matrix4(Matrix4d(rigid).inverted()));
+    CORRADE_COMPARE(rigid.invertedRigid(), rigid.inverted());
+    CORRADE_COMPARE(rigid.invertedRigid()*rigid, Matrix4());
+}
+
+void SimdTest::dot() {
+    const Vector4 u(1.5f, -2.0f, 0.25f, 3.0f);
+    const Vector4 v(-4.0f, 0.5f, 8.0f, 1.25f);
+    CORRADE_COMPARE(Vector4::dot(u, v), Float(Vector4d::dot(Vector4d(u), Vector4d(v))));
+    CORRADE_COMPARE(u.dot(), 15.3125f);
+    CORRADE_COMPARE(v.length(), 9.045026f);
+}
+
+void SimdTest::lerp() {
+    const Vector4 u(1.5f, -2.0f, 0.25f, 3.0f);
+    const Vector4 v(-4.0f, 0.5f, 8.0f, 1.25f);
+
+    /* Same operation order as the generic implementation, thus the results
+       are expected to be bit-exact */
+    const Vector4 expected((1.0f - 0.3f)*u[0] + 0.3f*v[0],
+                           (1.0f - 0.3f)*u[1] + 0.3f*v[1],
+                           (1.0f - 0.3f)*u[2] + 0.3f*v[2],
+                           (1.0f - 0.3f)*u[3] + 0.3f*v[3]);
+    const Vector4 actual = Math::lerp(u, v, 0.3f);
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_VERIFY(actual[i] == expected[i]);
+
+    const Math::Vector<4, Float> actualBase = Math::lerp(Math::Vector<4, Float>(u), Math::Vector<4, Float>(v), 0.3f);
+    CORRADE_VERIFY(actualBase == actual);
+}
+
+void SimdTest::lerpDerived() {
+    /* The specialization has to preserve the derived type */
+    CORRADE_VERIFY((std::is_same<decltype(Math::lerp(Vector4(), Vector4(), 0.5f)), Vector4>::value));
+    CORRADE_COMPARE(Math::lerp(Vector4(1.0f, 2.0f, 3.0f, 4.0f), Vector4(3.0f, 2.0f, 1.0f, 0.0f), 0.5f), Vector4(2.0f, 2.0f, 2.0f, 2.0f));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SimdTest)
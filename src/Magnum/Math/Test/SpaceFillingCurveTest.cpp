@@ -0,0 +1,343 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <limits>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/SpaceFillingCurve.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+class SpaceFillingCurveTest: public Corrade::TestSuite::Tester {
+    public:
+        explicit SpaceFillingCurveTest();
+
+        void morton2D();
+        void morton3D();
+        void mortonGeneric();
+        void hilbert2D();
+        void hilbert3D();
+        void hilbertNeighbors();
+
+        void mortonKeys2D();
+        void mortonKeys3D();
+        void hilbertKeys();
+
+        void radixSort();
+        void radixSortSameKeys();
+        void radixSortEmpty();
+
+        void sizeMismatch();
+};
+
+typedef Math::Vector2<UnsignedShort> Vector2us;
+typedef Math::Vector3<UnsignedShort> Vector3us;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Range2D<Float> Range2D;
+typedef Math::Range3D<Float> Range3D;
+
+SpaceFillingCurveTest::SpaceFillingCurveTest() {
+    addTests({&SpaceFillingCurveTest::morton2D,
+              &SpaceFillingCurveTest::morton3D,
+              &SpaceFillingCurveTest::mortonGeneric,
+              &SpaceFillingCurveTest::hilbert2D,
+              &SpaceFillingCurveTest::hilbert3D,
+              &SpaceFillingCurveTest::hilbertNeighbors,
+
+              &SpaceFillingCurveTest::mortonKeys2D,
+              &SpaceFillingCurveTest::mortonKeys3D,
+              &SpaceFillingCurveTest::hilbertKeys,
+
+              &SpaceFillingCurveTest::radixSort,
+              &SpaceFillingCurveTest::radixSortSameKeys,
+              &SpaceFillingCurveTest::radixSortEmpty,
+
+              &SpaceFillingCurveTest::sizeMismatch});
+}
+
+namespace {
+
+UnsignedInt random(UnsignedInt& state) {
+    state = state*1664525 + 1013904223;
+    return state;
+}
+
+}
+
+void SpaceFillingCurveTest::morton2D() {
+    CORRADE_COMPARE(mortonEncode(Vector2us(0, 0)), 0);
+    CORRADE_COMPARE(mortonEncode(Vector2us(1, 0)), 1);
+    CORRADE_COMPARE(mortonEncode(Vector2us(0, 1)), 2);
+    CORRADE_COMPARE(mortonEncode(Vector2us(5, 3)), 0x1b);
+    CORRADE_COMPARE(mortonEncode(Vector2us(0xffff, 0)), 0x55555555);
+    CORRADE_COMPARE(mortonEncode(Vector2us(0, 0xffff)), 0xaaaaaaaa);
+
+    CORRADE_COMPARE(mortonDecode2D(0x1b), Vector2us(5, 3));
+    CORRADE_COMPARE(mortonDecode2D(0xaaaaaaaa), Vector2us(0, 0xffff));
+
+    /* Keys of a 16x16 corner are all values from 0 to 255 */
+    std::vector<bool> found(256);
+    for(UnsignedShort y = 0; y != 16; ++y) for(UnsignedShort x = 0; x != 16; ++x) {
+        const UnsignedInt key = mortonEncode(Vector2us(x, y));
+        CORRADE_VERIFY(key < 256);
+        CORRADE_VERIFY(!found[key]);
+        found[key] = true;
+    }
+
+    UnsignedInt state = 0x12345678;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const UnsignedInt key = random(state);
+        CORRADE_COMPARE(mortonEncode(mortonDecode2D(key)), key);
+    }
+}
+
+void SpaceFillingCurveTest::morton3D() {
+    CORRADE_COMPARE(mortonEncode(Vector3us(1, 0, 0)), 1);
+    CORRADE_COMPARE(mortonEncode(Vector3us(0, 1, 0)), 2);
+    CORRADE_COMPARE(mortonEncode(Vector3us(0, 0, 1)), 4);
+    CORRADE_COMPARE(mortonEncode(Vector3us(1, 2, 4)), 0x111);
+    CORRADE_COMPARE(mortonEncode(Vector3us(0x3ff, 0x3ff, 0x3ff)), 0x3fffffff);
+
+    /* Upper bits are ignored */
+    CORRADE_COMPARE(mortonEncode(Vector3us(0xfc01, 0x400, 0)), 1);
+    CORRADE_COMPARE(mortonDecode3D(0xc0000111), Vector3us(1, 2, 4));
+
+    /* Keys of a 8x8x8 corner are all values from 0 to 511 */
+    std::vector<bool> found(512);
+    for(UnsignedShort z = 0; z != 8; ++z) for(UnsignedShort y = 0; y != 8; ++y) for(UnsignedShort x = 0; x != 8; ++x) {
+        const UnsignedInt key = mortonEncode(Vector3us(x, y, z));
+        CORRADE_VERIFY(key < 512);
+        CORRADE_VERIFY(!found[key]);
+        found[key] = true;
+    }
+
+    UnsignedInt state = 0x12345678;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const UnsignedInt key = random(state) & 0x3fffffff;
+        CORRADE_COMPARE(mortonEncode(mortonDecode3D(key)), key);
+    }
+}
+
+void SpaceFillingCurveTest::mortonGeneric() {
+    /* The public functions might use BMI2 instructions, verify that they
+       give the same results as the portable implementation */
+    UnsignedInt state = 0x87654321;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const UnsignedInt a = random(state);
+        const UnsignedInt b = random(state);
+        const Vector2us v2(UnsignedShort(a), UnsignedShort(a >> 16));
+        const Vector3us v3(UnsignedShort(b), UnsignedShort(b >> 10), UnsignedShort(b >> 20));
+        CORRADE_COMPARE(mortonEncode(v2), Implementation::mortonEncode(v2));
+        CORRADE_COMPARE(mortonEncode(v3), Implementation::mortonEncode(v3));
+        CORRADE_COMPARE(mortonDecode2D(a), Implementation::mortonDecode2D(a));
+        CORRADE_COMPARE(mortonDecode3D(b), Implementation::mortonDecode3D(b));
+    }
+}
+
+void SpaceFillingCurveTest::hilbert2D() {
+    CORRADE_COMPARE(hilbertEncode(Vector2us(0, 0)), 0);
+    CORRADE_COMPARE(hilbertEncode(Vector2us(1, 0)), 1);
+    CORRADE_COMPARE(hilbertEncode(Vector2us(1, 1)), 2);
+    CORRADE_COMPARE(hilbertEncode(Vector2us(0, 1)), 3);
+    CORRADE_COMPARE(hilbertEncode(Vector2us(0, 2)), 4);
+    CORRADE_COMPARE(hilbertDecode2D(15), Vector2us(3, 0));
+
+    /* Keys of a 16x16 corner are all values from 0 to 255 */
+    std::vector<bool> found(256);
+    for(UnsignedShort y = 0; y != 16; ++y) for(UnsignedShort x = 0; x != 16; ++x) {
+        const UnsignedInt key = hilbertEncode(Vector2us(x, y));
+        CORRADE_VERIFY(key < 256);
+        CORRADE_VERIFY(!found[key]);
+        found[key] = true;
+    }
+
+    UnsignedInt state = 0x12345678;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const UnsignedInt key = random(state);
+        CORRADE_COMPARE(hilbertEncode(hilbertDecode2D(key)), key);
+    }
+}
+
+void SpaceFillingCurveTest::hilbert3D() {
+    CORRADE_COMPARE(hilbertEncode(Vector3us(0, 0, 0)), 0);
+    CORRADE_COMPARE(hilbertEncode(Vector3us(0, 0, 1)), 1);
+    CORRADE_COMPARE(hilbertEncode(Vector3us(0, 1, 1)), 2);
+    CORRADE_COMPARE(hilbertDecode3D(7), Vector3us(1, 0, 0));
+
+    /* Upper bits are ignored */
+    CORRADE_COMPARE(hilbertEncode(Vector3us(0xfc00, 0x400, 0xfc01)), 1);
+
+    /* Keys of a 8x8x8 corner are all values from 0 to 511 */
+    std::vector<bool> found(512);
+    for(UnsignedShort z = 0; z != 8; ++z) for(UnsignedShort y = 0; y != 8; ++y) for(UnsignedShort x = 0; x != 8; ++x) {
+        const UnsignedInt key = hilbertEncode(Vector3us(x, y, z));
+        CORRADE_VERIFY(key < 512);
+        CORRADE_VERIFY(!found[key]);
+        found[key] = true;
+    }
+
+    UnsignedInt state = 0x12345678;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const UnsignedInt key = random(state) & 0x3fffffff;
+        CORRADE_COMPARE(hilbertEncode(hilbertDecode3D(key)), key);
+    }
+}
+
+void SpaceFillingCurveTest::hilbertNeighbors() {
+    /* Cells with successive keys are always adjacent */
+    UnsignedInt state = 0x12345678;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        const UnsignedInt key2 = random(state) % 0xffffffff;
+        const Math::Vector2<Int> a2(hilbertDecode2D(key2));
+        const Math::Vector2<Int> b2(hilbertDecode2D(key2 + 1));
+        CORRADE_COMPARE(Math::abs(b2 - a2).sum(), 1);
+
+        const UnsignedInt key3 = random(state) % 0x3fffffff;
+        const Math::Vector3<Int> a3(hilbertDecode3D(key3));
+        const Math::Vector3<Int> b3(hilbertDecode3D(key3 + 1));
+        CORRADE_COMPARE(Math::abs(b3 - a3).sum(), 1);
+    }
+}
+
+void SpaceFillingCurveTest::mortonKeys2D() {
+    const Vector2 points[]{
+        {-1.0f, 2.0f},
+        {3.0f, 6.0f},
+        {1.0f, 4.0f},
+        /* Outside, gets clamped */
+        {-5.0f, 100.0f},
+        {std::numeric_limits<Float>::quiet_NaN(), 2.0f}
+    };
+    UnsignedInt keys[5];
+    mortonKeys(Range2D{{-1.0f, 2.0f}, {3.0f, 6.0f}}, points, keys);
+
+    CORRADE_COMPARE(keys[0], mortonEncode(Vector2us(0, 0)));
+    CORRADE_COMPARE(keys[1], mortonEncode(Vector2us(0xffff, 0xffff)));
+    CORRADE_COMPARE(keys[2], mortonEncode(Vector2us(0x8000, 0x8000)));
+    CORRADE_COMPARE(keys[3], mortonEncode(Vector2us(0, 0xffff)));
+    CORRADE_COMPARE(keys[4], mortonEncode(Vector2us(0, 0)));
+
+    /* Degenerate range */
+    mortonKeys(Range2D{{-1.0f, 2.0f}, {-1.0f, 6.0f}}, points, keys);
+    CORRADE_COMPARE(keys[2], mortonEncode(Vector2us(0, 0x8000)));
+}
+
+void SpaceFillingCurveTest::mortonKeys3D() {
+    const Vector3 points[]{
+        {-1.0f, 2.0f, 0.0f},
+        {3.0f, 6.0f, 1.0f},
+        {1.0f, 4.0f, 0.25f},
+        /* Outside, gets clamped */
+        {-5.0f, 100.0f, 0.5f}
+    };
+    UnsignedInt keys[4];
+    mortonKeys(Range3D{{-1.0f, 2.0f, 0.0f}, {3.0f, 6.0f, 1.0f}}, points, keys);
+
+    CORRADE_COMPARE(keys[0], mortonEncode(Vector3us(0, 0, 0)));
+    CORRADE_COMPARE(keys[1], mortonEncode(Vector3us(1023, 1023, 1023)));
+    CORRADE_COMPARE(keys[2], mortonEncode(Vector3us(512, 512, 256)));
+    CORRADE_COMPARE(keys[3], mortonEncode(Vector3us(0, 1023, 512)));
+}
+
+void SpaceFillingCurveTest::hilbertKeys() {
+    const Vector2 points2[]{{-1.0f, 2.0f}, {3.0f, 6.0f}, {1.0f, 4.0f}};
+    UnsignedInt keys2[3];
+    Math::hilbertKeys(Range2D{{-1.0f, 2.0f}, {3.0f, 6.0f}}, points2, keys2);
+    CORRADE_COMPARE(keys2[0], hilbertEncode(Vector2us(0, 0)));
+    CORRADE_COMPARE(keys2[1], hilbertEncode(Vector2us(0xffff, 0xffff)));
+    CORRADE_COMPARE(keys2[2], hilbertEncode(Vector2us(0x8000, 0x8000)));
+
+    const Vector3 points3[]{{-1.0f, 2.0f, 0.0f}, {3.0f, 6.0f, 1.0f}, {1.0f, 4.0f, 0.25f}};
+    UnsignedInt keys3[3];
+    Math::hilbertKeys(Range3D{{-1.0f, 2.0f, 0.0f}, {3.0f, 6.0f, 1.0f}}, points3, keys3);
+    CORRADE_COMPARE(keys3[0], hilbertEncode(Vector3us(0, 0, 0)));
+    CORRADE_COMPARE(keys3[1], hilbertEncode(Vector3us(1023, 1023, 1023)));
+    CORRADE_COMPARE(keys3[2], hilbertEncode(Vector3us(512, 512, 256)));
+}
+
+void SpaceFillingCurveTest::radixSort() {
+    /* Few distinct values so the stability gets tested, differing in all
+       three digits */
+    std::vector<UnsignedInt> keys;
+    UnsignedInt state = 0x12345678;
+    for(std::size_t i = 0; i != 10000; ++i) {
+        const UnsignedInt value = random(state) >> 26;
+        keys.push_back((value << 26)|(value << 13)|value);
+    }
+
+    std::vector<UnsignedInt> permutation(keys.size());
+    radixSortPermutation({keys.data(), keys.size()}, {permutation.data(), permutation.size()});
+    for(std::size_t i = 1; i != keys.size(); ++i) {
+        const UnsignedInt previous = keys[permutation[i - 1]];
+        const UnsignedInt current = keys[permutation[i]];
+        CORRADE_VERIFY(previous < current || (previous == current && permutation[i - 1] < permutation[i]));
+    }
+
+    /* Keys differing only in the upper digit, two passes are skipped and the
+       result has to be copied from the temporary buffer */
+    const UnsignedInt upper[]{0xc0000000, 0x40000000, 0x80000000, 0x40000000};
+    UnsignedInt upperPermutation[4];
+    radixSortPermutation(upper, upperPermutation);
+    CORRADE_COMPARE(upperPermutation[0], 1);
+    CORRADE_COMPARE(upperPermutation[1], 3);
+    CORRADE_COMPARE(upperPermutation[2], 2);
+    CORRADE_COMPARE(upperPermutation[3], 0);
+}
+
+void SpaceFillingCurveTest::radixSortSameKeys() {
+    const UnsignedInt keys[]{7, 7, 7};
+    UnsignedInt permutation[]{5, 5, 5};
+    radixSortPermutation(keys, permutation);
+    CORRADE_COMPARE(permutation[0], 0);
+    CORRADE_COMPARE(permutation[1], 1);
+    CORRADE_COMPARE(permutation[2], 2);
+}
+
+void SpaceFillingCurveTest::radixSortEmpty() {
+    radixSortPermutation(nullptr, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void SpaceFillingCurveTest::sizeMismatch() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    const Vector3 points[3];
+    UnsignedInt keys[2];
+    mortonKeys(Range3D{}, points, keys);
+    Math::hilbertKeys(Range3D{}, points, keys);
+    radixSortPermutation(keys, {keys, 1});
+    CORRADE_COMPARE(o.str(), "Math::mortonKeys(): expected output array of size 3 but got 2\n"
+                             "Math::hilbertKeys(): expected output array of size 3 but got 2\n"
+                             "Math::radixSortPermutation(): expected output array of size 2 but got 1\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SpaceFillingCurveTest)
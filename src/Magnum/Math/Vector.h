@@ -39,6 +39,7 @@
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/BoolVector.h"
 #include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Implementation/simd.h"
 
 namespace Magnum { namespace Math {
 
@@ -1310,6 +1311,12 @@ template<std::size_t size, class T> inline T Vector<size, T>::max() const {
     return out;
 }
 
+#ifdef MAGNUM_MATH_SIMD
+template<> inline Float Vector<4, Float>::dot(const Vector<4, Float>& a, const Vector<4, Float>& b) {
+    return Implementation::simdDot(a._data, b._data);
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
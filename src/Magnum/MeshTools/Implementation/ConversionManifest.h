@@ -0,0 +1,104 @@
+#ifndef Magnum_MeshTools_Implementation_ConversionManifest_h
+#define Magnum_MeshTools_Implementation_ConversionManifest_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Corrade/Utility/Configuration.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace MeshTools { namespace Implementation {
+
+/* Hashes of input files of magnum-assetconverter together with output files
+   produced from them, stored in the output directory and used to skip files
+   which didn't change since the last run. Each input file has its own `file`
+   group, as file paths can't be used as group names. The manifest is
+   rewritten from scratch on every run, so only files recorded in current run
+   are kept and entries of input files which were removed or failed to
+   convert are dropped. */
+class ConversionManifest {
+    public:
+        explicit ConversionManifest(const std::string& outputDirectory): _outputDirectory{outputDirectory}, _previous{Utility::Directory::join(outputDirectory, ".magnum-assetconverter.conf"), Utility::Configuration::Flag::ReadOnly}, _current{_previous.filename(), Utility::Configuration::Flag::Truncate}, _recorded{false} {
+            for(const Utility::ConfigurationGroup* group: _previous.groups("file"))
+                _previousFiles.emplace(group->value("input"), group);
+        }
+
+        std::string filename() const { return _previous.filename(); }
+
+        /* Whether given file was converted in previous run from data with
+           the same hash and all output files produced from it still exist.
+           Only reads the previous state, thus it's safe to call it from
+           multiple threads. */
+        bool isUpToDate(const std::string& file, const std::string& hash) const {
+            const auto found = _previousFiles.find(file);
+            if(found == _previousFiles.end() || found->second->value("hash") != hash)
+                return false;
+
+            for(const std::string& output: found->second->values("output"))
+                if(!Utility::Directory::fileExists(Utility::Directory::join(_outputDirectory, output))) return false;
+            return true;
+        }
+
+        /* Output files produced from given file in previous run, relative to
+           the output directory */
+        std::vector<std::string> outputs(const std::string& file) const {
+            const auto found = _previousFiles.find(file);
+            return found == _previousFiles.end() ? std::vector<std::string>{} : found->second->values("output");
+        }
+
+        /* Records hash of file which was converted or skipped in this run
+           together with output files produced from it */
+        void record(const std::string& file, const std::string& hash, const std::vector<std::string>& outputs) {
+            Utility::ConfigurationGroup* const group = _current.addGroup("file");
+            group->setValue("input", file);
+            group->setValue("hash", hash);
+            for(const std::string& output: outputs)
+                group->addValue("output", output);
+            _recorded = true;
+        }
+
+        /* Saves the recorded hashes. The file isn't created if nothing was
+           recorded and there's nothing to prune. */
+        bool save() {
+            if(!_recorded && !Utility::Directory::fileExists(_previous.filename()))
+                return true;
+            return Utility::Directory::mkpath(Utility::Directory::path(_previous.filename())) && _current.save();
+        }
+
+    private:
+        std::string _outputDirectory;
+        Utility::Configuration _previous;
+        Utility::Configuration _current;
+        std::unordered_map<std::string, const Utility::ConfigurationGroup*> _previousFiles;
+        bool _recorded;
+};
+
+}}}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef Magnum_MeshTools_Implementation_meshView_h
+#define Magnum_MeshTools_Implementation_meshView_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Implementation {
+
+/* Dimension-independent view on the first position, normal and texture
+   coordinate array, used by mesh converter plugins to share one export
+   implementation for both 2D and 3D meshes */
+struct MeshView {
+    MeshPrimitive primitive;
+    const std::vector<UnsignedInt>* indices;
+    const Float* positions;
+    std::size_t positionSize;
+    std::size_t vertexCount;
+    const Vector3* normals;
+    std::size_t normalCount;
+    const Vector2* textureCoords;
+    std::size_t textureCoordCount;
+};
+
+inline MeshView meshView(const Trade::MeshData2D& mesh) {
+    return MeshView{mesh.primitive(),
+        mesh.isIndexed() ? &mesh.indices() : nullptr,
+        mesh.positionArrayCount() ? reinterpret_cast<const Float*>(mesh.positions(0).data()) : nullptr, 2,
+        mesh.positionArrayCount() ? mesh.positions(0).size() : 0,
+        nullptr, 0,
+        mesh.hasTextureCoords2D() ? mesh.textureCoords2D(0).data() : nullptr,
+        mesh.hasTextureCoords2D() ? mesh.textureCoords2D(0).size() : 0};
+}
+
+inline MeshView meshView(const Trade::MeshData3D& mesh) {
+    return MeshView{mesh.primitive(),
+        mesh.isIndexed() ? &mesh.indices() : nullptr,
+        mesh.positionArrayCount() ? reinterpret_cast<const Float*>(mesh.positions(0).data()) : nullptr, 3,
+        mesh.positionArrayCount() ? mesh.positions(0).size() : 0,
+        mesh.hasNormals() ? mesh.normals(0).data() : nullptr,
+        mesh.hasNormals() ? mesh.normals(0).size() : 0,
+        mesh.hasTextureCoords2D() ? mesh.textureCoords2D(0).data() : nullptr,
+        mesh.hasTextureCoords2D() ? mesh.textureCoords2D(0).size() : 0};
+}
+
+}}}
+
+#endif
@@ -0,0 +1,231 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Skin.h"
+
+#include <cstring>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Implementation/simd.h"
+#include "Magnum/Implementation/parallelRows.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Blended transformation is applied to both position and normal, so it makes
+   sense to compute it only once per vertex. Output is strided to support both
+   tightly packed arrays and interleaved buffers. */
+struct Output {
+    char* positions;
+    char* normals;
+    std::size_t stride;
+};
+
+inline void write(char* const to, const Vector3& value) {
+    std::memcpy(to, value.data(), sizeof(Vector3));
+}
+
+void skinVertices(const Containers::ArrayReference<const Matrix4> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals, const Output& out, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) {
+        const Vector4ui& j = joints[i];
+        const Vector4& w = weights[i];
+        const Vector3& p = positions[i];
+
+        #ifdef MAGNUM_MATH_SIMD
+        /* Weighted sum of the four matrices, column by column */
+        const Math::Implementation::SimdFloat4 w0 = Math::Implementation::simdSplat(w[0]);
+        const Math::Implementation::SimdFloat4 w1 = Math::Implementation::simdSplat(w[1]);
+        const Math::Implementation::SimdFloat4 w2 = Math::Implementation::simdSplat(w[2]);
+        const Math::Implementation::SimdFloat4 w3 = Math::Implementation::simdSplat(w[3]);
+        const Float* const m0 = palette[j[0]].data();
+        const Float* const m1 = palette[j[1]].data();
+        const Float* const m2 = palette[j[2]].data();
+        const Float* const m3 = palette[j[3]].data();
+        Math::Implementation::SimdFloat4 c[4];
+        for(std::size_t col = 0; col != 4; ++col) c[col] =
+            Math::Implementation::simdAdd(
+                Math::Implementation::simdAdd(
+                    Math::Implementation::simdMul(w0, Math::Implementation::simdLoad(m0 + col*4)),
+                    Math::Implementation::simdMul(w1, Math::Implementation::simdLoad(m1 + col*4))),
+                Math::Implementation::simdAdd(
+                    Math::Implementation::simdMul(w2, Math::Implementation::simdLoad(m2 + col*4)),
+                    Math::Implementation::simdMul(w3, Math::Implementation::simdLoad(m3 + col*4))));
+
+        /* Storing all four components would overwrite whatever is after the
+           attribute, go through a temporary */
+        Float result[4];
+        Math::Implementation::simdStore(result,
+            Math::Implementation::simdAdd(
+                Math::Implementation::simdAdd(
+                    Math::Implementation::simdMul(c[0], Math::Implementation::simdSplat(p.x())),
+                    Math::Implementation::simdMul(c[1], Math::Implementation::simdSplat(p.y()))),
+                Math::Implementation::simdAdd(
+                    Math::Implementation::simdMul(c[2], Math::Implementation::simdSplat(p.z())), c[3])));
+        std::memcpy(out.positions + i*out.stride, result, sizeof(Vector3));
+
+        if(out.normals) {
+            const Vector3& n = normals[i];
+            Math::Implementation::simdStore(result,
+                Math::Implementation::simdAdd(
+                    Math::Implementation::simdAdd(
+                        Math::Implementation::simdMul(c[0], Math::Implementation::simdSplat(n.x())),
+                        Math::Implementation::simdMul(c[1], Math::Implementation::simdSplat(n.y()))),
+                    Math::Implementation::simdMul(c[2], Math::Implementation::simdSplat(n.z()))));
+            write(out.normals + i*out.stride, Vector3(result[0], result[1], result[2]).normalized());
+        }
+        #else
+        const Matrix4 m = palette[j[0]]*w[0] + palette[j[1]]*w[1] + palette[j[2]]*w[2] + palette[j[3]]*w[3];
+        write(out.positions + i*out.stride, m.transformPoint(p));
+        if(out.normals) write(out.normals + i*out.stride, (m.rotationScaling()*normals[i]).normalized());
+        #endif
+    }
+}
+
+/* Optimized form of q*v*conjugate(q) for normalized quaternion q */
+inline Vector3 rotate(const Float (&q)[4], const Vector3& v) {
+    const Float c[]{
+        q[1]*v.z() - q[2]*v.y() + q[3]*v.x(),
+        q[2]*v.x() - q[0]*v.z() + q[3]*v.y(),
+        q[0]*v.y() - q[1]*v.x() + q[3]*v.z()};
+    return {v.x() + 2.0f*(q[1]*c[2] - q[2]*c[1]),
+            v.y() + 2.0f*(q[2]*c[0] - q[0]*c[2]),
+            v.z() + 2.0f*(q[0]*c[1] - q[1]*c[0])};
+}
+
+void skinVertices(const Containers::ArrayReference<const DualQuaternion> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals, const Output& out, const std::size_t begin, const std::size_t end) {
+    /* The dual quaternions are blended as plain arrays of eight floats */
+    static_assert(sizeof(DualQuaternion) == 8*sizeof(Float), "DualQuaternion is not tightly packed");
+
+    for(std::size_t i = begin; i != end; ++i) {
+        const Vector4ui& j = joints[i];
+        const Vector4& w = weights[i];
+        const DualQuaternion* const q[]{&palette[j[0]], &palette[j[1]], &palette[j[2]], &palette[j[3]]};
+
+        /* Flip quaternions lying in the other hemisphere than the first one
+           so the blend takes the shortest path */
+        Float s[4];
+        s[0] = w[0];
+        for(std::size_t k = 1; k != 4; ++k)
+            s[k] = Quaternion::dot(q[0]->real(), q[k]->real()) < 0.0f ? -w[k] : w[k];
+
+        /* Real part in the first four components, dual in the other four */
+        Float blended[8];
+        #ifdef MAGNUM_MATH_SIMD
+        Math::Implementation::SimdFloat4 real = Math::Implementation::simdSplat(0.0f);
+        Math::Implementation::SimdFloat4 dual = Math::Implementation::simdSplat(0.0f);
+        for(std::size_t k = 0; k != 4; ++k) {
+            const Float* const data = reinterpret_cast<const Float*>(q[k]);
+            const Math::Implementation::SimdFloat4 weight = Math::Implementation::simdSplat(s[k]);
+            real = Math::Implementation::simdAdd(real, Math::Implementation::simdMul(weight, Math::Implementation::simdLoad(data)));
+            dual = Math::Implementation::simdAdd(dual, Math::Implementation::simdMul(weight, Math::Implementation::simdLoad(data + 4)));
+        }
+        Math::Implementation::simdStore(blended, real);
+        Math::Implementation::simdStore(blended + 4, dual);
+        #else
+        for(std::size_t c = 0; c != 8; ++c) blended[c] = 0.0f;
+        for(std::size_t k = 0; k != 4; ++k) {
+            const Float* const data = reinterpret_cast<const Float*>(q[k]);
+            for(std::size_t c = 0; c != 8; ++c) blended[c] += s[k]*data[c];
+        }
+        #endif
+
+        /* Normalize and extract translation as 2*dual*conjugate(real). The
+           dual part doesn't stay orthogonal to the real part after blending,
+           but the extraction ignores the difference. Spelled out in scalars,
+           which is about twice as fast as going through the Math types
+           here. */
+        const Float invLength = 1.0f/std::sqrt(blended[0]*blended[0] + blended[1]*blended[1] + blended[2]*blended[2] + blended[3]*blended[3]);
+        const Float r[]{blended[0]*invLength, blended[1]*invLength, blended[2]*invLength, blended[3]*invLength};
+        const Float d[]{blended[4]*invLength, blended[5]*invLength, blended[6]*invLength, blended[7]*invLength};
+        const Vector3 translation{
+            2.0f*(r[3]*d[0] - d[3]*r[0] + r[1]*d[2] - r[2]*d[1]),
+            2.0f*(r[3]*d[1] - d[3]*r[1] + r[2]*d[0] - r[0]*d[2]),
+            2.0f*(r[3]*d[2] - d[3]*r[2] + r[0]*d[1] - r[1]*d[0])};
+
+        write(out.positions + i*out.stride, rotate(r, positions[i]) + translation);
+        if(out.normals) write(out.normals + i*out.stride, rotate(r, normals[i]));
+    }
+}
+
+template<class T> bool checkInputs(const char* const function, const Containers::ArrayReference<const T> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals) {
+    CORRADE_ASSERT(joints.size() == positions.size() && weights.size() == positions.size() && (normals.empty() || normals.size() == positions.size()),
+        function << "the arrays don't have the same size", false);
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != joints.size(); ++i)
+        CORRADE_ASSERT(joints[i].max() < palette.size(),
+            function << "joint index" << joints[i].max() << "out of bounds for" << palette.size() << "bones", false);
+    #else
+    static_cast<void>(function);
+    static_cast<void>(palette);
+    #endif
+    return true;
+}
+
+template<class T> void skinInternal(const Containers::ArrayReference<const T> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals, const Output& out) {
+    Magnum::Implementation::parallelRows(positions.size(), positions.size()*(normals.empty() ? 1 : 2)*sizeof(Vector3), true, [&](const Int begin, const Int end) {
+        skinVertices(palette, joints, weights, positions, normals, out, begin, end);
+    });
+}
+
+template<class T> void skinArrays(const Containers::ArrayReference<const T> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals, const Containers::ArrayReference<Vector3> outPositions, const Containers::ArrayReference<Vector3> outNormals) {
+    if(!checkInputs("MeshTools::skin():", palette, joints, weights, positions, normals)) return;
+    CORRADE_ASSERT(outPositions.size() == positions.size() && outNormals.size() == normals.size(),
+        "MeshTools::skin(): expected output arrays of size" << positions.size() << "and" << normals.size() << "but got" << outPositions.size() << "and" << outNormals.size(), );
+
+    skinInternal(palette, joints, weights, positions, normals, {reinterpret_cast<char*>(outPositions.data()), reinterpret_cast<char*>(outNormals.data()), sizeof(Vector3)});
+}
+
+template<class T> void skinBuffer(const Containers::ArrayReference<char> buffer, const std::size_t stride, const std::size_t positionOffset, const std::size_t normalOffset, const Containers::ArrayReference<const T> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals) {
+    if(!checkInputs("MeshTools::skinInto():", palette, joints, weights, positions, normals)) return;
+    if(positions.empty()) return;
+
+    const std::size_t vertexSize = Math::max(positionOffset, normals.empty() ? 0 : normalOffset) + sizeof(Vector3);
+    CORRADE_ASSERT((positions.size() - 1)*stride + vertexSize <= buffer.size(),
+        "MeshTools::skinInto(): the data buffer is too small, expected" << (positions.size() - 1)*stride + vertexSize << "but got" << buffer.size(), );
+
+    skinInternal(palette, joints, weights, positions, normals, {buffer.data() + positionOffset, normals.empty() ? nullptr : buffer.data() + normalOffset, stride});
+}
+
+}
+
+void skin(const Containers::ArrayReference<const Matrix4> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals, const Containers::ArrayReference<Vector3> outPositions, const Containers::ArrayReference<Vector3> outNormals) {
+    skinArrays(palette, joints, weights, positions, normals, outPositions, outNormals);
+}
+
+void skin(const Containers::ArrayReference<const DualQuaternion> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals, const Containers::ArrayReference<Vector3> outPositions, const Containers::ArrayReference<Vector3> outNormals) {
+    skinArrays(palette, joints, weights, positions, normals, outPositions, outNormals);
+}
+
+void skinInto(const Containers::ArrayReference<char> buffer, const std::size_t stride, const std::size_t positionOffset, const std::size_t normalOffset, const Containers::ArrayReference<const Matrix4> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals) {
+    skinBuffer(buffer, stride, positionOffset, normalOffset, palette, joints, weights, positions, normals);
+}
+
+void skinInto(const Containers::ArrayReference<char> buffer, const std::size_t stride, const std::size_t positionOffset, const std::size_t normalOffset, const Containers::ArrayReference<const DualQuaternion> palette, const Containers::ArrayReference<const Vector4ui> joints, const Containers::ArrayReference<const Vector4> weights, const Containers::ArrayReference<const Vector3> positions, const Containers::ArrayReference<const Vector3> normals) {
+    skinBuffer(buffer, stride, positionOffset, normalOffset, palette, joints, weights, positions, normals);
+}
+
+}}
@@ -0,0 +1,114 @@
+#ifndef Magnum_MeshTools_Skin_h
+#define Magnum_MeshTools_Skin_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::skin(), @ref Magnum::MeshTools::skinInto()
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Skin mesh positions and normals using linear blend skinning
+@param palette          Bone transformations
+@param joints           Per-vertex bone indices into @p palette
+@param weights          Per-vertex bone weights
+@param positions        Input positions
+@param normals          Input normals. Can be empty, in which case no
+    normals are skinned.
+@param[out] outPositions Skinned positions
+@param[out] outNormals  Skinned normals. Expected to be empty if @p normals
+    is empty.
+
+Each vertex is transformed by matrix that is weighted sum of up to four
+matrices from @p palette: @f[
+    \boldsymbol M = \sum_{i = 0}^3 w_i \boldsymbol B_{j_i} ~~~~~~~~~~
+    \boldsymbol p' = \boldsymbol M \boldsymbol p ~~~~~~~~~~
+    \boldsymbol n' = \frac{\boldsymbol M_{3 \times 3} \boldsymbol n}{|\boldsymbol M_{3 \times 3} \boldsymbol n|}
+@f]
+Weights are expected to be already normalized, unused joint slots should have
+zero weight (and any valid index). Normals are transformed with the upper-left
+3x3 part of the blended matrix, which is correct only if the bone
+transformations don't contain non-uniform scaling. The computation is done
+using SIMD instructions if Magnum is built with @ref MAGNUM_BUILD_SIMD and
+large meshes are split across all available hardware threads.
+
+Expects that all per-vertex arrays have the same size and that all joint
+indices are in bounds of @p palette.
+@see @ref skinInto(), @ref Matrix4::transformPoint()
+*/
+void MAGNUM_MESHTOOLS_EXPORT skin(Containers::ArrayReference<const Matrix4> palette, Containers::ArrayReference<const Vector4ui> joints, Containers::ArrayReference<const Vector4> weights, Containers::ArrayReference<const Vector3> positions, Containers::ArrayReference<const Vector3> normals, Containers::ArrayReference<Vector3> outPositions, Containers::ArrayReference<Vector3> outNormals);
+
+/**
+@brief Skin mesh positions and normals using dual quaternion skinning
+
+Similar to @ref skin(Containers::ArrayReference<const Matrix4>, Containers::ArrayReference<const Vector4ui>, Containers::ArrayReference<const Vector4>, Containers::ArrayReference<const Vector3>, Containers::ArrayReference<const Vector3>, Containers::ArrayReference<Vector3>, Containers::ArrayReference<Vector3>),
+but the bone transformations are blended as dual quaternions, which avoids
+the volume loss ("candy wrapper" artifacts) of linear blending on twisted
+joints: @f[
+    \hat q = \frac{\sum_{i = 0}^3 s_i w_i \hat q_{j_i}}{|\sum_{i = 0}^3 s_i w_i q_{0 j_i}|}
+@f]
+where @f$ s_i @f$ is @f$ -1 @f$ if real part of the quaternion lies in
+different hemisphere than the real part of the first one and @f$ 1 @f$
+otherwise. Dual quaternions in @p palette are expected to be normalized and
+can't contain any scaling.
+@see @ref DualQuaternion::transformPointNormalized(),
+    @ref Quaternion::transformVectorNormalized()
+*/
+void MAGNUM_MESHTOOLS_EXPORT skin(Containers::ArrayReference<const DualQuaternion> palette, Containers::ArrayReference<const Vector4ui> joints, Containers::ArrayReference<const Vector4> weights, Containers::ArrayReference<const Vector3> positions, Containers::ArrayReference<const Vector3> normals, Containers::ArrayReference<Vector3> outPositions, Containers::ArrayReference<Vector3> outNormals);
+
+/**
+@brief Skin mesh positions and normals into existing interleaved buffer
+@param buffer           Output buffer
+@param stride           Stride between consecutive vertices in @p buffer
+@param positionOffset   Offset of position attribute in @p buffer
+@param normalOffset     Offset of normal attribute in @p buffer. Ignored if
+    @p normals is empty.
+@param palette          Bone transformations
+@param joints           Per-vertex bone indices into @p palette
+@param weights          Per-vertex bone weights
+@param positions        Input positions
+@param normals          Input normals
+
+Same as @ref skin(), but the output is written directly into @p buffer, for
+example one prepared with @ref interleave() and updated every frame before
+uploading it to @ref Buffer. Similarly to @ref interleaveInto(), the gaps
+between the attributes are left untouched. Expects that the buffer is large
+enough to contain all vertices.
+*/
+void MAGNUM_MESHTOOLS_EXPORT skinInto(Containers::ArrayReference<char> buffer, std::size_t stride, std::size_t positionOffset, std::size_t normalOffset, Containers::ArrayReference<const Matrix4> palette, Containers::ArrayReference<const Vector4ui> joints, Containers::ArrayReference<const Vector4> weights, Containers::ArrayReference<const Vector3> positions, Containers::ArrayReference<const Vector3> normals);
+
+/** @overload */
+void MAGNUM_MESHTOOLS_EXPORT skinInto(Containers::ArrayReference<char> buffer, std::size_t stride, std::size_t positionOffset, std::size_t normalOffset, Containers::ArrayReference<const DualQuaternion> palette, Containers::ArrayReference<const Vector4ui> joints, Containers::ArrayReference<const Vector4> weights, Containers::ArrayReference<const Vector3> positions, Containers::ArrayReference<const Vector3> normals);
+
+}}
+
+#endif
@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/MeshTools/Implementation/ConversionManifest.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class ConversionManifestTest: public TestSuite::Tester {
+    public:
+        explicit ConversionManifestTest();
+
+        void empty();
+        void skipUnchanged();
+        void missingOutput();
+        void prune();
+};
+
+namespace {
+    /* Returns clean directory for given test case */
+    std::string outputDirectory(const std::string& name) {
+        const std::string directory = Utility::Directory::join(MESHTOOLS_TEST_OUTPUT_DIR, name);
+        Utility::Directory::rm(Utility::Directory::join(directory, ".magnum-assetconverter.conf"));
+        return directory;
+    }
+}
+
+ConversionManifestTest::ConversionManifestTest() {
+    addTests({&ConversionManifestTest::empty,
+              &ConversionManifestTest::skipUnchanged,
+              &ConversionManifestTest::missingOutput,
+              &ConversionManifestTest::prune});
+}
+
+void ConversionManifestTest::empty() {
+    Implementation::ConversionManifest manifest(outputDirectory("manifestEmpty"));
+    CORRADE_VERIFY(!manifest.isUpToDate("mesh.obj", "a1b2c3"));
+
+    /* Nothing recorded and no previous manifest, no file is created */
+    CORRADE_VERIFY(manifest.save());
+    CORRADE_VERIFY(!Utility::Directory::fileExists(manifest.filename()));
+}
+
+void ConversionManifestTest::skipUnchanged() {
+    const std::string directory = outputDirectory("manifestSkipUnchanged");
+    {
+        Implementation::ConversionManifest manifest(directory);
+        manifest.record("mesh.obj", "a1b2c3", {});
+        manifest.record("level/terrain.obj", "d4e5f6", {});
+        CORRADE_VERIFY(manifest.save());
+    }
+
+    /* Unchanged files are skipped, changed and new files are converted */
+    Implementation::ConversionManifest manifest(directory);
+    CORRADE_VERIFY(manifest.isUpToDate("mesh.obj", "a1b2c3"));
+    CORRADE_VERIFY(manifest.isUpToDate("level/terrain.obj", "d4e5f6"));
+    CORRADE_VERIFY(!manifest.isUpToDate("mesh.obj", "ffffff"));
+    CORRADE_VERIFY(!manifest.isUpToDate("level/water.obj", "a1b2c3"));
+}
+
+void ConversionManifestTest::missingOutput() {
+    const std::string directory = outputDirectory("manifestMissingOutput");
+    const unsigned char data[]{0xca, 0xfe};
+    CORRADE_VERIFY(Utility::Directory::mkpath(directory));
+    CORRADE_VERIFY(Utility::Directory::write(Utility::Directory::join(directory, "mesh-0.mesh"), data));
+    CORRADE_VERIFY(Utility::Directory::write(Utility::Directory::join(directory, "mesh-1.mesh"), data));
+    {
+        Implementation::ConversionManifest manifest(directory);
+        manifest.record("mesh.obj", "a1b2c3", {"mesh-0.mesh", "mesh-1.mesh"});
+        CORRADE_VERIFY(manifest.save());
+    }
+    {
+        Implementation::ConversionManifest manifest(directory);
+        CORRADE_VERIFY(manifest.isUpToDate("mesh.obj", "a1b2c3"));
+        CORRADE_COMPARE(manifest.outputs("mesh.obj"), (std::vector<std::string>{"mesh-0.mesh", "mesh-1.mesh"}));
+    }
+
+    /* The file is converted again if any of its outputs was deleted */
+    CORRADE_VERIFY(Utility::Directory::rm(Utility::Directory::join(directory, "mesh-1.mesh")));
+    Implementation::ConversionManifest manifest(directory);
+    CORRADE_VERIFY(!manifest.isUpToDate("mesh.obj", "a1b2c3"));
+}
+
+void ConversionManifestTest::prune() {
+    const std::string directory = outputDirectory("manifestPrune");
+    {
+        Implementation::ConversionManifest manifest(directory);
+        manifest.record("mesh.obj", "a1b2c3", {});
+        manifest.record("removed.obj", "d4e5f6", {});
+        CORRADE_VERIFY(manifest.save());
+    }
+
+    /* Second run doesn't record the removed file */
+    {
+        Implementation::ConversionManifest manifest(directory);
+        CORRADE_VERIFY(manifest.isUpToDate("removed.obj", "d4e5f6"));
+        manifest.record("mesh.obj", "a1b2c3", {});
+        CORRADE_VERIFY(manifest.save());
+    }
+    {
+        Implementation::ConversionManifest manifest(directory);
+        CORRADE_VERIFY(manifest.isUpToDate("mesh.obj", "a1b2c3"));
+        CORRADE_VERIFY(!manifest.isUpToDate("removed.obj", "d4e5f6"));
+
+        /* Third run doesn't record anything, the manifest is emptied */
+        CORRADE_VERIFY(manifest.save());
+    }
+
+    Implementation::ConversionManifest manifest(directory);
+    CORRADE_VERIFY(!manifest.isUpToDate("mesh.obj", "a1b2c3"));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ConversionManifestTest)
@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Skin.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+/* Prints skinning throughput for a small mesh processed on a single thread
+   and a large one split across all hardware threads */
+class SkinBenchmark: public TestSuite::Tester {
+    public:
+        explicit SkinBenchmark();
+
+        void linear();
+        void linearNoNormals();
+        void dualQuaternion();
+        void into();
+};
+
+SkinBenchmark::SkinBenchmark() {
+    addTests({&SkinBenchmark::linear,
+              &SkinBenchmark::linearNoNormals,
+              &SkinBenchmark::dualQuaternion,
+              &SkinBenchmark::into});
+}
+
+namespace {
+
+constexpr std::size_t BoneCount = 64;
+constexpr std::size_t SmallCount = 4096;
+constexpr std::size_t LargeCount = 1024*1024;
+
+struct Data {
+    Data();
+
+    Matrix4 matrices[BoneCount];
+    DualQuaternion dualQuaternions[BoneCount];
+    Containers::Array<Vector4ui> joints;
+    Containers::Array<Vector4> weights;
+    Containers::Array<Vector3> positions;
+    Containers::Array<Vector3> normals;
+    Containers::Array<Vector3> outPositions;
+    Containers::Array<Vector3> outNormals;
+};
+
+Data::Data(): joints(LargeCount), weights(LargeCount), positions(LargeCount), normals(LargeCount), outPositions(LargeCount), outNormals(LargeCount) {
+    UnsignedInt state = 0x12345678;
+    auto random = [&state]() {
+        state = state*1664525 + 1013904223;
+        return Float(state >> 8)/Float(1 << 23) - 1.0f;
+    };
+
+    for(std::size_t i = 0; i != BoneCount; ++i) {
+        const Vector3 axis = Vector3(random(), random(), random() + 2.0f).normalized();
+        const Vector3 translation(random(), random(), random());
+        const Rad angle(random()*3.0f);
+        matrices[i] = Matrix4::translation(translation)*Matrix4::rotation(angle, axis);
+        dualQuaternions[i] = DualQuaternion::translation(translation)*DualQuaternion::rotation(angle, axis);
+    }
+
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        joints[i] = Vector4ui(i%BoneCount, (i*7)%BoneCount, (i*13)%BoneCount, (i*31)%BoneCount);
+        const Vector4 w(random() + 1.1f, random() + 1.1f, random() + 1.1f, random() + 1.1f);
+        weights[i] = w/(w.sum());
+        positions[i] = Vector3(random(), random(), random());
+        normals[i] = Vector3(random(), random(), random() + 2.0f).normalized();
+    }
+}
+
+Data& data() {
+    static Data d;
+    return d;
+}
+
+template<class T> Containers::ArrayReference<T> prefix(Containers::Array<T>& array, const std::size_t count) {
+    return {array.begin(), count};
+}
+
+/* Calls the function `iterations` times and prints throughput in millions of
+   vertices per second */
+template<class F> void measure(const char* const name, const std::size_t count, const std::size_t iterations, F f) {
+    const Double time = Magnum::Test::averageDuration<std::micro>(iterations, [&]() { f(count); });
+
+    Debug() << name << count << "vertices:" << count/time << "M vertices/s";
+}
+
+}
+
+void SkinBenchmark::linear() {
+    Data& d = data();
+    auto f = [&d](const std::size_t count) {
+        MeshTools::skin(d.matrices, prefix(d.joints, count), prefix(d.weights, count), prefix(d.positions, count), prefix(d.normals, count), prefix(d.outPositions, count), prefix(d.outNormals, count));
+    };
+    measure("MeshTools::skin() with Matrix4,", SmallCount, 500, f);
+    measure("MeshTools::skin() with Matrix4,", LargeCount, 10, f);
+}
+
+void SkinBenchmark::linearNoNormals() {
+    Data& d = data();
+    auto f = [&d](const std::size_t count) {
+        MeshTools::skin(d.matrices, prefix(d.joints, count), prefix(d.weights, count), prefix(d.positions, count), nullptr, prefix(d.outPositions, count), nullptr);
+    };
+    measure("MeshTools::skin() with Matrix4 without normals,", SmallCount, 500, f);
+    measure("MeshTools::skin() with Matrix4 without normals,", LargeCount, 10, f);
+}
+
+void SkinBenchmark::dualQuaternion() {
+    Data& d = data();
+    auto f = [&d](const std::size_t count) {
+        MeshTools::skin(d.dualQuaternions, prefix(d.joints, count), prefix(d.weights, count), prefix(d.positions, count), prefix(d.normals, count), prefix(d.outPositions, count), prefix(d.outNormals, count));
+    };
+    measure("MeshTools::skin() with DualQuaternion,", SmallCount, 500, f);
+    measure("MeshTools::skin() with DualQuaternion,", LargeCount, 10, f);
+}
+
+void SkinBenchmark::into() {
+    Data& d = data();
+    /* Position, normal and texture coordinates */
+    Containers::Array<char> buffer(LargeCount*32);
+    auto f = [&d, &buffer](const std::size_t count) {
+        MeshTools::skinInto(buffer, 32, 0, 12, d.matrices, prefix(d.joints, count), prefix(d.weights, count), prefix(d.positions, count), prefix(d.normals, count));
+    };
+    measure("MeshTools::skinInto() with Matrix4,", SmallCount, 500, f);
+    measure("MeshTools::skinInto() with Matrix4,", LargeCount, 10, f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SkinBenchmark)
@@ -0,0 +1,342 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Skin.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+class SkinTest: public TestSuite::Tester {
+    public:
+        explicit SkinTest();
+
+        void linear();
+        void linearNormals();
+        void dualQuaternionSingleBone();
+        void dualQuaternionTranslation();
+        void dualQuaternionRotation();
+        void dualQuaternionAntipodal();
+        void noNormals();
+        void manyVertices();
+
+        void into();
+        void intoNoNormals();
+
+        void sizeMismatch();
+        void jointOutOfBounds();
+        void intoBufferTooSmall();
+};
+
+SkinTest::SkinTest() {
+    addTests({&SkinTest::linear,
+              &SkinTest::linearNormals,
+              &SkinTest::dualQuaternionSingleBone,
+              &SkinTest::dualQuaternionTranslation,
+              &SkinTest::dualQuaternionRotation,
+              &SkinTest::dualQuaternionAntipodal,
+              &SkinTest::noNormals,
+              &SkinTest::manyVertices,
+
+              &SkinTest::into,
+              &SkinTest::intoNoNormals,
+
+              &SkinTest::sizeMismatch,
+              &SkinTest::jointOutOfBounds,
+              &SkinTest::intoBufferTooSmall});
+}
+
+namespace {
+
+const Matrix4 matrixPalette[]{
+    Matrix4::translation({1.0f, 2.0f, -3.0f}),
+    Matrix4::translation({0.5f, 0.0f, 1.5f})*Matrix4::rotationX(Deg(35.0f)),
+    Matrix4::rotation(Deg(-70.0f), Vector3(1.0f, 1.0f, 0.0f).normalized())*Matrix4::scaling(Vector3(2.0f))
+};
+
+const DualQuaternion dualQuaternionPalette[]{
+    DualQuaternion::translation({1.0f, 2.0f, -3.0f}),
+    DualQuaternion::translation({0.5f, 0.0f, 1.5f})*DualQuaternion::rotation(Deg(35.0f), Vector3::xAxis()),
+    DualQuaternion::rotation(Deg(-70.0f), Vector3(1.0f, 1.0f, 0.0f).normalized())
+};
+
+const Vector4ui joints[]{
+    {0, 0, 0, 0},
+    {1, 0, 0, 0},
+    {0, 1, 0, 0},
+    {2, 1, 0, 0},
+    {0, 1, 2, 1}
+};
+
+const Vector4 weights[]{
+    {1.0f, 0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f, 0.0f},
+    {0.5f, 0.5f, 0.0f, 0.0f},
+    {0.75f, 0.25f, 0.0f, 0.0f},
+    {0.25f, 0.25f, 0.25f, 0.25f}
+};
+
+const Vector3 positions[]{
+    {1.0f, 0.0f, 0.0f},
+    {-2.0f, 3.5f, 0.5f},
+    {0.0f, 0.0f, 0.0f},
+    {1.5f, -1.0f, 4.0f},
+    {0.25f, 2.0f, -1.0f}
+};
+
+const Vector3 normals[]{
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, 1.0f},
+    Vector3(1.0f, 1.0f, 0.0f).normalized(),
+    {-1.0f, 0.0f, 0.0f},
+    Vector3(1.0f, -2.0f, 3.0f).normalized()
+};
+
+Matrix4 blend(const Vector4ui& joints, const Vector4& weights) {
+    Matrix4 m{Matrix4::Zero};
+    for(std::size_t i = 0; i != 4; ++i) m += matrixPalette[joints[i]]*weights[i];
+    return m;
+}
+
+}
+
+void SkinTest::linear() {
+    Vector3 outPositions[5];
+    Vector3 outNormals[5];
+    MeshTools::skin(matrixPalette, joints, weights, positions, normals, outPositions, outNormals);
+
+    for(std::size_t i = 0; i != 5; ++i) {
+        const Matrix4 m = blend(joints[i], weights[i]);
+        CORRADE_COMPARE(outPositions[i], m.transformPoint(positions[i]));
+        CORRADE_COMPARE(outNormals[i], m.transformVector(normals[i]).normalized());
+    }
+}
+
+void SkinTest::linearNormals() {
+    /* Uniform scaling doesn't affect the normal direction */
+    const Matrix4 palette[]{Matrix4::scaling(Vector3(3.0f))*Matrix4::rotationZ(Deg(90.0f))};
+    const Vector4ui joints[]{{}};
+    const Vector4 weights[]{{1.0f, 0.0f, 0.0f, 0.0f}};
+    const Vector3 positions[]{{1.0f, 2.0f, 3.0f}};
+    const Vector3 normals[]{Vector3::xAxis()};
+    Vector3 outPositions[1];
+    Vector3 outNormals[1];
+    MeshTools::skin(palette, joints, weights, positions, normals, outPositions, outNormals);
+
+    CORRADE_COMPARE(outPositions[0], Vector3(-6.0f, 3.0f, 9.0f));
+    CORRADE_COMPARE(outNormals[0], Vector3::yAxis());
+}
+
+void SkinTest::dualQuaternionSingleBone() {
+    const Vector4ui joints[]{{0, 0, 0, 0}, {1, 0, 0, 0}, {2, 0, 0, 0}};
+    const Vector4 weights[]{{1.0f, 0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f, 0.0f}};
+    Vector3 outPositions[3];
+    Vector3 outNormals[3];
+    MeshTools::skin(dualQuaternionPalette, joints, weights,
+        Containers::ArrayReference<const Vector3>(positions, 3),
+        Containers::ArrayReference<const Vector3>(normals, 3), outPositions, outNormals);
+
+    for(std::size_t i = 0; i != 3; ++i) {
+        const DualQuaternion& q = dualQuaternionPalette[joints[i][0]];
+        CORRADE_COMPARE(outPositions[i], q.transformPointNormalized(positions[i]));
+        CORRADE_COMPARE(outNormals[i], q.rotation().transformVectorNormalized(normals[i]));
+    }
+}
+
+void SkinTest::dualQuaternionTranslation() {
+    /* Pure translations are blended linearly */
+    const DualQuaternion palette[]{
+        DualQuaternion::translation({2.0f, 0.0f, 0.0f}),
+        DualQuaternion::translation({0.0f, 4.0f, -8.0f})
+    };
+    const Vector4ui joints[]{{0, 1, 0, 0}};
+    const Vector4 weights[]{{0.75f, 0.25f, 0.0f, 0.0f}};
+    const Vector3 positions[]{{1.0f, 1.0f, 1.0f}};
+    const Vector3 normals[]{Vector3::zAxis()};
+    Vector3 outPositions[1];
+    Vector3 outNormals[1];
+    MeshTools::skin(palette, joints, weights, positions, normals, outPositions, outNormals);
+
+    CORRADE_COMPARE(outPositions[0], Vector3(2.5f, 2.0f, -1.0f));
+    CORRADE_COMPARE(outNormals[0], Vector3::zAxis());
+}
+
+void SkinTest::dualQuaternionRotation() {
+    /* Blending rotations around the same axis doesn't shrink the mesh,
+       unlike linear blending */
+    const DualQuaternion dualQuaternionPalette[]{
+        DualQuaternion::rotation(Deg(0.0f), Vector3::zAxis()),
+        DualQuaternion::rotation(Deg(120.0f), Vector3::zAxis())
+    };
+    const Matrix4 matrixPalette[]{
+        Matrix4::rotationZ(Deg(0.0f)),
+        Matrix4::rotationZ(Deg(120.0f))
+    };
+    const Vector4ui joints[]{{0, 1, 0, 0}};
+    const Vector4 weights[]{{0.5f, 0.5f, 0.0f, 0.0f}};
+    const Vector3 positions[]{{2.0f, 0.0f, 1.0f}};
+    const Vector3 normals[]{Vector3::xAxis()};
+    Vector3 outPositions[1];
+    Vector3 outNormals[1];
+
+    MeshTools::skin(dualQuaternionPalette, joints, weights, positions, normals, outPositions, outNormals);
+    CORRADE_COMPARE(outPositions[0], Matrix4::rotationZ(Deg(60.0f)).transformPoint(positions[0]));
+    CORRADE_COMPARE(outNormals[0], Matrix4::rotationZ(Deg(60.0f)).transformVector(normals[0]));
+
+    MeshTools::skin(matrixPalette, joints, weights, positions, normals, outPositions, outNormals);
+    CORRADE_COMPARE(outPositions[0], Vector3(0.5f, 0.866025f, 1.0f));
+    CORRADE_COMPARE(outNormals[0], Matrix4::rotationZ(Deg(60.0f)).transformVector(normals[0]));
+}
+
+void SkinTest::dualQuaternionAntipodal() {
+    /* Both represent the same transformation, the blend must not cancel them
+       out */
+    const DualQuaternion a = DualQuaternion::translation({1.0f, 0.0f, 0.0f})*DualQuaternion::rotation(Deg(90.0f), Vector3::yAxis());
+    const DualQuaternion palette[]{a, {-a.real(), -a.dual()}};
+    const Vector4ui joints[]{{0, 1, 0, 0}};
+    const Vector4 weights[]{{0.5f, 0.5f, 0.0f, 0.0f}};
+    const Vector3 positions[]{{0.0f, 0.0f, 1.0f}};
+    const Vector3 normals[]{Vector3::zAxis()};
+    Vector3 outPositions[1];
+    Vector3 outNormals[1];
+    MeshTools::skin(palette, joints, weights, positions, normals, outPositions, outNormals);
+
+    CORRADE_COMPARE(outPositions[0], a.transformPointNormalized(positions[0]));
+    CORRADE_COMPARE(outNormals[0], Vector3::xAxis());
+}
+
+void SkinTest::noNormals() {
+    Vector3 outPositions[5];
+    MeshTools::skin(matrixPalette, joints, weights, positions, nullptr, outPositions, nullptr);
+    CORRADE_COMPARE(outPositions[3], blend(joints[3], weights[3]).transformPoint(positions[3]));
+
+    MeshTools::skin(dualQuaternionPalette, joints, weights, positions, nullptr, outPositions, nullptr);
+    CORRADE_COMPARE(outPositions[1], dualQuaternionPalette[1].transformPointNormalized(positions[1]));
+}
+
+void SkinTest::manyVertices() {
+    /* Large enough to be split across threads */
+    constexpr std::size_t count = 100003;
+    Containers::Array<Vector4ui> manyJoints(count);
+    Containers::Array<Vector4> manyWeights(count);
+    Containers::Array<Vector3> manyPositions(count);
+    Containers::Array<Vector3> manyNormals(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        manyJoints[i] = joints[i%5];
+        manyWeights[i] = weights[i%5];
+        manyPositions[i] = positions[i%5] + Vector3(Float(i%7));
+        manyNormals[i] = normals[i%5];
+    }
+
+    Containers::Array<Vector3> outPositions(count);
+    Containers::Array<Vector3> outNormals(count);
+    MeshTools::skin(matrixPalette, manyJoints, manyWeights, manyPositions, manyNormals, outPositions, outNormals);
+
+    for(std::size_t i: {std::size_t(0), std::size_t(1), count/3 + 1, count/2 + 3, count - 2, count - 1}) {
+        const Matrix4 m = blend(manyJoints[i], manyWeights[i]);
+        CORRADE_COMPARE(outPositions[i], m.transformPoint(manyPositions[i]));
+        CORRADE_COMPARE(outNormals[i], m.transformVector(manyNormals[i]).normalized());
+    }
+}
+
+void SkinTest::into() {
+    /* Color between position and normal, padding at the end */
+    constexpr std::size_t stride = 3*4 + 4 + 3*4 + 4;
+    char buffer[5*stride];
+    for(char& c: buffer) c = '\xcd';
+
+    MeshTools::skinInto(buffer, stride, 0, 16, dualQuaternionPalette, joints, weights, positions, normals);
+
+    Vector3 expectedPositions[5];
+    Vector3 expectedNormals[5];
+    MeshTools::skin(dualQuaternionPalette, joints, weights, positions, normals, expectedPositions, expectedNormals);
+
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_COMPARE(*reinterpret_cast<const Vector3*>(buffer + i*stride), expectedPositions[i]);
+        CORRADE_COMPARE(*reinterpret_cast<const Vector3*>(buffer + i*stride + 16), expectedNormals[i]);
+        CORRADE_COMPARE(*reinterpret_cast<const UnsignedInt*>(buffer + i*stride + 12), 0xcdcdcdcd);
+        CORRADE_COMPARE(*reinterpret_cast<const UnsignedInt*>(buffer + i*stride + 28), 0xcdcdcdcd);
+    }
+}
+
+void SkinTest::intoNoNormals() {
+    /* Last vertex doesn't need the trailing padding */
+    constexpr std::size_t stride = 4 + 3*4;
+    char buffer[4*stride + 4 + 3*4];
+    for(char& c: buffer) c = '\xcd';
+
+    MeshTools::skinInto(buffer, stride, 4, 0, matrixPalette, joints, weights, positions, nullptr);
+
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_COMPARE(*reinterpret_cast<const UnsignedInt*>(buffer + i*stride), 0xcdcdcdcd);
+        CORRADE_COMPARE(*reinterpret_cast<const Vector3*>(buffer + i*stride + 4), blend(joints[i], weights[i]).transformPoint(positions[i]));
+    }
+}
+
+void SkinTest::sizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Vector3 outPositions[5];
+    Vector3 outNormals[5];
+    MeshTools::skin(matrixPalette, joints, Containers::ArrayReference<const Vector4>(weights, 4), positions, normals, outPositions, outNormals);
+    MeshTools::skin(dualQuaternionPalette, joints, weights, positions, Containers::ArrayReference<const Vector3>(normals, 3), outPositions, outNormals);
+    MeshTools::skin(matrixPalette, joints, weights, positions, normals, outPositions, Containers::ArrayReference<Vector3>(outNormals, 4));
+    MeshTools::skin(matrixPalette, joints, weights, positions, nullptr, outPositions, outNormals);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::skin(): the arrays don't have the same size\n"
+        "MeshTools::skin(): the arrays don't have the same size\n"
+        "MeshTools::skin(): expected output arrays of size 5 and 5 but got 5 and 4\n"
+        "MeshTools::skin(): expected output arrays of size 5 and 0 but got 5 and 5\n");
+}
+
+void SkinTest::jointOutOfBounds() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Vector3 outPositions[5];
+    MeshTools::skin(Containers::ArrayReference<const Matrix4>(matrixPalette, 2), joints, weights, positions, nullptr, outPositions, nullptr);
+    CORRADE_COMPARE(out.str(), "MeshTools::skin(): joint index 2 out of bounds for 2 bones\n");
+}
+
+void SkinTest::intoBufferTooSmall() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    char buffer[4*24 + 23];
+    MeshTools::skinInto(buffer, 24, 0, 12, matrixPalette, joints, weights, positions, normals);
+    MeshTools::skinInto(buffer, 24, 0, 12, matrixPalette, joints, weights, positions, Containers::ArrayReference<const Vector3>(normals, 2));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::skinInto(): the data buffer is too small, expected 120 but got 119\n"
+        "MeshTools::skinInto(): the arrays don't have the same size\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SkinTest)
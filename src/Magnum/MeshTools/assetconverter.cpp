@@ -0,0 +1,367 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/CombineIndexedArrays.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/MeshTools/Implementation/ConversionManifest.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractMeshConverter.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "assetconverterConfigure.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+enum class Stage: UnsignedByte {
+    Read, Import, Deduplicate, Tipsify, Export
+};
+
+constexpr std::size_t StageCount = 5;
+
+constexpr const char* StageNames[StageCount] = {
+    "read", "import", "deduplicate", "tipsify", "export"
+};
+
+typedef std::chrono::high_resolution_clock Clock;
+typedef std::array<Clock::duration, StageCount> Timings;
+
+/* Adds time elapsed from construction to destruction to given stage */
+class StageTimer {
+    public:
+        explicit StageTimer(Timings& timings, Stage stage): _time(timings[std::size_t(stage)]), _begin(Clock::now()) {}
+
+        ~StageTimer() { _time += Clock::now() - _begin; }
+
+    private:
+        Clock::duration& _time;
+        Clock::time_point _begin;
+};
+
+enum class Status: UnsignedByte {
+    Converted, Skipped, Failed
+};
+
+struct FileResult {
+    explicit FileResult(): status(Status::Failed) {}
+
+    Status status;
+    std::string hash;
+    std::vector<std::string> outputs;
+};
+
+bool hasExtension(const std::string& filename, const std::string& extension) {
+    return filename.size() >= extension.size() && filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+/* Recursively collects paths of files with given extension relative to the
+   root */
+void listFiles(const std::string& root, const std::string& prefix, const std::string& extension, std::vector<std::string>& files) {
+    const std::string path = prefix.empty() ? root : Utility::Directory::join(root, prefix);
+
+    for(const std::string& file: Utility::Directory::list(path, Utility::Directory::Flag::SkipDirectories|Utility::Directory::Flag::SkipSpecial|Utility::Directory::Flag::SortAscending))
+        if(hasExtension(file, extension))
+            files.push_back(prefix.empty() ? file : Utility::Directory::join(prefix, file));
+
+    for(const std::string& directory: Utility::Directory::list(path, Utility::Directory::Flag::SkipFiles|Utility::Directory::Flag::SkipSpecial|Utility::Directory::Flag::SkipDotAndDotDot|Utility::Directory::Flag::SortAscending))
+        listFiles(root, prefix.empty() ? directory : Utility::Directory::join(prefix, directory), extension, files);
+}
+
+std::string hexString(const Utility::MurmurHash2::Digest& digest) {
+    std::ostringstream out;
+    out << std::hex << *reinterpret_cast<const std::size_t*>(digest.byteArray());
+    return out.str();
+}
+
+/* Removes duplicate vertices, makes the mesh indexed. Returns false if the
+   mesh has more than one array of some attribute, as these can't be
+   deduplicated together. */
+bool deduplicate(Trade::MeshData3D& mesh) {
+    if(mesh.positionArrayCount() != 1 || mesh.normalArrayCount() > 1 || mesh.textureCoords2DArrayCount() > 1)
+        return false;
+
+    std::vector<Vector3> positions = std::move(mesh.positions(0));
+    if(positions.empty()) return true;
+
+    std::vector<UnsignedInt> indices;
+    if(mesh.isIndexed()) indices = std::move(mesh.indices());
+    else {
+        indices.resize(positions.size());
+        std::iota(indices.begin(), indices.end(), 0);
+    }
+
+    /* Remove duplicates from each attribute separately, then combine the
+       index arrays together */
+    std::vector<UnsignedInt> positionIndices = duplicate(indices, removeDuplicates(positions));
+    std::vector<std::vector<Vector3>> normals;
+    std::vector<std::vector<Vector2>> textureCoords2D;
+    if(mesh.normalArrayCount() && mesh.textureCoords2DArrayCount()) {
+        normals.push_back(std::move(mesh.normals(0)));
+        textureCoords2D.push_back(std::move(mesh.textureCoords2D(0)));
+        const std::vector<UnsignedInt> normalIndices = duplicate(indices, removeDuplicates(normals.front()));
+        const std::vector<UnsignedInt> textureCoordIndices = duplicate(indices, removeDuplicates(textureCoords2D.front()));
+        indices = combineIndexedArrays(
+            std::make_pair(std::cref(positionIndices), std::ref(positions)),
+            std::make_pair(std::cref(normalIndices), std::ref(normals.front())),
+            std::make_pair(std::cref(textureCoordIndices), std::ref(textureCoords2D.front())));
+    } else if(mesh.normalArrayCount()) {
+        normals.push_back(std::move(mesh.normals(0)));
+        const std::vector<UnsignedInt> normalIndices = duplicate(indices, removeDuplicates(normals.front()));
+        indices = combineIndexedArrays(
+            std::make_pair(std::cref(positionIndices), std::ref(positions)),
+            std::make_pair(std::cref(normalIndices), std::ref(normals.front())));
+    } else if(mesh.textureCoords2DArrayCount()) {
+        textureCoords2D.push_back(std::move(mesh.textureCoords2D(0)));
+        const std::vector<UnsignedInt> textureCoordIndices = duplicate(indices, removeDuplicates(textureCoords2D.front()));
+        indices = combineIndexedArrays(
+            std::make_pair(std::cref(positionIndices), std::ref(positions)),
+            std::make_pair(std::cref(textureCoordIndices), std::ref(textureCoords2D.front())));
+    } else indices = std::move(positionIndices);
+
+    mesh = Trade::MeshData3D(mesh.primitive(), std::move(indices), {std::move(positions)}, std::move(normals), std::move(textureCoords2D));
+    return true;
+}
+
+}
+
+class AssetConverter {
+    public:
+        explicit AssetConverter(int argc, char** argv);
+
+        int exec();
+
+    private:
+        FileResult convert(Trade::AbstractImporter& importer, Trade::AbstractMeshConverter& converter, const std::string& file, const Implementation::ConversionManifest& manifest, Timings& timings);
+        bool convertMeshes(Trade::AbstractImporter& importer, Trade::AbstractMeshConverter& converter, const std::string& file, std::vector<std::string>& outputs, Timings& timings);
+
+        Utility::Arguments args;
+        std::size_t optionsHash;
+        std::mutex outputMutex;
+};
+
+AssetConverter::AssetConverter(int argc, char** argv) {
+    args.addArgument("input").setHelp("input", "input directory")
+        .addArgument("output").setHelp("output", "output directory")
+        .addOption("importer", "ObjImporter").setHelp("importer", "mesh importer plugin")
+        .addOption("converter", "MagnumMeshConverter").setHelp("converter", "mesh converter plugin")
+        .addOption("extension", ".obj").setHelp("extension", "extension of input files")
+        .addOption("output-extension", ".mesh").setHelp("output-extension", "extension of output files")
+        .addOption("plugin-dir", MAGNUM_PLUGINS_DIR).setHelpKey("plugin-dir", "DIR").setHelp("plugin-dir", "base plugin dir")
+        .addOption("jobs", "0").setHelpKey("jobs", "N").setHelp("jobs", "number of parallel jobs, 0 for one job per CPU core")
+        .addBooleanOption("no-deduplicate").setHelp("no-deduplicate", "don't remove duplicate vertices")
+        .addOption("tipsify", "24").setHelpKey("tipsify", "N").setHelp("tipsify", "post-transform vertex cache size for triangle reordering, 0 to disable")
+        .addBooleanOption("force").setHelp("force", "convert also files which didn't change")
+        .addBooleanOption("verbose").setHelp("verbose", "print timing of each file")
+        .setHelp("Converts all meshes in given directory tree, optionally processing them with MeshTools.")
+        .parse(argc, argv);
+
+    /* Output depends on the plugins and processing options, so they are
+       hashed together with file contents */
+    std::ostringstream options;
+    options << args.value("importer") << '\n' << args.value("converter") << '\n'
+            << args.value("output-extension") << '\n' << args.isSet("no-deduplicate") << '\n'
+            << args.value<UnsignedInt>("tipsify");
+    optionsHash = *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(options.str()).byteArray());
+}
+
+FileResult AssetConverter::convert(Trade::AbstractImporter& importer, Trade::AbstractMeshConverter& converter, const std::string& file, const Implementation::ConversionManifest& manifest, Timings& timings) {
+    FileResult result;
+
+    /* Read the file and skip it if it didn't change */
+    Containers::Array<unsigned char> data;
+    {
+        StageTimer timer{timings, Stage::Read};
+        data = Utility::Directory::read(Utility::Directory::join(args.value("input"), file));
+        result.hash = hexString(Utility::MurmurHash2(optionsHash)(reinterpret_cast<const char*>(data.begin()), data.size()));
+    }
+    if(!args.isSet("force") && manifest.isUpToDate(file, result.hash)) {
+        result.status = Status::Skipped;
+        result.outputs = manifest.outputs(file);
+        return result;
+    }
+
+    {
+        StageTimer timer{timings, Stage::Import};
+        if(!importer.openData(data)) return result;
+    }
+
+    /* Close the importer also on failure, so the next file doesn't see stale
+       state */
+    const bool converted = convertMeshes(importer, converter, file, result.outputs, timings);
+    importer.close();
+    if(converted) result.status = Status::Converted;
+    return result;
+}
+
+bool AssetConverter::convertMeshes(Trade::AbstractImporter& importer, Trade::AbstractMeshConverter& converter, const std::string& file, std::vector<std::string>& outputs, Timings& timings) {
+    const std::string stem = file.substr(0, file.size() - args.value("extension").size());
+    const UnsignedInt meshCount = importer.mesh3DCount();
+    for(UnsignedInt i = 0; i != meshCount; ++i) {
+        std::optional<Trade::MeshData3D> mesh;
+        {
+            StageTimer timer{timings, Stage::Import};
+            if(!(mesh = importer.mesh3D(i))) return false;
+        }
+
+        if(!args.isSet("no-deduplicate")) {
+            StageTimer timer{timings, Stage::Deduplicate};
+            if(!deduplicate(*mesh)) {
+                std::lock_guard<std::mutex> lock(outputMutex);
+                Warning() << "Mesh" << i << "in" << file << "has more than one array of some attribute, skipping deduplication";
+            }
+        }
+
+        const UnsignedInt cacheSize = args.value<UnsignedInt>("tipsify");
+        if(cacheSize && mesh->primitive() == MeshPrimitive::Triangles && mesh->isIndexed()) {
+            StageTimer timer{timings, Stage::Tipsify};
+            tipsify(mesh->indices(), mesh->positions(0).size(), cacheSize);
+        }
+
+        /* Files with more than one mesh produce one output file per mesh */
+        StageTimer timer{timings, Stage::Export};
+        std::ostringstream outputFile;
+        outputFile << stem;
+        if(meshCount != 1) outputFile << '-' << i;
+        outputFile << args.value("output-extension");
+        const std::string output = Utility::Directory::join(args.value("output"), outputFile.str());
+        if(!Utility::Directory::mkpath(Utility::Directory::path(output)) || !converter.exportToFile(*mesh, output))
+            return false;
+        outputs.push_back(outputFile.str());
+    }
+
+    return true;
+}
+
+int AssetConverter::exec() {
+    /* Load plugins */
+    PluginManager::Manager<Trade::AbstractImporter> importerManager(Utility::Directory::join(args.value("plugin-dir"), "importers/"));
+    if(!(importerManager.load(args.value("importer")) & PluginManager::LoadState::Loaded))
+        return 1;
+    PluginManager::Manager<Trade::AbstractMeshConverter> converterManager(Utility::Directory::join(args.value("plugin-dir"), "meshconverters/"));
+    if(!(converterManager.load(args.value("converter")) & PluginManager::LoadState::Loaded))
+        return 1;
+
+    std::vector<std::string> files;
+    listFiles(args.value("input"), {}, args.value("extension"), files);
+    Debug() << "Found" << files.size() << "files in" << args.value("input");
+
+    /* Hashes of files from the previous run */
+    Implementation::ConversionManifest manifest(args.value("output"));
+
+    /* Plugin manager isn't thread-safe, so create plugin instances for all
+       workers upfront. Each worker has its own instance, so the importer
+       doesn't need to be thread-safe. */
+    UnsignedInt jobCount = args.value<UnsignedInt>("jobs");
+    if(!jobCount) jobCount = std::max(std::thread::hardware_concurrency(), 1u);
+    jobCount = std::max(std::min(jobCount, UnsignedInt(files.size())), 1u);
+    std::vector<std::unique_ptr<Trade::AbstractImporter>> importers;
+    std::vector<std::unique_ptr<Trade::AbstractMeshConverter>> converters;
+    for(UnsignedInt i = 0; i != jobCount; ++i) {
+        importers.push_back(importerManager.instance(args.value("importer")));
+        converters.push_back(converterManager.instance(args.value("converter")));
+    }
+
+    /* Each worker picks the next unprocessed file until there are none */
+    const Clock::time_point begin = Clock::now();
+    std::vector<FileResult> results(files.size());
+    std::vector<Timings> timings(jobCount);
+    std::atomic<std::size_t> next(0);
+    auto work = [&](const UnsignedInt job) {
+        for(std::size_t i; (i = next++) < files.size(); ) {
+            Timings fileTimings{};
+            results[i] = convert(*importers[job], *converters[job], files[i], manifest, fileTimings);
+
+            for(std::size_t stage = 0; stage != StageCount; ++stage)
+                timings[job][stage] += fileTimings[stage];
+
+            std::lock_guard<std::mutex> lock(outputMutex);
+            if(results[i].status == Status::Failed)
+                Error() << "Cannot convert" << files[i];
+            else if(args.isSet("verbose")) {
+                Debug d;
+                d << (results[i].status == Status::Skipped ? "Skipped" : "Converted") << files[i];
+                for(std::size_t stage = 0; stage != StageCount; ++stage) if(fileTimings[stage].count())
+                    d << StageNames[stage] << std::chrono::duration<Double, std::milli>(fileTimings[stage]).count() << "ms";
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for(UnsignedInt i = 1; i < jobCount; ++i) threads.emplace_back(work, i);
+    work(0);
+    for(std::thread& thread: threads) thread.join();
+    const Clock::duration elapsed = Clock::now() - begin;
+
+    /* Save hashes of files which are up-to-date, entries of files which
+       failed or are no longer in the input directory are dropped */
+    std::size_t converted = 0, skipped = 0, failed = 0;
+    for(std::size_t i = 0; i != files.size(); ++i) {
+        if(results[i].status == Status::Failed) {
+            ++failed;
+            continue;
+        }
+
+        ++(results[i].status == Status::Converted ? converted : skipped);
+        manifest.record(files[i], results[i].hash, results[i].outputs);
+    }
+    if(!manifest.save())
+        Warning() << "Cannot save file hashes to" << manifest.filename();
+
+    /* Print summary */
+    Debug() << "Converted" << converted << "files, skipped" << skipped << "unchanged and" << failed << "failed in" << std::chrono::duration<Double>(elapsed).count() << "seconds using" << jobCount << "jobs";
+    Debug() << "Time spent in each stage, summed over all jobs:";
+    for(std::size_t stage = 0; stage != StageCount; ++stage) {
+        Clock::duration total{};
+        for(const Timings& t: timings) total += t[stage];
+        Debug() << "   " << StageNames[stage] << std::chrono::duration<Double, std::milli>(total).count() << "ms";
+    }
+
+    return failed ? 1 : 0;
+}
+
+}}
+
+int main(int argc, char** argv) {
+    Magnum::MeshTools::AssetConverter app(argc, argv);
+    return app.exec();
+}
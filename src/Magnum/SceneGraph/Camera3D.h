@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera3D
  */
 
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/SceneGraph/AbstractCamera.h"
 
 #ifdef CORRADE_TARGET_WINDOWS /* I so HATE windef.h */
@@ -123,6 +124,18 @@ template<class T> class BasicCamera3D: public AbstractCamera<3, T> {
         /** @brief Far clipping plane */
         T far() const { return _far; }
 
+        /**
+         * @brief View frustum in world space
+         *
+         * Extracted from product of @ref projectionMatrix() and
+         * @ref cameraMatrix(), usable for culling objects with
+         * @ref Math::cullSpheres() or @ref Math::cullBoxes().
+         * @see @ref Math::Frustum::fromMatrix()
+         */
+        Math::Frustum<T> frustum() {
+            return Math::Frustum<T>::fromMatrix(AbstractCamera<3, T>::projectionMatrix()*AbstractCamera<3, T>::cameraMatrix());
+        }
+
         /* Overloads to remove WTF-factor from method chaining order */
         #ifndef DOXYGEN_GENERATING_OUTPUT
         BasicCamera3D<T>& setAspectRatioPolicy(AspectRatioPolicy policy) {
@@ -46,6 +46,7 @@ class CameraTest: public TestSuite::Tester {
         void projectionSizeOrthographic();
         void projectionSizePerspective();
         void projectionSizeViewport();
+        void frustum();
         void draw();
 };
 
@@ -61,6 +62,7 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
+              &CameraTest::frustum,
               &CameraTest::draw});
 }
 
@@ -156,6 +158,21 @@ void CameraTest::projectionSizeViewport() {
     CORRADE_COMPARE(camera.projectionSize(), Vector2(4.0f/3.0f, 2.0f));
 }
 
+void CameraTest::frustum() {
+    Object3D o;
+    o.translate(Vector3::zAxis(5.0f));
+    Camera3D camera(o);
+    camera.setOrthographic({4.0f, 6.0f}, 1.0f, 10.0f);
+
+    CORRADE_COMPARE(camera.frustum(), Frustum(
+        {1.0f, 0.0f, 0.0f, 2.0f},
+        {-1.0f, 0.0f, 0.0f, 2.0f},
+        {0.0f, 1.0f, 0.0f, 3.0f},
+        {0.0f, -1.0f, 0.0f, 3.0f},
+        {0.0f, 0.0f, -1.0f, 4.0f},
+        {0.0f, 0.0f, 1.0f, 5.0f}));
+}
+
 void CameraTest::draw() {
     class Drawable: public SceneGraph::Drawable3D {
         public:
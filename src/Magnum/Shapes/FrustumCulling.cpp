@@ -0,0 +1,45 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FrustumCulling.h"
+
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Sphere.h"
+
+namespace Magnum { namespace Shapes {
+
+/* The shapes are passed to the batch functions as-is, without copying */
+static_assert(sizeof(Sphere3D) == sizeof(Vector4), "Sphere3D layout doesn't match Vector4");
+static_assert(sizeof(AxisAlignedBox3D) == sizeof(Range3D), "AxisAlignedBox3D layout doesn't match Range3D");
+
+void cull(const Frustum& frustum, Corrade::Containers::ArrayReference<const Sphere3D> spheres, Corrade::Containers::ArrayReference<UnsignedByte> visibility, const Math::FrustumCulling culling) {
+    Math::cullSpheres(frustum, {reinterpret_cast<const Vector4*>(spheres.data()), spheres.size()}, visibility, culling);
+}
+
+void cull(const Frustum& frustum, Corrade::Containers::ArrayReference<const AxisAlignedBox3D> boxes, Corrade::Containers::ArrayReference<UnsignedByte> visibility, const Math::FrustumCulling culling) {
+    Math::cullBoxes(frustum, {reinterpret_cast<const Range3D*>(boxes.data()), boxes.size()}, visibility, culling);
+}
+
+}}
@@ -0,0 +1,69 @@
+#ifndef Magnum_Shapes_FrustumCulling_h
+#define Magnum_Shapes_FrustumCulling_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Shapes::cull()
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Shapes/Shapes.h"
+#include "Magnum/Shapes/visibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Cull spheres against view frustum
+@param frustum      View frustum
+@param spheres      Spheres to cull
+@param visibility   Output visibility bitmask, one bit per sphere
+@param culling      Culling mode
+
+Batch version of @ref Geometry::Intersection::sphereFrustum(), see
+@ref Math::cullSpheres() for details about the output format. Expects that
+@p visibility has `(spheres.size() + 7)/8` bytes.
+@see @ref SceneGraph::Camera3D::frustum()
+*/
+MAGNUM_SHAPES_EXPORT void cull(const Frustum& frustum, Corrade::Containers::ArrayReference<const Sphere3D> spheres, Corrade::Containers::ArrayReference<UnsignedByte> visibility, Math::FrustumCulling culling = Math::FrustumCulling::Precise);
+
+/**
+@brief Cull axis-aligned boxes against view frustum
+@param frustum      View frustum
+@param boxes        Boxes to cull
+@param visibility   Output visibility bitmask, one bit per box
+@param culling      Culling mode
+
+Batch version of @ref Geometry::Intersection::boxFrustum(), see
+@ref Math::cullBoxes() for details about the output format. Expects that
+@p visibility has `(boxes.size() + 7)/8` bytes.
+@see @ref SceneGraph::Camera3D::frustum()
+*/
+MAGNUM_SHAPES_EXPORT void cull(const Frustum& frustum, Corrade::Containers::ArrayReference<const AxisAlignedBox3D> boxes, Corrade::Containers::ArrayReference<UnsignedByte> visibility, Math::FrustumCulling culling = Math::FrustumCulling::Precise);
+
+}}
+
+#endif
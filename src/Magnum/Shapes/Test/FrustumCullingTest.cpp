@@ -0,0 +1,86 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/FrustumCulling.h"
+#include "Magnum/Shapes/Sphere.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+class FrustumCullingTest: public TestSuite::Tester {
+    public:
+        FrustumCullingTest();
+
+        void spheres();
+        void boxes();
+};
+
+FrustumCullingTest::FrustumCullingTest() {
+    addTests({&FrustumCullingTest::spheres,
+              &FrustumCullingTest::boxes});
+}
+
+namespace {
+    const Frustum frustum = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 6.0f}, 1.0f, 10.0f));
+}
+
+void FrustumCullingTest::spheres() {
+    const Sphere3D spheres[] = {
+        {{0.0f, 0.0f, -5.0f}, 1.0f},
+        {{0.0f, 0.0f, 5.0f}, 1.0f},
+        {{3.0f, 0.0f, -5.0f}, 1.5f},
+        {{0.0f, 5.0f, -5.0f}, 1.5f},
+        {{0.0f, 0.0f, -11.0f}, 2.0f},
+        {{2.9f, 3.9f, -5.0f}, 1.0f},
+        {{0.0f, -3.0f, -0.5f}, 0.1f},
+        {{-1.0f, 1.0f, -2.0f}, 0.0f},
+        {{-3.0f, 0.0f, -5.0f}, 0.5f}
+    };
+
+    UnsignedByte visibility[2];
+    cull(frustum, spheres, visibility);
+    CORRADE_COMPARE(visibility[0], 0xb5);
+    CORRADE_COMPARE(visibility[1], 0x00);
+}
+
+void FrustumCullingTest::boxes() {
+    const AxisAlignedBox3D boxes[] = {
+        {{-1.0f, -1.0f, -6.0f}, {1.0f, 1.0f, -4.0f}},
+        {{-1.0f, -1.0f, 4.0f}, {1.0f, 1.0f, 6.0f}},
+        {{1.5f, -1.0f, -6.0f}, {3.5f, 1.0f, -4.0f}},
+        {{-5.0f, -5.0f, -20.0f}, {5.0f, 5.0f, 0.0f}},
+        {{2.5f, 3.5f, -6.0f}, {3.5f, 4.5f, -4.0f}}
+    };
+
+    UnsignedByte visibility[1];
+    cull(frustum, boxes, visibility);
+    CORRADE_COMPARE(visibility[0], 0x0d);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::FrustumCullingTest)
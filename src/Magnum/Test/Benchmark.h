@@ -0,0 +1,50 @@
+#ifndef Magnum_Test_Benchmark_h
+#define Magnum_Test_Benchmark_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Test {
+
+/**
+@brief Average duration of a call
+@tparam Period  Unit of the returned value, e.g. `std::milli` or `std::nano`
+
+Calls @p f @p repeats times and returns average duration of one call. Used by
+benchmarks, which are built only if `BUILD_BENCHMARKS` is enabled and are not
+part of the test suite run by CTest.
+*/
+template<class Period = std::milli, class F> Double averageDuration(const std::size_t repeats, F f) {
+    const auto begin = std::chrono::high_resolution_clock::now();
+    for(std::size_t i = 0; i != repeats; ++i) f();
+    return std::chrono::duration<Double, Period>(std::chrono::high_resolution_clock::now() - begin).count()/repeats;
+}
+
+}}
+
+#endif
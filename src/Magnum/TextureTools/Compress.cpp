@@ -0,0 +1,793 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Compress.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/ConvertFormat.h"
+#include "Magnum/Implementation/parallelRows.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* 4x4 block of RGBA pixels, row by row */
+typedef UnsignedByte Block[16][4];
+
+Int sq(const Int value) { return value*value; }
+
+/* Encoded color distance, unweighted so it matches PSNR */
+Int distance(const Int* const a, const UnsignedByte* const b) {
+    return sq(a[0] - b[0]) + sq(a[1] - b[1]) + sq(a[2] - b[2]);
+}
+
+/* BC1 color endpoints */
+UnsignedShort pack565(const Float* const color) {
+    const Int r = Math::clamp(Int(color[0]*31.0f/255.0f + 0.5f), 0, 31);
+    const Int g = Math::clamp(Int(color[1]*63.0f/255.0f + 0.5f), 0, 63);
+    const Int b = Math::clamp(Int(color[2]*31.0f/255.0f + 0.5f), 0, 31);
+    return (r << 11)|(g << 5)|b;
+}
+
+void unpack565(const UnsignedShort color, Int* const out) {
+    const Int r = (color >> 11) & 0x1f;
+    const Int g = (color >> 5) & 0x3f;
+    const Int b = color & 0x1f;
+    out[0] = (r << 3)|(r >> 2);
+    out[1] = (g << 2)|(g >> 4);
+    out[2] = (b << 3)|(b >> 2);
+}
+
+/* Four-color palette, used when first endpoint is larger */
+void bc1Palette(const UnsignedShort color0, const UnsignedShort color1, Int (&palette)[4][3]) {
+    unpack565(color0, palette[0]);
+    unpack565(color1, palette[1]);
+    for(Int c = 0; c != 3; ++c) {
+        palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+        palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+    }
+}
+
+/* Picks the best palette entry for each pixel, returns total error */
+Int bc1Indices(const Block& block, const UnsignedShort color0, const UnsignedShort color1, UnsignedInt& indices) {
+    Int palette[4][3];
+    bc1Palette(color0, color1, palette);
+
+    Int error = 0;
+    indices = 0;
+    for(Int i = 0; i != 16; ++i) {
+        Int best = 0;
+        Int bestDistance = distance(palette[0], block[i]);
+        for(Int j = 1; j != 4; ++j) {
+            const Int d = distance(palette[j], block[i]);
+            if(d < bestDistance) {
+                best = j;
+                bestDistance = d;
+            }
+        }
+        indices |= best << (2*i);
+        error += bestDistance;
+    }
+
+    return error;
+}
+
+/* Least squares fit of the endpoints to given indices. Returns false if the
+   system is singular, i.e. all pixels use the same palette entry. */
+bool bc1FitEndpoints(const Block& block, const UnsignedInt indices, Float* const endpoint0, Float* const endpoint1) {
+    constexpr Float Weights[]{1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f};
+    Float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    Float ax[3]{}, bx[3]{};
+    for(Int i = 0; i != 16; ++i) {
+        const Float a = Weights[(indices >> (2*i)) & 3];
+        const Float b = 1.0f - a;
+        aa += a*a;
+        ab += a*b;
+        bb += b*b;
+        for(Int c = 0; c != 3; ++c) {
+            ax[c] += a*block[i][c];
+            bx[c] += b*block[i][c];
+        }
+    }
+
+    const Float determinant = aa*bb - ab*ab;
+    if(std::abs(determinant) < 1.0e-6f) return false;
+
+    for(Int c = 0; c != 3; ++c) {
+        endpoint0[c] = (bb*ax[c] - ab*bx[c])/determinant;
+        endpoint1[c] = (aa*bx[c] - ab*ax[c])/determinant;
+    }
+    return true;
+}
+
+struct Bc1Result {
+    UnsignedShort color0, color1;
+    UnsignedInt indices;
+    Int error;
+};
+
+Bc1Result bc1Evaluate(const Block& block, const UnsignedShort color0, const UnsignedShort color1) {
+    Bc1Result result{color0, color1, 0, 0};
+    result.error = bc1Indices(block, color0, color1, result.indices);
+    return result;
+}
+
+void encodeBc1(const Block& block, const CompressionQuality quality, UnsignedByte* const out) {
+    /* Mean and bounding box */
+    Float mean[3]{};
+    Int min[3]{255, 255, 255}, max[3]{};
+    for(Int i = 0; i != 16; ++i) for(Int c = 0; c != 3; ++c) {
+        mean[c] += block[i][c]/16.0f;
+        min[c] = Math::min(min[c], Int(block[i][c]));
+        max[c] = Math::max(max[c], Int(block[i][c]));
+    }
+
+    /* Covariance */
+    Float covariance[6]{};
+    for(Int i = 0; i != 16; ++i) {
+        const Float d[]{block[i][0] - mean[0], block[i][1] - mean[1], block[i][2] - mean[2]};
+        covariance[0] += d[0]*d[0];
+        covariance[1] += d[0]*d[1];
+        covariance[2] += d[0]*d[2];
+        covariance[3] += d[1]*d[1];
+        covariance[4] += d[1]*d[2];
+        covariance[5] += d[2]*d[2];
+    }
+
+    Float endpoint0[3], endpoint1[3];
+
+    /* Bounding box diagonal, with orientation of green and blue matching
+       their correlation with red, inset to reduce the error in the middle */
+    if(quality == CompressionQuality::Fast) {
+        for(Int c = 0; c != 3; ++c) {
+            const Float inset = (max[c] - min[c])/16.0f;
+            endpoint0[c] = max[c] - inset;
+            endpoint1[c] = min[c] + inset;
+        }
+        if(covariance[1] < 0.0f) std::swap(endpoint0[1], endpoint1[1]);
+        if(covariance[2] < 0.0f) std::swap(endpoint0[2], endpoint1[2]);
+
+    /* Principal axis using power iteration, endpoints from extremes of the
+       projection onto it */
+    } else {
+        Float axis[]{Float(max[0] - min[0]), Float(max[1] - min[1]), Float(max[2] - min[2])};
+        for(Int iteration = 0; iteration != 8; ++iteration) {
+            const Float next[]{
+                covariance[0]*axis[0] + covariance[1]*axis[1] + covariance[2]*axis[2],
+                covariance[1]*axis[0] + covariance[3]*axis[1] + covariance[4]*axis[2],
+                covariance[2]*axis[0] + covariance[4]*axis[1] + covariance[5]*axis[2]};
+            const Float length = std::sqrt(next[0]*next[0] + next[1]*next[1] + next[2]*next[2]);
+            if(length < 1.0e-6f) break;
+            for(Int c = 0; c != 3; ++c) axis[c] = next[c]/length;
+        }
+
+        const Float axisLength = std::sqrt(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+        if(axisLength > 1.0e-6f) for(Int c = 0; c != 3; ++c) axis[c] /= axisLength;
+
+        Float minProjection = 0.0f, maxProjection = 0.0f;
+        for(Int i = 0; i != 16; ++i) {
+            const Float projection = (block[i][0] - mean[0])*axis[0] + (block[i][1] - mean[1])*axis[1] + (block[i][2] - mean[2])*axis[2];
+            minProjection = Math::min(minProjection, projection);
+            maxProjection = Math::max(maxProjection, projection);
+        }
+
+        for(Int c = 0; c != 3; ++c) {
+            endpoint0[c] = mean[c] + axis[c]*maxProjection;
+            endpoint1[c] = mean[c] + axis[c]*minProjection;
+        }
+    }
+
+    Bc1Result best = bc1Evaluate(block, pack565(endpoint0), pack565(endpoint1));
+
+    /* Least squares refinement of the endpoints for current indices */
+    if(quality != CompressionQuality::Fast) {
+        const Int iterations = quality == CompressionQuality::High ? 8 : 1;
+        for(Int iteration = 0; iteration != iterations && best.error; ++iteration) {
+            if(!bc1FitEndpoints(block, best.indices, endpoint0, endpoint1)) break;
+            const Bc1Result result = bc1Evaluate(block, pack565(endpoint0), pack565(endpoint1));
+            if(result.error >= best.error) break;
+            best = result;
+        }
+    }
+
+    /* Greedy search in the neighborhood of the endpoints */
+    if(quality == CompressionQuality::High) {
+        constexpr UnsignedShort Steps[]{1 << 11, 1 << 5, 1};
+        constexpr UnsignedShort Masks[]{0x1f << 11, 0x3f << 5, 0x1f};
+        for(bool improved = true; improved && best.error; ) {
+            improved = false;
+            for(Int endpoint = 0; endpoint != 2; ++endpoint) for(Int c = 0; c != 3; ++c) for(Int direction = -1; direction <= 1; direction += 2) {
+                UnsignedShort colors[]{best.color0, best.color1};
+                const Int component = (colors[endpoint] & Masks[c]) + direction*Steps[c];
+                if(component < 0 || component > Masks[c]) continue;
+                colors[endpoint] = (colors[endpoint] & ~Masks[c]) | component;
+
+                const Bc1Result result = bc1Evaluate(block, colors[0], colors[1]);
+                if(result.error < best.error) {
+                    best = result;
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    /* Four-color mode needs the first endpoint larger, swap the palette
+       entries otherwise. With equal endpoints everything uses the first
+       one. */
+    if(best.color0 < best.color1) {
+        std::swap(best.color0, best.color1);
+        best.indices ^= 0x55555555;
+    } else if(best.color0 == best.color1) best.indices = 0;
+
+    out[0] = best.color0 & 0xff;
+    out[1] = best.color0 >> 8;
+    out[2] = best.color1 & 0xff;
+    out[3] = best.color1 >> 8;
+    for(Int i = 0; i != 4; ++i) out[4 + i] = (best.indices >> (8*i)) & 0xff;
+}
+
+/* BC1 switches to three-color mode with transparent black if the first
+   endpoint is not larger, color block of BC3 is always in four-color mode */
+void decodeBc1(const UnsignedByte* const in, Block& block, const bool alwaysFourColor) {
+    const UnsignedShort color0 = in[0]|(in[1] << 8);
+    const UnsignedShort color1 = in[2]|(in[3] << 8);
+    const UnsignedInt indices = in[4]|(in[5] << 8)|(in[6] << 16)|(UnsignedInt(in[7]) << 24);
+
+    Int palette[4][3];
+    bc1Palette(color0, color1, palette);
+
+    /* Three-color mode */
+    const bool threeColor = !alwaysFourColor && color0 <= color1;
+    if(threeColor) for(Int c = 0; c != 3; ++c) {
+        palette[2][c] = (palette[0][c] + palette[1][c])/2;
+        palette[3][c] = 0;
+    }
+
+    for(Int i = 0; i != 16; ++i) {
+        const Int index = (indices >> (2*i)) & 3;
+        for(Int c = 0; c != 3; ++c) block[i][c] = palette[index][c];
+        block[i][3] = threeColor && index == 3 ? 0 : 255;
+    }
+}
+
+/* BC4 palette, eight values if the first endpoint is larger, six values
+   and explicit 0 and 255 otherwise */
+void bc4Palette(const Int endpoint0, const Int endpoint1, Int (&palette)[8]) {
+    palette[0] = endpoint0;
+    palette[1] = endpoint1;
+    if(endpoint0 > endpoint1) {
+        for(Int i = 1; i != 7; ++i)
+            palette[i + 1] = ((7 - i)*endpoint0 + i*endpoint1)/7;
+    } else {
+        for(Int i = 1; i != 5; ++i)
+            palette[i + 1] = ((5 - i)*endpoint0 + i*endpoint1)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+Int bc4Indices(const UnsignedByte* const values, const Int endpoint0, const Int endpoint1, std::uint64_t& indices) {
+    Int palette[8];
+    bc4Palette(endpoint0, endpoint1, palette);
+
+    Int error = 0;
+    indices = 0;
+    for(Int i = 0; i != 16; ++i) {
+        Int best = 0;
+        Int bestDistance = sq(palette[0] - values[i]);
+        for(Int j = 1; j != 8; ++j) {
+            const Int d = sq(palette[j] - values[i]);
+            if(d < bestDistance) {
+                best = j;
+                bestDistance = d;
+            }
+        }
+        indices |= std::uint64_t(best) << (3*i);
+        error += bestDistance;
+    }
+
+    return error;
+}
+
+void encodeBc4(const UnsignedByte* const values, const CompressionQuality quality, UnsignedByte* const out) {
+    Int min = 255, max = 0;
+    for(Int i = 0; i != 16; ++i) {
+        min = Math::min(min, Int(values[i]));
+        max = Math::max(max, Int(values[i]));
+    }
+
+    Int bestEndpoint0 = max, bestEndpoint1 = min;
+    std::uint64_t bestIndices;
+    Int bestError = bc4Indices(values, max, min, bestIndices);
+
+    /* Six-value mode with endpoints excluding the extremes, which are
+       available explicitly */
+    if(quality != CompressionQuality::Fast && bestError) {
+        Int innerMin = 255, innerMax = 0;
+        for(Int i = 0; i != 16; ++i) if(values[i] != 0 && values[i] != 255) {
+            innerMin = Math::min(innerMin, Int(values[i]));
+            innerMax = Math::max(innerMax, Int(values[i]));
+        }
+        if(innerMin <= innerMax) {
+            std::uint64_t indices;
+            const Int error = bc4Indices(values, innerMin, innerMax, indices);
+            if(error < bestError) {
+                bestEndpoint0 = innerMin;
+                bestEndpoint1 = innerMax;
+                bestIndices = indices;
+                bestError = error;
+            }
+        }
+    }
+
+    /* Search the neighborhood of the eight-value mode endpoints */
+    if(quality == CompressionQuality::High && bestError && max > min) {
+        for(Int d0 = -2; d0 <= 2; ++d0) for(Int d1 = -2; d1 <= 2; ++d1) {
+            const Int endpoint0 = max + d0;
+            const Int endpoint1 = min + d1;
+            if(endpoint0 > 255 || endpoint1 < 0 || endpoint0 <= endpoint1) continue;
+
+            std::uint64_t indices;
+            const Int error = bc4Indices(values, endpoint0, endpoint1, indices);
+            if(error < bestError) {
+                bestEndpoint0 = endpoint0;
+                bestEndpoint1 = endpoint1;
+                bestIndices = indices;
+                bestError = error;
+            }
+        }
+    }
+
+    out[0] = bestEndpoint0;
+    out[1] = bestEndpoint1;
+    for(Int i = 0; i != 6; ++i) out[2 + i] = (bestIndices >> (8*i)) & 0xff;
+}
+
+void decodeBc4(const UnsignedByte* const in, Block& block, const Int channel) {
+    Int palette[8];
+    bc4Palette(in[0], in[1], palette);
+
+    std::uint64_t indices = 0;
+    for(Int i = 0; i != 6; ++i) indices |= std::uint64_t(in[2 + i]) << (8*i);
+    for(Int i = 0; i != 16; ++i)
+        block[i][channel] = palette[(indices >> (3*i)) & 7];
+}
+
+/* ETC1 modifier tables, the index is (msb << 1)|lsb */
+constexpr Int Etc1Tables[8][2]{
+    {2, 8}, {5, 17}, {9, 29}, {13, 42},
+    {18, 60}, {24, 80}, {33, 106}, {47, 183}
+};
+
+Int etc1Modifier(const Int table, const Int index) {
+    const Int value = Etc1Tables[table][index & 1];
+    return index & 2 ? -value : value;
+}
+
+/* Pixels of given subblock, subblocks are 2x4 side by side or 4x2 above each
+   other if flipped */
+void etc1Subblock(const Int flip, const Int subblock, Int (&pixels)[8]) {
+    Int n = 0;
+    for(Int y = 0; y != 4; ++y) for(Int x = 0; x != 4; ++x)
+        if((flip ? y/2 : x/2) == subblock) pixels[n++] = y*4 + x;
+}
+
+struct Etc1Subblock {
+    Int table;
+    UnsignedInt indices;    /* Two bits per subblock pixel */
+    Int error;
+};
+
+/* Best table and modifiers for given base color */
+Etc1Subblock etc1Modifiers(const Block& block, const Int (&pixels)[8], const Int* const base) {
+    Etc1Subblock best{0, 0, std::numeric_limits<Int>::max()};
+    for(Int table = 0; table != 8 && best.error; ++table) {
+        Etc1Subblock result{table, 0, 0};
+        for(Int i = 0; i != 8; ++i) {
+            Int bestDistance = std::numeric_limits<Int>::max();
+            Int bestIndex = 0;
+            for(Int index = 0; index != 4; ++index) {
+                const Int modifier = etc1Modifier(table, index);
+                const Int color[]{
+                    Math::clamp(base[0] + modifier, 0, 255),
+                    Math::clamp(base[1] + modifier, 0, 255),
+                    Math::clamp(base[2] + modifier, 0, 255)};
+                const Int d = distance(color, block[pixels[i]]);
+                if(d < bestDistance) {
+                    bestDistance = d;
+                    bestIndex = index;
+                }
+            }
+            result.indices |= bestIndex << (2*i);
+            result.error += bestDistance;
+            if(result.error >= best.error) break;
+        }
+        if(result.error < best.error) best = result;
+    }
+
+    return best;
+}
+
+Int etc1Expand(const Int value, const Int bits) {
+    return bits == 4 ? value*17 : (value << 3)|(value >> 2);
+}
+
+/* Base color candidates, quantized to given bit count */
+struct Etc1Candidate {
+    Int quantized[3];
+    Int expanded[3];
+    Etc1Subblock modifiers;
+};
+
+Etc1Candidate etc1Candidate(const Block& block, const Int (&pixels)[8], const Int* const quantized, const Int bits) {
+    Etc1Candidate candidate;
+    for(Int c = 0; c != 3; ++c) {
+        candidate.quantized[c] = quantized[c];
+        candidate.expanded[c] = etc1Expand(quantized[c], bits);
+    }
+    candidate.modifiers = etc1Modifiers(block, pixels, candidate.expanded);
+    return candidate;
+}
+
+/* Finds best base color of a subblock. The average is quantized first, then
+   refined with the mean of pixels with modifiers removed, optionally
+   followed by a greedy neighbor search. If the reference is given, only
+   colors with difference from it representable in the differential mode are
+   accepted. */
+Etc1Candidate etc1BestCandidate(const Block& block, const Int (&pixels)[8], const Int bits, const CompressionQuality quality, const Int* const reference) {
+    const Int maxValue = (1 << bits) - 1;
+    auto valid = [&](const Int* const quantized) {
+        for(Int c = 0; c != 3; ++c) {
+            if(quantized[c] < 0 || quantized[c] > maxValue) return false;
+            if(reference && (quantized[c] - reference[c] < -4 || quantized[c] - reference[c] > 3)) return false;
+        }
+        return true;
+    };
+
+    Float average[3]{};
+    for(Int i = 0; i != 8; ++i) for(Int c = 0; c != 3; ++c)
+        average[c] += block[pixels[i]][c]/8.0f;
+
+    Int quantized[3];
+    for(Int c = 0; c != 3; ++c) {
+        quantized[c] = Math::clamp(Int(average[c]*maxValue/255.0f + 0.5f), 0, maxValue);
+        if(reference) quantized[c] = Math::clamp(quantized[c], reference[c] - 4, reference[c] + 3);
+    }
+    Etc1Candidate best = etc1Candidate(block, pixels, quantized, bits);
+
+    /* Remove the modifiers from the pixels and use their mean as new base */
+    if(quality != CompressionQuality::Fast && best.modifiers.error) {
+        Float mean[3]{};
+        for(Int i = 0; i != 8; ++i) {
+            const Int modifier = etc1Modifier(best.modifiers.table, (best.modifiers.indices >> (2*i)) & 3);
+            for(Int c = 0; c != 3; ++c) mean[c] += (block[pixels[i]][c] - modifier)/8.0f;
+        }
+        for(Int c = 0; c != 3; ++c)
+            quantized[c] = Math::clamp(Int(mean[c]*maxValue/255.0f + 0.5f), 0, maxValue);
+        if(valid(quantized)) {
+            const Etc1Candidate candidate = etc1Candidate(block, pixels, quantized, bits);
+            if(candidate.modifiers.error < best.modifiers.error) best = candidate;
+        }
+    }
+
+    /* Greedy search along the axes and the gray diagonal */
+    if(quality == CompressionQuality::High) {
+        constexpr Int Directions[][3]{
+            {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1},
+            {-1, -1, -1}, {1, 1, 1}};
+        for(bool improved = true; improved && best.modifiers.error; ) {
+            improved = false;
+            const Etc1Candidate center = best;
+            for(const auto& direction: Directions) {
+                const Int neighbor[]{center.quantized[0] + direction[0], center.quantized[1] + direction[1], center.quantized[2] + direction[2]};
+                if(!valid(neighbor)) continue;
+                const Etc1Candidate candidate = etc1Candidate(block, pixels, neighbor, bits);
+                if(candidate.modifiers.error < best.modifiers.error) {
+                    best = candidate;
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    return best;
+}
+
+void encodeEtc1(const Block& block, const CompressionQuality quality, UnsignedByte* const out) {
+    /* In fast mode pick the subblock orientation with lower variance */
+    Int flipBegin = 0, flipEnd = 2;
+    if(quality == CompressionQuality::Fast) {
+        Float variance[2]{};
+        for(Int flip = 0; flip != 2; ++flip) for(Int subblock = 0; subblock != 2; ++subblock) {
+            Int pixels[8];
+            etc1Subblock(flip, subblock, pixels);
+            Float sum[3]{}, sumSquared[3]{};
+            for(Int i = 0; i != 8; ++i) for(Int c = 0; c != 3; ++c) {
+                sum[c] += block[pixels[i]][c];
+                sumSquared[c] += sq(block[pixels[i]][c]);
+            }
+            for(Int c = 0; c != 3; ++c) variance[flip] += sumSquared[c] - sum[c]*sum[c]/8.0f;
+        }
+        flipBegin = variance[1] < variance[0] ? 1 : 0;
+        flipEnd = flipBegin + 1;
+    }
+
+    Int bestError = std::numeric_limits<Int>::max();
+    std::uint64_t bestBits = 0;
+    for(Int flip = flipBegin; flip != flipEnd; ++flip) {
+        Int pixels[2][8];
+        etc1Subblock(flip, 0, pixels[0]);
+        etc1Subblock(flip, 1, pixels[1]);
+
+        /* Individual mode, 4-bit colors */
+        {
+            const Etc1Candidate first = etc1BestCandidate(block, pixels[0], 4, quality, nullptr);
+            const Etc1Candidate second = etc1BestCandidate(block, pixels[1], 4, quality, nullptr);
+            const Int error = first.modifiers.error + second.modifiers.error;
+            if(error < bestError) {
+                bestError = error;
+                bestBits =
+                    std::uint64_t(first.quantized[0]) << 60 | std::uint64_t(second.quantized[0]) << 56 |
+                    std::uint64_t(first.quantized[1]) << 52 | std::uint64_t(second.quantized[1]) << 48 |
+                    std::uint64_t(first.quantized[2]) << 44 | std::uint64_t(second.quantized[2]) << 40 |
+                    std::uint64_t(first.modifiers.table) << 37 | std::uint64_t(second.modifiers.table) << 34 |
+                    std::uint64_t(flip) << 32;
+                for(Int subblock = 0; subblock != 2; ++subblock) {
+                    const UnsignedInt indices = (subblock ? second : first).modifiers.indices;
+                    for(Int i = 0; i != 8; ++i) {
+                        const Int index = (indices >> (2*i)) & 3;
+                        const Int bit = (pixels[subblock][i]%4)*4 + pixels[subblock][i]/4;
+                        bestBits |= std::uint64_t(index >> 1) << (16 + bit) | std::uint64_t(index & 1) << bit;
+                    }
+                }
+            }
+        }
+
+        /* Differential mode, 5-bit first color and 3-bit signed difference */
+        {
+            const Etc1Candidate first = etc1BestCandidate(block, pixels[0], 5, quality, nullptr);
+            const Etc1Candidate second = etc1BestCandidate(block, pixels[1], 5, quality, first.quantized);
+            const Int error = first.modifiers.error + second.modifiers.error;
+            if(error < bestError) {
+                bestError = error;
+                bestBits =
+                    std::uint64_t(first.quantized[0]) << 59 | std::uint64_t((second.quantized[0] - first.quantized[0]) & 7) << 56 |
+                    std::uint64_t(first.quantized[1]) << 51 | std::uint64_t((second.quantized[1] - first.quantized[1]) & 7) << 48 |
+                    std::uint64_t(first.quantized[2]) << 43 | std::uint64_t((second.quantized[2] - first.quantized[2]) & 7) << 40 |
+                    std::uint64_t(first.modifiers.table) << 37 | std::uint64_t(second.modifiers.table) << 34 |
+                    std::uint64_t(1) << 33 | std::uint64_t(flip) << 32;
+                for(Int subblock = 0; subblock != 2; ++subblock) {
+                    const UnsignedInt indices = (subblock ? second : first).modifiers.indices;
+                    for(Int i = 0; i != 8; ++i) {
+                        const Int index = (indices >> (2*i)) & 3;
+                        const Int bit = (pixels[subblock][i]%4)*4 + pixels[subblock][i]/4;
+                        bestBits |= std::uint64_t(index >> 1) << (16 + bit) | std::uint64_t(index & 1) << bit;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Stored as big endian */
+    for(Int i = 0; i != 8; ++i) out[i] = (bestBits >> (56 - 8*i)) & 0xff;
+}
+
+void decodeEtc1(const UnsignedByte* const in, Block& block) {
+    std::uint64_t bits = 0;
+    for(Int i = 0; i != 8; ++i) bits = bits << 8 | in[i];
+
+    const bool flip = (bits >> 32) & 1;
+    const bool differential = (bits >> 33) & 1;
+    const Int tables[]{Int((bits >> 37) & 7), Int((bits >> 34) & 7)};
+
+    Int base[2][3];
+    for(Int c = 0; c != 3; ++c) {
+        if(differential) {
+            const Int first = (bits >> (59 - 8*c)) & 0x1f;
+            Int delta = (bits >> (56 - 8*c)) & 7;
+            if(delta >= 4) delta -= 8;
+            base[0][c] = etc1Expand(first, 5);
+            base[1][c] = etc1Expand(first + delta, 5);
+        } else {
+            base[0][c] = etc1Expand((bits >> (60 - 8*c)) & 0xf, 4);
+            base[1][c] = etc1Expand((bits >> (56 - 8*c)) & 0xf, 4);
+        }
+    }
+
+    for(Int y = 0; y != 4; ++y) for(Int x = 0; x != 4; ++x) {
+        const Int subblock = flip ? y/2 : x/2;
+        const Int bit = x*4 + y;
+        const Int index = Int((bits >> (16 + bit)) & 1) << 1 | Int((bits >> bit) & 1);
+        const Int modifier = etc1Modifier(tables[subblock], index);
+        for(Int c = 0; c != 3; ++c)
+            block[y*4 + x][c] = Math::clamp(base[subblock][c] + modifier, 0, 255);
+        block[y*4 + x][3] = 255;
+    }
+}
+
+std::size_t blockSize(const CompressedFormat format) {
+    return format == CompressedFormat::Bc3 || format == CompressedFormat::Bc5 ? 16 : 8;
+}
+
+void encodeBlock(const Block& block, const CompressedFormat format, const CompressionQuality quality, UnsignedByte* const out) {
+    UnsignedByte channel[16];
+    switch(format) {
+        case CompressedFormat::Bc1:
+            encodeBc1(block, quality, out);
+            return;
+        case CompressedFormat::Bc3:
+            for(Int i = 0; i != 16; ++i) channel[i] = block[i][3];
+            encodeBc4(channel, quality, out);
+            encodeBc1(block, quality, out + 8);
+            return;
+        case CompressedFormat::Bc4:
+            for(Int i = 0; i != 16; ++i) channel[i] = block[i][0];
+            encodeBc4(channel, quality, out);
+            return;
+        case CompressedFormat::Bc5:
+            for(Int c = 0; c != 2; ++c) {
+                for(Int i = 0; i != 16; ++i) channel[i] = block[i][c];
+                encodeBc4(channel, quality, out + 8*c);
+            }
+            return;
+        case CompressedFormat::Etc1:
+            encodeEtc1(block, quality, out);
+            return;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+void decodeBlock(const UnsignedByte* const in, const CompressedFormat format, Block& block) {
+    switch(format) {
+        case CompressedFormat::Bc1:
+            decodeBc1(in, block, false);
+            return;
+        case CompressedFormat::Bc3:
+            decodeBc1(in + 8, block, true);
+            decodeBc4(in, block, 3);
+            return;
+        case CompressedFormat::Bc4:
+            decodeBc4(in, block, 0);
+            return;
+        case CompressedFormat::Bc5:
+            decodeBc4(in, block, 0);
+            decodeBc4(in + 8, block, 1);
+            return;
+        case CompressedFormat::Etc1:
+            decodeEtc1(in, block);
+            return;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+}
+
+std::size_t compressedDataSize(const CompressedFormat format, const Vector2i& size) {
+    return ((size.x() + 3)/4)*((size.y() + 3)/4)*blockSize(format);
+}
+
+Containers::Array<unsigned char> compress(const ImageReference2D& image, const CompressedFormat format, const CompressionQuality quality) {
+    /* Convert the image to RGBA8, so the rows are tightly packed */
+    std::optional<Trade::ImageData2D> converted;
+    if(image.format() != ColorFormat::RGBA || image.type() != ColorType::UnsignedByte) {
+        converted = convertFormat(image, ColorFormat::RGBA, ColorType::UnsignedByte);
+        if(!converted) return nullptr;
+    }
+    const UnsignedByte* const pixels = converted ? converted->data<UnsignedByte>() : image.data<UnsignedByte>();
+
+    const Vector2i size = image.size();
+    const Vector2i blockCount = (size + Vector2i(3))/4;
+    Containers::Array<unsigned char> out(compressedDataSize(format, size));
+
+    Magnum::Implementation::parallelRows(blockCount.y(), out.size()*64, true, [&](const Int begin, const Int end) {
+        Block block;
+        for(Int by = begin; by != end; ++by) for(Int bx = 0; bx != blockCount.x(); ++bx) {
+            /* Edge blocks repeat the last row and column */
+            for(Int y = 0; y != 4; ++y) for(Int x = 0; x != 4; ++x) {
+                const Int sx = Math::min(bx*4 + x, size.x() - 1);
+                const Int sy = Math::min(by*4 + y, size.y() - 1);
+                for(Int c = 0; c != 4; ++c) block[y*4 + x][c] = pixels[(sy*size.x() + sx)*4 + c];
+            }
+
+            encodeBlock(block, format, quality, out + (by*blockCount.x() + bx)*blockSize(format));
+        }
+    });
+
+    return out;
+}
+
+std::optional<Trade::ImageData2D> decompress(const Containers::ArrayReference<const unsigned char> data, const CompressedFormat format, const Vector2i& size) {
+    if(data.size() != compressedDataSize(format, size)) {
+        Error() << "TextureTools::decompress(): expected" << compressedDataSize(format, size) << "bytes for" << size << "image but got" << data.size();
+        return std::nullopt;
+    }
+
+    ColorFormat colorFormat;
+    Int channelCount;
+    switch(format) {
+        case CompressedFormat::Bc3:
+            colorFormat = ColorFormat::RGBA;
+            channelCount = 4;
+            break;
+        case CompressedFormat::Bc4:
+            colorFormat = ColorFormat::Red;
+            channelCount = 1;
+            break;
+        case CompressedFormat::Bc5:
+            colorFormat = ColorFormat::RG;
+            channelCount = 2;
+            break;
+        default:
+            colorFormat = ColorFormat::RGB;
+            channelCount = 3;
+    }
+
+    /* Rows are aligned to four bytes */
+    const std::size_t stride = ((size.x()*channelCount + 3)/4)*4;
+    Trade::ImageData2D image(colorFormat, ColorType::UnsignedByte, size, new unsigned char[stride*size.y()]());
+
+    const Vector2i blockCount = (size + Vector2i(3))/4;
+    Block block{};
+    for(Int by = 0; by != blockCount.y(); ++by) for(Int bx = 0; bx != blockCount.x(); ++bx) {
+        decodeBlock(data + (by*blockCount.x() + bx)*blockSize(format), format, block);
+        for(Int y = 0; y != 4 && by*4 + y < size.y(); ++y) for(Int x = 0; x != 4 && bx*4 + x < size.x(); ++x)
+            for(Int c = 0; c != channelCount; ++c)
+                image.data()[(by*4 + y)*stride + (bx*4 + x)*channelCount + c] = block[y*4 + x][c];
+    }
+
+    return std::move(image);
+}
+
+Double psnr(const ImageReference2D& a, const ImageReference2D& b) {
+    if(a.size() != b.size()) {
+        Error() << "TextureTools::psnr(): size mismatch," << a.size() << "and" << b.size();
+        return 0.0;
+    }
+
+    const std::optional<Trade::ImageData2D> first = convertFormat(a, a.format(), ColorType::UnsignedByte);
+    const std::optional<Trade::ImageData2D> second = convertFormat(b, a.format(), ColorType::UnsignedByte);
+    if(!first || !second) return 0.0;
+
+    const std::size_t rowSize = a.size().x()*first->pixelSize();
+    const std::size_t stride = ((rowSize + 3)/4)*4;
+    Double error = 0.0;
+    for(Int y = 0; y != a.size().y(); ++y) for(std::size_t x = 0; x != rowSize; ++x)
+        error += sq(first->data<UnsignedByte>()[y*stride + x] - second->data<UnsignedByte>()[y*stride + x]);
+    if(error == 0.0) return std::numeric_limits<Double>::infinity();
+
+    return 10.0*std::log10(255.0*255.0/(error/(rowSize*a.size().y())));
+}
+
+}}
@@ -0,0 +1,163 @@
+#ifndef Magnum_TextureTools_Compress_h
+#define Magnum_TextureTools_Compress_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::compress(), @ref Magnum::TextureTools::decompress(), @ref Magnum::TextureTools::compressedDataSize(), @ref Magnum::TextureTools::psnr(), enum @ref Magnum::TextureTools::CompressedFormat, @ref Magnum::TextureTools::CompressionQuality
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/TextureTools/magnumTextureToolsVisibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Block-compressed format
+
+All formats encode blocks of 4x4 pixels.
+@see @ref compress()
+*/
+enum class CompressedFormat: UnsignedByte {
+    /**
+     * BC1 (DXT1), opaque RGB in 8 bytes per block. Corresponds to
+     * `GL_COMPRESSED_RGB_S3TC_DXT1_EXT`.
+     */
+    Bc1,
+
+    /**
+     * BC3 (DXT5), RGBA in 16 bytes per block, alpha is encoded the same way
+     * as in @ref CompressedFormat::Bc4. Corresponds to
+     * `GL_COMPRESSED_RGBA_S3TC_DXT5_EXT`.
+     */
+    Bc3,
+
+    /**
+     * BC4 (RGTC1), single channel in 8 bytes per block. Corresponds to
+     * `GL_COMPRESSED_RED_RGTC1`.
+     */
+    Bc4,
+
+    /**
+     * BC5 (RGTC2), two channels in 16 bytes per block, suitable for normal
+     * maps. Corresponds to `GL_COMPRESSED_RG_RGTC2`.
+     */
+    Bc5,
+
+    /**
+     * ETC1, opaque RGB in 8 bytes per block. Corresponds to
+     * `GL_ETC1_RGB8_OES`.
+     */
+    Etc1
+};
+
+/**
+@brief Compression quality
+
+@see @ref compress()
+*/
+enum class CompressionQuality: UnsignedByte {
+    /**
+     * Endpoints from bounding box of the block colors, base colors from
+     * subblock averages and only one subblock orientation in ETC1
+     */
+    Fast,
+
+    /**
+     * Endpoints along principal axis of the block colors refined with least
+     * squares fit, base colors refined with the modifiers removed in ETC1
+     */
+    Normal,
+
+    /**
+     * Iterated least squares fit followed by greedy search in the
+     * neighborhood of the endpoints and base colors
+     */
+    High
+};
+
+/**
+@brief Size of compressed data
+@param format       Compressed format
+@param size         %Image size
+
+Size of the data returned by @ref compress() for image of given size. Each
+row of blocks is stored after each other, incomplete blocks on the right and
+bottom edge are stored as whole.
+*/
+std::size_t MAGNUM_TEXTURETOOLS_EXPORT compressedDataSize(CompressedFormat format, const Vector2i& size);
+
+/**
+@brief Compress image
+@param image        Input image
+@param format       Compressed format
+@param quality      Compression quality
+
+Accepts all formats and types supported by @ref convertFormat(), the image is
+converted to 8-bit RGBA first. @ref CompressedFormat::Bc4 takes the red
+channel, @ref CompressedFormat::Bc5 red and green channel, other formats
+ignore alpha except for @ref CompressedFormat::Bc3. Incomplete blocks on the
+edges are padded by repeating the last row and column. Rows of blocks are
+compressed in parallel, if supported on given platform.
+
+Returns zero-sized array if the input format is not supported.
+@see @ref compressedDataSize(), @ref decompress(), @ref psnr()
+*/
+Containers::Array<unsigned char> MAGNUM_TEXTURETOOLS_EXPORT compress(const ImageReference2D& image, CompressedFormat format, CompressionQuality quality = CompressionQuality::Normal);
+
+/**
+@brief Decompress image
+@param data         Compressed data
+@param format       Compressed format
+@param size         %Image size
+
+Returns 8-bit image with @ref ColorFormat::Red for
+@ref CompressedFormat::Bc4, @ref ColorFormat::RG for
+@ref CompressedFormat::Bc5, @ref ColorFormat::RGBA for
+@ref CompressedFormat::Bc3 and @ref ColorFormat::RGB otherwise. Returns
+`std::nullopt` if the data size doesn't match @ref compressedDataSize().
+*/
+std::optional<Trade::ImageData2D> MAGNUM_TEXTURETOOLS_EXPORT decompress(Containers::ArrayReference<const unsigned char> data, CompressedFormat format, const Vector2i& size);
+
+/**
+@brief Peak signal-to-noise ratio of two images
+@param a            First image
+@param b            Second image
+
+Both images are converted to 8-bit values of format of @p a, the result is
+in decibels over all channels of the format. Returns infinity if the images
+are the same and zero if the sizes differ or the format is not supported.
+Useful for measuring quality of lossy compression, with values over 40 dB
+being generally indistinguishable from the original.
+*/
+Double MAGNUM_TEXTURETOOLS_EXPORT psnr(const ImageReference2D& a, const ImageReference2D& b);
+
+}}
+
+#endif
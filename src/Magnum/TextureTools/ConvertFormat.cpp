@@ -0,0 +1,369 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ConvertFormat.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Implementation/parallelRows.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Supported formats, in order Red, RG, RGB, RGBA, BGR, BGRA. The format
+   index is used as template parameter of the conversion kernels. */
+constexpr UnsignedInt FormatChannels[]{1, 2, 3, 4, 3, 4};
+constexpr bool FormatSwapped[]{false, false, false, false, true, true};
+
+Int formatIndex(const ColorFormat format) {
+    switch(format) {
+        case ColorFormat::Red: return 0;
+        case ColorFormat::RG: return 1;
+        case ColorFormat::RGB: return 2;
+        case ColorFormat::RGBA: return 3;
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::BGR: return 4;
+        #endif
+        case ColorFormat::BGRA: return 5;
+        default: return -1;
+    }
+}
+
+std::size_t typeSize(const ColorType type) {
+    switch(type) {
+        case ColorType::UnsignedByte: return 1;
+        case ColorType::UnsignedShort:
+        case ColorType::HalfFloat: return 2;
+        case ColorType::Float: return 4;
+        default: return 0;
+    }
+}
+
+/* Canonical RGBA channel stored at given position of given format */
+constexpr UnsignedInt canonicalChannel(const UnsignedInt format, const UnsignedInt position) {
+    return FormatSwapped[format] && position != 1 && position != 3 ? 2 - position : position;
+}
+
+/* Position of canonical RGBA channel in given format or -1 if the format
+   doesn't have it. Red is treated as luminance. */
+constexpr Int channelPosition(const UnsignedInt format, const UnsignedInt channel) {
+    return format == 0 ? (channel < 3 ? 0 : -1) :
+        channel < FormatChannels[format] ? Int(canonicalChannel(format, channel)) : -1;
+}
+
+/* Packing and unpacking of particular types to normalized floats */
+struct UnsignedByteTraits {
+    typedef UnsignedByte Type;
+    static Float unpack(const Type value) { return value*(1.0f/255.0f); }
+    static Type pack(const Float value) { return Type(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f); }
+};
+struct UnsignedShortTraits {
+    typedef UnsignedShort Type;
+    static Float unpack(const Type value) { return value*(1.0f/65535.0f); }
+    static Type pack(const Float value) { return Type(Math::clamp(value, 0.0f, 1.0f)*65535.0f + 0.5f); }
+};
+struct HalfFloatTraits {
+    typedef UnsignedShort Type;
+    static Float unpack(const Type value) { return Math::unpackHalf(value); }
+    static Type pack(const Float value) { return Math::packHalf(value); }
+};
+struct FloatTraits {
+    typedef Float Type;
+    static Float unpack(const Type value) { return value; }
+    static Type pack(const Float value) { return value; }
+};
+
+/* Reorders, adds or removes channels of the same type. Fixed channel counts
+   and positions allow the compiler to unroll the inner loops and vectorize
+   the outer one. The whole pixel is read before writing, so the input and
+   output can be the same. */
+typedef void(*SwizzleFunction)(const char*, char*, std::size_t, UnsignedInt);
+template<class T, UnsignedInt in, UnsignedInt out> void swizzle(const char* const input, char* const output, const std::size_t count, const UnsignedInt one) {
+    const T* i = reinterpret_cast<const T*>(input);
+    T* o = reinterpret_cast<T*>(output);
+    for(std::size_t p = 0; p != count; ++p, i += FormatChannels[in], o += FormatChannels[out]) {
+        T pixel[4];
+        for(UnsignedInt c = 0; c != FormatChannels[out]; ++c) {
+            const Int position = channelPosition(in, canonicalChannel(out, c));
+            pixel[c] = position != -1 ? i[position] : canonicalChannel(out, c) == 3 ? T(one) : T(0);
+        }
+        for(UnsignedInt c = 0; c != FormatChannels[out]; ++c) o[c] = pixel[c];
+    }
+}
+
+template<class T, UnsignedInt in> SwizzleFunction swizzleFunction(const UnsignedInt out) {
+    switch(out) {
+        case 0: return swizzle<T, in, 0>;
+        case 1: return swizzle<T, in, 1>;
+        case 2: return swizzle<T, in, 2>;
+        case 3: return swizzle<T, in, 3>;
+        case 4: return swizzle<T, in, 4>;
+        case 5: return swizzle<T, in, 5>;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+template<class T> SwizzleFunction swizzleFunction(const UnsignedInt in, const UnsignedInt out) {
+    switch(in) {
+        case 0: return swizzleFunction<T, 0>(out);
+        case 1: return swizzleFunction<T, 1>(out);
+        case 2: return swizzleFunction<T, 2>(out);
+        case 3: return swizzleFunction<T, 3>(out);
+        case 4: return swizzleFunction<T, 4>(out);
+        case 5: return swizzleFunction<T, 5>(out);
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+/* Conversion of a row to and from RGBA floats */
+typedef void(*LoadFunction)(const char*, Float*, std::size_t);
+typedef void(*StoreFunction)(const Float*, char*, std::size_t);
+template<class Traits, UnsignedInt format> void load(const char* const input, Float* output, const std::size_t count) {
+    const typename Traits::Type* i = reinterpret_cast<const typename Traits::Type*>(input);
+    for(std::size_t p = 0; p != count; ++p, i += FormatChannels[format], output += 4) {
+        for(UnsignedInt c = 0; c != 4; ++c) {
+            const Int position = channelPosition(format, c);
+            output[c] = position != -1 ? Traits::unpack(i[position]) : c == 3 ? 1.0f : 0.0f;
+        }
+    }
+}
+
+template<class Traits, UnsignedInt format> void store(const Float* input, char* const output, const std::size_t count) {
+    typename Traits::Type* o = reinterpret_cast<typename Traits::Type*>(output);
+    for(std::size_t p = 0; p != count; ++p, input += 4, o += FormatChannels[format])
+        for(UnsignedInt c = 0; c != FormatChannels[format]; ++c)
+            o[c] = Traits::pack(input[canonicalChannel(format, c)]);
+}
+
+/* Half-float RGBA rows have the same layout as the RGBA float rows, so they
+   are converted in one batch */
+template<> void load<HalfFloatTraits, 3>(const char* const input, Float* const output, const std::size_t count) {
+    Math::unpackHalf({reinterpret_cast<const UnsignedShort*>(input), count*4}, {output, count*4});
+}
+
+template<> void store<HalfFloatTraits, 3>(const Float* const input, char* const output, const std::size_t count) {
+    Math::packHalf({input, count*4}, {reinterpret_cast<UnsignedShort*>(output), count*4});
+}
+
+template<class Traits> std::pair<LoadFunction, StoreFunction> loadStoreFunctions(const UnsignedInt format) {
+    switch(format) {
+        case 0: return {load<Traits, 0>, store<Traits, 0>};
+        case 1: return {load<Traits, 1>, store<Traits, 1>};
+        case 2: return {load<Traits, 2>, store<Traits, 2>};
+        case 3: return {load<Traits, 3>, store<Traits, 3>};
+        case 4: return {load<Traits, 4>, store<Traits, 4>};
+        case 5: return {load<Traits, 5>, store<Traits, 5>};
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+std::pair<LoadFunction, StoreFunction> loadStoreFunctions(const ColorType type, const UnsignedInt format) {
+    switch(type) {
+        case ColorType::UnsignedByte: return loadStoreFunctions<UnsignedByteTraits>(format);
+        case ColorType::UnsignedShort: return loadStoreFunctions<UnsignedShortTraits>(format);
+        case ColorType::HalfFloat: return loadStoreFunctions<HalfFloatTraits>(format);
+        case ColorType::Float: return loadStoreFunctions<FloatTraits>(format);
+        default: CORRADE_ASSERT_UNREACHABLE();
+    }
+}
+
+Float srgbToLinear(const Float value) {
+    return value <= 0.04045f ? value/12.92f : std::pow((value + 0.055f)/1.055f, 2.4f);
+}
+
+Float linearToSrgb(const Float value) {
+    return value <= 0.0031308f ? value*12.92f : 1.055f*std::pow(value, 1.0f/2.4f) - 0.055f;
+}
+
+/* Lookup tables for conversion of 8-bit values. Linear to sRGB conversion
+   first looks up an approximate value in a coarse table indexed by the linear
+   value and then corrects it using a table of bounds between adjacent 8-bit
+   sRGB values. That matches the calculation with subsequent rounding except
+   for floating-point error on the bounds themselves. The coarse table is fine
+   enough that the correction is at most one. */
+struct SrgbLookup {
+    explicit SrgbLookup() {
+        for(Int i = 0; i != 256; ++i) toLinear[i] = srgbToLinear(i/255.0f);
+        for(Int i = 0; i != 255; ++i) fromLinearBounds[i] = srgbToLinear((i + 0.5f)/255.0f);
+        fromLinearBounds[255] = 2.0f;
+
+        Int bound = 0;
+        for(Int i = 0; i != 4096; ++i) {
+            while(fromLinearBounds[bound] <= i/4095.0f) ++bound;
+            fromLinearCoarse[i] = bound;
+        }
+    }
+
+    Int fromLinear(Float value) const {
+        value = Math::clamp(value, 0.0f, 1.0f);
+        const Int index = fromLinearCoarse[Int(value*4095.0f)];
+        return index + (fromLinearBounds[index] <= value ? 1 : 0);
+    }
+
+    Float toLinear[256];
+    Float fromLinearBounds[256];
+    UnsignedByte fromLinearCoarse[4096];
+};
+
+/* Operations done on the floating-point representation */
+void applyFlags(Float* const data, const std::size_t count, const FormatConversionFlags flags, const SrgbLookup* const toLinearLookup, const SrgbLookup* const fromLinearLookup) {
+    for(Float* pixel = data; pixel != data + count*4; pixel += 4) {
+        if(flags & FormatConversionFlag::SrgbToLinear) {
+            for(UnsignedInt c = 0; c != 3; ++c)
+                pixel[c] = toLinearLookup ? toLinearLookup->toLinear[Int(pixel[c]*255.0f + 0.5f)] : srgbToLinear(pixel[c]);
+        }
+
+        if(flags & FormatConversionFlag::UnpremultiplyAlpha && pixel[3] != 0.0f) {
+            for(UnsignedInt c = 0; c != 3; ++c) pixel[c] /= pixel[3];
+        }
+
+        if(flags & FormatConversionFlag::PremultiplyAlpha) {
+            for(UnsignedInt c = 0; c != 3; ++c) pixel[c] *= pixel[3];
+        }
+
+        if(flags & FormatConversionFlag::LinearToSrgb) {
+            for(UnsignedInt c = 0; c != 3; ++c) pixel[c] = fromLinearLookup ?
+                fromLinearLookup->fromLinear(pixel[c])/255.0f : linearToSrgb(pixel[c]);
+        }
+    }
+}
+
+std::size_t rowStride(const Int width, const std::size_t pixelSize) {
+    /* Same as in AbstractImage::dataSize() */
+    return ((width*pixelSize + 3)/4)*4;
+}
+
+bool convert(const char* const function, const ImageReference2D& image, char* const output, const ColorFormat format, const ColorType type, const FormatConversionFlags flags) {
+    const Int inFormat = formatIndex(image.format());
+    const Int outFormat = formatIndex(format);
+    const std::size_t inTypeSize = typeSize(image.type());
+    const std::size_t outTypeSize = typeSize(type);
+    if(inFormat == -1 || outFormat == -1 || !inTypeSize || !outTypeSize) {
+        Error() << function << "unsupported conversion from" << image.format() << image.type() << "to" << format << type;
+        return false;
+    }
+
+    const char* const input = image.data<char>();
+    const std::size_t inStride = rowStride(image.size().x(), inTypeSize*FormatChannels[inFormat]);
+    const std::size_t outStride = rowStride(image.size().x(), outTypeSize*FormatChannels[outFormat]);
+
+    /* When converting in place, rows can be processed in parallel only if
+       they don't move */
+    const bool parallel = input != output || inStride == outStride;
+    const std::size_t dataSize = image.size().y()*Math::max(inStride, outStride);
+
+    /* Same type without any additional operations, only reorder the
+       channels */
+    if(image.type() == type && !flags) {
+        SwizzleFunction swizzleRow;
+        UnsignedInt one;
+        switch(type) {
+            case ColorType::UnsignedByte:
+                swizzleRow = swizzleFunction<UnsignedByte>(inFormat, outFormat);
+                one = 0xff;
+                break;
+            case ColorType::UnsignedShort:
+                swizzleRow = swizzleFunction<UnsignedShort>(inFormat, outFormat);
+                one = 0xffff;
+                break;
+            case ColorType::HalfFloat:
+                swizzleRow = swizzleFunction<UnsignedShort>(inFormat, outFormat);
+                one = 0x3c00;
+                break;
+            case ColorType::Float:
+                swizzleRow = swizzleFunction<UnsignedInt>(inFormat, outFormat);
+                one = 0x3f800000;
+                break;
+            default: CORRADE_ASSERT_UNREACHABLE();
+        }
+
+        Magnum::Implementation::parallelRows(image.size().y(), dataSize, parallel, [&](const Int begin, const Int end) {
+            for(Int row = begin; row != end; ++row)
+                swizzleRow(input + row*inStride, output + row*outStride, image.size().x(), one);
+        });
+        return true;
+    }
+
+    /* Otherwise convert each row to RGBA floats and back */
+    const LoadFunction loadRow = loadStoreFunctions(image.type(), inFormat).first;
+    const StoreFunction storeRow = loadStoreFunctions(type, outFormat).second;
+
+    /* Use lookup tables for sRGB conversion of 8-bit values */
+    std::unique_ptr<SrgbLookup> srgbLookup;
+    if(flags & (FormatConversionFlag::SrgbToLinear|FormatConversionFlag::LinearToSrgb) && (image.type() == ColorType::UnsignedByte || type == ColorType::UnsignedByte))
+        srgbLookup.reset(new SrgbLookup);
+    const SrgbLookup* const toLinearLookup = image.type() == ColorType::UnsignedByte ? srgbLookup.get() : nullptr;
+    const SrgbLookup* const fromLinearLookup = type == ColorType::UnsignedByte ? srgbLookup.get() : nullptr;
+
+    Magnum::Implementation::parallelRows(image.size().y(), dataSize, parallel, [&](const Int begin, const Int end) {
+        std::vector<Float> buffer(image.size().x()*4);
+        for(Int row = begin; row != end; ++row) {
+            loadRow(input + row*inStride, buffer.data(), image.size().x());
+            if(flags) applyFlags(buffer.data(), image.size().x(), flags, toLinearLookup, fromLinearLookup);
+            storeRow(buffer.data(), output + row*outStride, image.size().x());
+        }
+    });
+    return true;
+}
+
+}
+
+std::optional<Trade::ImageData2D> convertFormat(const ImageReference2D& image, const ColorFormat format, const ColorType type, const FormatConversionFlags flags) {
+    const std::size_t dataSize = image.size().y()*rowStride(image.size().x(), typeSize(type)*(formatIndex(format) == -1 ? 0 : FormatChannels[formatIndex(format)]));
+    Trade::ImageData2D out(format, type, image.size(), new char[dataSize]);
+    if(!convert("TextureTools::convertFormat():", image, out.data<char>(), format, type, flags))
+        return std::nullopt;
+
+    return std::move(out);
+}
+
+bool convertFormatInPlace(Trade::ImageData2D& image, const ColorFormat format, const ColorType type, const FormatConversionFlags flags) {
+    const Int outFormat = formatIndex(format);
+    if(outFormat != -1 && typeSize(type)*FormatChannels[outFormat] > image.pixelSize()) {
+        Error() << "TextureTools::convertFormatInPlace(): can't convert" << image.format() << image.type() << "to larger" << format << type << "in place";
+        return false;
+    }
+
+    if(!convert("TextureTools::convertFormatInPlace():", image, image.data<char>(), format, type, flags))
+        return false;
+
+    const Vector2i size = image.size();
+    image = Trade::ImageData2D(format, type, size, image.release());
+    return true;
+}
+
+}}
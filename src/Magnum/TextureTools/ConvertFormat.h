@@ -0,0 +1,114 @@
+#ifndef Magnum_TextureTools_ConvertFormat_h
+#define Magnum_TextureTools_ConvertFormat_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::convertFormat(), @ref Magnum::TextureTools::convertFormatInPlace(), enum @ref Magnum::TextureTools::FormatConversionFlag, enum set @ref Magnum::TextureTools::FormatConversionFlags
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/TextureTools/magnumTextureToolsVisibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Format conversion flag
+
+@see @ref FormatConversionFlags, @ref convertFormat()
+*/
+enum class FormatConversionFlag: UnsignedByte {
+    /** Convert color channels from sRGB to linear space */
+    SrgbToLinear = 1 << 0,
+
+    /** Convert color channels from linear to sRGB space */
+    LinearToSrgb = 1 << 1,
+
+    /** Multiply color channels by alpha */
+    PremultiplyAlpha = 1 << 2,
+
+    /** Divide color channels by alpha, pixels with zero alpha are kept */
+    UnpremultiplyAlpha = 1 << 3
+};
+
+/**
+@brief Format conversion flags
+
+@see @ref convertFormat()
+*/
+typedef Containers::EnumSet<FormatConversionFlag, UnsignedByte> FormatConversionFlags;
+
+CORRADE_ENUMSET_OPERATORS(FormatConversionFlags)
+
+/**
+@brief Convert image to another pixel format
+@param image        Input image
+@param format       Output format
+@param type         Output type
+@param flags        Additional operations
+
+Supported formats are @ref ColorFormat::Red, @ref ColorFormat::RG,
+@ref ColorFormat::RGB, @ref ColorFormat::RGBA, @ref ColorFormat::BGR and
+@ref ColorFormat::BGRA, supported types are @ref ColorType::UnsignedByte,
+@ref ColorType::UnsignedShort, @ref ColorType::HalfFloat and
+@ref ColorType::Float, both for input and output. Integer types are treated
+as normalized, i.e. values are mapped to range @f$ [0, 1] @f$ and floating
+point values outside of that range are clamped when converting to them.
+
+Missing channels are filled with zero, missing alpha with one. Red channel of
+single-channel images is treated as luminance and replicated into all color
+channels. Excess channels are dropped.
+
+Conversions which only reorder, add or remove channels of the same type are
+done with dedicated kernels operating directly on the input type, other
+conversions go through floating-point representation. Conversion of large
+images is spread across multiple threads, if supported on given platform.
+Alpha channel is never affected by sRGB conversion; alpha premultiplication
+is done after sRGB to linear conversion and before linear to sRGB
+conversion, so both can be combined to premultiply sRGB image in linear
+space.
+
+Returns `std::nullopt` if given format or type is not supported.
+@see @ref convertFormatInPlace()
+*/
+std::optional<Trade::ImageData2D> MAGNUM_TEXTURETOOLS_EXPORT convertFormat(const ImageReference2D& image, ColorFormat format, ColorType type, FormatConversionFlags flags = {});
+
+/**
+@brief Convert image to another pixel format in place
+
+Same as @ref convertFormat(), but reuses the image storage. Possible only if
+the output pixel size is not larger than input pixel size, otherwise the
+image is left untouched and `false` is returned. Also returns `false` if
+given format or type is not supported.
+*/
+bool MAGNUM_TEXTURETOOLS_EXPORT convertFormatInPlace(Trade::ImageData2D& image, ColorFormat format, ColorType type, FormatConversionFlags flags = {});
+
+}}
+
+#endif
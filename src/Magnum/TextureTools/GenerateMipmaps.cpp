@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateMipmaps.h"
+
+#include <cmath>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/ConvertFormat.h"
+#include "Magnum/TextureTools/Implementation/resample.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Kaiser filter lobe count and window shape parameter */
+constexpr Float KaiserWidth = 3.0f;
+constexpr Float KaiserAlpha = 4.0f;
+
+/* Zeroth order modified Bessel function of the first kind */
+Float besselI0(const Float x) {
+    Float sum = 1.0f;
+    Float term = 1.0f;
+    for(Int i = 1; i != 16; ++i) {
+        term *= (x/(2*i))*(x/(2*i));
+        sum += term;
+    }
+    return sum;
+}
+
+Implementation::Taps taps(const MipmapFilter filter, const Int inSize, const Int outSize) {
+    /* Windowed sinc, distance is in output pixels */
+    if(filter == MipmapFilter::Kaiser) return Implementation::kernelTaps([](const Float t) {
+        return std::abs(t) >= KaiserWidth ? 0.0f :
+            Implementation::sinc(t)*besselI0(KaiserAlpha*std::sqrt(1.0f - (t/KaiserWidth)*(t/KaiserWidth)))/besselI0(KaiserAlpha);
+    }, KaiserWidth, inSize, outSize);
+
+    /* Maximal footprint of an output pixel */
+    const Float scale = Float(inSize)/outSize;
+    const Float radius = scale*0.5f;
+    Implementation::Taps taps;
+    taps.count = Int(std::ceil(radius*2)) + 1;
+    taps.indices.resize(outSize*taps.count);
+    taps.weights.resize(outSize*taps.count);
+
+    for(Int x = 0; x != outSize; ++x) {
+        const Float center = (x + 0.5f)*scale;
+        const Int begin = Int(std::floor(center - radius));
+        Int* const indices = taps.indices.data() + x*taps.count;
+        Float* const weights = taps.weights.data() + x*taps.count;
+
+        /* Area of the source pixel covered by the output pixel */
+        for(Int i = 0; i != taps.count; ++i) {
+            const Int source = begin + i;
+            indices[i] = Math::clamp(source, 0, inSize - 1);
+            weights[i] = Math::max(0.0f, Math::min(source + 1.0f, center + radius) - Math::max(Float(source), center - radius))/scale;
+        }
+    }
+
+    return taps;
+}
+
+/* Fraction of pixels with scaled alpha above the reference value */
+Float alphaCoverage(const Float* const data, const std::size_t pixelCount, const Float reference, const Float scale) {
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != pixelCount; ++i)
+        if(data[i*4 + 3]*scale > reference) ++count;
+    return Float(count)/pixelCount;
+}
+
+/* Scales alpha of the level so its coverage matches given value. The
+   coverage grows monotonically with the scale, so it's found with bisection.
+   The coverage is a step function, so the closest match is remembered. */
+void preserveAlphaCoverage(std::vector<Float>& data, const Float reference, const Float coverage) {
+    Float min = 0.0f;
+    Float max = 4.0f;
+    Float scale = 1.0f;
+    Float bestScale = 1.0f;
+    Float bestError = 1.0f;
+    for(Int i = 0; i != 16; ++i) {
+        const Float current = alphaCoverage(data.data(), data.size()/4, reference, scale);
+        if(std::abs(current - coverage) <= bestError) {
+            bestError = std::abs(current - coverage);
+            bestScale = scale;
+        }
+
+        if(current < coverage) min = scale;
+        else if(current > coverage) max = scale;
+        else break;
+        scale = (min + max)*0.5f;
+    }
+
+    for(std::size_t i = 3; i < data.size(); i += 4)
+        data[i] = Math::min(data[i]*bestScale, 1.0f);
+}
+
+}
+
+std::vector<Trade::ImageData2D> generateMipmaps(const ImageReference2D& image, const MipmapFilter filter, const MipmapFlags flags, const Float alphaReference) {
+    std::vector<Trade::ImageData2D> levels;
+    if(image.size().product() <= 1) return levels;
+
+    /* Convert the image to linear RGBA floats */
+    std::optional<Trade::ImageData2D> base = convertFormat(image, ColorFormat::RGBA, ColorType::Float, flags & MipmapFlag::Srgb ? FormatConversionFlag::SrgbToLinear : FormatConversionFlags{});
+    if(!base) return levels;
+
+    /* Alpha coverage makes sense only if the image has some alpha */
+    const bool preserveCoverage = (flags & MipmapFlag::PreserveAlphaCoverage) && (image.format() == ColorFormat::RGBA || image.format() == ColorFormat::BGRA);
+    const Float coverage = preserveCoverage ?
+        alphaCoverage(base->data<Float>(), image.size().product(), alphaReference, 1.0f) : 0.0f;
+
+    std::vector<Float> level;
+    Vector2i size = image.size();
+    while(size != Vector2i(1)) {
+        const Vector2i levelSize = Math::max(size/2, Vector2i(1));
+        level = Implementation::resample(level.empty() ? base->data<Float>() : level.data(), size, levelSize, taps(filter, size.x(), levelSize.x()), taps(filter, size.y(), levelSize.y()));
+        size = levelSize;
+
+        if(preserveCoverage) preserveAlphaCoverage(level, alphaReference, coverage);
+
+        /* Convert the level back to original format */
+        std::optional<Trade::ImageData2D> converted = convertFormat(ImageReference2D(ColorFormat::RGBA, ColorType::Float, size, level.data()), image.format(), image.type(), flags & MipmapFlag::Srgb ? FormatConversionFlag::LinearToSrgb : FormatConversionFlags{});
+        levels.push_back(std::move(*converted));
+    }
+
+    return levels;
+}
+
+}}
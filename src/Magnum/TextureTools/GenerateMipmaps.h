@@ -0,0 +1,114 @@
+#ifndef Magnum_TextureTools_GenerateMipmaps_h
+#define Magnum_TextureTools_GenerateMipmaps_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::generateMipmaps(), enum @ref Magnum::TextureTools::MipmapFilter, @ref Magnum::TextureTools::MipmapFlag, enum set @ref Magnum::TextureTools::MipmapFlags
+ */
+
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/TextureTools/magnumTextureToolsVisibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Mipmap downsampling filter
+
+@see @ref generateMipmaps()
+*/
+enum class MipmapFilter: UnsignedByte {
+    /**
+     * Box filter. Each pixel is an average of the pixels it covers in the
+     * previous level. Fast, but slightly blurry and prone to aliasing.
+     */
+    Box,
+
+    /**
+     * Kaiser-windowed sinc filter. Sharper than box filter with less
+     * aliasing, at the cost of slight ringing on hard edges.
+     */
+    Kaiser
+};
+
+/**
+@brief Mipmap generation flag
+
+@see @ref MipmapFlags, @ref generateMipmaps()
+*/
+enum class MipmapFlag: UnsignedByte {
+    /**
+     * The image is in sRGB space. Color channels are converted to linear
+     * space before downsampling and back after, alpha is always linear.
+     */
+    Srgb = 1 << 0,
+
+    /**
+     * Preserve alpha coverage. Alpha of each level is scaled so the fraction
+     * of pixels with alpha above the reference value is the same as in the
+     * original image, which prevents alpha-tested geometry such as foliage
+     * from thinning out in the distance.
+     */
+    PreserveAlphaCoverage = 1 << 1
+};
+
+/**
+@brief Mipmap generation flags
+
+@see @ref generateMipmaps()
+*/
+typedef Containers::EnumSet<MipmapFlag, UnsignedByte> MipmapFlags;
+
+CORRADE_ENUMSET_OPERATORS(MipmapFlags)
+
+/**
+@brief Generate mipmap chain
+@param image            Input image
+@param filter           Downsampling filter
+@param flags            Additional options
+@param alphaReference   Alpha reference value for
+    @ref MipmapFlag::PreserveAlphaCoverage
+
+Returns all mip levels below the input image, down to 1x1, each half the
+size of the previous (rounded down). The levels have the same format and
+type as the input image, supported formats and types are the same as for
+@ref convertFormat(). Returns empty vector if the format is not supported.
+
+Each level is downsampled from the previous one in floating point, using
+separable filter with precomputed weights; odd sizes are handled by
+weighting the pixels by their coverage. The rows of large levels are
+processed in parallel, if supported on given platform. Unlike
+@ref Texture::generateMipmap() this doesn't need any GL context and gives
+the same result on all platforms.
+*/
+std::vector<Trade::ImageData2D> MAGNUM_TEXTURETOOLS_EXPORT generateMipmaps(const ImageReference2D& image, MipmapFilter filter = MipmapFilter::Box, MipmapFlags flags = {}, Float alphaReference = 0.5f);
+
+}}
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef Magnum_TextureTools_Implementation_resample_h
+#define Magnum_TextureTools_Implementation_resample_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Implementation/parallelRows.h"
+
+namespace Magnum { namespace TextureTools { namespace Implementation {
+
+/* Filter taps for one dimension. Each output pixel has the same count of
+   taps, source indices are clamped to the edge. */
+struct Taps {
+    Int count;
+    std::vector<Int> indices;
+    std::vector<Float> weights;
+};
+
+inline Float sinc(const Float x) {
+    if(std::abs(x) < 1.0e-6f) return 1.0f;
+    const Float px = Constants::pi()*x;
+    return std::sin(px)/px;
+}
+
+/* Taps of a filter kernel with given support. When downsampling, the kernel
+   is stretched to the footprint of the output pixel, distance passed to it
+   is thus in output pixels. Weights of each output pixel sum to one. */
+template<class Kernel> Taps kernelTaps(const Kernel& kernel, const Float support, const Int inSize, const Int outSize) {
+    const Float ratio = Float(inSize)/outSize;
+    const Float scale = Math::max(ratio, 1.0f);
+    const Float radius = support*scale;
+
+    Taps taps;
+    taps.count = Int(std::ceil(radius*2)) + 1;
+    taps.indices.resize(outSize*taps.count);
+    taps.weights.resize(outSize*taps.count);
+
+    for(Int x = 0; x != outSize; ++x) {
+        const Float center = (x + 0.5f)*ratio;
+        const Int begin = Int(std::floor(center - radius));
+        Int* const indices = taps.indices.data() + x*taps.count;
+        Float* const weights = taps.weights.data() + x*taps.count;
+
+        Float sum = 0.0f;
+        for(Int i = 0; i != taps.count; ++i) {
+            const Int source = begin + i;
+            indices[i] = Math::clamp(source, 0, inSize - 1);
+            weights[i] = kernel((source + 0.5f - center)/scale);
+            sum += weights[i];
+        }
+
+        for(Int i = 0; i != taps.count; ++i) weights[i] /= sum;
+    }
+
+    /* Drop taps that have zero weight for all output pixels, which happens
+       on the edges of the kernel support */
+    Int leading = taps.count, trailing = taps.count;
+    for(Int x = 0; x != outSize; ++x) {
+        const Float* const weights = taps.weights.data() + x*taps.count;
+        Int i = 0;
+        while(i != taps.count && weights[i] == 0.0f) ++i;
+        leading = Math::min(leading, i);
+        Int j = 0;
+        while(j != taps.count && weights[taps.count - j - 1] == 0.0f) ++j;
+        trailing = Math::min(trailing, j);
+    }
+
+    const Int count = taps.count - leading - trailing;
+    if(count > 0 && count != taps.count) {
+        for(Int x = 0; x != outSize; ++x) for(Int i = 0; i != count; ++i) {
+            taps.indices[x*count + i] = taps.indices[x*taps.count + leading + i];
+            taps.weights[x*count + i] = taps.weights[x*taps.count + leading + i];
+        }
+        taps.count = count;
+        taps.indices.resize(outSize*count);
+        taps.weights.resize(outSize*count);
+    }
+
+    return taps;
+}
+
+/* Horizontal pass over tightly packed RGBA floats. The four channels are
+   accumulated together, which the compiler turns into single vector
+   operation. */
+inline void resampleRows(const Float* const input, const Int inWidth, const Int outWidth, const Int rows, const Taps& taps, Float* const output) {
+    Magnum::Implementation::parallelRows(rows, std::size_t(outWidth)*rows*4*sizeof(Float), true, [&](const Int begin, const Int end) {
+        for(Int y = begin; y != end; ++y) {
+            const Float* const in = input + std::size_t(y)*inWidth*4;
+            Float* out = output + std::size_t(y)*outWidth*4;
+            const Int* indices = taps.indices.data();
+            const Float* weights = taps.weights.data();
+            for(Int x = 0; x != outWidth; ++x, out += 4) {
+                Float pixel[4]{};
+                for(Int i = 0; i != taps.count; ++i, ++indices, ++weights) {
+                    const Float* const source = in + *indices*4;
+                    for(Int c = 0; c != 4; ++c) pixel[c] += source[c]**weights;
+                }
+                for(Int c = 0; c != 4; ++c) out[c] = pixel[c];
+            }
+        }
+    });
+}
+
+/* Vertical pass, goes over whole rows, so the inner loop is trivially
+   vectorizable */
+inline void resampleColumns(const Float* const input, const std::size_t rowSize, const Int outHeight, const Taps& taps, Float* const output) {
+    Magnum::Implementation::parallelRows(outHeight, rowSize*outHeight*sizeof(Float), true, [&](const Int begin, const Int end) {
+        for(Int y = begin; y != end; ++y) {
+            Float* const out = output + y*rowSize;
+            for(std::size_t x = 0; x != rowSize; ++x) out[x] = 0.0f;
+            for(Int i = 0; i != taps.count; ++i) {
+                const Float* const in = input + taps.indices[y*taps.count + i]*rowSize;
+                const Float weight = taps.weights[y*taps.count + i];
+                for(std::size_t x = 0; x != rowSize; ++x) out[x] += in[x]*weight;
+            }
+        }
+    });
+}
+
+/* Separable resampling of tightly packed RGBA floats. The pass order is
+   picked so the amount of work is minimal -- shrinking dimension first and
+   enlarging dimension last. */
+inline std::vector<Float> resample(const Float* const input, const Vector2i& inSize, const Vector2i& outSize, const Taps& horizontal, const Taps& vertical) {
+    const std::size_t horizontalFirst = std::size_t(inSize.y())*outSize.x()*horizontal.count + std::size_t(outSize.y())*outSize.x()*vertical.count;
+    const std::size_t verticalFirst = std::size_t(outSize.y())*inSize.x()*vertical.count + std::size_t(outSize.y())*outSize.x()*horizontal.count;
+
+    std::vector<Float> output(outSize.product()*4);
+    if(horizontalFirst <= verticalFirst) {
+        std::vector<Float> temporary(outSize.x()*inSize.y()*4);
+        resampleRows(input, inSize.x(), outSize.x(), inSize.y(), horizontal, temporary.data());
+        resampleColumns(temporary.data(), outSize.x()*4, outSize.y(), vertical, output.data());
+    } else {
+        std::vector<Float> temporary(inSize.x()*outSize.y()*4);
+        resampleColumns(input, inSize.x()*4, outSize.y(), vertical, temporary.data());
+        resampleRows(temporary.data(), inSize.x(), outSize.x(), outSize.y(), horizontal, output.data());
+    }
+
+    return output;
+}
+
+}}}
+
+#endif
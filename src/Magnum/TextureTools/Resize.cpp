@@ -0,0 +1,93 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Resize.h"
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/TextureTools/ConvertFormat.h"
+#include "Magnum/TextureTools/Implementation/resample.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Mitchell-Netravali filter parameters */
+constexpr Float MitchellB = 1.0f/3.0f;
+constexpr Float MitchellC = 1.0f/3.0f;
+
+/* Lanczos lobe count */
+constexpr Float LanczosWidth = 3.0f;
+
+Implementation::Taps taps(const ResizeFilter filter, const Int inSize, const Int outSize) {
+    switch(filter) {
+        case ResizeFilter::Box:
+            return Implementation::kernelTaps([](const Float t) {
+                return t >= -0.5f && t < 0.5f ? 1.0f : 0.0f;
+            }, 0.5f, inSize, outSize);
+
+        case ResizeFilter::Mitchell:
+            return Implementation::kernelTaps([](const Float t) {
+                const Float x = std::abs(t);
+                if(x < 1.0f) return ((12.0f - 9.0f*MitchellB - 6.0f*MitchellC)*x*x*x +
+                                     (-18.0f + 12.0f*MitchellB + 6.0f*MitchellC)*x*x +
+                                     (6.0f - 2.0f*MitchellB))/6.0f;
+                if(x < 2.0f) return ((-MitchellB - 6.0f*MitchellC)*x*x*x +
+                                     (6.0f*MitchellB + 30.0f*MitchellC)*x*x +
+                                     (-12.0f*MitchellB - 48.0f*MitchellC)*x +
+                                     (8.0f*MitchellB + 24.0f*MitchellC))/6.0f;
+                return 0.0f;
+            }, 2.0f, inSize, outSize);
+
+        case ResizeFilter::Lanczos:
+            return Implementation::kernelTaps([](const Float t) {
+                return std::abs(t) >= LanczosWidth ? 0.0f :
+                    Implementation::sinc(t)*Implementation::sinc(t/LanczosWidth);
+            }, LanczosWidth, inSize, outSize);
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+}
+
+std::optional<Trade::ImageData2D> resize(const ImageReference2D& image, const Vector2i& size, const ResizeFilter filter, const ResizeFlags flags) {
+    if((image.size() <= Vector2i{0}).any() || (size <= Vector2i{0}).any()) {
+        Error() << "TextureTools::resize(): can't resize" << image.size() << "image to" << size;
+        return std::nullopt;
+    }
+
+    /* Convert the image to linear RGBA floats */
+    std::optional<Trade::ImageData2D> input = convertFormat(image, ColorFormat::RGBA, ColorType::Float, flags & ResizeFlag::Srgb ? FormatConversionFlag::SrgbToLinear : FormatConversionFlags{});
+    if(!input) return std::nullopt;
+
+    const std::vector<Float> output = Implementation::resample(input->data<Float>(), image.size(), size, taps(filter, image.size().x(), size.x()), taps(filter, image.size().y(), size.y()));
+
+    /* Convert back to original format */
+    return convertFormat(ImageReference2D(ColorFormat::RGBA, ColorType::Float, size, output.data()), image.format(), image.type(), flags & ResizeFlag::Srgb ? FormatConversionFlag::LinearToSrgb : FormatConversionFlags{});
+}
+
+}}
@@ -0,0 +1,114 @@
+#ifndef Magnum_TextureTools_Resize_h
+#define Magnum_TextureTools_Resize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::resize(), enum @ref Magnum::TextureTools::ResizeFilter, @ref Magnum::TextureTools::ResizeFlag, enum set @ref Magnum::TextureTools::ResizeFlags
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/TextureTools/magnumTextureToolsVisibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Resampling filter
+
+@see @ref resize()
+*/
+enum class ResizeFilter: UnsignedByte {
+    /**
+     * Box filter. Averages the covered pixels when shrinking, equivalent to
+     * nearest neighbor when enlarging. Fastest, but prone to aliasing.
+     */
+    Box,
+
+    /**
+     * Mitchell-Netravali cubic filter with @f$ B = C = \frac{1}{3} @f$.
+     * Good balance between blurring, ringing and aliasing, suitable for
+     * enlarging.
+     */
+    Mitchell,
+
+    /**
+     * Lanczos filter with three lobes. Sharpest of the three with the least
+     * aliasing, at the cost of slight ringing on hard edges.
+     */
+    Lanczos
+};
+
+/**
+@brief Resize flag
+
+@see @ref ResizeFlags, @ref resize()
+*/
+enum class ResizeFlag: UnsignedByte {
+    /**
+     * The image is in sRGB space. Color channels are converted to linear
+     * space before resampling and back after, alpha is always linear.
+     */
+    Srgb = 1 << 0
+};
+
+/**
+@brief Resize flags
+
+@see @ref resize()
+*/
+typedef Containers::EnumSet<ResizeFlag, UnsignedByte> ResizeFlags;
+
+CORRADE_ENUMSET_OPERATORS(ResizeFlags)
+
+/**
+@brief Resize image
+@param image        Input image
+@param size         Output size
+@param filter       Resampling filter
+@param flags        Additional options
+
+Returns image of given size with the same format and type as the input
+image, supported formats and types are the same as for @ref convertFormat().
+Returns `std::nullopt` if the format is not supported or any of the sizes is
+not positive.
+
+The image is resampled in floating point using separable filter, weights for
+each axis are computed upfront. Horizontal and vertical pass are ordered so
+the image is shrunk first and enlarged last, rows of large images are
+processed in parallel, if supported on given platform. Pixels outside of the
+image are treated as copies of the edge pixels. Values overshooting the
+range of normalized types due to ringing of @ref ResizeFilter::Mitchell and
+@ref ResizeFilter::Lanczos are clamped.
+@see @ref generateMipmaps()
+*/
+std::optional<Trade::ImageData2D> MAGNUM_TEXTURETOOLS_EXPORT resize(const ImageReference2D& image, const Vector2i& size, ResizeFilter filter = ResizeFilter::Lanczos, ResizeFlags flags = {});
+
+}}
+
+#endif
@@ -0,0 +1,108 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Test/Benchmark.h"
+#include "Magnum/TextureTools/Compress.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class CompressBenchmark: public TestSuite::Tester {
+    public:
+        explicit CompressBenchmark();
+
+        void bc1();
+        void bc3();
+        void bc4();
+        void bc5();
+        void etc1();
+};
+
+namespace {
+
+constexpr Vector2i Size{1024, 1024};
+
+/* Smooth gradient with noise, resembling a photo more than white noise does */
+Containers::Array<unsigned char> image() {
+    Containers::Array<unsigned char> data(Size.product()*4);
+    UnsignedInt state = 0x12345678;
+    for(Int y = 0; y != Size.y(); ++y) for(Int x = 0; x != Size.x(); ++x) {
+        state = state*1664525 + 1013904223;
+        const Int noise = (state >> 28) - 8;
+        unsigned char* const pixel = data + (y*Size.x() + x)*4;
+        pixel[0] = Math::clamp((x + y)/8 + noise, 0, 255);
+        pixel[1] = Math::clamp((x ^ y) & 0xff, 0, 255);
+        pixel[2] = Math::clamp(255 - y/4 + noise, 0, 255);
+        pixel[3] = Math::clamp(x/4 + noise, 0, 255);
+    }
+    return data;
+}
+
+/* Measures the compression in all qualities and prints throughput in
+   megapixels per second together with the resulting PSNR */
+void measure(const char* const name, const CompressedFormat format) {
+    const Containers::Array<unsigned char> data = image();
+    const ImageReference2D reference(ColorFormat::RGBA, ColorType::UnsignedByte, Size, data);
+
+    for(CompressionQuality quality: {CompressionQuality::Fast, CompressionQuality::Normal, CompressionQuality::High}) {
+        Containers::Array<unsigned char> compressed;
+        const Double time = Magnum::Test::averageDuration(1, [&]() {
+            compressed = compress(reference, format, quality);
+        });
+
+        std::optional<Trade::ImageData2D> decompressed = decompress(compressed, format, Size);
+        Debug() << name << "quality" << Int(quality) << time << "ms," << Double(Size.product())/(1000*time) << "Mpx/s, PSNR" << (decompressed ? psnr(*decompressed, reference) : 0.0) << "dB";
+    }
+}
+
+}
+
+CompressBenchmark::CompressBenchmark() {
+    addTests({&CompressBenchmark::bc1,
+              &CompressBenchmark::bc3,
+              &CompressBenchmark::bc4,
+              &CompressBenchmark::bc5,
+              &CompressBenchmark::etc1});
+}
+
+void CompressBenchmark::bc1() { measure("BC1", CompressedFormat::Bc1); }
+
+void CompressBenchmark::bc3() { measure("BC3", CompressedFormat::Bc3); }
+
+void CompressBenchmark::bc4() { measure("BC4", CompressedFormat::Bc4); }
+
+void CompressBenchmark::bc5() { measure("BC5", CompressedFormat::Bc5); }
+
+void CompressBenchmark::etc1() { measure("ETC1", CompressedFormat::Etc1); }
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::CompressBenchmark)
@@ -0,0 +1,306 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <limits>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/Compress.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class CompressTest: public TestSuite::Tester {
+    public:
+        explicit CompressTest();
+
+        void dataSize();
+        void solidBc1();
+        void solidBc4();
+        void solidEtc1();
+        void decodeBc1();
+        void decodeBc3();
+        void decodeBc4();
+        void decodeEtc1();
+        void gradient();
+        void quality();
+        void oddSize();
+        void unsupported();
+        void decompressWrongSize();
+        void psnrIdentical();
+        void psnrSizeMismatch();
+};
+
+CompressTest::CompressTest() {
+    addTests({&CompressTest::dataSize,
+              &CompressTest::solidBc1,
+              &CompressTest::solidBc4,
+              &CompressTest::solidEtc1,
+              &CompressTest::decodeBc1,
+              &CompressTest::decodeBc3,
+              &CompressTest::decodeBc4,
+              &CompressTest::decodeEtc1,
+              &CompressTest::gradient,
+              &CompressTest::quality,
+              &CompressTest::oddSize,
+              &CompressTest::unsupported,
+              &CompressTest::decompressWrongSize,
+              &CompressTest::psnrIdentical,
+              &CompressTest::psnrSizeMismatch});
+}
+
+namespace {
+
+/* Smooth RGBA gradient with a bit of noise */
+Containers::Array<unsigned char> gradient(const Vector2i& size) {
+    Containers::Array<unsigned char> data(size.product()*4);
+    UnsignedInt state = 0x12345678;
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x) {
+        state = state*1664525 + 1013904223;
+        const Int noise = (state >> 29) - 4;
+        unsigned char* const pixel = data + (y*size.x() + x)*4;
+        pixel[0] = Math::clamp(x*255/size.x() + noise, 0, 255);
+        pixel[1] = Math::clamp(y*255/size.y() + noise, 0, 255);
+        pixel[2] = Math::clamp(255 - (x + y)*255/(size.x() + size.y()) + noise, 0, 255);
+        pixel[3] = Math::clamp((x*y)*255/size.product() + noise, 0, 255);
+    }
+    return data;
+}
+
+}
+
+void CompressTest::dataSize() {
+    CORRADE_COMPARE(compressedDataSize(CompressedFormat::Bc1, {8, 4}), 16);
+    CORRADE_COMPARE(compressedDataSize(CompressedFormat::Bc3, {8, 4}), 32);
+    CORRADE_COMPARE(compressedDataSize(CompressedFormat::Bc4, {5, 5}), 32);
+    CORRADE_COMPARE(compressedDataSize(CompressedFormat::Bc5, {1, 1}), 16);
+    CORRADE_COMPARE(compressedDataSize(CompressedFormat::Etc1, {9, 4}), 24);
+}
+
+void CompressTest::solidBc1() {
+    /* Exactly representable in RGB565 */
+    const UnsignedByte pixel[]{0xff, 0x82, 0x00};
+    std::vector<UnsignedByte> data;
+    for(Int i = 0; i != 16; ++i) data.insert(data.end(), pixel, pixel + 3);
+
+    const ImageReference2D image(ColorFormat::RGB, ColorType::UnsignedByte, {4, 4}, data.data());
+    for(CompressionQuality quality: {CompressionQuality::Fast, CompressionQuality::Normal, CompressionQuality::High}) {
+        const Containers::Array<unsigned char> compressed = compress(image, CompressedFormat::Bc1, quality);
+        CORRADE_COMPARE(compressed.size(), 8);
+
+        std::optional<Trade::ImageData2D> decompressed = decompress(compressed, CompressedFormat::Bc1, {4, 4});
+        CORRADE_VERIFY(decompressed);
+        CORRADE_COMPARE(psnr(image, *decompressed), std::numeric_limits<Double>::infinity());
+    }
+}
+
+void CompressTest::solidBc4() {
+    const std::vector<UnsignedByte> data(16, 0x37);
+    const ImageReference2D image(ColorFormat::Red, ColorType::UnsignedByte, {4, 4}, data.data());
+    const Containers::Array<unsigned char> compressed = compress(image, CompressedFormat::Bc4);
+    CORRADE_COMPARE(compressed.size(), 8);
+    CORRADE_COMPARE(compressed[0], 0x37);
+    CORRADE_COMPARE(compressed[1], 0x37);
+
+    std::optional<Trade::ImageData2D> decompressed = decompress(compressed, CompressedFormat::Bc4, {4, 4});
+    CORRADE_VERIFY(decompressed);
+    CORRADE_COMPARE(decompressed->format(), ColorFormat::Red);
+    CORRADE_COMPARE(decompressed->data<UnsignedByte>()[15], 0x37);
+}
+
+void CompressTest::solidEtc1() {
+    /* Exactly representable as 4-bit individual color, 0x11*n */
+    const UnsignedByte pixel[]{0x33, 0xaa, 0xff};
+    std::vector<UnsignedByte> data;
+    for(Int i = 0; i != 16; ++i) data.insert(data.end(), pixel, pixel + 3);
+    const ImageReference2D image(ColorFormat::RGB, ColorType::UnsignedByte, {4, 4}, data.data());
+
+    /* Modifiers can't be zero, so it's not exact, but close */
+    const Containers::Array<unsigned char> compressed = compress(image, CompressedFormat::Etc1, CompressionQuality::High);
+    std::optional<Trade::ImageData2D> decompressed = decompress(compressed, CompressedFormat::Etc1, {4, 4});
+    CORRADE_VERIFY(decompressed);
+    CORRADE_VERIFY(psnr(image, *decompressed) > 40.0);
+}
+
+void CompressTest::decodeBc1() {
+    /* Red and blue endpoints, first row uses all four palette entries, the
+       rest uses the first endpoint */
+    const UnsignedByte data[]{0x00, 0xf8, 0x1f, 0x00, 0xe4, 0x00, 0x00, 0x00};
+    std::optional<Trade::ImageData2D> image = decompress(data, CompressedFormat::Bc1, {4, 4});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+
+    const UnsignedByte* pixels = image->data<UnsignedByte>();
+    const UnsignedByte expected[]{
+        0xff, 0x00, 0x00,
+        0x00, 0x00, 0xff,
+        0xaa, 0x00, 0x55,
+        0x55, 0x00, 0xaa,
+        0xff, 0x00, 0x00};
+    for(std::size_t i = 0; i != 15; ++i)
+        CORRADE_COMPARE(Int(pixels[i]), Int(expected[i]));
+}
+
+void CompressTest::decodeBc3() {
+    /* Opaque alpha block, color block with blue endpoint smaller than red
+       one. BC1 would decode it in three-color mode, BC3 is always in
+       four-color mode. */
+    const UnsignedByte data[]{0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                              0x1f, 0x00, 0x00, 0xf8, 0xe4, 0x00, 0x00, 0x00};
+    std::optional<Trade::ImageData2D> image = decompress(data, CompressedFormat::Bc3, {4, 4});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGBA);
+
+    const UnsignedByte* pixels = image->data<UnsignedByte>();
+    const UnsignedByte expected[]{
+        0x00, 0x00, 0xff, 0xff,
+        0xff, 0x00, 0x00, 0xff,
+        0x55, 0x00, 0xaa, 0xff,
+        0xaa, 0x00, 0x55, 0xff};
+    for(std::size_t i = 0; i != 16; ++i)
+        CORRADE_COMPARE(Int(pixels[i]), Int(expected[i]));
+}
+
+void CompressTest::decodeBc4() {
+    /* Eight-value mode, first pixel uses index 2, second index 1 */
+    const UnsignedByte data[]{0xff, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00};
+    std::optional<Trade::ImageData2D> image = decompress(data, CompressedFormat::Bc4, {4, 4});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(Int(image->data<UnsignedByte>()[0]), 218);
+    CORRADE_COMPARE(Int(image->data<UnsignedByte>()[1]), 0);
+    CORRADE_COMPARE(Int(image->data<UnsignedByte>()[2]), 255);
+}
+
+void CompressTest::decodeEtc1() {
+    /* Individual mode, left half 0x88 gray, right half 0x22 gray, both with
+       table 0 and all modifiers +2 except first pixel with -8 */
+    const UnsignedByte data[]{0x82, 0x82, 0x82, 0x00, 0x00, 0x01, 0x00, 0x01};
+    std::optional<Trade::ImageData2D> image = decompress(data, CompressedFormat::Etc1, {4, 4});
+    CORRADE_VERIFY(image);
+
+    const UnsignedByte* pixels = image->data<UnsignedByte>();
+    CORRADE_COMPARE(Int(pixels[0]), 0x88 - 8);
+    CORRADE_COMPARE(Int(pixels[3]), 0x88 + 2);
+    CORRADE_COMPARE(Int(pixels[6]), 0x22 + 2);
+    CORRADE_COMPARE(Int(pixels[3*4 + 0]), 0x88 + 2);
+}
+
+void CompressTest::gradient() {
+    const Vector2i size{64, 64};
+    const Containers::Array<unsigned char> data = TextureTools::Test::gradient(size);
+    const ImageReference2D image(ColorFormat::RGBA, ColorType::UnsignedByte, size, data);
+
+    /* Compare only the channels the format stores */
+    const std::pair<CompressedFormat, Double> formats[]{
+        {CompressedFormat::Bc1, 35.0},
+        {CompressedFormat::Bc3, 35.0},
+        {CompressedFormat::Bc4, 40.0},
+        {CompressedFormat::Bc5, 40.0},
+        {CompressedFormat::Etc1, 33.0}};
+    for(const auto& format: formats) {
+        std::optional<Trade::ImageData2D> decompressed = decompress(compress(image, format.first), format.first, size);
+        CORRADE_VERIFY(decompressed);
+
+        const Double value = psnr(*decompressed, image);
+        if(value < format.second) Error() << "Format" << Int(format.first) << "has PSNR" << value;
+        CORRADE_VERIFY(value > format.second);
+    }
+}
+
+void CompressTest::quality() {
+    const Vector2i size{64, 64};
+    const Containers::Array<unsigned char> data = TextureTools::Test::gradient(size);
+    const ImageReference2D image(ColorFormat::RGBA, ColorType::UnsignedByte, size, data);
+
+    for(CompressedFormat format: {CompressedFormat::Bc1, CompressedFormat::Bc4, CompressedFormat::Etc1}) {
+        std::optional<Trade::ImageData2D> fast = decompress(compress(image, format, CompressionQuality::Fast), format, size);
+        std::optional<Trade::ImageData2D> high = decompress(compress(image, format, CompressionQuality::High), format, size);
+        CORRADE_VERIFY(fast);
+        CORRADE_VERIFY(high);
+        CORRADE_VERIFY(psnr(*high, image) >= psnr(*fast, image));
+    }
+}
+
+void CompressTest::oddSize() {
+    /* Horizontal ramp, rows padded to four bytes */
+    const Vector2i size{7, 5};
+    UnsignedByte data[8*5]{};
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x)
+        data[y*8 + x] = 40 + x*20 + y*2;
+    const ImageReference2D image(ColorFormat::Red, ColorType::UnsignedByte, size, data);
+
+    const Containers::Array<unsigned char> compressed = compress(image, CompressedFormat::Bc4);
+    CORRADE_COMPARE(compressed.size(), 2*2*8);
+
+    std::optional<Trade::ImageData2D> decompressed = decompress(compressed, CompressedFormat::Bc4, size);
+    CORRADE_VERIFY(decompressed);
+    CORRADE_COMPARE(decompressed->size(), size);
+    CORRADE_VERIFY(psnr(*decompressed, image) > 40.0);
+}
+
+void CompressTest::unsupported() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const UnsignedByte data[16*4]{};
+    CORRADE_VERIFY(!compress(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedInt, {4, 4}, data), CompressedFormat::Bc1));
+}
+
+void CompressTest::decompressWrongSize() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const UnsignedByte data[8]{};
+    CORRADE_VERIFY(!decompress(data, CompressedFormat::Bc3, {4, 4}));
+    CORRADE_COMPARE(out.str(), "TextureTools::decompress(): expected 16 bytes for Vector(4, 4) image but got 8\n");
+}
+
+void CompressTest::psnrIdentical() {
+    const UnsignedByte a[]{1, 2, 3, 0, 4, 5, 6, 0};
+    const UnsignedByte b[]{1, 2, 3, 0, 4, 5, 7, 0};
+    const ImageReference2D first(ColorFormat::RGB, ColorType::UnsignedByte, {1, 2}, a);
+    CORRADE_COMPARE(psnr(first, first), std::numeric_limits<Double>::infinity());
+
+    /* One error out of six values */
+    CORRADE_COMPARE(psnr(first, ImageReference2D(ColorFormat::RGB, ColorType::UnsignedByte, {1, 2}, b)), 10.0*std::log10(255.0*255.0*6.0));
+}
+
+void CompressTest::psnrSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const UnsignedByte data[16]{};
+    CORRADE_COMPARE(psnr(ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {4, 1}, data),
+                         ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {1, 4}, data)), 0.0);
+    CORRADE_COMPARE(out.str(), "TextureTools::psnr(): size mismatch, Vector(4, 1) and Vector(1, 4)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::CompressTest)
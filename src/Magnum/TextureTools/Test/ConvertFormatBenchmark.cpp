@@ -0,0 +1,112 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Test/Benchmark.h"
+#include "Magnum/TextureTools/ConvertFormat.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class ConvertFormatBenchmark: public TestSuite::Tester {
+    public:
+        explicit ConvertFormatBenchmark();
+
+        void rgbToRgba();
+        void bgraToRgba();
+        void unsignedByteToFloat();
+        void floatToHalfFloat();
+        void premultiplySrgb();
+};
+
+namespace {
+
+constexpr Vector2i Size{4096, 4096};
+constexpr std::size_t Repeats = 5;
+
+Containers::Array<unsigned char> noise(const std::size_t size) {
+    Containers::Array<unsigned char> data(size);
+    UnsignedInt state = 0x12345678;
+    for(unsigned char& i: data) {
+        state = state*1664525 + 1013904223;
+        i = state >> 24;
+    }
+    return data;
+}
+
+/* Measures the conversion and prints throughput in megapixels per second */
+void measure(const char* const name, const ImageReference2D& image, const ColorFormat format, const ColorType type, const FormatConversionFlags flags = {}) {
+    std::optional<Trade::ImageData2D> out;
+    const Double time = Magnum::Test::averageDuration(Repeats, [&]() {
+        out = convertFormat(image, format, type, flags);
+    });
+
+    Debug() << name << time << "ms," << Double(image.size().product())/(1000*time) << "Mpx/s";
+}
+
+}
+
+ConvertFormatBenchmark::ConvertFormatBenchmark() {
+    addTests({&ConvertFormatBenchmark::rgbToRgba,
+              &ConvertFormatBenchmark::bgraToRgba,
+              &ConvertFormatBenchmark::unsignedByteToFloat,
+              &ConvertFormatBenchmark::floatToHalfFloat,
+              &ConvertFormatBenchmark::premultiplySrgb});
+}
+
+void ConvertFormatBenchmark::rgbToRgba() {
+    const Containers::Array<unsigned char> data = noise(Size.product()*3);
+    measure("RGB8 to RGBA8:", ImageReference2D(ColorFormat::RGB, ColorType::UnsignedByte, Size, data), ColorFormat::RGBA, ColorType::UnsignedByte);
+}
+
+void ConvertFormatBenchmark::bgraToRgba() {
+    const Containers::Array<unsigned char> data = noise(Size.product()*4);
+    measure("BGRA8 to RGBA8:", ImageReference2D(ColorFormat::BGRA, ColorType::UnsignedByte, Size, data), ColorFormat::RGBA, ColorType::UnsignedByte);
+}
+
+void ConvertFormatBenchmark::unsignedByteToFloat() {
+    const Containers::Array<unsigned char> data = noise(Size.product()*4);
+    measure("RGBA8 to RGBA32F:", ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, Size, data), ColorFormat::RGBA, ColorType::Float);
+}
+
+void ConvertFormatBenchmark::floatToHalfFloat() {
+    const Containers::Array<unsigned char> data = noise(Size.product()*4);
+    const std::optional<Trade::ImageData2D> image = convertFormat(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, Size, data), ColorFormat::RGBA, ColorType::Float);
+    CORRADE_VERIFY(image);
+    measure("RGBA32F to RGBA16F:", *image, ColorFormat::RGBA, ColorType::HalfFloat);
+}
+
+void ConvertFormatBenchmark::premultiplySrgb() {
+    const Containers::Array<unsigned char> data = noise(Size.product()*4);
+    measure("RGBA8 sRGB premultiply:", ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, Size, data), ColorFormat::RGBA, ColorType::UnsignedByte, FormatConversionFlag::SrgbToLinear|FormatConversionFlag::PremultiplyAlpha|FormatConversionFlag::LinearToSrgb);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ConvertFormatBenchmark)
@@ -0,0 +1,219 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/TextureTools/ConvertFormat.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class ConvertFormatTest: public TestSuite::Tester {
+    public:
+        explicit ConvertFormatTest();
+
+        void swizzle();
+        void expandRed();
+        void removeChannels();
+        void unsignedByteToFloat();
+        void floatToUnsignedShort();
+        void halfFloat();
+        void srgb();
+        void premultiply();
+        void inPlace();
+        void inPlaceLarger();
+        void unsupported();
+};
+
+ConvertFormatTest::ConvertFormatTest() {
+    addTests({&ConvertFormatTest::swizzle,
+              &ConvertFormatTest::expandRed,
+              &ConvertFormatTest::removeChannels,
+              &ConvertFormatTest::unsignedByteToFloat,
+              &ConvertFormatTest::floatToUnsignedShort,
+              &ConvertFormatTest::halfFloat,
+              &ConvertFormatTest::srgb,
+              &ConvertFormatTest::premultiply,
+              &ConvertFormatTest::inPlace,
+              &ConvertFormatTest::inPlaceLarger,
+              &ConvertFormatTest::unsupported});
+}
+
+void ConvertFormatTest::swizzle() {
+    /* Rows are padded to four bytes */
+    const UnsignedByte data[]{1, 2, 3, 4, 5, 6, 0, 0,
+                              7, 8, 9, 10, 11, 12, 0, 0};
+
+    #ifndef MAGNUM_TARGET_GLES
+    std::optional<Trade::ImageData2D> image = convertFormat(ImageReference2D(ColorFormat::BGR, ColorType::UnsignedByte, {2, 2}, data), ColorFormat::RGBA, ColorType::UnsignedByte);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 2));
+    CORRADE_COMPARE((std::vector<UnsignedByte>(image->data<UnsignedByte>(), image->data<UnsignedByte>() + 16)),
+        (std::vector<UnsignedByte>{3, 2, 1, 255, 6, 5, 4, 255, 9, 8, 7, 255, 12, 11, 10, 255}));
+    #else
+    CORRADE_SKIP("BGR format is not available in OpenGL ES.");
+    #endif
+}
+
+void ConvertFormatTest::expandRed() {
+    const UnsignedShort data[]{1000, 2000};
+    std::optional<Trade::ImageData2D> image = convertFormat(ImageReference2D(ColorFormat::Red, ColorType::UnsignedShort, {2, 1}, data), ColorFormat::RGBA, ColorType::UnsignedShort);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE((std::vector<UnsignedShort>(image->data<UnsignedShort>(), image->data<UnsignedShort>() + 8)),
+        (std::vector<UnsignedShort>{1000, 1000, 1000, 65535, 2000, 2000, 2000, 65535}));
+}
+
+void ConvertFormatTest::removeChannels() {
+    const Float data[]{0.5f, 0.25f, 0.125f, 1.0f};
+    std::optional<Trade::ImageData2D> image = convertFormat(ImageReference2D(ColorFormat::BGRA, ColorType::Float, {1, 1}, data), ColorFormat::RG, ColorType::Float);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->data<Float>()[0], 0.125f);
+    CORRADE_COMPARE(image->data<Float>()[1], 0.25f);
+}
+
+void ConvertFormatTest::unsignedByteToFloat() {
+    const UnsignedByte data[]{0, 51, 255, 0};
+    std::optional<Trade::ImageData2D> image = convertFormat(ImageReference2D(ColorFormat::RGB, ColorType::UnsignedByte, {1, 1}, data), ColorFormat::RGBA, ColorType::Float);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->type(), ColorType::Float);
+    CORRADE_COMPARE(image->data<Float>()[0], 0.0f);
+    CORRADE_COMPARE(image->data<Float>()[1], 0.2f);
+    CORRADE_COMPARE(image->data<Float>()[2], 1.0f);
+    CORRADE_COMPARE(image->data<Float>()[3], 1.0f);
+}
+
+void ConvertFormatTest::floatToUnsignedShort() {
+    const Float data[]{-1.0f, 0.5f, 2.0f};
+    std::optional<Trade::ImageData2D> image = convertFormat(ImageReference2D(ColorFormat::RGB, ColorType::Float, {1, 1}, data), ColorFormat::RGB, ColorType::UnsignedShort);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->data<UnsignedShort>()[0], 0);
+    CORRADE_COMPARE(image->data<UnsignedShort>()[1], 32768);
+    CORRADE_COMPARE(image->data<UnsignedShort>()[2], 65535);
+}
+
+void ConvertFormatTest::halfFloat() {
+    const Float data[]{1.0f, -2.5f, 65504.0f, 1.0e-7f, 1.0e6f, 0.33325195f, 0.0f, 0.0f};
+    std::optional<Trade::ImageData2D> half = convertFormat(ImageReference2D(ColorFormat::RG, ColorType::Float, {3, 1}, data), ColorFormat::RG, ColorType::HalfFloat);
+    CORRADE_VERIFY(half);
+    CORRADE_COMPARE(half->data<UnsignedShort>()[0], 0x3c00);
+    CORRADE_COMPARE(half->data<UnsignedShort>()[1], 0xc100);
+    CORRADE_COMPARE(half->data<UnsignedShort>()[2], 0x7bff);
+    CORRADE_COMPARE(half->data<UnsignedShort>()[3], 0x0002);
+    CORRADE_COMPARE(half->data<UnsignedShort>()[4], 0x7c00);
+    CORRADE_COMPARE(half->data<UnsignedShort>()[5], 0x3555);
+
+    std::optional<Trade::ImageData2D> image = convertFormat(*half, ColorFormat::RGBA, ColorType::Float);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->data<Float>()[0], 1.0f);
+    CORRADE_COMPARE(image->data<Float>()[1], -2.5f);
+    CORRADE_COMPARE(image->data<Float>()[2], 0.0f);
+    CORRADE_COMPARE(image->data<Float>()[3], 1.0f);
+    CORRADE_COMPARE(image->data<Float>()[4], 65504.0f);
+    CORRADE_COMPARE(image->data<Float>()[5], 1.1920929e-7f);
+    CORRADE_COMPARE(image->data<Float>()[9], 0.33325195f);
+
+    /* Adding alpha to half-float image uses half-float one */
+    std::optional<Trade::ImageData2D> rgba = convertFormat(*half, ColorFormat::RGBA, ColorType::HalfFloat);
+    CORRADE_VERIFY(rgba);
+    CORRADE_COMPARE(rgba->data<UnsignedShort>()[3], 0x3c00);
+}
+
+void ConvertFormatTest::srgb() {
+    const UnsignedByte data[]{0, 128, 255, 128};
+    std::optional<Trade::ImageData2D> image = convertFormat(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, {1, 1}, data), ColorFormat::RGBA, ColorType::Float, FormatConversionFlag::SrgbToLinear);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->data<Float>()[0], 0.0f);
+    CORRADE_COMPARE(image->data<Float>()[1], 0.2158605f);
+    CORRADE_COMPARE(image->data<Float>()[2], 1.0f);
+    /* Alpha is not converted */
+    CORRADE_COMPARE(image->data<Float>()[3], 128.0f/255.0f);
+
+    std::optional<Trade::ImageData2D> back = convertFormat(*image, ColorFormat::RGBA, ColorType::UnsignedByte, FormatConversionFlag::LinearToSrgb);
+    CORRADE_VERIFY(back);
+    CORRADE_COMPARE((std::vector<UnsignedByte>(back->data<UnsignedByte>(), back->data<UnsignedByte>() + 4)),
+        (std::vector<UnsignedByte>{0, 128, 255, 128}));
+}
+
+void ConvertFormatTest::premultiply() {
+    const UnsignedByte data[]{200, 100, 50, 128};
+    std::optional<Trade::ImageData2D> image = convertFormat(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, {1, 1}, data), ColorFormat::RGBA, ColorType::UnsignedByte, FormatConversionFlag::PremultiplyAlpha);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE((std::vector<UnsignedByte>(image->data<UnsignedByte>(), image->data<UnsignedByte>() + 4)),
+        (std::vector<UnsignedByte>{100, 50, 25, 128}));
+
+    std::optional<Trade::ImageData2D> back = convertFormat(*image, ColorFormat::RGBA, ColorType::UnsignedByte, FormatConversionFlag::UnpremultiplyAlpha);
+    CORRADE_VERIFY(back);
+    CORRADE_COMPARE((std::vector<UnsignedByte>(back->data<UnsignedByte>(), back->data<UnsignedByte>() + 4)),
+        (std::vector<UnsignedByte>{199, 100, 50, 128}));
+}
+
+void ConvertFormatTest::inPlace() {
+    /* Row stride shrinks from 20 to 16 bytes */
+    UnsignedByte* data = new UnsignedByte[40];
+    for(Int i = 0; i != 40; ++i) data[i] = i;
+    Trade::ImageData2D image(ColorFormat::RGBA, ColorType::UnsignedByte, {5, 2}, data);
+
+    CORRADE_VERIFY(convertFormatInPlace(image, ColorFormat::BGRA, ColorType::UnsignedByte));
+    CORRADE_COMPARE(image.format(), ColorFormat::BGRA);
+    CORRADE_COMPARE(image.data<UnsignedByte>()[0], 2);
+    CORRADE_COMPARE(image.data<UnsignedByte>()[2], 0);
+
+    CORRADE_VERIFY(convertFormatInPlace(image, ColorFormat::RGB, ColorType::UnsignedByte));
+    CORRADE_COMPARE(image.format(), ColorFormat::RGB);
+    CORRADE_COMPARE(image.size(), Vector2i(5, 2));
+    CORRADE_COMPARE(image.data(), reinterpret_cast<unsigned char*>(data));
+    CORRADE_COMPARE((std::vector<UnsignedByte>(image.data<UnsignedByte>(), image.data<UnsignedByte>() + 15)),
+        (std::vector<UnsignedByte>{0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 16, 17, 18}));
+    CORRADE_COMPARE((std::vector<UnsignedByte>(image.data<UnsignedByte>() + 16, image.data<UnsignedByte>() + 31)),
+        (std::vector<UnsignedByte>{20, 21, 22, 24, 25, 26, 28, 29, 30, 32, 33, 34, 36, 37, 38}));
+}
+
+void ConvertFormatTest::inPlaceLarger() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Trade::ImageData2D image(ColorFormat::RGB, ColorType::UnsignedByte, {1, 1}, new UnsignedByte[4]{});
+    CORRADE_VERIFY(!convertFormatInPlace(image, ColorFormat::RGBA, ColorType::UnsignedByte));
+    CORRADE_COMPARE(image.format(), ColorFormat::RGB);
+    CORRADE_VERIFY(!out.str().empty());
+}
+
+void ConvertFormatTest::unsupported() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const UnsignedByte data[4]{};
+    CORRADE_VERIFY(!convertFormat(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedInt, {1, 1}, data), ColorFormat::RGBA, ColorType::UnsignedByte));
+    CORRADE_VERIFY(!out.str().empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ConvertFormatTest)
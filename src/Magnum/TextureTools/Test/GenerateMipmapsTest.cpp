@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/TextureTools/GenerateMipmaps.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class GenerateMipmapsTest: public TestSuite::Tester {
+    public:
+        explicit GenerateMipmapsTest();
+
+        void sizes();
+        void box();
+        void boxOddSize();
+        void kaiser();
+        void srgb();
+        void alphaCoverage();
+        void unsupported();
+        void singlePixel();
+};
+
+GenerateMipmapsTest::GenerateMipmapsTest() {
+    addTests({&GenerateMipmapsTest::sizes,
+              &GenerateMipmapsTest::box,
+              &GenerateMipmapsTest::boxOddSize,
+              &GenerateMipmapsTest::kaiser,
+              &GenerateMipmapsTest::srgb,
+              &GenerateMipmapsTest::alphaCoverage,
+              &GenerateMipmapsTest::unsupported,
+              &GenerateMipmapsTest::singlePixel});
+}
+
+void GenerateMipmapsTest::sizes() {
+    const std::vector<UnsignedByte> data(20*5*4);
+    const std::vector<Trade::ImageData2D> levels = generateMipmaps(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, {20, 5}, data.data()));
+    CORRADE_COMPARE(levels.size(), 4);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(10, 2));
+    CORRADE_COMPARE(levels[1].size(), Vector2i(5, 1));
+    CORRADE_COMPARE(levels[2].size(), Vector2i(2, 1));
+    CORRADE_COMPARE(levels[3].size(), Vector2i(1, 1));
+    CORRADE_COMPARE(levels[3].format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(levels[3].type(), ColorType::UnsignedByte);
+}
+
+void GenerateMipmapsTest::box() {
+    const Float data[]{0.0f, 1.0f, 0.5f, 0.5f,
+                       0.25f, 0.25f, 1.0f, 0.0f};
+    const std::vector<Trade::ImageData2D> levels = generateMipmaps(ImageReference2D(ColorFormat::Red, ColorType::Float, {4, 2}, data));
+    CORRADE_COMPARE(levels.size(), 2);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(2, 1));
+    CORRADE_COMPARE(levels[0].data<Float>()[0], 0.375f);
+    CORRADE_COMPARE(levels[0].data<Float>()[1], 0.5f);
+    CORRADE_COMPARE(levels[1].data<Float>()[0], 0.4375f);
+}
+
+void GenerateMipmapsTest::boxOddSize() {
+    /* Each output pixel covers one and half input pixel */
+    const Float data[]{0.0f, 0.3f, 0.6f};
+    const std::vector<Trade::ImageData2D> levels = generateMipmaps(ImageReference2D(ColorFormat::Red, ColorType::Float, {3, 1}, data));
+    CORRADE_COMPARE(levels.size(), 1);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(1, 1));
+    CORRADE_COMPARE(levels[0].data<Float>()[0], 0.3f);
+}
+
+void GenerateMipmapsTest::kaiser() {
+    /* Constant image stays constant, weights are normalized */
+    const std::vector<UnsignedByte> data(16*16, 200);
+    const std::vector<Trade::ImageData2D> levels = generateMipmaps(ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {16, 16}, data.data()), MipmapFilter::Kaiser);
+    CORRADE_COMPARE(levels.size(), 4);
+    CORRADE_COMPARE(levels[0].data<UnsignedByte>()[0], 200);
+    CORRADE_COMPARE(levels[0].data<UnsignedByte>()[27], 200);
+    CORRADE_COMPARE(levels[3].data<UnsignedByte>()[0], 200);
+
+    /* Checkerboard gets averaged to gray */
+    std::vector<Float> checkerboard(16*16);
+    for(Int i = 0; i != 16*16; ++i) checkerboard[i] = (i/16 + i%16)%2;
+    const std::vector<Trade::ImageData2D> levels2 = generateMipmaps(ImageReference2D(ColorFormat::Red, ColorType::Float, {16, 16}, checkerboard.data()), MipmapFilter::Kaiser);
+    CORRADE_COMPARE(levels2[0].data<Float>()[27], 0.5f);
+}
+
+void GenerateMipmapsTest::srgb() {
+    const UnsignedByte data[]{0, 255, 0, 0};
+    const std::vector<Trade::ImageData2D> linear = generateMipmaps(ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {2, 1}, data));
+    CORRADE_COMPARE(linear.size(), 1);
+    CORRADE_COMPARE(linear[0].data<UnsignedByte>()[0], 128);
+
+    /* Average of black and white in linear space is brighter in sRGB */
+    const std::vector<Trade::ImageData2D> srgb = generateMipmaps(ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {2, 1}, data), MipmapFilter::Box, MipmapFlag::Srgb);
+    CORRADE_COMPARE(srgb.size(), 1);
+    CORRADE_COMPARE(srgb[0].data<UnsignedByte>()[0], 188);
+}
+
+namespace {
+
+Float coverage(const Trade::ImageData2D& image) {
+    Int covered = 0;
+    for(Int i = 0; i != image.size().product(); ++i)
+        if(image.data<UnsignedByte>()[i*4 + 3] >= 128) ++covered;
+    return Float(covered)/image.size().product();
+}
+
+}
+
+void GenerateMipmapsTest::alphaCoverage() {
+    /* Noisy alpha with 30% of pixels opaque, which gets averaged below the
+       reference value in lower levels */
+    std::vector<UnsignedByte> data(64*64*4, 255);
+    UnsignedInt state = 0x12345678;
+    for(Int i = 0; i != 64*64; ++i) {
+        state = state*1664525 + 1013904223;
+        data[i*4 + 3] = (state >> 8)%10 < 3 ? 255 : 0;
+    }
+
+    const std::vector<Trade::ImageData2D> plain = generateMipmaps(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, {64, 64}, data.data()));
+    CORRADE_VERIFY(coverage(plain[1]) < 0.1f);
+
+    const std::vector<Trade::ImageData2D> levels = generateMipmaps(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, {64, 64}, data.data()), MipmapFilter::Box, MipmapFlag::PreserveAlphaCoverage, 0.5f);
+    CORRADE_COMPARE(levels.size(), 6);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_VERIFY(coverage(levels[i]) > 0.2f);
+        CORRADE_VERIFY(coverage(levels[i]) < 0.4f);
+    }
+}
+
+void GenerateMipmapsTest::unsupported() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const UnsignedInt data[4]{};
+    CORRADE_VERIFY(generateMipmaps(ImageReference2D(ColorFormat::Red, ColorType::UnsignedInt, {2, 2}, data)).empty());
+}
+
+void GenerateMipmapsTest::singlePixel() {
+    const UnsignedByte data[4]{};
+    CORRADE_VERIFY(generateMipmaps(ImageReference2D(ColorFormat::RGBA, ColorType::UnsignedByte, {1, 1}, data)).empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::GenerateMipmapsTest)
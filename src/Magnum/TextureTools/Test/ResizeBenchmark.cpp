@@ -0,0 +1,107 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Test/Benchmark.h"
+#include "Magnum/TextureTools/Resize.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class ResizeBenchmark: public TestSuite::Tester {
+    public:
+        explicit ResizeBenchmark();
+
+        void downsampleBox();
+        void downsampleLanczos();
+        void downsampleLanczosSrgb();
+        void upsampleMitchell();
+        void anisotropicLanczos();
+};
+
+namespace {
+
+constexpr Vector2i Size{4096, 4096};
+
+Containers::Array<unsigned char> noise(const std::size_t size) {
+    Containers::Array<unsigned char> data(size);
+    UnsignedInt state = 0x12345678;
+    for(unsigned char& i: data) {
+        state = state*1664525 + 1013904223;
+        i = state >> 24;
+    }
+    return data;
+}
+
+/* Measures the resize and prints throughput in output megapixels per
+   second */
+void measure(const char* const name, const Vector2i& inSize, const Vector2i& outSize, const ResizeFilter filter, const ResizeFlags flags = {}) {
+    const Containers::Array<unsigned char> data = noise(inSize.product()*4);
+    const ImageReference2D image(ColorFormat::RGBA, ColorType::UnsignedByte, inSize, data);
+
+    const Double time = Magnum::Test::averageDuration(1, [&]() {
+        resize(image, outSize, filter, flags);
+    });
+
+    Debug() << name << time << "ms," << Double(outSize.product())/(1000*time) << "Mpx/s";
+}
+
+}
+
+ResizeBenchmark::ResizeBenchmark() {
+    addTests({&ResizeBenchmark::downsampleBox,
+              &ResizeBenchmark::downsampleLanczos,
+              &ResizeBenchmark::downsampleLanczosSrgb,
+              &ResizeBenchmark::upsampleMitchell,
+              &ResizeBenchmark::anisotropicLanczos});
+}
+
+void ResizeBenchmark::downsampleBox() {
+    measure("RGBA8 4096x4096 to 1024x1024, box:", Size, Size/4, ResizeFilter::Box);
+}
+
+void ResizeBenchmark::downsampleLanczos() {
+    measure("RGBA8 4096x4096 to 1024x1024, Lanczos:", Size, Size/4, ResizeFilter::Lanczos);
+}
+
+void ResizeBenchmark::downsampleLanczosSrgb() {
+    measure("RGBA8 4096x4096 to 1024x1024, Lanczos, sRGB:", Size, Size/4, ResizeFilter::Lanczos, ResizeFlag::Srgb);
+}
+
+void ResizeBenchmark::upsampleMitchell() {
+    measure("RGBA8 1024x1024 to 4096x4096, Mitchell:", Size/4, Size, ResizeFilter::Mitchell);
+}
+
+void ResizeBenchmark::anisotropicLanczos() {
+    measure("RGBA8 4096x1024 to 1024x4096, Lanczos:", {4096, 1024}, {1024, 4096}, ResizeFilter::Lanczos);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ResizeBenchmark)
@@ -0,0 +1,217 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/Resize.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+class ResizeTest: public TestSuite::Tester {
+    public:
+        explicit ResizeTest();
+
+        void identity();
+        void boxDownsample();
+        void boxUpsample();
+        void constant();
+        void mitchellSymmetric();
+        void clampOvershoot();
+        void srgb();
+        void formatPreserved();
+        void zeroSize();
+        void negativeSize();
+        void unsupported();
+};
+
+ResizeTest::ResizeTest() {
+    addTests({&ResizeTest::identity,
+              &ResizeTest::boxDownsample,
+              &ResizeTest::boxUpsample,
+              &ResizeTest::constant,
+              &ResizeTest::mitchellSymmetric,
+              &ResizeTest::clampOvershoot,
+              &ResizeTest::srgb,
+              &ResizeTest::formatPreserved,
+              &ResizeTest::zeroSize,
+              &ResizeTest::negativeSize,
+              &ResizeTest::unsupported});
+}
+
+void ResizeTest::identity() {
+    const UnsignedByte data[]{10, 200, 30, 0,
+                              40, 50, 255, 0};
+    for(ResizeFilter filter: {ResizeFilter::Box, ResizeFilter::Mitchell, ResizeFilter::Lanczos}) {
+        std::optional<Trade::ImageData2D> image = resize(ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {3, 2}, data), {3, 2}, filter);
+        CORRADE_VERIFY(image);
+        const UnsignedByte* out = image->data<UnsignedByte>();
+
+        /* Mitchell blurs slightly even at the same size */
+        if(filter == ResizeFilter::Mitchell) {
+            CORRADE_VERIFY(out[1] > out[0] && out[1] > out[2]);
+            continue;
+        }
+
+        CORRADE_COMPARE(Int(out[0]), 10);
+        CORRADE_COMPARE(Int(out[1]), 200);
+        CORRADE_COMPARE(Int(out[2]), 30);
+        CORRADE_COMPARE(Int(out[4]), 40);
+        CORRADE_COMPARE(Int(out[5]), 50);
+        CORRADE_COMPARE(Int(out[6]), 255);
+    }
+}
+
+void ResizeTest::boxDownsample() {
+    const Float data[]{0.0f, 1.0f, 0.5f, 0.25f,
+                       1.0f, 1.0f, 0.25f, 0.75f};
+    std::optional<Trade::ImageData2D> image = resize(ImageReference2D(ColorFormat::Red, ColorType::Float, {4, 2}, data), {2, 1}, ResizeFilter::Box);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 1));
+    CORRADE_COMPARE(image->data<Float>()[0], 0.75f);
+    CORRADE_COMPARE(image->data<Float>()[1], 0.4375f);
+}
+
+void ResizeTest::boxUpsample() {
+    const Float data[]{0.25f, 0.75f};
+    std::optional<Trade::ImageData2D> image = resize(ImageReference2D(ColorFormat::Red, ColorType::Float, {2, 1}, data), {4, 2}, ResizeFilter::Box);
+    CORRADE_VERIFY(image);
+    const Float* out = image->data<Float>();
+    CORRADE_COMPARE(out[0], 0.25f);
+    CORRADE_COMPARE(out[1], 0.25f);
+    CORRADE_COMPARE(out[2], 0.75f);
+    CORRADE_COMPARE(out[3], 0.75f);
+    CORRADE_COMPARE(out[7], 0.75f);
+}
+
+void ResizeTest::constant() {
+    std::vector<UnsignedByte> data(17*9*4);
+    for(std::size_t i = 0; i != data.size(); i += 4) {
+        data[i + 0] = 12;
+        data[i + 1] = 99;
+        data[i + 2] = 200;
+        data[i + 3] = 255;
+    }
+    const ImageReference2D input(ColorFormat::RGBA, ColorType::UnsignedByte, {17, 9}, data.data());
+
+    for(const Vector2i& size: {Vector2i(5, 3), Vector2i(40, 31)}) {
+        for(ResizeFilter filter: {ResizeFilter::Box, ResizeFilter::Mitchell, ResizeFilter::Lanczos}) {
+            std::optional<Trade::ImageData2D> image = resize(input, size, filter);
+            CORRADE_VERIFY(image);
+            const UnsignedByte* out = image->data<UnsignedByte>();
+            for(Int i = 0; i != size.product(); ++i) {
+                CORRADE_COMPARE(Int(out[i*4 + 0]), 12);
+                CORRADE_COMPARE(Int(out[i*4 + 1]), 99);
+                CORRADE_COMPARE(Int(out[i*4 + 2]), 200);
+                CORRADE_COMPARE(Int(out[i*4 + 3]), 255);
+            }
+        }
+    }
+}
+
+void ResizeTest::mitchellSymmetric() {
+    const Float data[]{0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+    std::optional<Trade::ImageData2D> image = resize(ImageReference2D(ColorFormat::Red, ColorType::Float, {5, 1}, data), {10, 1}, ResizeFilter::Mitchell);
+    CORRADE_VERIFY(image);
+    const Float* out = image->data<Float>();
+    for(Int i = 0; i != 5; ++i) CORRADE_COMPARE(out[i], out[9 - i]);
+    CORRADE_VERIFY(out[4] > out[3]);
+    CORRADE_VERIFY(out[3] > out[2]);
+}
+
+void ResizeTest::clampOvershoot() {
+    /* Lanczos rings around a hard edge, floats keep it, normalized types
+       clamp */
+    const Float floats[]{0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f};
+    std::optional<Trade::ImageData2D> floatImage = resize(ImageReference2D(ColorFormat::Red, ColorType::Float, {6, 1}, floats), {24, 1}, ResizeFilter::Lanczos);
+    CORRADE_VERIFY(floatImage);
+    Float max = 0.0f;
+    for(Int i = 0; i != 24; ++i) max = Math::max(max, floatImage->data<Float>()[i]);
+    CORRADE_VERIFY(max > 1.0f);
+
+    const UnsignedByte bytes[]{0, 0, 0, 255, 255, 255, 0, 0};
+    std::optional<Trade::ImageData2D> byteImage = resize(ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {6, 1}, bytes), {24, 1}, ResizeFilter::Lanczos);
+    CORRADE_VERIFY(byteImage);
+    CORRADE_COMPARE(Int(byteImage->data<UnsignedByte>()[0]), 0);
+    CORRADE_COMPARE(Int(byteImage->data<UnsignedByte>()[23]), 255);
+}
+
+void ResizeTest::srgb() {
+    const UnsignedByte data[]{0, 0, 0, 255, 255, 255, 0, 0};
+    const ImageReference2D input(ColorFormat::RGB, ColorType::UnsignedByte, {2, 1}, data);
+
+    std::optional<Trade::ImageData2D> linear = resize(input, {1, 1}, ResizeFilter::Box);
+    CORRADE_VERIFY(linear);
+    CORRADE_COMPARE(Int(linear->data<UnsignedByte>()[0]), 128);
+
+    /* Linear 0.5 is 188 in sRGB */
+    std::optional<Trade::ImageData2D> srgb = resize(input, {1, 1}, ResizeFilter::Box, ResizeFlag::Srgb);
+    CORRADE_VERIFY(srgb);
+    CORRADE_COMPARE(Int(srgb->data<UnsignedByte>()[0]), 188);
+}
+
+void ResizeTest::formatPreserved() {
+    const UnsignedShort data[5*3*2]{};
+    std::optional<Trade::ImageData2D> image = resize(ImageReference2D(ColorFormat::RG, ColorType::UnsignedShort, {5, 3}, data), {3, 7});
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(3, 7));
+    CORRADE_COMPARE(image->format(), ColorFormat::RG);
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedShort);
+}
+
+void ResizeTest::zeroSize() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const UnsignedByte data[4]{};
+    CORRADE_VERIFY(!resize(ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {4, 1}, data), {0, 3}));
+    CORRADE_COMPARE(out.str(), "TextureTools::resize(): can't resize Vector(4, 1) image to Vector(0, 3)\n");
+}
+
+void ResizeTest::negativeSize() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    /* Product of the size is positive, but the size is not */
+    const UnsignedByte data[4]{};
+    CORRADE_VERIFY(!resize(ImageReference2D(ColorFormat::Red, ColorType::UnsignedByte, {4, 1}, data), {-4, -4}));
+    CORRADE_COMPARE(out.str(), "TextureTools::resize(): can't resize Vector(4, 1) image to Vector(-4, -4)\n");
+}
+
+void ResizeTest::unsupported() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const UnsignedInt data[4]{};
+    CORRADE_VERIFY(!resize(ImageReference2D(ColorFormat::Red, ColorType::UnsignedInt, {4, 1}, data), {2, 1}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ResizeTest)
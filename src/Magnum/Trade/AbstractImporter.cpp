@@ -29,6 +29,7 @@
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Implementation/MappedFile.h"
 #include "Magnum/Trade/AbstractMaterialData.h"
 #include "Magnum/Trade/CameraData.h"
 #include "Magnum/Trade/ImageData.h"
@@ -42,9 +43,11 @@
 
 namespace Magnum { namespace Trade {
 
-AbstractImporter::AbstractImporter() = default;
+AbstractImporter::AbstractImporter(): _persistentData(false) {}
 
-AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractPlugin(manager, std::move(plugin)) {}
+AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractPlugin(manager, std::move(plugin)), _persistentData(false) {}
+
+AbstractImporter::~AbstractImporter() = default;
 
 bool AbstractImporter::openData(Containers::ArrayReference<const unsigned char> data) {
     CORRADE_ASSERT(features() & Feature::OpenData,
@@ -55,6 +58,17 @@ bool AbstractImporter::openData(Containers::ArrayReference<const unsigned char>
     return isOpened();
 }
 
+bool AbstractImporter::openPersistentData(Containers::ArrayReference<const unsigned char> data) {
+    CORRADE_ASSERT(features() & Feature::OpenData,
+        "Trade::AbstractImporter::openPersistentData(): feature not supported", false);
+
+    close();
+    _persistentData = true;
+    doOpenData(data);
+    if(!isOpened()) _persistentData = false;
+    return isOpened();
+}
+
 void AbstractImporter::doOpenData(Containers::ArrayReference<const unsigned char>) {
     CORRADE_ASSERT(false, "Trade::AbstractImporter::openData(): feature advertised but not implemented", );
 }
@@ -62,6 +76,12 @@ void AbstractImporter::doOpenData(Containers::ArrayReference<const unsigned char
 bool AbstractImporter::openFile(const std::string& filename) {
     close();
     doOpenFile(filename);
+
+    /* Release the mapping right away if opening failed */
+    if(!isOpened()) {
+        _mappedFile.reset();
+        _persistentData = false;
+    }
     return isOpened();
 }
 
@@ -74,7 +94,16 @@ void AbstractImporter::doOpenFile(const std::string& filename) {
         return;
     }
 
-    doOpenData(Utility::Directory::read(filename));
+    /* Map the file and keep it until the file is closed */
+    std::unique_ptr<Implementation::MappedFile> mappedFile{new Implementation::MappedFile{filename}};
+    if(!mappedFile->isValid()) {
+        Error() << "Trade::AbstractImporter::openFile(): cannot map file" << filename;
+        return;
+    }
+
+    _mappedFile = std::move(mappedFile);
+    _persistentData = true;
+    doOpenData(_mappedFile->data());
 }
 
 void AbstractImporter::close() {
@@ -82,6 +111,10 @@ void AbstractImporter::close() {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    /* Data are released only after the plugin doesn't reference them */
+    _mappedFile.reset();
+    _persistentData = false;
 }
 
 Int AbstractImporter::defaultScene() {
@@ -38,7 +38,11 @@
 #include "Magnum/Trade/Trade.h"
 #include "MagnumExternal/Optional/optional.hpp"
 
-namespace Magnum { namespace Trade {
+namespace Magnum {
+
+namespace Implementation { class MappedFile; }
+
+namespace Trade {
 
 /**
 @brief Base for importer plugins
@@ -59,6 +63,12 @@ be done in data parsing functions, because the user might want to import only
 some data. This is obviously not the case for single-data formats like images,
 as the file contains all data user wants to import.
 
+If the plugin doesn't implement @ref doOpenFile(), the default implementation
+memory-maps the file and passes the mapped memory to @ref doOpenData(). The
+mapping is kept until the file is closed, so if @ref isDataPersistent()
+returns `true`, the plugin can reference the data directly instead of copying
+them.
+
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
 
@@ -67,15 +77,22 @@ checked by the implementation:
     is any file opened.
 -   Function @ref doOpenData() is called only if @ref Feature::OpenData is
     supported.
+-   Data memory-mapped by default @ref doOpenFile() implementation are
+    released only after @ref doClose() is called.
 -   All `do*()` implementations working on opened file are called only if there
     is any file opened.
 -   All `do*()` implementations taking data ID as parameter are called only if
     the ID is from valid range.
 
+If the plugin advertises @ref Feature::ThreadSafe, the data access functions
+must not modify any state of the importer, so they can be executed in
+parallel. Opening and closing the file is never done concurrently with any
+other call.
+
 @todo How to handle casting from std::unique_ptr<> in more convenient way?
 */
 class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
-    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImporter/0.3")
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImporter/0.3.1")
 
     public:
         /**
@@ -85,7 +102,14 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
          */
         enum class Feature: UnsignedByte {
             /** Opening files from raw data using openData() */
-            OpenData = 1 << 0
+            OpenData = 1 << 0,
+
+            /**
+             * Data access functions can be called from multiple threads at
+             * once on the same opened file. Used by @ref AsyncImporter to
+             * decide whether the calls can be executed in parallel.
+             */
+            ThreadSafe = 1 << 1
         };
 
         /** @brief Set of features supported by this importer */
@@ -97,6 +121,8 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
         /** @brief Plugin manager constructor */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin);
 
+        ~AbstractImporter();
+
         /** @brief Features supported by this importer */
         Features features() const { return doFeatures(); }
 
@@ -113,11 +139,26 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
          */
         bool openData(Containers::ArrayReference<const unsigned char> data);
 
+        /**
+         * @brief Open raw data which stay valid until the file is closed
+         *
+         * Same as @ref openData(), but the caller guarantees that @p data
+         * stay valid and unchanged until @ref close() is called or another
+         * file is opened. The plugin can then reference the data directly
+         * instead of copying them, see @ref isDataPersistent(). Available
+         * only if @ref Feature::OpenData is supported.
+         * @see features(), openFile()
+         */
+        bool openPersistentData(Containers::ArrayReference<const unsigned char> data);
+
         /**
          * @brief Open file
          *
          * Closes previous file, if it was opened, and tries to open given
-         * file. Returns `true` on success, `false` otherwise.
+         * file. Returns `true` on success, `false` otherwise. If the plugin
+         * supports @ref Feature::OpenData, the file is memory-mapped instead
+         * of being read into memory, see @ref AbstractImporter-subclassing
+         * for more information.
          * @see features(), openData()
          */
         bool openFile(const std::string& filename);
@@ -466,6 +507,19 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
 
         /*@}*/
 
+    protected:
+        /**
+         * @brief Whether data passed to @ref doOpenData() stay valid
+         *
+         * Returns `true` if the data passed to @ref doOpenData() are
+         * guaranteed to stay valid until @ref doClose() is called, i.e. when
+         * the file was memory-mapped by default @ref doOpenFile()
+         * implementation or opened with @ref openPersistentData(). The
+         * plugin can then reference the data directly instead of copying
+         * them. Meaningful only inside @ref doOpenData().
+         */
+        bool isDataPersistent() const { return _persistentData; }
+
     #ifndef DOXYGEN_GENERATING_OUTPUT
     private:
     #else
@@ -483,8 +537,12 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
         /**
          * @brief Implementation for openFile()
          *
-         * If @ref Feature::OpenData is supported, default implementation opens
-         * the file and calls @ref doOpenData() with its contents.
+         * If @ref Feature::OpenData is supported, default implementation
+         * memory-maps the file and calls @ref doOpenData() with its contents.
+         * On platforms without memory mapping support the file is read into
+         * memory instead. In both cases the data are kept until the file is
+         * closed.
+         * @see @ref isDataPersistent()
          */
         virtual void doOpenFile(const std::string& filename);
 
@@ -637,6 +695,10 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
 
         /** @brief Implementation for image3D() */
         virtual std::optional<ImageData3D> doImage3D(UnsignedInt id);
+
+    private:
+        std::unique_ptr<Implementation::MappedFile> _mappedFile;
+        bool _persistentData;
 };
 
 CORRADE_ENUMSET_OPERATORS(AbstractImporter::Features)
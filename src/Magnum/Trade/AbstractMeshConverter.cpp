@@ -0,0 +1,91 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AbstractMeshConverter.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Directory.h>
+
+namespace Magnum { namespace Trade {
+
+AbstractMeshConverter::AbstractMeshConverter() = default;
+
+AbstractMeshConverter::AbstractMeshConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractPlugin(manager, std::move(plugin)) {}
+
+Containers::Array<unsigned char> AbstractMeshConverter::exportToData(const MeshData2D& mesh) const {
+    CORRADE_ASSERT(features() & Feature::ConvertData2D,
+        "Trade::AbstractMeshConverter::exportToData(): feature not supported", nullptr);
+
+    return doExportToData(mesh);
+}
+
+Containers::Array<unsigned char> AbstractMeshConverter::doExportToData(const MeshData2D&) const {
+    CORRADE_ASSERT(false, "Trade::AbstractMeshConverter::exportToData(): feature advertised but not implemented", nullptr);
+}
+
+Containers::Array<unsigned char> AbstractMeshConverter::exportToData(const MeshData3D& mesh) const {
+    CORRADE_ASSERT(features() & Feature::ConvertData3D,
+        "Trade::AbstractMeshConverter::exportToData(): feature not supported", nullptr);
+
+    return doExportToData(mesh);
+}
+
+Containers::Array<unsigned char> AbstractMeshConverter::doExportToData(const MeshData3D&) const {
+    CORRADE_ASSERT(false, "Trade::AbstractMeshConverter::exportToData(): feature advertised but not implemented", nullptr);
+}
+
+bool AbstractMeshConverter::exportToFile(const MeshData2D& mesh, const std::string& filename) const {
+    return doExportToFile(mesh, filename);
+}
+
+bool AbstractMeshConverter::doExportToFile(const MeshData2D& mesh, const std::string& filename) const {
+    CORRADE_ASSERT(features() & Feature::ConvertData2D, "Trade::AbstractMeshConverter::exportToFile(): not implemented", false);
+
+    return writeToFile(doExportToData(mesh), filename);
+}
+
+bool AbstractMeshConverter::exportToFile(const MeshData3D& mesh, const std::string& filename) const {
+    return doExportToFile(mesh, filename);
+}
+
+bool AbstractMeshConverter::doExportToFile(const MeshData3D& mesh, const std::string& filename) const {
+    CORRADE_ASSERT(features() & Feature::ConvertData3D, "Trade::AbstractMeshConverter::exportToFile(): not implemented", false);
+
+    return writeToFile(doExportToData(mesh), filename);
+}
+
+bool AbstractMeshConverter::writeToFile(const Containers::Array<unsigned char>& data, const std::string& filename) const {
+    if(!data) return false;
+
+    if(!Utility::Directory::write(filename, data)) {
+        Error() << "Trade::AbstractMeshConverter::exportToFile(): cannot write to file" << filename;
+        return false;
+    }
+
+    return true;
+}
+
+}}
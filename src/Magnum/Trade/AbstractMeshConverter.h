@@ -0,0 +1,169 @@
+#ifndef Magnum_Trade_AbstractMeshConverter_h
+#define Magnum_Trade_AbstractMeshConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Trade::AbstractMeshConverter
+ */
+
+#include <Corrade/PluginManager/AbstractPlugin.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Base for mesh converter plugins
+
+Provides functionality for exporting meshes to various file formats. See
+@ref plugins for more information and `*MeshConverter` classes in @ref Trade
+namespace for available mesh converter plugins.
+
+@section AbstractMeshConverter-subclassing Subclassing
+
+Plugin implements function doFeatures() and one or both of
+@ref doExportToData(const MeshData2D&) const and
+@ref doExportToData(const MeshData3D&) const functions based on what features
+are supported. If the format can't be held in memory, @ref doExportToFile()
+functions can be implemented instead.
+
+You don't need to do most of the redundant sanity checks, these things are
+checked by the implementation:
+
+-   Functions @ref doExportToData(const MeshData2D&) const or
+    @ref doExportToData(const MeshData3D&) const are called only if
+    @ref Feature::ConvertData2D or @ref Feature::ConvertData3D is supported.
+*/
+class MAGNUM_EXPORT AbstractMeshConverter: public PluginManager::AbstractPlugin {
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractMeshConverter/0.1")
+
+    public:
+        /**
+         * @brief Features supported by this converter
+         *
+         * @see Features, features()
+         */
+        enum class Feature: UnsignedByte {
+            /** Exporting two-dimensional meshes to raw data with exportToData() */
+            ConvertData2D = 1 << 0,
+
+            /** Exporting three-dimensional meshes to raw data with exportToData() */
+            ConvertData3D = 1 << 1
+        };
+
+        /**
+         * @brief Features supported by this converter
+         *
+         * @see features()
+         */
+        typedef Containers::EnumSet<Feature, UnsignedByte> Features;
+
+        /** @brief Default constructor */
+        explicit AbstractMeshConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit AbstractMeshConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        /** @brief Features supported by this converter */
+        Features features() const { return doFeatures(); }
+
+        /**
+         * @brief Export two-dimensional mesh to raw data
+         *
+         * Available only if @ref Feature::ConvertData2D is supported. Returns
+         * data on success, zero-sized array otherwise.
+         * @see @ref features(), @ref exportToFile()
+         */
+        Containers::Array<unsigned char> exportToData(const MeshData2D& mesh) const;
+
+        /**
+         * @brief Export three-dimensional mesh to raw data
+         *
+         * Available only if @ref Feature::ConvertData3D is supported. Returns
+         * data on success, zero-sized array otherwise.
+         * @see @ref features(), @ref exportToFile()
+         */
+        Containers::Array<unsigned char> exportToData(const MeshData3D& mesh) const;
+
+        /**
+         * @brief Export two-dimensional mesh to file
+         *
+         * Returns `true` on success, `false` otherwise.
+         * @see @ref features(), @ref exportToData()
+         */
+        bool exportToFile(const MeshData2D& mesh, const std::string& filename) const;
+
+        /**
+         * @brief Export three-dimensional mesh to file
+         *
+         * Returns `true` on success, `false` otherwise.
+         * @see @ref features(), @ref exportToData()
+         */
+        bool exportToFile(const MeshData3D& mesh, const std::string& filename) const;
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #else
+    protected:
+    #endif
+        /** @brief Implementation of features() */
+        virtual Features doFeatures() const = 0;
+
+        /** @brief Implementation of exportToData(const MeshData2D&) const */
+        virtual Containers::Array<unsigned char> doExportToData(const MeshData2D& mesh) const;
+
+        /** @brief Implementation of exportToData(const MeshData3D&) const */
+        virtual Containers::Array<unsigned char> doExportToData(const MeshData3D& mesh) const;
+
+        /**
+         * @brief Implementation of exportToFile(const MeshData2D&, const std::string&) const
+         *
+         * If @ref Feature::ConvertData2D is supported, default implementation
+         * calls @ref doExportToData(const MeshData2D&) const and saves the
+         * result to given file.
+         */
+        virtual bool doExportToFile(const MeshData2D& mesh, const std::string& filename) const;
+
+        /**
+         * @brief Implementation of exportToFile(const MeshData3D&, const std::string&) const
+         *
+         * If @ref Feature::ConvertData3D is supported, default implementation
+         * calls @ref doExportToData(const MeshData3D&) const and saves the
+         * result to given file.
+         */
+        virtual bool doExportToFile(const MeshData3D& mesh, const std::string& filename) const;
+
+    private:
+        MAGNUM_LOCAL bool writeToFile(const Containers::Array<unsigned char>& data, const std::string& filename) const;
+};
+
+CORRADE_ENUMSET_OPERATORS(AbstractMeshConverter::Features)
+
+}}
+
+#endif
@@ -0,0 +1,306 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AsyncImporter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractMaterialData.h"
+#include "Magnum/Trade/CameraData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/LightData.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/ObjectData2D.h"
+#include "Magnum/Trade/ObjectData3D.h"
+#include "Magnum/Trade/SceneData.h"
+#include "Magnum/Trade/TextureData.h"
+
+namespace Magnum {
+
+namespace Implementation {
+
+struct AsyncTaskState {
+    explicit AsyncTaskState(std::function<void(bool)> job, Trade::AsyncPriority priority): job(std::move(job)), status(UnsignedByte(Trade::AsyncTask::Status::Pending)), priority(priority), order(0) {}
+
+    /* Called with `true` when the task is executed, with `false` when it is
+       cancelled. Whoever moves the status away from Pending calls it, so it
+       is called exactly once. */
+    std::function<void(bool)> job;
+    std::atomic<UnsignedByte> status;
+    Trade::AsyncPriority priority;
+    std::size_t order;
+};
+
+struct AsyncImporterState {
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable queueChanged, idle;
+
+    /* Binary heap with highest priority and lowest order on top */
+    std::vector<std::shared_ptr<AsyncTaskState>> queue;
+    std::size_t order;
+    std::size_t running;
+    bool quit;
+};
+
+}
+
+namespace Trade {
+
+namespace {
+
+bool compareTasks(const std::shared_ptr<Implementation::AsyncTaskState>& a, const std::shared_ptr<Implementation::AsyncTaskState>& b) {
+    if(a->priority != b->priority) return a->priority < b->priority;
+    return a->order > b->order;
+}
+
+bool setStatus(Implementation::AsyncTaskState& task, AsyncTask::Status from, AsyncTask::Status to) {
+    UnsignedByte expected = UnsignedByte(from);
+    return task.status.compare_exchange_strong(expected, UnsignedByte(to));
+}
+
+}
+
+AsyncTask::AsyncTask() = default;
+
+AsyncTask::AsyncTask(std::shared_ptr<Implementation::AsyncTaskState> state): _state(std::move(state)) {}
+
+auto AsyncTask::status() const -> Status {
+    CORRADE_ASSERT(_state, "Trade::AsyncTask::status(): the handle doesn't refer to any task", {});
+    return Status(_state->status.load());
+}
+
+bool AsyncTask::cancel() {
+    CORRADE_ASSERT(_state, "Trade::AsyncTask::cancel(): the handle doesn't refer to any task", false);
+
+    if(!setStatus(*_state, Status::Pending, Status::Cancelled)) return false;
+
+    /* Deliver the empty result right away, the worker will just throw the
+       task away when it gets to it */
+    _state->job(false);
+    _state->job = nullptr;
+    return true;
+}
+
+AsyncImporter::AsyncImporter(AbstractImporter& importer, UnsignedInt threadCount): _importer(importer), _state(new Implementation::AsyncImporterState) {
+    _state->order = 0;
+    _state->running = 0;
+    _state->quit = false;
+
+    /* Stateful importers have to be serialized */
+    if(!(importer.features() & AbstractImporter::Feature::ThreadSafe))
+        threadCount = 1;
+    else if(!threadCount)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    _state->threads.reserve(threadCount);
+    for(UnsignedInt i = 0; i != threadCount; ++i)
+        _state->threads.emplace_back(&AsyncImporter::work, this);
+}
+
+AsyncImporter::~AsyncImporter() {
+    std::vector<std::shared_ptr<Implementation::AsyncTaskState>> queue;
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        queue = std::move(_state->queue);
+        _state->queue.clear();
+        _state->quit = true;
+    }
+    _state->queueChanged.notify_all();
+
+    /* Cancel tasks which weren't executed yet */
+    for(const std::shared_ptr<Implementation::AsyncTaskState>& task: queue)
+        AsyncTask{task}.cancel();
+
+    for(std::thread& thread: _state->threads) thread.join();
+}
+
+UnsignedInt AsyncImporter::threadCount() const { return _state->threads.size(); }
+
+void AsyncImporter::wait() {
+    std::unique_lock<std::mutex> lock(_state->mutex);
+    _state->idle.wait(lock, [this]() { return _state->queue.empty() && !_state->running; });
+}
+
+void AsyncImporter::enqueue(const std::shared_ptr<Implementation::AsyncTaskState>& task) {
+    {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        task->order = _state->order++;
+        _state->queue.push_back(task);
+        std::push_heap(_state->queue.begin(), _state->queue.end(), compareTasks);
+    }
+    _state->queueChanged.notify_one();
+}
+
+void AsyncImporter::work() {
+    std::unique_lock<std::mutex> lock(_state->mutex);
+    for(;;) {
+        _state->queueChanged.wait(lock, [this]() { return _state->quit || !_state->queue.empty(); });
+        if(_state->quit) return;
+
+        std::pop_heap(_state->queue.begin(), _state->queue.end(), compareTasks);
+        const std::shared_ptr<Implementation::AsyncTaskState> task = std::move(_state->queue.back());
+        _state->queue.pop_back();
+
+        /* Skip the task if it got cancelled in the meantime */
+        if(setStatus(*task, AsyncTask::Status::Pending, AsyncTask::Status::Running)) {
+            ++_state->running;
+            lock.unlock();
+            task->job(true);
+            task->job = nullptr;
+            task->status = UnsignedByte(AsyncTask::Status::Finished);
+            lock.lock();
+            --_state->running;
+        }
+
+        if(_state->queue.empty() && !_state->running) _state->idle.notify_all();
+    }
+}
+
+template<class T> AsyncResult<T> AsyncImporter::submit(T(AbstractImporter::*function)(UnsignedInt), const UnsignedInt id, const AsyncPriority priority) {
+    /* std::function needs to be copyable, so the promise can't be moved in */
+    auto promise = std::make_shared<std::promise<T>>();
+    std::future<T> future = promise->get_future();
+    auto task = std::make_shared<Implementation::AsyncTaskState>([this, function, id, promise](bool execute) {
+        promise->set_value(execute ? (_importer.*function)(id) : T{});
+    }, priority);
+
+    enqueue(task);
+    return AsyncResult<T>{std::move(task), std::move(future)};
+}
+
+template<class T> AsyncTask AsyncImporter::submit(T(AbstractImporter::*function)(UnsignedInt), const UnsignedInt id, std::function<void(T)> callback, const AsyncPriority priority) {
+    auto task = std::make_shared<Implementation::AsyncTaskState>([this, function, id, callback](bool execute) {
+        if(execute) callback((_importer.*function)(id));
+    }, priority);
+
+    enqueue(task);
+    return AsyncTask{std::move(task)};
+}
+
+AsyncResult<std::optional<SceneData>> AsyncImporter::scene(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::scene, id, priority);
+}
+
+AsyncTask AsyncImporter::scene(const UnsignedInt id, std::function<void(std::optional<SceneData>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::scene, id, std::move(callback), priority);
+}
+
+AsyncResult<std::optional<LightData>> AsyncImporter::light(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::light, id, priority);
+}
+
+AsyncTask AsyncImporter::light(const UnsignedInt id, std::function<void(std::optional<LightData>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::light, id, std::move(callback), priority);
+}
+
+AsyncResult<std::optional<CameraData>> AsyncImporter::camera(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::camera, id, priority);
+}
+
+AsyncTask AsyncImporter::camera(const UnsignedInt id, std::function<void(std::optional<CameraData>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::camera, id, std::move(callback), priority);
+}
+
+AsyncResult<std::unique_ptr<ObjectData2D>> AsyncImporter::object2D(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::object2D, id, priority);
+}
+
+AsyncTask AsyncImporter::object2D(const UnsignedInt id, std::function<void(std::unique_ptr<ObjectData2D>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::object2D, id, std::move(callback), priority);
+}
+
+AsyncResult<std::unique_ptr<ObjectData3D>> AsyncImporter::object3D(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::object3D, id, priority);
+}
+
+AsyncTask AsyncImporter::object3D(const UnsignedInt id, std::function<void(std::unique_ptr<ObjectData3D>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::object3D, id, std::move(callback), priority);
+}
+
+AsyncResult<std::optional<MeshData2D>> AsyncImporter::mesh2D(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::mesh2D, id, priority);
+}
+
+AsyncTask AsyncImporter::mesh2D(const UnsignedInt id, std::function<void(std::optional<MeshData2D>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::mesh2D, id, std::move(callback), priority);
+}
+
+AsyncResult<std::optional<MeshData3D>> AsyncImporter::mesh3D(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::mesh3D, id, priority);
+}
+
+AsyncTask AsyncImporter::mesh3D(const UnsignedInt id, std::function<void(std::optional<MeshData3D>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::mesh3D, id, std::move(callback), priority);
+}
+
+AsyncResult<std::unique_ptr<AbstractMaterialData>> AsyncImporter::material(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::material, id, priority);
+}
+
+AsyncTask AsyncImporter::material(const UnsignedInt id, std::function<void(std::unique_ptr<AbstractMaterialData>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::material, id, std::move(callback), priority);
+}
+
+AsyncResult<std::optional<TextureData>> AsyncImporter::texture(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::texture, id, priority);
+}
+
+AsyncTask AsyncImporter::texture(const UnsignedInt id, std::function<void(std::optional<TextureData>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::texture, id, std::move(callback), priority);
+}
+
+AsyncResult<std::optional<ImageData1D>> AsyncImporter::image1D(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::image1D, id, priority);
+}
+
+AsyncTask AsyncImporter::image1D(const UnsignedInt id, std::function<void(std::optional<ImageData1D>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::image1D, id, std::move(callback), priority);
+}
+
+AsyncResult<std::optional<ImageData2D>> AsyncImporter::image2D(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::image2D, id, priority);
+}
+
+AsyncTask AsyncImporter::image2D(const UnsignedInt id, std::function<void(std::optional<ImageData2D>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::image2D, id, std::move(callback), priority);
+}
+
+AsyncResult<std::optional<ImageData3D>> AsyncImporter::image3D(const UnsignedInt id, const AsyncPriority priority) {
+    return submit(&AbstractImporter::image3D, id, priority);
+}
+
+AsyncTask AsyncImporter::image3D(const UnsignedInt id, std::function<void(std::optional<ImageData3D>)> callback, const AsyncPriority priority) {
+    return submit(&AbstractImporter::image3D, id, std::move(callback), priority);
+}
+
+}}
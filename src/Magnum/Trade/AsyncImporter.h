@@ -0,0 +1,334 @@
+#ifndef Magnum_Trade_AsyncImporter_h
+#define Magnum_Trade_AsyncImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::AsyncImporter, @ref Magnum::Trade::AsyncTask, @ref Magnum::Trade::AsyncResult, enum @ref Magnum::Trade::AsyncPriority
+ */
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Trade/Trade.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum {
+
+namespace Implementation {
+    struct AsyncImporterState;
+    struct AsyncTaskState;
+}
+
+namespace Trade {
+
+/**
+@brief Priority of asynchronous import task
+
+@see @ref AsyncImporter
+*/
+enum class AsyncPriority: UnsignedByte {
+    Low,        /**< Executed after all normal and high priority tasks */
+    Normal,     /**< Default priority */
+    High        /**< Executed before all normal and low priority tasks */
+};
+
+/**
+@brief Asynchronous import task
+
+Handle for querying status of and cancelling task submitted to
+@ref AsyncImporter. Copies of the handle refer to the same task.
+@see @ref AsyncResult
+*/
+class MAGNUM_EXPORT AsyncTask {
+    friend AsyncImporter;
+
+    public:
+        /**
+         * @brief Task status
+         *
+         * @see @ref status()
+         */
+        enum class Status: UnsignedByte {
+            Pending,    /**< Waiting in the queue */
+            Running,    /**< Being executed */
+            Finished,   /**< Finished */
+            Cancelled   /**< Cancelled before it was executed */
+        };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates handle not referring to any task.
+         */
+        explicit AsyncTask();
+
+        /** @brief Whether the handle refers to any task */
+        explicit operator bool() const { return !!_state; }
+
+        /** @brief Task status */
+        Status status() const;
+
+        /**
+         * @brief Cancel the task
+         *
+         * Succeeds only if the task wasn't executed yet, in that case
+         * returns `true` and the task is removed from the queue. If the task
+         * is delivering its result to a future, the future gets empty value
+         * (i.e. `std::nullopt` or `nullptr`), if it has completion callback,
+         * the callback is not called at all. Returns `false` if the task is
+         * already running or finished.
+         */
+        bool cancel();
+
+    protected:
+        explicit AsyncTask(std::shared_ptr<Implementation::AsyncTaskState> state);
+
+    private:
+        std::shared_ptr<Implementation::AsyncTaskState> _state;
+};
+
+/**
+@brief Asynchronous import result
+
+@ref AsyncTask with future holding the imported data.
+*/
+template<class T> class AsyncResult: public AsyncTask {
+    friend AsyncImporter;
+
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates handle not referring to any task.
+         */
+        explicit AsyncResult() = default;
+
+        /** @brief Whether the result is available */
+        bool isReady() const {
+            return _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        /** @brief Wait until the result is available */
+        void wait() const { _future.wait(); }
+
+        /**
+         * @brief Imported data
+         *
+         * Waits until the result is available and returns it. If the task
+         * was cancelled or importing failed, returns empty value (i.e.
+         * `std::nullopt` or `nullptr`). Can be called only once.
+         */
+        T get() { return _future.get(); }
+
+    private:
+        explicit AsyncResult(std::shared_ptr<Implementation::AsyncTaskState> state, std::future<T> future): AsyncTask(std::move(state)), _future(std::move(future)) {}
+
+        std::future<T> _future;
+};
+
+/**
+@brief Asynchronous importer
+
+Executes data import functions of any @ref AbstractImporter on a pool of
+worker threads, so e.g. level loading doesn't block the main thread. Open the
+file using the importer first, then submit the import tasks:
+@code
+Trade::AbstractImporter& importer;
+importer.openFile("level.obj");
+
+Trade::AsyncImporter async(importer);
+Trade::AsyncResult<std::optional<Trade::MeshData3D>> terrain = async.mesh3D(0, Trade::AsyncPriority::High);
+async.image2D(3, [](std::optional<Trade::ImageData2D> image) {
+    // called from the worker thread
+});
+
+// ...
+
+std::optional<Trade::MeshData3D> data = terrain.get();
+@endcode
+
+Each data access function either returns @ref AsyncResult with the data
+delivered through a future or takes completion callback, which is called from
+the worker thread, and returns just @ref AsyncTask handle. The tasks are
+executed in order of their @ref AsyncPriority, tasks with the same priority
+in order of submission. Tasks which weren't executed yet can be cancelled,
+see @ref AsyncTask::cancel().
+
+@section AsyncImporter-thread-safety Thread safety
+
+If the importer advertises @ref AbstractImporter::Feature::ThreadSafe, the
+tasks are executed in parallel on all worker threads, otherwise they are
+serialized on a single worker thread. While any tasks are pending, the
+importer shouldn't be used directly, except for functions not taking data ID
+as parameter (such as @ref AbstractImporter::mesh3DCount()) on thread-safe
+importers. The importer must stay opened until all tasks are finished. The
+@ref AsyncImporter functions themselves can be called from any thread.
+
+@note This class is not available on @ref CORRADE_TARGET_NACL_NEWLIB "NaCl newlib"
+    and @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", as these don't support
+    threads.
+*/
+class MAGNUM_EXPORT AsyncImporter {
+    public:
+        /**
+         * @brief Constructor
+         * @param importer      Importer with opened file
+         * @param threadCount   Worker thread count. If set to `0`,
+         *      @ref std::thread::hardware_concurrency() is used. Ignored if
+         *      the importer isn't thread-safe.
+         */
+        explicit AsyncImporter(AbstractImporter& importer, UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        AsyncImporter(const AsyncImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncImporter(AsyncImporter&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Cancels all pending tasks and waits for the running ones to finish.
+         */
+        ~AsyncImporter();
+
+        /** @brief Copying is not allowed */
+        AsyncImporter& operator=(const AsyncImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncImporter& operator=(AsyncImporter&&) = delete;
+
+        /** @brief Wrapped importer */
+        AbstractImporter& importer() { return _importer; }
+
+        /** @brief Worker thread count */
+        UnsignedInt threadCount() const;
+
+        /**
+         * @brief Wait for all tasks
+         *
+         * Blocks until all submitted tasks are finished or cancelled.
+         */
+        void wait();
+
+        /**
+         * @brief Scene
+         *
+         * Asynchronous version of @ref AbstractImporter::scene().
+         */
+        AsyncResult<std::optional<SceneData>> scene(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /**
+         * @brief Scene with completion callback
+         *
+         * Asynchronous version of @ref AbstractImporter::scene(). The
+         * callback is called from the worker thread.
+         */
+        AsyncTask scene(UnsignedInt id, std::function<void(std::optional<SceneData>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::optional<LightData>> light(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask light(UnsignedInt id, std::function<void(std::optional<LightData>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::optional<CameraData>> camera(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask camera(UnsignedInt id, std::function<void(std::optional<CameraData>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::unique_ptr<ObjectData2D>> object2D(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask object2D(UnsignedInt id, std::function<void(std::unique_ptr<ObjectData2D>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::unique_ptr<ObjectData3D>> object3D(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask object3D(UnsignedInt id, std::function<void(std::unique_ptr<ObjectData3D>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::optional<MeshData2D>> mesh2D(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask mesh2D(UnsignedInt id, std::function<void(std::optional<MeshData2D>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::optional<MeshData3D>> mesh3D(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask mesh3D(UnsignedInt id, std::function<void(std::optional<MeshData3D>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::unique_ptr<AbstractMaterialData>> material(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask material(UnsignedInt id, std::function<void(std::unique_ptr<AbstractMaterialData>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::optional<TextureData>> texture(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask texture(UnsignedInt id, std::function<void(std::optional<TextureData>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::optional<ImageData1D>> image1D(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask image1D(UnsignedInt id, std::function<void(std::optional<ImageData1D>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::optional<ImageData2D>> image2D(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask image2D(UnsignedInt id, std::function<void(std::optional<ImageData2D>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, AsyncPriority) */
+        AsyncResult<std::optional<ImageData3D>> image3D(UnsignedInt id, AsyncPriority priority = AsyncPriority::Normal);
+
+        /** @copydoc scene(UnsignedInt, std::function<void(std::optional<SceneData>)>, AsyncPriority) */
+        AsyncTask image3D(UnsignedInt id, std::function<void(std::optional<ImageData3D>)> callback, AsyncPriority priority = AsyncPriority::Normal);
+
+    private:
+        template<class T> MAGNUM_LOCAL AsyncResult<T> submit(T(AbstractImporter::*function)(UnsignedInt), UnsignedInt id, AsyncPriority priority);
+        template<class T> MAGNUM_LOCAL AsyncTask submit(T(AbstractImporter::*function)(UnsignedInt), UnsignedInt id, std::function<void(T)> callback, AsyncPriority priority);
+        MAGNUM_LOCAL void enqueue(const std::shared_ptr<Implementation::AsyncTaskState>& task);
+        MAGNUM_LOCAL void work();
+
+        AbstractImporter& _importer;
+        std::unique_ptr<Implementation::AsyncImporterState> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CachedImporter.h"
+
+#include <sstream>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImporterCache.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+CachedImporter::CachedImporter(AbstractImporter& importer, ImporterCache& cache, std::string configuration): _importer(importer), _cache(cache), _configuration(std::move(configuration)), _data(nullptr), _image2DCount(0), _mesh3DCount(0) {}
+
+CachedImporter::~CachedImporter() { close(); }
+
+auto CachedImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+bool CachedImporter::doIsOpened() const { return !_key.empty(); }
+
+void CachedImporter::doOpenData(const Containers::ArrayReference<const unsigned char> data) {
+    CORRADE_ASSERT(_importer.features() & Feature::OpenData,
+        "Trade::CachedImporter::openData(): the wrapped importer doesn't support opening raw data", );
+
+    /* Key prefix from plugin name, configuration and hash of the contents.
+       Two differently seeded hashes make accidental collisions unlikely
+       also on 32-bit platforms. */
+    std::ostringstream key;
+    key << _importer.plugin() << '\n' << _configuration << '\n' << std::hex;
+    for(std::size_t seed: {0, 1})
+        key << *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2(seed)(reinterpret_cast<const char*>(data.data()), data.size()).byteArray());
+    key << '\n';
+    const std::string prefix = key.str();
+
+    /* Keep the data for lazy opening of the wrapped importer, copy them only
+       if they are not guaranteed to stay valid */
+    if(isDataPersistent()) _data = data;
+    else {
+        _dataCopy = Containers::Array<unsigned char>(data.size());
+        std::copy(data.begin(), data.end(), _dataCopy.begin());
+        _data = _dataCopy;
+    }
+
+    /* Data counts are cached, open the wrapped importer only if they are not
+       there */
+    const Containers::Array<unsigned char> info = _cache.data(prefix + "info");
+    if(info.size() == 2*sizeof(UnsignedInt)) {
+        _image2DCount = reinterpret_cast<const UnsignedInt*>(info.begin())[0];
+        _mesh3DCount = reinterpret_cast<const UnsignedInt*>(info.begin())[1];
+    } else {
+        if(!_importer.openPersistentData(_data)) {
+            _dataCopy = nullptr;
+            _data = nullptr;
+            return;
+        }
+
+        _image2DCount = _importer.image2DCount();
+        _mesh3DCount = _importer.mesh3DCount();
+        const UnsignedInt counts[]{_image2DCount, _mesh3DCount};
+        _cache.setData(prefix + "info", {reinterpret_cast<const unsigned char*>(counts), sizeof(counts)});
+    }
+
+    _key = prefix;
+}
+
+void CachedImporter::doClose() {
+    _importer.close();
+    _key.clear();
+    _dataCopy = nullptr;
+    _data = nullptr;
+    _image2DCount = _mesh3DCount = 0;
+}
+
+bool CachedImporter::openImporter() {
+    return _importer.isOpened() || _importer.openPersistentData(_data);
+}
+
+UnsignedInt CachedImporter::doImage2DCount() const { return _image2DCount; }
+
+Int CachedImporter::doImage2DForName(const std::string& name) {
+    return openImporter() ? _importer.image2DForName(name) : -1;
+}
+
+std::string CachedImporter::doImage2DName(const UnsignedInt id) {
+    return openImporter() ? _importer.image2DName(id) : std::string{};
+}
+
+std::optional<ImageData2D> CachedImporter::doImage2D(const UnsignedInt id) {
+    const std::string key = _key + "image2D " + std::to_string(id);
+    std::optional<ImageData2D> image = _cache.image2D(key);
+    if(image || !openImporter()) return image;
+
+    image = _importer.image2D(id);
+    if(image) _cache.setImage2D(key, *image);
+    return image;
+}
+
+UnsignedInt CachedImporter::doMesh3DCount() const { return _mesh3DCount; }
+
+Int CachedImporter::doMesh3DForName(const std::string& name) {
+    return openImporter() ? _importer.mesh3DForName(name) : -1;
+}
+
+std::string CachedImporter::doMesh3DName(const UnsignedInt id) {
+    return openImporter() ? _importer.mesh3DName(id) : std::string{};
+}
+
+std::optional<MeshData3D> CachedImporter::doMesh3D(const UnsignedInt id) {
+    const std::string key = _key + "mesh3D " + std::to_string(id);
+    std::optional<MeshData3D> mesh = _cache.mesh3D(key);
+    if(mesh || !openImporter()) return mesh;
+
+    mesh = _importer.mesh3D(id);
+    if(mesh) _cache.setMesh3D(key, *mesh);
+    return mesh;
+}
+
+}}
@@ -0,0 +1,119 @@
+#ifndef Magnum_Trade_CachedImporter_h
+#define Magnum_Trade_CachedImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::CachedImporter
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Importer using persistent cache
+
+Wraps another importer and stores two-dimensional images and
+three-dimensional meshes imported by it in @ref ImporterCache. The data are
+keyed by plugin name of the wrapped importer, hash of the file contents and a
+configuration string supplied by the caller, so a modified file is never
+served stale data. The wrapped importer configuration is not inspected, stale
+data are served after changing any import option which is not part of the
+configuration string. Example usage:
+@code
+PluginManager::Manager<Trade::AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_DIR};
+std::unique_ptr<Trade::AbstractImporter> importer = manager.instance("ObjImporter");
+Trade::ImporterCache cache{"/var/cache/app", 512*1024*1024};
+// ObjImporter has no options affecting the result
+Trade::CachedImporter cachedImporter{*importer, cache, ""};
+
+if(!cachedImporter.openFile("scene.obj")) return;
+std::optional<Trade::MeshData3D> mesh = cachedImporter.mesh3D(0);
+@endcode
+
+The wrapped importer is opened only if some requested data are not in the
+cache, image and mesh counts are cached too, under the same key. Image and
+mesh names are not cached, querying them opens the wrapped importer. Other
+data types are not supported.
+
+The wrapped importer must support @ref Feature::OpenData.
+*/
+class MAGNUM_EXPORT CachedImporter: public AbstractImporter {
+    public:
+        /**
+         * @brief Constructor
+         * @param importer      Wrapped importer
+         * @param cache         Cache to use
+         * @param configuration Configuration of the wrapped importer
+         *
+         * The @p configuration string is made a part of the cache key. It
+         * must contain every option which affects the import result,
+         * otherwise data imported with different options are served from
+         * the cache. Pass an empty string if the importer has no such
+         * options. The wrapped importer and the cache must stay valid
+         * during whole lifetime of the instance.
+         */
+        explicit CachedImporter(AbstractImporter& importer, ImporterCache& cache, std::string configuration);
+
+        ~CachedImporter();
+
+        /** @brief Wrapped importer */
+        AbstractImporter& importer() { return _importer; }
+
+        /** @brief Cache */
+        ImporterCache& cache() { return _cache; }
+
+    private:
+        Features MAGNUM_LOCAL doFeatures() const override;
+        bool MAGNUM_LOCAL doIsOpened() const override;
+        void MAGNUM_LOCAL doOpenData(Containers::ArrayReference<const unsigned char> data) override;
+        void MAGNUM_LOCAL doClose() override;
+
+        UnsignedInt MAGNUM_LOCAL doImage2DCount() const override;
+        Int MAGNUM_LOCAL doImage2DForName(const std::string& name) override;
+        std::string MAGNUM_LOCAL doImage2DName(UnsignedInt id) override;
+        std::optional<ImageData2D> MAGNUM_LOCAL doImage2D(UnsignedInt id) override;
+
+        UnsignedInt MAGNUM_LOCAL doMesh3DCount() const override;
+        Int MAGNUM_LOCAL doMesh3DForName(const std::string& name) override;
+        std::string MAGNUM_LOCAL doMesh3DName(UnsignedInt id) override;
+        std::optional<MeshData3D> MAGNUM_LOCAL doMesh3D(UnsignedInt id) override;
+
+        bool MAGNUM_LOCAL openImporter();
+
+        AbstractImporter& _importer;
+        ImporterCache& _cache;
+        std::string _configuration, _key;
+        Containers::Array<unsigned char> _dataCopy;
+        Containers::ArrayReference<const unsigned char> _data;
+        UnsignedInt _image2DCount, _mesh3DCount;
+};
+
+}}
+
+#endif
@@ -0,0 +1,519 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImporterCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+/* All entries start with this header, the rest of the file is type-specific
+   and all arrays are aligned to 16 bytes */
+struct EntryHeader {
+    char magic[4];          /* "MGNC" */
+    UnsignedByte version;
+    UnsignedByte type;      /* EntryType */
+    UnsignedShort byteOrder;
+    UnsignedInt fields[8];  /* Type-specific fields */
+    std::uint64_t size;     /* Size of whole file including the header */
+};
+
+static_assert(sizeof(EntryHeader) == 48, "Improper size of cache entry header");
+
+enum: UnsignedByte { EntryVersion = 1 };
+enum: UnsignedShort { EntryByteOrder = 0x0102 };
+enum: std::size_t { EntryAlignment = 16 };
+
+enum class EntryType: UnsignedByte {
+    /* No fields, raw data after the header */
+    Data = 0,
+
+    /* Format, type, width and height, pixel data after the header */
+    Image2D = 1,
+
+    /* Primitive, index count, position, normal and 2D texture coordinate
+       array count; vertex count of each array after the header, then index
+       array, position, normal and texture coordinate arrays */
+    Mesh3D = 2
+};
+
+std::size_t align(const std::size_t offset) {
+    return (offset + EntryAlignment - 1)/EntryAlignment*EntryAlignment;
+}
+
+EntryHeader entryHeader(const EntryType type, const std::size_t size) {
+    EntryHeader header{};
+    std::memcpy(header.magic, "MGNC", 4);
+    header.version = EntryVersion;
+    header.type = UnsignedByte(type);
+    header.byteOrder = EntryByteOrder;
+    header.size = size;
+    return header;
+}
+
+/* Reads entry file directly into output data. Sizes are checked against
+   remaining file size before reading, so corrupted files don't cause huge
+   allocations. */
+class EntryReader {
+    public:
+        explicit EntryReader(const std::string& filename): _in(filename, std::ios::binary), _size(0), _offset(0) {
+            if(_in.seekg(0, std::ios::end)) {
+                _size = _in.tellg();
+                _in.seekg(0);
+            }
+        }
+
+        /* Size of the whole file */
+        std::size_t size() const { return _size; }
+
+        /* Remaining size of the file */
+        std::size_t remaining() const { return _size - _offset; }
+
+        bool read(void* const out, const std::size_t size) {
+            if(size > remaining() || (size && !_in.read(static_cast<char*>(out), size)))
+                return false;
+            _offset += size;
+            return true;
+        }
+
+        /* Reads given count of items and skips the padding after them */
+        template<class T> bool readArray(const std::size_t count, std::vector<T>& out) {
+            if(count > remaining()/sizeof(T)) return false;
+            out.resize(count);
+            return read(out.data(), count*sizeof(T)) && skipPadding();
+        }
+
+        bool skipPadding() {
+            const std::size_t padding = std::min(align(_offset) - _offset, remaining());
+            if(padding && !_in.ignore(padding)) return false;
+            _offset += padding;
+            return true;
+        }
+
+    private:
+        std::ifstream _in;
+        std::size_t _size, _offset;
+};
+
+template<class T> std::size_t writeArray(Containers::Array<unsigned char>& data, const std::size_t offset, const std::vector<T>& array) {
+    if(!array.empty()) std::memcpy(data + offset, array.data(), array.size()*sizeof(T));
+    return align(offset + array.size()*sizeof(T));
+}
+
+std::optional<Containers::Array<unsigned char>> decodeData(EntryReader& in, const EntryHeader&) {
+    Containers::Array<unsigned char> out(in.remaining());
+    if(!in.read(out.begin(), out.size())) return std::nullopt;
+    return std::move(out);
+}
+
+Containers::Array<unsigned char> encodeData(const Containers::ArrayReference<const unsigned char> data) {
+    Containers::Array<unsigned char> out(sizeof(EntryHeader) + data.size());
+    const EntryHeader header = entryHeader(EntryType::Data, out.size());
+    std::memcpy(out.begin(), &header, sizeof(EntryHeader));
+    std::copy(data.begin(), data.end(), out.begin() + sizeof(EntryHeader));
+    return out;
+}
+
+/* Whether given format and type combination is known to this build.
+   AbstractImage::pixelSize() asserts on anything else, which would abort on
+   damaged entries or entries written by a build with different enum set. */
+bool isKnownPixelFormat(const ColorFormat format, const ColorType type) {
+    bool packed;
+    switch(type) {
+        case ColorType::UnsignedByte:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Byte:
+        #endif
+        case ColorType::UnsignedShort:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Short:
+        #endif
+        case ColorType::HalfFloat:
+        case ColorType::UnsignedInt:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Int:
+        #endif
+        case ColorType::Float:
+            packed = false;
+            break;
+
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorType::UnsignedByte332:
+        case ColorType::UnsignedByte233Rev:
+        #endif
+        case ColorType::UnsignedShort565:
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorType::UnsignedShort565Rev:
+        #endif
+        case ColorType::UnsignedShort4444:
+        case ColorType::UnsignedShort4444Rev:
+        case ColorType::UnsignedShort5551:
+        case ColorType::UnsignedShort1555Rev:
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorType::UnsignedInt8888:
+        case ColorType::UnsignedInt8888Rev:
+        case ColorType::UnsignedInt1010102:
+        #endif
+        case ColorType::UnsignedInt2101010Rev:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::UnsignedInt10F11F11FRev:
+        case ColorType::UnsignedInt5999Rev:
+        #endif
+        case ColorType::UnsignedInt248:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Float32UnsignedInt248Rev:
+        #endif
+            packed = true;
+            break;
+
+        default: return false;
+    }
+
+    switch(format) {
+        case ColorFormat::Red:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorFormat::RedInteger:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::Green:
+        case ColorFormat::Blue:
+        case ColorFormat::GreenInteger:
+        case ColorFormat::BlueInteger:
+        #endif
+        #ifdef MAGNUM_TARGET_GLES2
+        case ColorFormat::Luminance:
+        #endif
+        case ColorFormat::DepthComponent:
+        case ColorFormat::StencilIndex:
+        case ColorFormat::RG:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorFormat::RGInteger:
+        #endif
+        #ifdef MAGNUM_TARGET_GLES2
+        case ColorFormat::LuminanceAlpha:
+        #endif
+        case ColorFormat::RGB:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorFormat::RGBInteger:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::BGR:
+        case ColorFormat::BGRInteger:
+        #endif
+        case ColorFormat::RGBA:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorFormat::RGBAInteger:
+        #endif
+        case ColorFormat::BGRA:
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::BGRAInteger:
+        #endif
+            return true;
+
+        /* Only packed depth/stencil types are allowed */
+        case ColorFormat::DepthStencil:
+            return packed;
+    }
+
+    return false;
+}
+
+std::optional<ImageData2D> decodeImage2D(EntryReader& in, const EntryHeader& header) {
+    const ColorFormat format = ColorFormat(header.fields[0]);
+    const ColorType type = ColorType(header.fields[1]);
+    if(!isKnownPixelFormat(format, type)) return std::nullopt;
+
+    const Vector2i size(header.fields[2], header.fields[3]);
+    const std::size_t dataSize = in.remaining();
+    ImageData2D image(format, type, size, new unsigned char[dataSize]);
+    if(image.dataSize(size) != dataSize || !in.read(image.data(), dataSize))
+        return std::nullopt;
+    return std::move(image);
+}
+
+Containers::Array<unsigned char> encodeImage2D(const ImageData2D& image) {
+    const std::size_t dataSize = image.dataSize(image.size());
+    Containers::Array<unsigned char> out(sizeof(EntryHeader) + dataSize);
+    EntryHeader header = entryHeader(EntryType::Image2D, out.size());
+    header.fields[0] = UnsignedInt(image.format());
+    header.fields[1] = UnsignedInt(image.type());
+    header.fields[2] = image.size().x();
+    header.fields[3] = image.size().y();
+    std::memcpy(out.begin(), &header, sizeof(EntryHeader));
+    std::memcpy(out.begin() + sizeof(EntryHeader), image.data(), dataSize);
+    return out;
+}
+
+std::optional<MeshData3D> decodeMesh3D(EntryReader& in, const EntryHeader& header) {
+    std::vector<UnsignedInt> sizes;
+    std::vector<UnsignedInt> indices;
+    if(!in.readArray(std::size_t(header.fields[2]) + header.fields[3] + header.fields[4], sizes) || !in.readArray(header.fields[1], indices))
+        return std::nullopt;
+
+    std::vector<std::vector<Vector3>> positions(header.fields[2]);
+    std::vector<std::vector<Vector3>> normals(header.fields[3]);
+    std::vector<std::vector<Vector2>> textureCoords2D(header.fields[4]);
+    auto size = sizes.begin();
+    for(std::vector<Vector3>& array: positions)
+        if(!in.readArray(*size++, array)) return std::nullopt;
+    for(std::vector<Vector3>& array: normals)
+        if(!in.readArray(*size++, array)) return std::nullopt;
+    for(std::vector<Vector2>& array: textureCoords2D)
+        if(!in.readArray(*size++, array)) return std::nullopt;
+
+    return MeshData3D(MeshPrimitive(header.fields[0]), std::move(indices), std::move(positions), std::move(normals), std::move(textureCoords2D));
+}
+
+Containers::Array<unsigned char> encodeMesh3D(const MeshData3D& mesh) {
+    const std::vector<UnsignedInt> noIndices;
+    const std::vector<UnsignedInt>& indices = mesh.isIndexed() ? mesh.indices() : noIndices;
+
+    /* Calculate output size */
+    std::vector<UnsignedInt> sizes;
+    std::size_t size = align(indices.size()*sizeof(UnsignedInt));
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i) {
+        sizes.push_back(mesh.positions(i).size());
+        size += align(mesh.positions(i).size()*sizeof(Vector3));
+    }
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i) {
+        sizes.push_back(mesh.normals(i).size());
+        size += align(mesh.normals(i).size()*sizeof(Vector3));
+    }
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i) {
+        sizes.push_back(mesh.textureCoords2D(i).size());
+        size += align(mesh.textureCoords2D(i).size()*sizeof(Vector2));
+    }
+    const std::size_t dataOffset = align(sizeof(EntryHeader) + sizes.size()*sizeof(UnsignedInt));
+
+    Containers::Array<unsigned char> out(dataOffset + size);
+    std::fill(out.begin(), out.end(), 0);
+    EntryHeader header = entryHeader(EntryType::Mesh3D, out.size());
+    header.fields[0] = UnsignedInt(mesh.primitive());
+    header.fields[1] = indices.size();
+    header.fields[2] = mesh.positionArrayCount();
+    header.fields[3] = mesh.normalArrayCount();
+    header.fields[4] = mesh.textureCoords2DArrayCount();
+    std::memcpy(out.begin(), &header, sizeof(EntryHeader));
+    writeArray(out, sizeof(EntryHeader), sizes);
+
+    std::size_t offset = writeArray(out, dataOffset, indices);
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        offset = writeArray(out, offset, mesh.positions(i));
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+        offset = writeArray(out, offset, mesh.normals(i));
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        offset = writeArray(out, offset, mesh.textureCoords2D(i));
+    CORRADE_INTERNAL_ASSERT(offset == out.size());
+
+    return out;
+}
+
+/* Hash of the key, with two different seeds so the name has at least 64
+   bits also on 32-bit platforms */
+std::string entryName(const std::string& key) {
+    std::ostringstream out;
+    out << std::hex;
+    for(std::size_t seed: {0, 1}) {
+        out.width(sizeof(std::size_t)*2);
+        out.fill('0');
+        out << *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2(seed)(key).byteArray());
+    }
+    return out.str();
+}
+
+}
+
+ImporterCache::ImporterCache(std::string directory, const std::size_t maxSize): _directory(std::move(directory)), _maxSize(maxSize), _size(0), _useCounter(0), _hitCount(0), _missCount(0) {
+    Utility::Directory::mkpath(_directory);
+
+    /* Load usage information, each line has entry name, size and last use.
+       Entries whose file is missing are dropped. */
+    {
+        std::ifstream in(Utility::Directory::join(_directory, "index.txt"));
+        std::string name;
+        Entry entry;
+        while(in >> name >> entry.size >> entry.lastUse) {
+            if(!Utility::Directory::fileExists(entryFilename(name))) continue;
+            _entries.emplace(name, entry);
+            _size += entry.size;
+            _useCounter = std::max(_useCounter, entry.lastUse);
+        }
+    }
+
+    /* Remove entry files which are not in the index, e.g. if the application
+       crashed between writing the entry and the index. These would be never
+       evicted otherwise. */
+    for(const std::string& file: Utility::Directory::list(_directory, Utility::Directory::Flag::SkipDirectories|Utility::Directory::Flag::SkipDotAndDotDot)) {
+        if(file.size() <= 4 || file.compare(file.size() - 4, 4, ".bin") != 0) continue;
+        if(_entries.find(file.substr(0, file.size() - 4)) == _entries.end())
+            Utility::Directory::rm(Utility::Directory::join(_directory, file));
+    }
+
+    evict();
+    save();
+}
+
+ImporterCache::~ImporterCache() { save(); }
+
+ImporterCache& ImporterCache::setMaxSize(const std::size_t size) {
+    _maxSize = size;
+    if(_size > _maxSize) {
+        evict();
+        save();
+    }
+    return *this;
+}
+
+bool ImporterCache::save() {
+    std::ofstream out(Utility::Directory::join(_directory, "index.txt"), std::ios::trunc);
+    if(!out.good()) {
+        Error() << "Trade::ImporterCache::save(): cannot write index file in" << _directory;
+        return false;
+    }
+
+    for(const auto& entry: _entries)
+        out << entry.first << ' ' << entry.second.size << ' ' << entry.second.lastUse << '\n';
+    return out.good();
+}
+
+void ImporterCache::clear() {
+    for(const auto& entry: _entries)
+        Utility::Directory::rm(entryFilename(entry.first));
+    _entries.clear();
+    _size = 0;
+    save();
+}
+
+std::string ImporterCache::entryFilename(const std::string& name) const {
+    return Utility::Directory::join(_directory, name + ".bin");
+}
+
+template<class T, class Decoder> std::optional<T> ImporterCache::load(const std::string& key, const UnsignedByte type, Decoder decode) {
+    const std::string name = entryName(key);
+    const auto found = _entries.find(name);
+    if(found == _entries.end()) {
+        ++_missCount;
+        return std::nullopt;
+    }
+
+    /* Verify the header, remove the entry if it's not usable. The data are
+       read directly into the output, as they need to be copied out of the
+       file anyway. */
+    std::optional<T> out;
+    {
+        EntryReader in(entryFilename(name));
+        EntryHeader header;
+        if(in.read(&header, sizeof(EntryHeader)) && std::memcmp(header.magic, "MGNC", 4) == 0 && header.version == EntryVersion && header.byteOrder == EntryByteOrder && header.size == in.size() && header.type == type)
+            out = decode(in, header);
+    }
+
+    if(!out) {
+        remove(name);
+        save();
+        ++_missCount;
+        return std::nullopt;
+    }
+
+    found->second.lastUse = ++_useCounter;
+    ++_hitCount;
+    return out;
+}
+
+bool ImporterCache::store(const std::string& key, const Containers::ArrayReference<const unsigned char> data) {
+    const std::string name = entryName(key);
+    if(_entries.find(name) != _entries.end()) remove(name);
+
+    if(!Utility::Directory::write(entryFilename(name), data)) {
+        Error() << "Trade::ImporterCache: cannot write entry" << entryFilename(name);
+        return false;
+    }
+
+    _entries.emplace(name, Entry{data.size(), ++_useCounter});
+    _size += data.size();
+    evict();
+    return save();
+}
+
+void ImporterCache::remove(const std::string& name) {
+    const auto found = _entries.find(name);
+    Utility::Directory::rm(entryFilename(name));
+    _size -= found->second.size;
+    _entries.erase(found);
+}
+
+void ImporterCache::evict() {
+    if(_size <= _maxSize) return;
+
+    /* Remove least recently used entries until the size fits */
+    std::vector<std::pair<std::size_t, std::string>> entries;
+    entries.reserve(_entries.size());
+    for(const auto& entry: _entries)
+        entries.emplace_back(entry.second.lastUse, entry.first);
+    std::sort(entries.begin(), entries.end());
+    for(auto it = entries.begin(); it != entries.end() && _size > _maxSize; ++it)
+        remove(it->second);
+}
+
+Containers::Array<unsigned char> ImporterCache::data(const std::string& key) {
+    std::optional<Containers::Array<unsigned char>> data = load<Containers::Array<unsigned char>>(key, UnsignedByte(EntryType::Data), decodeData);
+    return data ? std::move(*data) : nullptr;
+}
+
+bool ImporterCache::setData(const std::string& key, const Containers::ArrayReference<const unsigned char> data) {
+    return store(key, encodeData(data));
+}
+
+std::optional<ImageData2D> ImporterCache::image2D(const std::string& key) {
+    return load<ImageData2D>(key, UnsignedByte(EntryType::Image2D), decodeImage2D);
+}
+
+bool ImporterCache::setImage2D(const std::string& key, const ImageData2D& image) {
+    return store(key, encodeImage2D(image));
+}
+
+std::optional<MeshData3D> ImporterCache::mesh3D(const std::string& key) {
+    return load<MeshData3D>(key, UnsignedByte(EntryType::Mesh3D), decodeMesh3D);
+}
+
+bool ImporterCache::setMesh3D(const std::string& key, const MeshData3D& mesh) {
+    return store(key, encodeMesh3D(mesh));
+}
+
+}}
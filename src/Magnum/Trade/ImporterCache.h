@@ -0,0 +1,209 @@
+#ifndef Magnum_Trade_ImporterCache_h
+#define Magnum_Trade_ImporterCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ImporterCache
+ */
+
+#include <string>
+#include <unordered_map>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Trade/Trade.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Persistent cache of imported data
+
+Stores imported images and meshes in a directory on disk, so repeated
+imports of the same data can skip the decoding. See @ref CachedImporter for
+a drop-in importer using the cache.
+
+Each entry is stored in a separate file named after hash of its key. The
+data are stored in machine byte order with all arrays aligned to 16 bytes,
+so loading the entry is just a matter of reading the arrays directly into
+the output. Entries of different byte order or format version are treated
+as missing.
+
+If total size of all entries exceeds @ref maxSize(), least recently used
+entries are removed. Usage information is kept in `index.txt` file in the
+cache directory. It is written each time an entry is added or removed, order
+of recent uses is written on @ref save() and on destruction. On construction,
+index entries without a file are dropped and entry files which are not in the
+index are removed.
+
+The class is not thread-safe.
+*/
+class MAGNUM_EXPORT ImporterCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param directory     Cache directory. Created if it doesn't exist.
+         * @param maxSize       Max total size of all entries in bytes
+         */
+        explicit ImporterCache(std::string directory, std::size_t maxSize);
+
+        /** @brief Copying is not allowed */
+        ImporterCache(const ImporterCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImporterCache(ImporterCache&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref save().
+         */
+        ~ImporterCache();
+
+        /** @brief Copying is not allowed */
+        ImporterCache& operator=(const ImporterCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImporterCache& operator=(ImporterCache&&) = delete;
+
+        /** @brief Cache directory */
+        const std::string& directory() const { return _directory; }
+
+        /** @brief Max total size of all entries in bytes */
+        std::size_t maxSize() const { return _maxSize; }
+
+        /**
+         * @brief Set max total size of all entries
+         * @return Reference to self (for method chaining)
+         *
+         * Least recently used entries are removed if the current size
+         * exceeds the new value.
+         */
+        ImporterCache& setMaxSize(std::size_t size);
+
+        /** @brief Total size of all entries in bytes */
+        std::size_t size() const { return _size; }
+
+        /** @brief Entry count */
+        std::size_t entryCount() const { return _entries.size(); }
+
+        /**
+         * @brief Hit count
+         *
+         * Count of lookups which found the entry since the cache was
+         * created.
+         * @see @ref missCount()
+         */
+        std::size_t hitCount() const { return _hitCount; }
+
+        /**
+         * @brief Miss count
+         *
+         * Count of lookups which didn't find the entry since the cache was
+         * created.
+         * @see @ref hitCount()
+         */
+        std::size_t missCount() const { return _missCount; }
+
+        /**
+         * @brief Save usage information
+         *
+         * Returns `false` if the index file cannot be written.
+         */
+        bool save();
+
+        /** @brief Remove all entries */
+        void clear();
+
+        /**
+         * @brief Raw data
+         *
+         * Returns `nullptr` if no data are stored under given key.
+         * @see @ref setData()
+         */
+        Containers::Array<unsigned char> data(const std::string& key);
+
+        /**
+         * @brief Store raw data
+         *
+         * Returns `false` if the entry cannot be written.
+         * @see @ref data()
+         */
+        bool setData(const std::string& key, Containers::ArrayReference<const unsigned char> data);
+
+        /**
+         * @brief Two-dimensional image
+         *
+         * Returns `std::nullopt` if no image is stored under given key.
+         * @see @ref setImage2D()
+         */
+        std::optional<ImageData2D> image2D(const std::string& key);
+
+        /**
+         * @brief Store two-dimensional image
+         *
+         * Returns `false` if the entry cannot be written.
+         * @see @ref image2D()
+         */
+        bool setImage2D(const std::string& key, const ImageData2D& image);
+
+        /**
+         * @brief Three-dimensional mesh
+         *
+         * Returns `std::nullopt` if no mesh is stored under given key.
+         * @see @ref setMesh3D()
+         */
+        std::optional<MeshData3D> mesh3D(const std::string& key);
+
+        /**
+         * @brief Store three-dimensional mesh
+         *
+         * Returns `false` if the entry cannot be written.
+         * @see @ref mesh3D()
+         */
+        bool setMesh3D(const std::string& key, const MeshData3D& mesh);
+
+    private:
+        struct Entry {
+            std::size_t size;
+            std::size_t lastUse;
+        };
+
+        MAGNUM_LOCAL std::string entryFilename(const std::string& name) const;
+        template<class T, class Decoder> MAGNUM_LOCAL std::optional<T> load(const std::string& key, UnsignedByte type, Decoder decode);
+        MAGNUM_LOCAL bool store(const std::string& key, Containers::ArrayReference<const unsigned char> data);
+        MAGNUM_LOCAL void remove(const std::string& name);
+        MAGNUM_LOCAL void evict();
+
+        std::string _directory;
+        std::size_t _maxSize, _size, _useCounter, _hitCount, _missCount;
+        std::unordered_map<std::string, Entry> _entries;
+};
+
+}}
+
+#endif
@@ -38,10 +38,12 @@ class AbstractImporterTest: public TestSuite::Tester {
         explicit AbstractImporterTest();
 
         void openFile();
+        void openFileMapped();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::openFileMapped});
 }
 
 void AbstractImporterTest::openFile() {
@@ -68,6 +70,43 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+void AbstractImporterTest::openFileMapped() {
+    class DataImporter: public Trade::AbstractImporter {
+        public:
+            explicit DataImporter(): persistent(false) {}
+
+            Containers::ArrayReference<const unsigned char> data;
+            bool persistent;
+
+        private:
+            Features doFeatures() const override { return Feature::OpenData; }
+            bool doIsOpened() const override { return data; }
+            void doClose() override { data = nullptr; }
+
+            void doOpenData(Containers::ArrayReference<const unsigned char> data) override {
+                this->data = data;
+                persistent = isDataPersistent();
+            }
+    };
+
+    /* Data from doOpenFile() should stay valid until the file is closed */
+    DataImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.persistent);
+    CORRADE_COMPARE(importer.data.size(), 1);
+    CORRADE_COMPARE(importer.data[0], 0xa5);
+
+    /* Data passed to openData() are not persistent */
+    const unsigned char data[] = { 0xa5 };
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_VERIFY(!importer.persistent);
+
+    /* Data passed to openPersistentData() are */
+    CORRADE_VERIFY(importer.openPersistentData(data));
+    CORRADE_VERIFY(importer.persistent);
+    CORRADE_VERIFY(importer.data.data() == data);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractImporterTest)
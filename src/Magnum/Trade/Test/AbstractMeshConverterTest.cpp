@@ -0,0 +1,124 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/FileToString.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractMeshConverter.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class AbstractMeshConverterTest: public TestSuite::Tester {
+    public:
+        explicit AbstractMeshConverterTest();
+
+        void exportToFile2D();
+        void exportToFile3D();
+        void exportNotSupported();
+};
+
+AbstractMeshConverterTest::AbstractMeshConverterTest() {
+    addTests({&AbstractMeshConverterTest::exportToFile2D,
+              &AbstractMeshConverterTest::exportToFile3D,
+              &AbstractMeshConverterTest::exportNotSupported});
+}
+
+namespace {
+    class DataExporter: public Trade::AbstractMeshConverter {
+        private:
+            Features doFeatures() const override { return Feature::ConvertData2D|Feature::ConvertData3D; }
+
+            Containers::Array<unsigned char> doExportToData(const MeshData2D& mesh) const override {
+                Containers::Array<unsigned char> out(2);
+                out[0] = static_cast<unsigned char>(mesh.indices().size());
+                out[1] = static_cast<unsigned char>(mesh.positions(0).size());
+                return out;
+            }
+
+            Containers::Array<unsigned char> doExportToData(const MeshData3D& mesh) const override {
+                Containers::Array<unsigned char> out(3);
+                out[0] = static_cast<unsigned char>(mesh.indices().size());
+                out[1] = static_cast<unsigned char>(mesh.positions(0).size());
+                out[2] = static_cast<unsigned char>(mesh.normalArrayCount());
+                return out;
+            }
+    };
+}
+
+void AbstractMeshConverterTest::exportToFile2D() {
+    /* Remove previous file */
+    Utility::Directory::rm(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh2D.out"));
+
+    /* doExportToFile() should call doExportToData() */
+    DataExporter exporter;
+    const MeshData2D mesh(MeshPrimitive::Triangles, {0, 1, 2, 2}, {{{}, {}, {}}}, {});
+    CORRADE_VERIFY(exporter.exportToFile(mesh, Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh2D.out")));
+    CORRADE_COMPARE_AS(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh2D.out"),
+        "\x04\x03", TestSuite::Compare::FileToString);
+}
+
+void AbstractMeshConverterTest::exportToFile3D() {
+    /* Remove previous file */
+    Utility::Directory::rm(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh3D.out"));
+
+    /* doExportToFile() should call doExportToData() */
+    DataExporter exporter;
+    const MeshData3D mesh(MeshPrimitive::Triangles, {0, 1, 2}, {{{}, {}}}, {{}, {}}, {});
+    CORRADE_VERIFY(exporter.exportToFile(mesh, Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh3D.out")));
+    CORRADE_COMPARE_AS(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "mesh3D.out"),
+        "\x03\x02\x02", TestSuite::Compare::FileToString);
+}
+
+void AbstractMeshConverterTest::exportNotSupported() {
+    class Exporter3D: public Trade::AbstractMeshConverter {
+        private:
+            Features doFeatures() const override { return Feature::ConvertData3D; }
+
+            Containers::Array<unsigned char> doExportToData(const MeshData3D&) const override {
+                return Containers::Array<unsigned char>(1);
+            }
+    };
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Exporter3D exporter;
+    const MeshData2D mesh(MeshPrimitive::Triangles, {}, {{}}, {});
+    CORRADE_VERIFY(!exporter.exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractMeshConverter::exportToData(): feature not supported\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractMeshConverterTest)
@@ -0,0 +1,304 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AsyncImporter.h"
+#include "Magnum/Trade/MeshData2D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class AsyncImporterTest: public TestSuite::Tester {
+    public:
+        explicit AsyncImporterTest();
+
+        void future();
+        void callback();
+        void failed();
+        void priority();
+        void cancel();
+        void cancelOnDestruction();
+        void serialized();
+        void parallel();
+};
+
+AsyncImporterTest::AsyncImporterTest() {
+    addTests({&AsyncImporterTest::future,
+              &AsyncImporterTest::callback,
+              &AsyncImporterTest::failed,
+              &AsyncImporterTest::priority,
+              &AsyncImporterTest::cancel,
+              &AsyncImporterTest::cancelOnDestruction,
+              &AsyncImporterTest::serialized,
+              &AsyncImporterTest::parallel});
+}
+
+namespace {
+
+/* Importer returning one-vertex meshes with position equal to mesh ID. Mesh
+   import blocks while the gate is closed and the order of imports and
+   maximal count of concurrent imports is recorded. */
+class Importer: public AbstractImporter {
+    public:
+        explicit Importer(bool threadSafe = false): threadSafe(threadSafe), open(true), blocked(0), running(0), maxRunning(0) {}
+
+        void closeGate() {
+            std::lock_guard<std::mutex> lock(mutex);
+            open = false;
+        }
+
+        void openGate() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                open = true;
+            }
+            gate.notify_all();
+        }
+
+        /* Waits until given count of imports is blocked by the gate */
+        void waitForBlocked(const UnsignedInt count) {
+            std::unique_lock<std::mutex> lock(mutex);
+            gate.wait(lock, [this, count]() { return blocked == count; });
+        }
+
+        bool threadSafe;
+        std::mutex mutex;
+        std::condition_variable gate;
+        bool open;
+        UnsignedInt blocked;
+        std::vector<UnsignedInt> order;
+        std::atomic<UnsignedInt> running, maxRunning;
+
+    private:
+        Features doFeatures() const override {
+            return threadSafe ? Feature::ThreadSafe : Features();
+        }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMesh2DCount() const override { return 128; }
+        std::optional<MeshData2D> doMesh2D(UnsignedInt id) override {
+            const UnsignedInt current = ++running;
+            UnsignedInt max = maxRunning;
+            while(current > max && !maxRunning.compare_exchange_weak(max, current)) {}
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                order.push_back(id);
+                if(!open) {
+                    ++blocked;
+                    gate.notify_all();
+                    gate.wait(lock, [this]() { return open; });
+                    --blocked;
+                }
+            }
+
+            --running;
+
+            /* Odd IDs fail */
+            if(id % 2) return std::nullopt;
+            return MeshData2D(MeshPrimitive::Points, {}, {{Vector2(Float(id))}}, {});
+        }
+};
+
+}
+
+void AsyncImporterTest::future() {
+    Importer importer;
+    AsyncImporter async(importer);
+
+    AsyncResult<std::optional<MeshData2D>> result = async.mesh2D(42);
+    CORRADE_VERIFY(result);
+
+    std::optional<MeshData2D> mesh = result.get();
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->positions(0), std::vector<Vector2>{Vector2(42.0f)});
+
+    async.wait();
+    CORRADE_VERIFY(result.status() == AsyncTask::Status::Finished);
+}
+
+void AsyncImporterTest::callback() {
+    Importer importer;
+
+    std::vector<Vector2> positions;
+    {
+        AsyncImporter async(importer);
+        AsyncTask task = async.mesh2D(16, [&positions](std::optional<MeshData2D> mesh) {
+            CORRADE_INTERNAL_ASSERT(mesh);
+            positions = mesh->positions(0);
+        });
+        CORRADE_VERIFY(task);
+
+        async.wait();
+        CORRADE_VERIFY(task.status() == AsyncTask::Status::Finished);
+    }
+
+    CORRADE_COMPARE(positions, std::vector<Vector2>{Vector2(16.0f)});
+}
+
+void AsyncImporterTest::failed() {
+    Importer importer;
+    AsyncImporter async(importer);
+
+    CORRADE_VERIFY(!async.mesh2D(17).get());
+}
+
+void AsyncImporterTest::priority() {
+    Importer importer;
+    AsyncImporter async(importer);
+    CORRADE_COMPARE(async.threadCount(), 1);
+
+    /* Block the only worker thread, then submit tasks of various priorities */
+    importer.closeGate();
+    async.mesh2D(0);
+    importer.waitForBlocked(1);
+    async.mesh2D(1, AsyncPriority::Low);
+    async.mesh2D(2);
+    async.mesh2D(3, AsyncPriority::High);
+    async.mesh2D(4, AsyncPriority::Low);
+    async.mesh2D(5, AsyncPriority::High);
+    async.mesh2D(6);
+    importer.openGate();
+    async.wait();
+
+    /* Same priorities are executed in order of submission */
+    CORRADE_COMPARE(importer.order, (std::vector<UnsignedInt>{0, 3, 5, 2, 6, 1, 4}));
+}
+
+void AsyncImporterTest::cancel() {
+    Importer importer;
+    AsyncImporter async(importer);
+
+    importer.closeGate();
+    AsyncResult<std::optional<MeshData2D>> running = async.mesh2D(0);
+    importer.waitForBlocked(1);
+    AsyncResult<std::optional<MeshData2D>> cancelled = async.mesh2D(2);
+    bool called = false;
+    AsyncTask cancelledCallback = async.mesh2D(4, [&called](std::optional<MeshData2D>) {
+        called = true;
+    });
+    AsyncResult<std::optional<MeshData2D>> pending = async.mesh2D(6);
+
+    /* Running task can't be cancelled */
+    CORRADE_VERIFY(running.status() == AsyncTask::Status::Running);
+    CORRADE_VERIFY(!running.cancel());
+
+    /* Result of cancelled task is available immediately */
+    CORRADE_VERIFY(cancelled.cancel());
+    CORRADE_VERIFY(cancelled.status() == AsyncTask::Status::Cancelled);
+    CORRADE_VERIFY(cancelled.isReady());
+    CORRADE_VERIFY(!cancelled.get());
+    CORRADE_VERIFY(!cancelled.cancel());
+
+    CORRADE_VERIFY(cancelledCallback.cancel());
+
+    importer.openGate();
+    async.wait();
+
+    /* The cancelled tasks were not executed at all */
+    CORRADE_VERIFY(running.get());
+    CORRADE_VERIFY(pending.get());
+    CORRADE_VERIFY(!called);
+    CORRADE_COMPARE(importer.order, (std::vector<UnsignedInt>{0, 6}));
+}
+
+void AsyncImporterTest::cancelOnDestruction() {
+    Importer importer;
+    AsyncResult<std::optional<MeshData2D>> running, pending;
+    std::thread thread;
+    {
+        AsyncImporter async(importer);
+        importer.closeGate();
+        running = async.mesh2D(0);
+        importer.waitForBlocked(1);
+        pending = async.mesh2D(2);
+
+        /* Open the gate from another thread a bit later, as the destructor
+           waits for the running task */
+        thread = std::thread([&importer]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            importer.openGate();
+        });
+    }
+    thread.join();
+
+    CORRADE_VERIFY(running.status() == AsyncTask::Status::Finished);
+    CORRADE_VERIFY(pending.status() == AsyncTask::Status::Cancelled);
+    CORRADE_VERIFY(running.get());
+    CORRADE_VERIFY(!pending.get());
+    CORRADE_COMPARE(importer.order, std::vector<UnsignedInt>{0});
+}
+
+void AsyncImporterTest::serialized() {
+    /* Stateful importer should use only one thread */
+    Importer importer;
+    AsyncImporter async(importer, 4);
+    CORRADE_COMPARE(async.threadCount(), 1);
+
+    std::vector<AsyncResult<std::optional<MeshData2D>>> results;
+    for(UnsignedInt i = 0; i != 64; ++i) results.push_back(async.mesh2D(i*2));
+    async.wait();
+
+    for(UnsignedInt i = 0; i != 64; ++i) {
+        std::optional<MeshData2D> mesh = results[i].get();
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->positions(0)[0], Vector2(Float(i*2)));
+    }
+    CORRADE_COMPARE(importer.maxRunning.load(), 1);
+}
+
+void AsyncImporterTest::parallel() {
+    Importer importer{true};
+    AsyncImporter async(importer, 4);
+    CORRADE_COMPARE(async.threadCount(), 4);
+
+    /* All four threads should be able to import at once */
+    importer.closeGate();
+    std::vector<AsyncResult<std::optional<MeshData2D>>> results;
+    for(UnsignedInt i = 0; i != 4; ++i) results.push_back(async.mesh2D(i*2));
+    importer.waitForBlocked(4);
+    CORRADE_COMPARE(importer.maxRunning.load(), 4);
+    importer.openGate();
+
+    for(UnsignedInt i = 0; i != 4; ++i) {
+        std::optional<MeshData2D> mesh = results[i].get();
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->positions(0)[0], Vector2(Float(i*2)));
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AsyncImporterTest)
@@ -0,0 +1,226 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/CachedImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImporterCache.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class CachedImporterTest: public TestSuite::Tester {
+    public:
+        explicit CachedImporterTest();
+
+        void mesh3D();
+        void image2D();
+        void name();
+        void differentData();
+        void differentConfiguration();
+        void openFailed();
+
+    private:
+        std::string _directory;
+};
+
+CachedImporterTest::CachedImporterTest(): _directory(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "cachedimporter")) {
+    addTests({&CachedImporterTest::mesh3D,
+              &CachedImporterTest::image2D,
+              &CachedImporterTest::name,
+              &CachedImporterTest::differentData,
+              &CachedImporterTest::differentConfiguration,
+              &CachedImporterTest::openFailed});
+}
+
+namespace {
+
+/* Importer with one image and one mesh, both filled with first byte of the
+   data, counting how many times it was opened and imported. Data starting
+   with zero byte are invalid. */
+class Importer: public AbstractImporter {
+    public:
+        explicit Importer(): value(0), openCount(0), importCount(0) {}
+
+        UnsignedByte value;
+        Int openCount, importCount;
+
+    private:
+        Features doFeatures() const override { return Feature::OpenData; }
+        bool doIsOpened() const override { return value; }
+        void doClose() override { value = 0; }
+
+        void doOpenData(Containers::ArrayReference<const unsigned char> data) override {
+            ++openCount;
+            value = data[0];
+        }
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        std::optional<ImageData2D> doImage2D(UnsignedInt) override {
+            ++importCount;
+            return ImageData2D(ColorFormat::Red, ColorType::UnsignedByte, {4, 1}, new unsigned char[4]{value, value, value, value});
+        }
+
+        UnsignedInt doMesh3DCount() const override { return 1; }
+        std::string doMesh3DName(UnsignedInt) override { return "mesh"; }
+        Int doMesh3DForName(const std::string& name) override { return name == "mesh" ? 0 : -1; }
+        std::optional<MeshData3D> doMesh3D(UnsignedInt) override {
+            ++importCount;
+            return MeshData3D(MeshPrimitive::Points, {}, {{Vector3(value)}}, {}, {});
+        }
+};
+
+}
+
+void CachedImporterTest::mesh3D() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+    Importer importer;
+    const unsigned char data[]{42};
+
+    {
+        CachedImporter cachedImporter(importer, cache, {});
+        CORRADE_VERIFY(cachedImporter.openData(data));
+        CORRADE_COMPARE(cachedImporter.mesh3DCount(), 1);
+
+        std::optional<MeshData3D> mesh = cachedImporter.mesh3D(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{Vector3(42.0f)}));
+        CORRADE_COMPARE(importer.openCount, 1);
+        CORRADE_COMPARE(importer.importCount, 1);
+    }
+
+    /* Second import is served from the cache without opening the importer */
+    CachedImporter cachedImporter(importer, cache, {});
+    CORRADE_VERIFY(cachedImporter.openData(data));
+    CORRADE_COMPARE(cachedImporter.mesh3DCount(), 1);
+
+    std::optional<MeshData3D> mesh = cachedImporter.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{Vector3(42.0f)}));
+    CORRADE_COMPARE(importer.openCount, 1);
+    CORRADE_COMPARE(importer.importCount, 1);
+    CORRADE_COMPARE(cache.hitCount(), 2);
+}
+
+void CachedImporterTest::image2D() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+    Importer importer;
+    const unsigned char data[]{42};
+
+    CachedImporter cachedImporter(importer, cache, {});
+    for(Int i = 0; i != 2; ++i) {
+        CORRADE_VERIFY(cachedImporter.openData(data));
+        CORRADE_COMPARE(cachedImporter.image2DCount(), 1);
+
+        std::optional<ImageData2D> image = cachedImporter.image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->format(), ColorFormat::Red);
+        CORRADE_COMPARE(image->size(), Vector2i(4, 1));
+        CORRADE_COMPARE(image->data()[3], 42);
+    }
+
+    CORRADE_COMPARE(importer.openCount, 1);
+    CORRADE_COMPARE(importer.importCount, 1);
+}
+
+void CachedImporterTest::name() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+    Importer importer;
+    const unsigned char data[]{42};
+
+    CachedImporter cachedImporter(importer, cache, {});
+    CORRADE_VERIFY(cachedImporter.openData(data));
+    cachedImporter.close();
+    CORRADE_VERIFY(!importer.isOpened());
+
+    /* Names are not cached, the importer is opened lazily */
+    CORRADE_VERIFY(cachedImporter.openData(data));
+    CORRADE_COMPARE(importer.openCount, 1);
+    CORRADE_COMPARE(cachedImporter.mesh3DName(0), "mesh");
+    CORRADE_COMPARE(cachedImporter.mesh3DForName("mesh"), 0);
+    CORRADE_COMPARE(importer.openCount, 2);
+}
+
+void CachedImporterTest::differentData() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+    Importer importer;
+    const unsigned char a[]{42};
+    const unsigned char b[]{17};
+
+    CachedImporter cachedImporter(importer, cache, {});
+    CORRADE_VERIFY(cachedImporter.openData(a));
+    CORRADE_VERIFY(cachedImporter.mesh3D(0));
+    CORRADE_VERIFY(cachedImporter.openData(b));
+
+    std::optional<MeshData3D> mesh = cachedImporter.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{Vector3(17.0f)}));
+    CORRADE_COMPARE(importer.importCount, 2);
+}
+
+void CachedImporterTest::differentConfiguration() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+    Importer importer;
+    const unsigned char data[]{42};
+
+    {
+        CachedImporter cachedImporter(importer, cache, "a");
+        CORRADE_VERIFY(cachedImporter.openData(data));
+        CORRADE_VERIFY(cachedImporter.mesh3D(0));
+    }
+
+    CachedImporter cachedImporter(importer, cache, "b");
+    CORRADE_VERIFY(cachedImporter.openData(data));
+    CORRADE_VERIFY(cachedImporter.mesh3D(0));
+    CORRADE_COMPARE(importer.openCount, 2);
+    CORRADE_COMPARE(importer.importCount, 2);
+}
+
+void CachedImporterTest::openFailed() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+    Importer importer;
+    const unsigned char data[]{0};
+
+    CachedImporter cachedImporter(importer, cache, {});
+    CORRADE_VERIFY(!cachedImporter.openData(data));
+    CORRADE_COMPARE(cache.entryCount(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::CachedImporterTest)
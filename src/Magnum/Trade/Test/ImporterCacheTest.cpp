@@ -0,0 +1,291 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImporterCache.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class ImporterCacheTest: public TestSuite::Tester {
+    public:
+        explicit ImporterCacheTest();
+
+        void data();
+        void image2D();
+        void mesh3D();
+        void meshNotIndexed();
+        void wrongType();
+        void corrupted();
+        void unknownImageFormat();
+        void persistent();
+        void persistentWithoutSave();
+        void orphanedEntries();
+        void evict();
+        void clear();
+
+    private:
+        std::string _directory;
+};
+
+ImporterCacheTest::ImporterCacheTest(): _directory(Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "cache")) {
+    addTests({&ImporterCacheTest::data,
+              &ImporterCacheTest::image2D,
+              &ImporterCacheTest::mesh3D,
+              &ImporterCacheTest::meshNotIndexed,
+              &ImporterCacheTest::wrongType,
+              &ImporterCacheTest::corrupted,
+              &ImporterCacheTest::unknownImageFormat,
+              &ImporterCacheTest::persistent,
+              &ImporterCacheTest::persistentWithoutSave,
+              &ImporterCacheTest::orphanedEntries,
+              &ImporterCacheTest::evict,
+              &ImporterCacheTest::clear});
+}
+
+void ImporterCacheTest::data() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+
+    const unsigned char data[]{0xca, 0xfe, 0xba, 0xbe};
+    CORRADE_VERIFY(!cache.data("key"));
+    CORRADE_VERIFY(cache.setData("key", data));
+    CORRADE_COMPARE(cache.entryCount(), 1);
+    CORRADE_COMPARE(cache.size(), 48 + 4);
+
+    const Containers::Array<unsigned char> out = cache.data("key");
+    CORRADE_COMPARE(out.size(), 4);
+    CORRADE_COMPARE(out[0], 0xca);
+    CORRADE_COMPARE(out[3], 0xbe);
+    CORRADE_COMPARE(cache.hitCount(), 1);
+    CORRADE_COMPARE(cache.missCount(), 1);
+}
+
+void ImporterCacheTest::image2D() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+
+    unsigned char* pixels = new unsigned char[12]{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    CORRADE_VERIFY(cache.setImage2D("image", ImageData2D(ColorFormat::RGB, ColorType::UnsignedByte, {2, 2}, pixels)));
+
+    std::optional<ImageData2D> image = cache.image2D("image");
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 2));
+    CORRADE_COMPARE(image->data()[0], 1);
+    CORRADE_COMPARE(image->data()[11], 12);
+}
+
+void ImporterCacheTest::mesh3D() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+
+    CORRADE_VERIFY(cache.setMesh3D("mesh", MeshData3D(MeshPrimitive::Triangles,
+        {0, 1, 2, 2, 1, 0},
+        {{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}},
+         {{0.5f, 0.5f, 0.5f}}},
+        {{{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}}},
+        {{{0.5f, 0.25f}, {0.75f, 1.0f}, {0.0f, 0.0f}}})));
+
+    std::optional<MeshData3D> mesh = cache.mesh3D("mesh");
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 0}));
+    CORRADE_COMPARE(mesh->positionArrayCount(), 2);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}}));
+    CORRADE_COMPARE(mesh->positions(1), (std::vector<Vector3>{{0.5f, 0.5f, 0.5f}}));
+    CORRADE_COMPARE(mesh->normalArrayCount(), 1);
+    CORRADE_COMPARE(mesh->normals(0), (std::vector<Vector3>{{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}}));
+    CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(mesh->textureCoords2D(0), (std::vector<Vector2>{{0.5f, 0.25f}, {0.75f, 1.0f}, {0.0f, 0.0f}}));
+}
+
+void ImporterCacheTest::meshNotIndexed() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+
+    CORRADE_VERIFY(cache.setMesh3D("mesh", MeshData3D(MeshPrimitive::Points, {}, {{{1.0f, 2.0f, 3.0f}}}, {}, {})));
+
+    std::optional<MeshData3D> mesh = cache.mesh3D("mesh");
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!mesh->isIndexed());
+    CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{{1.0f, 2.0f, 3.0f}}));
+}
+
+void ImporterCacheTest::wrongType() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+
+    const unsigned char data[]{0xca, 0xfe};
+    CORRADE_VERIFY(cache.setData("key", data));
+
+    /* Entry of different type is treated as missing and removed */
+    CORRADE_VERIFY(!cache.mesh3D("key"));
+    CORRADE_COMPARE(cache.entryCount(), 0);
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_COMPARE(cache.missCount(), 1);
+}
+
+void ImporterCacheTest::corrupted() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+
+    CORRADE_VERIFY(cache.setMesh3D("mesh", MeshData3D(MeshPrimitive::Points, {}, {{{1.0f, 2.0f, 3.0f}}}, {}, {})));
+
+    /* Truncate all entry files */
+    for(const std::string& file: Utility::Directory::list(_directory, Utility::Directory::Flag::SkipDirectories|Utility::Directory::Flag::SkipDotAndDotDot))
+        if(file != "index.txt") Utility::Directory::write(Utility::Directory::join(_directory, file), Containers::ArrayReference<const unsigned char>{nullptr, 0});
+
+    CORRADE_VERIFY(!cache.mesh3D("mesh"));
+    CORRADE_COMPARE(cache.entryCount(), 0);
+}
+
+void ImporterCacheTest::unknownImageFormat() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+
+    unsigned char* pixels = new unsigned char[4]{1, 2, 3, 4};
+    CORRADE_VERIFY(cache.setImage2D("image", ImageData2D(ColorFormat::RGBA, ColorType::UnsignedByte, {1, 1}, pixels)));
+
+    /* Patch the format field right after magic, version, type and byte
+       order to a value unknown to any build */
+    for(const std::string& file: Utility::Directory::list(_directory, Utility::Directory::Flag::SkipDirectories|Utility::Directory::Flag::SkipDotAndDotDot)) {
+        if(file == "index.txt") continue;
+        const std::string filename = Utility::Directory::join(_directory, file);
+        Containers::Array<unsigned char> data = Utility::Directory::read(filename);
+        CORRADE_VERIFY(data.size() > 12);
+        std::fill(data.begin() + 8, data.begin() + 12, 0xfe);
+        CORRADE_VERIFY(Utility::Directory::write(filename, data));
+    }
+
+    /* The entry is treated as missing and removed instead of asserting */
+    CORRADE_VERIFY(!cache.image2D("image"));
+    CORRADE_COMPARE(cache.entryCount(), 0);
+    CORRADE_COMPARE(cache.size(), 0);
+}
+
+void ImporterCacheTest::persistent() {
+    const unsigned char data[]{0xca, 0xfe};
+    {
+        ImporterCache cache(_directory, 1024*1024);
+        cache.clear();
+        CORRADE_VERIFY(cache.setData("key", data));
+    }
+
+    ImporterCache cache(_directory, 1024*1024);
+    CORRADE_COMPARE(cache.entryCount(), 1);
+    CORRADE_COMPARE(cache.size(), 48 + 2);
+    CORRADE_COMPARE(cache.data("key").size(), 2);
+    CORRADE_COMPARE(cache.hitCount(), 1);
+}
+
+void ImporterCacheTest::persistentWithoutSave() {
+    const unsigned char data[]{0xca, 0xfe};
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+    CORRADE_VERIFY(cache.setData("unsaved", data));
+
+    /* The index is written right after storing the entry, so it's visible
+       even if the first instance is never destroyed (e.g. on a crash) */
+    ImporterCache other(_directory, 1024*1024);
+    CORRADE_COMPARE(other.entryCount(), 1);
+    CORRADE_COMPARE(other.data("unsaved").size(), 2);
+}
+
+void ImporterCacheTest::orphanedEntries() {
+    const unsigned char data[]{0xca, 0xfe};
+    {
+        ImporterCache cache(_directory, 1024*1024);
+        cache.clear();
+        CORRADE_VERIFY(cache.setData("key", data));
+    }
+
+    /* Entry file which is not in the index and index entry without a file */
+    const std::string orphan = Utility::Directory::join(_directory, "0123456789abcdef.bin");
+    CORRADE_VERIFY(Utility::Directory::write(orphan, data));
+    for(const std::string& file: Utility::Directory::list(_directory, Utility::Directory::Flag::SkipDirectories|Utility::Directory::Flag::SkipDotAndDotDot))
+        if(file != "index.txt" && file != "0123456789abcdef.bin")
+            Utility::Directory::rm(Utility::Directory::join(_directory, file));
+
+    ImporterCache cache(_directory, 1024*1024);
+    CORRADE_VERIFY(!Utility::Directory::fileExists(orphan));
+    CORRADE_COMPARE(cache.entryCount(), 0);
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_VERIFY(!cache.data("key"));
+}
+
+void ImporterCacheTest::evict() {
+    ImporterCache cache(_directory, 1024*1024);
+    cache.clear();
+    cache.setMaxSize(3*(48 + 16));
+
+    const unsigned char data[16]{};
+    CORRADE_VERIFY(cache.setData("a", data));
+    CORRADE_VERIFY(cache.setData("b", data));
+    CORRADE_VERIFY(cache.setData("c", data));
+    CORRADE_COMPARE(cache.entryCount(), 3);
+
+    /* Use the first, so the second is least recently used and is evicted */
+    CORRADE_VERIFY(cache.data("a"));
+    CORRADE_VERIFY(cache.setData("d", data));
+    CORRADE_COMPARE(cache.entryCount(), 3);
+    CORRADE_COMPARE(cache.size(), 3*(48 + 16));
+    CORRADE_VERIFY(cache.data("a"));
+    CORRADE_VERIFY(!cache.data("b"));
+    CORRADE_VERIFY(cache.data("c"));
+    CORRADE_VERIFY(cache.data("d"));
+
+    /* Shrinking the cache evicts immediately */
+    cache.setMaxSize(48 + 16);
+    CORRADE_COMPARE(cache.entryCount(), 1);
+    CORRADE_VERIFY(cache.data("d"));
+}
+
+void ImporterCacheTest::clear() {
+    ImporterCache cache(_directory, 1024*1024);
+
+    const unsigned char data[]{0xca, 0xfe};
+    CORRADE_VERIFY(cache.setData("key", data));
+    cache.clear();
+    CORRADE_COMPARE(cache.entryCount(), 0);
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_VERIFY(!cache.data("key"));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ImporterCacheTest)
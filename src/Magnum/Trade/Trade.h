@@ -36,6 +36,12 @@ namespace Magnum { namespace Trade {
 class AbstractImageConverter;
 class AbstractImporter;
 class AbstractMaterialData;
+class AbstractMeshConverter;
+class AsyncImporter;
+enum class AsyncPriority: UnsignedByte;
+template<class> class AsyncResult;
+class AsyncTask;
+class CachedImporter;
 class CameraData;
 
 template<UnsignedInt> class ImageData;
@@ -43,6 +49,7 @@ typedef ImageData<1> ImageData1D;
 typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
+class ImporterCache;
 class LightData;
 class MeshData2D;
 class MeshData3D;
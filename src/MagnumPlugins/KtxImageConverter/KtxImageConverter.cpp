@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "KtxImageConverter.h"
+
+#include <cstring>
+#include <tuple>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/TextureTools/GenerateMipmaps.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+/* KTX 1.1 file header, stored in native endianness */
+struct KtxHeader {
+    UnsignedByte identifier[12];
+    UnsignedInt endianness;
+    UnsignedInt glType;
+    UnsignedInt glTypeSize;
+    UnsignedInt glFormat;
+    UnsignedInt glInternalFormat;
+    UnsignedInt glBaseInternalFormat;
+    UnsignedInt pixelWidth;
+    UnsignedInt pixelHeight;
+    UnsignedInt pixelDepth;
+    UnsignedInt numberOfArrayElements;
+    UnsignedInt numberOfFaces;
+    UnsignedInt numberOfMipmapLevels;
+    UnsignedInt bytesOfKeyValueData;
+};
+
+static_assert(sizeof(KtxHeader) == 64, "Improper size of KTX header");
+
+constexpr UnsignedByte KtxIdentifier[]{0xab, 'K', 'T', 'X', ' ', '1', '1', 0xbb, '\r', '\n', 0x1a, '\n'};
+
+/* Internal format and base internal format of given compressed format, the
+   values are the same on all GL flavors */
+std::pair<UnsignedInt, UnsignedInt> glFormats(const TextureTools::CompressedFormat format) {
+    switch(format) {
+        case TextureTools::CompressedFormat::Bc1: return {0x83f0, 0x1907};
+        case TextureTools::CompressedFormat::Bc3: return {0x83f3, 0x1908};
+        case TextureTools::CompressedFormat::Bc4: return {0x8dbb, 0x1903};
+        case TextureTools::CompressedFormat::Bc5: return {0x8dbd, 0x8227};
+        case TextureTools::CompressedFormat::Etc1: return {0x8d64, 0x1907};
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+TextureTools::CompressedFormat defaultFormat(const ColorFormat format) {
+    switch(format) {
+        case ColorFormat::Red:
+            return TextureTools::CompressedFormat::Bc4;
+        case ColorFormat::RG:
+            return TextureTools::CompressedFormat::Bc5;
+        case ColorFormat::RGBA:
+        case ColorFormat::BGRA:
+            return TextureTools::CompressedFormat::Bc3;
+        default:
+            return TextureTools::CompressedFormat::Bc1;
+    }
+}
+
+}
+
+KtxImageConverter::KtxImageConverter(): _quality(TextureTools::CompressionQuality::Normal), _mipmaps(false) {}
+
+KtxImageConverter::KtxImageConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImageConverter(manager, std::move(plugin)), _quality(TextureTools::CompressionQuality::Normal), _mipmaps(false) {}
+
+auto KtxImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
+
+Containers::Array<unsigned char> KtxImageConverter::doExportToData(const ImageReference2D& image) const {
+    if(!image.size().product()) {
+        Error() << "Trade::KtxImageConverter::convertToData(): empty image";
+        return nullptr;
+    }
+
+    const TextureTools::CompressedFormat format = _format ? *_format : defaultFormat(image.format());
+
+    /* Compress the base level and all generated levels */
+    std::vector<Containers::Array<unsigned char>> levels;
+    levels.push_back(TextureTools::compress(image, format, _quality));
+    if(!levels.back()) {
+        Error() << "Trade::KtxImageConverter::convertToData(): unsupported image format" << image.format() << "and type" << image.type();
+        return nullptr;
+    }
+    if(_mipmaps) for(const Trade::ImageData2D& level: TextureTools::generateMipmaps(image))
+        levels.push_back(TextureTools::compress(level, format, _quality));
+
+    /* Fill header */
+    KtxHeader header{};
+    std::memcpy(header.identifier, KtxIdentifier, sizeof(KtxIdentifier));
+    header.endianness = 0x04030201;
+    header.glTypeSize = 1;
+    std::tie(header.glInternalFormat, header.glBaseInternalFormat) = glFormats(format);
+    header.pixelWidth = image.size().x();
+    header.pixelHeight = image.size().y();
+    header.numberOfFaces = 1;
+    header.numberOfMipmapLevels = levels.size();
+
+    /* Blocks are multiples of four bytes, so no padding is needed */
+    std::size_t size = sizeof(KtxHeader);
+    for(const Containers::Array<unsigned char>& level: levels)
+        size += sizeof(UnsignedInt) + level.size();
+
+    Containers::Array<unsigned char> data(size);
+    std::memcpy(data.begin(), &header, sizeof(KtxHeader));
+
+    /* Fill data, each level prefixed with its size */
+    unsigned char* out = data.begin() + sizeof(KtxHeader);
+    for(const Containers::Array<unsigned char>& level: levels) {
+        const UnsignedInt levelSize = level.size();
+        std::memcpy(out, &levelSize, sizeof(UnsignedInt));
+        std::memcpy(out + sizeof(UnsignedInt), level.begin(), level.size());
+        out += sizeof(UnsignedInt) + level.size();
+    }
+
+    CORRADE_INTERNAL_ASSERT(out == data.end());
+    return std::move(data);
+}
+
+}}
@@ -0,0 +1,128 @@
+#ifndef Magnum_Trade_KtxImageConverter_h
+#define Magnum_Trade_KtxImageConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class Magnum::Trade::KtxImageConverter
+ */
+
+#include "Magnum/TextureTools/Compress.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BUILD_STATIC
+    #if defined(KtxImageConverter_EXPORTS) || defined(KtxImageConverterObjects_EXPORTS)
+        #define MAGNUM_TRADE_KTXIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_TRADE_KTXIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_TRADE_KTXIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_TRADE_KTXIMAGECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief KTX image converter plugin
+
+Compresses the image using @ref TextureTools::compress() and saves it into
+KTX 1.1 container, which can be uploaded directly to compressed texture
+without any processing at runtime. Supports all formats and types accepted by
+@ref TextureTools::convertFormat().
+
+This plugin is built if `WITH_KTXIMAGECONVERTER` is enabled when building
+%Magnum. To use dynamic plugin, you need to load `%KtxImageConverter` plugin
+from `MAGNUM_PLUGINS_IMAGECONVERTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `%KtxImageConverter`
+component of `%Magnum` package in CMake and link to
+`${MAGNUM_KTXIMAGECONVERTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+If no format is set using @ref setFormat(), it is chosen based on channel
+count of the image -- @ref TextureTools::CompressedFormat::Bc4 for
+@ref ColorFormat::Red, @ref TextureTools::CompressedFormat::Bc5 for
+@ref ColorFormat::RG, @ref TextureTools::CompressedFormat::Bc3 for formats
+with alpha and @ref TextureTools::CompressedFormat::Bc1 otherwise. If
+@ref setMipmaps() is enabled, the whole mip chain is generated using
+@ref TextureTools::generateMipmaps() and saved together with the image.
+*/
+class MAGNUM_TRADE_KTXIMAGECONVERTER_EXPORT KtxImageConverter: public AbstractImageConverter {
+    public:
+        /** @brief Default constructor */
+        explicit KtxImageConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit KtxImageConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        /**
+         * @brief Compressed format
+         *
+         * If no format was set, returns `std::nullopt`.
+         */
+        std::optional<TextureTools::CompressedFormat> format() const { return _format; }
+
+        /**
+         * @brief Set compressed format
+         *
+         * Chosen based on the image by default, see class documentation for
+         * more information.
+         */
+        void setFormat(TextureTools::CompressedFormat format) { _format = format; }
+
+        /** @brief Compression quality */
+        TextureTools::CompressionQuality quality() const { return _quality; }
+
+        /**
+         * @brief Set compression quality
+         *
+         * Default is @ref TextureTools::CompressionQuality::Normal.
+         */
+        void setQuality(TextureTools::CompressionQuality quality) { _quality = quality; }
+
+        /** @brief Whether mip levels are generated */
+        bool mipmaps() const { return _mipmaps; }
+
+        /**
+         * @brief Enable or disable mip level generation
+         *
+         * Disabled by default.
+         */
+        void setMipmaps(bool enabled) { _mipmaps = enabled; }
+
+    private:
+        Features MAGNUM_TRADE_KTXIMAGECONVERTER_LOCAL doFeatures() const override;
+        Containers::Array<unsigned char> MAGNUM_TRADE_KTXIMAGECONVERTER_LOCAL doExportToData(const ImageReference2D& image) const override;
+
+        std::optional<TextureTools::CompressedFormat> _format;
+        TextureTools::CompressionQuality _quality;
+        bool _mipmaps;
+};
+
+}}
+
+#endif
@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/KtxImageConverter/KtxImageConverter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class KtxImageConverterTest: public TestSuite::Tester {
+    public:
+        explicit KtxImageConverterTest();
+
+        void wrongType();
+        void empty();
+
+        void header();
+        void defaultFormat();
+        void mipmaps();
+        void roundTrip();
+};
+
+namespace {
+    UnsignedInt read(const Containers::Array<unsigned char>& data, const std::size_t offset) {
+        UnsignedInt value;
+        std::memcpy(&value, data + offset, sizeof(UnsignedInt));
+        return value;
+    }
+}
+
+KtxImageConverterTest::KtxImageConverterTest() {
+    addTests({&KtxImageConverterTest::wrongType,
+              &KtxImageConverterTest::empty,
+
+              &KtxImageConverterTest::header,
+              &KtxImageConverterTest::defaultFormat,
+              &KtxImageConverterTest::mipmaps,
+              &KtxImageConverterTest::roundTrip});
+}
+
+void KtxImageConverterTest::wrongType() {
+    const UnsignedInt data[16]{};
+    ImageReference2D image(ColorFormat::Red, ColorType::UnsignedInt, {4, 4}, data);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    CORRADE_VERIFY(!KtxImageConverter().exportToData(image));
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::convertFormat(): unsupported conversion from ColorFormat::Red ColorType::UnsignedInt to ColorFormat::RGBA ColorType::UnsignedByte\n"
+        "Trade::KtxImageConverter::convertToData(): unsupported image format ColorFormat::Red and type ColorType::UnsignedInt\n");
+}
+
+void KtxImageConverterTest::empty() {
+    ImageReference2D image(ColorFormat::RGB, ColorType::UnsignedByte, {}, nullptr);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    CORRADE_VERIFY(!KtxImageConverter().exportToData(image));
+    CORRADE_COMPARE(out.str(), "Trade::KtxImageConverter::convertToData(): empty image\n");
+}
+
+void KtxImageConverterTest::header() {
+    const UnsignedByte data[6*5*4]{};
+    const ImageReference2D image(ColorFormat::RGBA, ColorType::UnsignedByte, {6, 5}, data);
+
+    KtxImageConverter converter;
+    converter.setFormat(TextureTools::CompressedFormat::Etc1);
+    const Containers::Array<unsigned char> out = converter.exportToData(image);
+    CORRADE_COMPARE(out.size(), 64 + 4 + 2*2*8);
+
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(out.begin()), 12), std::string("\xabKTX 11\xbb\r\n\x1a\n", 12));
+    CORRADE_COMPARE(read(out, 12), 0x04030201);
+    CORRADE_COMPARE(read(out, 16), 0);
+    CORRADE_COMPARE(read(out, 20), 1);
+    CORRADE_COMPARE(read(out, 24), 0);
+    CORRADE_COMPARE(read(out, 28), 0x8d64);
+    CORRADE_COMPARE(read(out, 32), 0x1907);
+    CORRADE_COMPARE(read(out, 36), 6);
+    CORRADE_COMPARE(read(out, 40), 5);
+    CORRADE_COMPARE(read(out, 44), 0);
+    CORRADE_COMPARE(read(out, 48), 0);
+    CORRADE_COMPARE(read(out, 52), 1);
+    CORRADE_COMPARE(read(out, 56), 1);
+    CORRADE_COMPARE(read(out, 60), 0);
+    CORRADE_COMPARE(read(out, 64), 32);
+}
+
+void KtxImageConverterTest::defaultFormat() {
+    const UnsignedByte data[4*4*4]{};
+    const std::pair<ColorFormat, UnsignedInt> formats[]{
+        {ColorFormat::Red, 0x8dbb},
+        {ColorFormat::RG, 0x8dbd},
+        {ColorFormat::RGB, 0x83f0},
+        {ColorFormat::RGBA, 0x83f3}};
+    for(const auto& format: formats) {
+        const Containers::Array<unsigned char> out = KtxImageConverter().exportToData(ImageReference2D(format.first, ColorType::UnsignedByte, {4, 4}, data));
+        CORRADE_VERIFY(out);
+        CORRADE_COMPARE(read(out, 28), format.second);
+    }
+}
+
+void KtxImageConverterTest::mipmaps() {
+    const UnsignedByte data[16*8]{};
+    const ImageReference2D image(ColorFormat::Red, ColorType::UnsignedByte, {16, 8}, data);
+
+    KtxImageConverter converter;
+    converter.setMipmaps(true);
+    const Containers::Array<unsigned char> out = converter.exportToData(image);
+
+    /* 16x8, 8x4, 4x2, 2x1, 1x1 */
+    CORRADE_COMPARE(read(out, 56), 5);
+    CORRADE_COMPARE(out.size(), 64 + 5*4 + (8 + 2 + 1 + 1 + 1)*8);
+    CORRADE_COMPARE(read(out, 64), 8*8);
+    CORRADE_COMPARE(read(out, 64 + 4 + 8*8), 2*8);
+}
+
+void KtxImageConverterTest::roundTrip() {
+    UnsignedByte data[8*8*2];
+    for(std::size_t i = 0; i != 8*8; ++i) {
+        data[i*2 + 0] = 10 + (i%8)*30;
+        data[i*2 + 1] = 250 - (i/8)*20;
+    }
+    const ImageReference2D image(ColorFormat::RG, ColorType::UnsignedByte, {8, 8}, data);
+
+    KtxImageConverter converter;
+    converter.setQuality(TextureTools::CompressionQuality::High);
+    const Containers::Array<unsigned char> out = converter.exportToData(image);
+    CORRADE_VERIFY(out);
+
+    std::optional<Trade::ImageData2D> decompressed = TextureTools::decompress(Containers::ArrayReference<const unsigned char>(out + 68, out.size() - 68), TextureTools::CompressedFormat::Bc5, {8, 8});
+    CORRADE_VERIFY(decompressed);
+    CORRADE_VERIFY(TextureTools::psnr(*decompressed, image) > 35.0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::KtxImageConverterTest)
@@ -0,0 +1,124 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MagnumMeshConverter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+UnsignedLong align(const UnsignedLong offset) {
+    return (offset + MagnumMeshAlignment - 1)/MagnumMeshAlignment*MagnumMeshAlignment;
+}
+
+/* Places the array after given offset, returns offset after the array */
+template<class T> UnsignedLong placeArray(const std::vector<T>& data, const UnsignedLong offset, MagnumMeshArray& array) {
+    array.offset = offset;
+    array.size = data.size();
+    array.reserved = 0;
+    return align(offset + data.size()*sizeof(T));
+}
+
+template<class T> void copyArray(const std::vector<T>& data, const MagnumMeshArray& array, unsigned char* const out) {
+    if(!data.empty()) std::memcpy(out + array.offset, data.data(), data.size()*sizeof(T));
+}
+
+}
+
+MagnumMeshConverter::MagnumMeshConverter() = default;
+
+MagnumMeshConverter::MagnumMeshConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractMeshConverter(manager, std::move(plugin)) {}
+
+auto MagnumMeshConverter::doFeatures() const -> Features { return Feature::ConvertData3D; }
+
+Containers::Array<unsigned char> MagnumMeshConverter::doExportToData(const MeshData3D& mesh) const {
+    const std::vector<UnsignedInt> noIndices;
+    const std::vector<UnsignedInt>& indices = mesh.isIndexed() ? mesh.indices() : noIndices;
+
+    /* Check that all sizes fit into the header */
+    std::size_t maxSize = indices.size();
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        maxSize = std::max(maxSize, mesh.positions(i).size());
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+        maxSize = std::max(maxSize, mesh.normals(i).size());
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        maxSize = std::max(maxSize, mesh.textureCoords2D(i).size());
+    if(maxSize > std::numeric_limits<UnsignedInt>::max()) {
+        Error() << "Trade::MagnumMeshConverter::exportToData(): array with" << maxSize << "items is too large";
+        return nullptr;
+    }
+
+    MagnumMeshHeader header;
+    std::memcpy(header.magic, "MGNMESH", sizeof(header.magic));
+    header.version = MagnumMeshVersion;
+    header.byteOrder = MagnumMeshByteOrder;
+    header.primitive = UnsignedInt(mesh.primitive());
+    header.indexCount = indices.size();
+    header.positionArrayCount = mesh.positionArrayCount();
+    header.normalArrayCount = mesh.normalArrayCount();
+    header.textureCoords2DArrayCount = mesh.textureCoords2DArrayCount();
+
+    /* Lay out the data after the header and array table, each array aligned */
+    std::vector<MagnumMeshArray> arrays(header.positionArrayCount + header.normalArrayCount + header.textureCoords2DArrayCount);
+    UnsignedLong offset = align(sizeof(MagnumMeshHeader) + arrays.size()*sizeof(MagnumMeshArray));
+    header.indexOffset = offset;
+    offset = align(offset + indices.size()*sizeof(UnsignedInt));
+    std::size_t arrayId = 0;
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        offset = placeArray(mesh.positions(i), offset, arrays[arrayId++]);
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+        offset = placeArray(mesh.normals(i), offset, arrays[arrayId++]);
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        offset = placeArray(mesh.textureCoords2D(i), offset, arrays[arrayId++]);
+    header.dataSize = offset;
+
+    /* Copy everything in, padding is zero-filled */
+    auto out = Containers::Array<unsigned char>::zeroInitialized(header.dataSize);
+    std::memcpy(out.begin(), &header, sizeof(MagnumMeshHeader));
+    if(!arrays.empty())
+        std::memcpy(out.begin() + sizeof(MagnumMeshHeader), arrays.data(), arrays.size()*sizeof(MagnumMeshArray));
+    if(!indices.empty())
+        std::memcpy(out.begin() + header.indexOffset, indices.data(), indices.size()*sizeof(UnsignedInt));
+    arrayId = 0;
+    for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+        copyArray(mesh.positions(i), arrays[arrayId++], out.begin());
+    for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+        copyArray(mesh.normals(i), arrays[arrayId++], out.begin());
+    for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+        copyArray(mesh.textureCoords2D(i), arrays[arrayId++], out.begin());
+
+    return out;
+}
+
+}}
@@ -0,0 +1,80 @@
+#ifndef Magnum_Trade_MagnumMeshConverter_h
+#define Magnum_Trade_MagnumMeshConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MagnumMeshConverter
+ */
+
+#include "Magnum/Trade/AbstractMeshConverter.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BUILD_STATIC
+    #if defined(MagnumMeshConverter_EXPORTS) || defined(MagnumMeshConverterObjects_EXPORTS)
+        #define MAGNUM_TRADE_MAGNUMMESHCONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_TRADE_MAGNUMMESHCONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_TRADE_MAGNUMMESHCONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_TRADE_MAGNUMMESHCONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum mesh converter plugin
+
+Exports three-dimensional meshes to binary format which can be imported with
+@ref MagnumMeshImporter without any parsing. All index, position, normal and
+2D texture coordinate arrays are saved, see @ref MagnumMeshHeader for
+description of the format. The data are saved in machine byte order.
+
+This plugin is built if `WITH_MAGNUMMESHCONVERTER` is enabled when building
+%Magnum. To use dynamic plugin, you need to load `%MagnumMeshConverter` plugin
+from `MAGNUM_PLUGINS_MESHCONVERTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `%MagnumMeshConverter`
+component of `%Magnum` package in CMake and link to
+`${MAGNUM_MAGNUMMESHCONVERTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+*/
+class MAGNUM_TRADE_MAGNUMMESHCONVERTER_EXPORT MagnumMeshConverter: public AbstractMeshConverter {
+    public:
+        /** @brief Default constructor */
+        explicit MagnumMeshConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit MagnumMeshConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+    private:
+        Features MAGNUM_TRADE_MAGNUMMESHCONVERTER_LOCAL doFeatures() const override;
+        Containers::Array<unsigned char> MAGNUM_TRADE_MAGNUMMESHCONVERTER_LOCAL doExportToData(const MeshData3D& mesh) const override;
+};
+
+}}
+
+#endif
@@ -0,0 +1,145 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MagnumMeshConverter/MagnumMeshConverter.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshHeader.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MagnumMeshConverterTest: public TestSuite::Tester {
+    public:
+        explicit MagnumMeshConverterTest();
+
+        void layout();
+        void notIndexed();
+        void file();
+};
+
+MagnumMeshConverterTest::MagnumMeshConverterTest() {
+    addTests({&MagnumMeshConverterTest::layout,
+              &MagnumMeshConverterTest::notIndexed,
+              &MagnumMeshConverterTest::file});
+}
+
+namespace {
+    MeshData3D mesh(std::vector<UnsignedInt> indices) {
+        return MeshData3D(MeshPrimitive::TriangleStrip, std::move(indices), {
+            {{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}},
+            {{-1.0f, 0.5f, 0.0f}}
+        }, {
+            {{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}
+        }, {
+            {{0.0f, 0.5f}, {1.0f, 0.25f}, {0.75f, 1.0f}}
+        });
+    }
+}
+
+void MagnumMeshConverterTest::layout() {
+    const auto data = MagnumMeshConverter().exportToData(mesh({0, 1, 2, 2, 1}));
+    CORRADE_VERIFY(data);
+
+    /* Header at 0, array table at 48, indices at 112, positions at 144 and
+       192, normals at 208 and texture coordinates at 256 */
+    CORRADE_COMPARE(data.size(), 288);
+    MagnumMeshHeader header;
+    std::memcpy(&header, data.begin(), sizeof(header));
+    CORRADE_COMPARE(std::string(header.magic, 7), "MGNMESH");
+    CORRADE_COMPARE(header.version, 1);
+    CORRADE_COMPARE(header.byteOrder, 0x01020304);
+    CORRADE_COMPARE(MeshPrimitive(header.primitive), MeshPrimitive::TriangleStrip);
+    CORRADE_COMPARE(header.indexCount, 5);
+    CORRADE_COMPARE(header.positionArrayCount, 2);
+    CORRADE_COMPARE(header.normalArrayCount, 1);
+    CORRADE_COMPARE(header.textureCoords2DArrayCount, 1);
+    CORRADE_COMPARE(header.indexOffset, 112);
+    CORRADE_COMPARE(header.dataSize, 288);
+
+    MagnumMeshArray arrays[4];
+    std::memcpy(arrays, data.begin() + 48, sizeof(arrays));
+    CORRADE_COMPARE(arrays[0].offset, 144);
+    CORRADE_COMPARE(arrays[0].size, 3);
+    CORRADE_COMPARE(arrays[1].offset, 192);
+    CORRADE_COMPARE(arrays[1].size, 1);
+    CORRADE_COMPARE(arrays[2].offset, 208);
+    CORRADE_COMPARE(arrays[2].size, 3);
+    CORRADE_COMPARE(arrays[3].offset, 256);
+    CORRADE_COMPARE(arrays[3].size, 3);
+
+    /* Import it back */
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<MeshData3D> imported = importer.mesh3D(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), MeshPrimitive::TriangleStrip);
+    CORRADE_COMPARE(imported->indices(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1}));
+    CORRADE_COMPARE(imported->positions(0), (std::vector<Vector3>{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}}));
+    CORRADE_COMPARE(imported->positions(1), (std::vector<Vector3>{{-1.0f, 0.5f, 0.0f}}));
+    CORRADE_COMPARE(imported->normals(0), (std::vector<Vector3>{{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}));
+    CORRADE_COMPARE(imported->textureCoords2D(0), (std::vector<Vector2>{{0.0f, 0.5f}, {1.0f, 0.25f}, {0.75f, 1.0f}}));
+}
+
+void MagnumMeshConverterTest::notIndexed() {
+    const auto data = MagnumMeshConverter().exportToData(mesh({}));
+    CORRADE_VERIFY(data);
+
+    /* Positions directly after the array table */
+    MagnumMeshArray array;
+    std::memcpy(&array, data.begin() + 48, sizeof(array));
+    CORRADE_COMPARE(array.offset, 112);
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<MeshData3D> imported = importer.mesh3D(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_VERIFY(!imported->isIndexed());
+    CORRADE_COMPARE(imported->positions(0).size(), 3);
+}
+
+void MagnumMeshConverterTest::file() {
+    const std::string filename = Utility::Directory::join(MAGNUMMESHCONVERTER_TEST_OUTPUT_DIR, "mesh.mesh");
+    Utility::Directory::rm(filename);
+    CORRADE_VERIFY(MagnumMeshConverter().exportToFile(mesh({2, 1, 0}), filename));
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openFile(filename));
+    CORRADE_COMPARE(importer.indexData()[0], 2);
+    CORRADE_COMPARE(importer.positionData(0)[2], (Vector3{7.0f, 8.0f, 9.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumMeshConverterTest)
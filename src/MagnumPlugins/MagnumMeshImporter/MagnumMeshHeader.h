@@ -0,0 +1,80 @@
+#ifndef Magnum_Trade_MagnumMeshHeader_h
+#define Magnum_Trade_MagnumMeshHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::MagnumMeshHeader, @ref Magnum::Trade::MagnumMeshArray
+ */
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum mesh file header
+
+The file starts with this header, followed by @ref MagnumMeshArray entry for
+each position, normal and 2D texture coordinate array (in this order) and then
+the data. Index data are stored as @ref UnsignedInt, positions and normals as
+@ref Vector3 and texture coordinates as @ref Vector2. Beginning of each data
+array is aligned to @ref MagnumMeshAlignment bytes, all values are in machine
+byte order.
+*/
+struct MagnumMeshHeader {
+    char magic[7];                      /**< @brief `MGNMESH` */
+    UnsignedByte version;               /**< @brief Format version (1) */
+    UnsignedInt byteOrder;              /**< @brief @ref MagnumMeshByteOrder written in machine byte order */
+    UnsignedInt primitive;              /**< @brief @ref MeshPrimitive value */
+    UnsignedInt indexCount;             /**< @brief Index count, `0` if the mesh is not indexed */
+    UnsignedInt positionArrayCount;     /**< @brief Count of position arrays */
+    UnsignedInt normalArrayCount;       /**< @brief Count of normal arrays */
+    UnsignedInt textureCoords2DArrayCount; /**< @brief Count of 2D texture coordinate arrays */
+    UnsignedLong indexOffset;           /**< @brief Offset of index data from beginning of the file */
+    UnsignedLong dataSize;              /**< @brief Size of the whole file */
+};
+
+/** @brief Magnum mesh data array entry */
+struct MagnumMeshArray {
+    UnsignedLong offset;                /**< @brief Offset of the data from beginning of the file */
+    UnsignedInt size;                   /**< @brief Item count */
+    UnsignedInt reserved;               /**< @brief Reserved, `0` */
+};
+
+static_assert(sizeof(MagnumMeshHeader) == 48, "MagnumMeshHeader size is not 48 bytes");
+static_assert(sizeof(MagnumMeshArray) == 16, "MagnumMeshArray size is not 16 bytes");
+
+/** @brief Magnum mesh file format version */
+constexpr UnsignedByte MagnumMeshVersion = 1;
+
+/** @brief Magnum mesh byte order mark */
+constexpr UnsignedInt MagnumMeshByteOrder = 0x01020304;
+
+/** @brief Alignment of Magnum mesh data arrays */
+constexpr std::size_t MagnumMeshAlignment = 16;
+
+}}
+
+#endif
@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MagnumMeshImporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+bool isPrimitiveValid(const UnsignedInt primitive) {
+    switch(MeshPrimitive(primitive)) {
+        case MeshPrimitive::Points:
+        case MeshPrimitive::LineStrip:
+        case MeshPrimitive::LineLoop:
+        case MeshPrimitive::Lines:
+        case MeshPrimitive::TriangleStrip:
+        case MeshPrimitive::TriangleFan:
+        case MeshPrimitive::Triangles:
+        #ifndef MAGNUM_TARGET_GLES
+        case MeshPrimitive::LineStripAdjacency:
+        case MeshPrimitive::LinesAdjacency:
+        case MeshPrimitive::TriangleStripAdjacency:
+        case MeshPrimitive::TrianglesAdjacency:
+        case MeshPrimitive::Patches:
+        #endif
+            return true;
+    }
+
+    return false;
+}
+
+/* Checks that the array is aligned and fits into the data */
+bool isArrayValid(const UnsignedLong offset, const UnsignedInt size, const std::size_t itemSize, const UnsignedLong dataSize) {
+    return offset % MagnumMeshAlignment == 0 && offset <= dataSize && (dataSize - offset)/itemSize >= size;
+}
+
+}
+
+MagnumMeshImporter::MagnumMeshImporter(): _header(nullptr) {}
+
+MagnumMeshImporter::MagnumMeshImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), _header(nullptr) {}
+
+MagnumMeshImporter::~MagnumMeshImporter() { close(); }
+
+auto MagnumMeshImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ThreadSafe; }
+
+bool MagnumMeshImporter::doIsOpened() const { return _header; }
+
+void MagnumMeshImporter::doOpenData(const Containers::ArrayReference<const unsigned char> data) {
+    /* Check the header. It is copied out as the data might not be aligned. */
+    if(data.size() < sizeof(MagnumMeshHeader)) {
+        Error() << "Trade::MagnumMeshImporter::openData(): the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    MagnumMeshHeader header;
+    std::memcpy(&header, data.data(), sizeof(MagnumMeshHeader));
+    if(std::memcmp(header.magic, "MGNMESH", sizeof(header.magic)) != 0) {
+        Error() << "Trade::MagnumMeshImporter::openData(): invalid file signature";
+        return;
+    }
+    if(header.version != MagnumMeshVersion) {
+        Error() << "Trade::MagnumMeshImporter::openData(): unsupported file version" << header.version;
+        return;
+    }
+    if(header.byteOrder != MagnumMeshByteOrder) {
+        if(header.byteOrder == 0x04030201)
+            Error() << "Trade::MagnumMeshImporter::openData(): the file has different byte order";
+        else
+            Error() << "Trade::MagnumMeshImporter::openData(): invalid byte order mark";
+        return;
+    }
+    if(!isPrimitiveValid(header.primitive)) {
+        Error() << "Trade::MagnumMeshImporter::openData(): invalid primitive" << header.primitive;
+        return;
+    }
+    if(data.size() < header.dataSize) {
+        Error() << "Trade::MagnumMeshImporter::openData(): the file is too short: expected" << header.dataSize << "bytes but got" << data.size();
+        return;
+    }
+
+    /* Check the array table and all arrays */
+    const UnsignedLong arrayCount = UnsignedLong(header.positionArrayCount) + header.normalArrayCount + header.textureCoords2DArrayCount;
+    if((header.dataSize - std::min<UnsignedLong>(header.dataSize, sizeof(MagnumMeshHeader)))/sizeof(MagnumMeshArray) < arrayCount) {
+        Error() << "Trade::MagnumMeshImporter::openData(): array table is out of bounds";
+        return;
+    }
+    if(header.indexCount && !isArrayValid(header.indexOffset, header.indexCount, sizeof(UnsignedInt), header.dataSize)) {
+        Error() << "Trade::MagnumMeshImporter::openData(): index data are misaligned or out of bounds";
+        return;
+    }
+    for(UnsignedLong i = 0; i != arrayCount; ++i) {
+        MagnumMeshArray array;
+        std::memcpy(&array, data.data() + sizeof(MagnumMeshHeader) + i*sizeof(MagnumMeshArray), sizeof(MagnumMeshArray));
+
+        const std::size_t itemSize = i < header.positionArrayCount + header.normalArrayCount ? sizeof(Vector3) : sizeof(Vector2);
+        if(!isArrayValid(array.offset, array.size, itemSize, header.dataSize)) {
+            Error() << "Trade::MagnumMeshImporter::openData(): array" << i << "is misaligned or out of bounds";
+            return;
+        }
+    }
+
+    /* Reference the data directly if they stay valid until the file is
+       closed and the header and arrays can be accessed in place, otherwise
+       make a copy. The arrays are aligned relative to the beginning of the
+       file, so the file itself needs to have the same alignment. */
+    if(isDataPersistent() && reinterpret_cast<std::uintptr_t>(data.data()) % MagnumMeshAlignment == 0) _in = data;
+    else {
+        _storage = Containers::Array<unsigned char>(data.size());
+        std::copy(data.begin(), data.end(), _storage.begin());
+        _in = _storage;
+    }
+
+    _header = reinterpret_cast<const MagnumMeshHeader*>(_in.data());
+}
+
+void MagnumMeshImporter::doClose() {
+    _storage = nullptr;
+    _in = nullptr;
+    _header = nullptr;
+}
+
+template<class T> Containers::ArrayReference<const T> MagnumMeshImporter::arrayData(const UnsignedInt id) const {
+    const MagnumMeshArray& array = reinterpret_cast<const MagnumMeshArray*>(_in.data() + sizeof(MagnumMeshHeader))[id];
+    return {reinterpret_cast<const T*>(_in.data() + array.offset), array.size};
+}
+
+Containers::ArrayReference<const UnsignedInt> MagnumMeshImporter::indexData() const {
+    CORRADE_ASSERT(_header, "Trade::MagnumMeshImporter::indexData(): no file opened", nullptr);
+
+    /* Index offset is not validated for non-indexed meshes */
+    if(!_header->indexCount) return nullptr;
+    return {reinterpret_cast<const UnsignedInt*>(_in.data() + _header->indexOffset), _header->indexCount};
+}
+
+Containers::ArrayReference<const Vector3> MagnumMeshImporter::positionData(const UnsignedInt id) const {
+    CORRADE_ASSERT(_header, "Trade::MagnumMeshImporter::positionData(): no file opened", nullptr);
+    CORRADE_ASSERT(id < _header->positionArrayCount, "Trade::MagnumMeshImporter::positionData(): index" << id << "out of range for" << _header->positionArrayCount << "arrays", nullptr);
+    return arrayData<Vector3>(id);
+}
+
+Containers::ArrayReference<const Vector3> MagnumMeshImporter::normalData(const UnsignedInt id) const {
+    CORRADE_ASSERT(_header, "Trade::MagnumMeshImporter::normalData(): no file opened", nullptr);
+    CORRADE_ASSERT(id < _header->normalArrayCount, "Trade::MagnumMeshImporter::normalData(): index" << id << "out of range for" << _header->normalArrayCount << "arrays", nullptr);
+    return arrayData<Vector3>(_header->positionArrayCount + id);
+}
+
+Containers::ArrayReference<const Vector2> MagnumMeshImporter::textureCoords2DData(const UnsignedInt id) const {
+    CORRADE_ASSERT(_header, "Trade::MagnumMeshImporter::textureCoords2DData(): no file opened", nullptr);
+    CORRADE_ASSERT(id < _header->textureCoords2DArrayCount, "Trade::MagnumMeshImporter::textureCoords2DData(): index" << id << "out of range for" << _header->textureCoords2DArrayCount << "arrays", nullptr);
+    return arrayData<Vector2>(_header->positionArrayCount + _header->normalArrayCount + id);
+}
+
+UnsignedInt MagnumMeshImporter::doMesh3DCount() const { return 1; }
+
+std::optional<MeshData3D> MagnumMeshImporter::doMesh3D(UnsignedInt) {
+    const Containers::ArrayReference<const UnsignedInt> indexView = indexData();
+    std::vector<UnsignedInt> indices(indexView.begin(), indexView.end());
+
+    std::vector<std::vector<Vector3>> positions;
+    positions.reserve(_header->positionArrayCount);
+    for(UnsignedInt i = 0; i != _header->positionArrayCount; ++i) {
+        const Containers::ArrayReference<const Vector3> view = positionData(i);
+        positions.emplace_back(view.begin(), view.end());
+    }
+
+    std::vector<std::vector<Vector3>> normals;
+    normals.reserve(_header->normalArrayCount);
+    for(UnsignedInt i = 0; i != _header->normalArrayCount; ++i) {
+        const Containers::ArrayReference<const Vector3> view = normalData(i);
+        normals.emplace_back(view.begin(), view.end());
+    }
+
+    std::vector<std::vector<Vector2>> textureCoords2D;
+    textureCoords2D.reserve(_header->textureCoords2DArrayCount);
+    for(UnsignedInt i = 0; i != _header->textureCoords2DArrayCount; ++i) {
+        const Containers::ArrayReference<const Vector2> view = textureCoords2DData(i);
+        textureCoords2D.emplace_back(view.begin(), view.end());
+    }
+
+    return MeshData3D(MeshPrimitive(_header->primitive), std::move(indices), std::move(positions), std::move(normals), std::move(textureCoords2D));
+}
+
+}}
@@ -0,0 +1,145 @@
+#ifndef Magnum_Trade_MagnumMeshImporter_h
+#define Magnum_Trade_MagnumMeshImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MagnumMeshImporter
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BUILD_STATIC
+    #if defined(MagnumMeshImporter_EXPORTS) || defined(MagnumMeshImporterObjects_EXPORTS)
+        #define MAGNUM_TRADE_MAGNUMMESHIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_TRADE_MAGNUMMESHIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_TRADE_MAGNUMMESHIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_TRADE_MAGNUMMESHIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+struct MagnumMeshHeader;
+
+/**
+@brief Magnum mesh importer plugin
+
+Imports single three-dimensional mesh from binary files produced by
+@ref MagnumMeshConverter. The file contains the data in the same layout as
+@ref MeshData3D, so preprocessed meshes can be loaded without any parsing. See
+@ref MagnumMeshHeader for description of the format.
+
+This plugin is built if `WITH_MAGNUMMESHIMPORTER` is enabled when building
+%Magnum. To use dynamic plugin, you need to load `%MagnumMeshImporter` plugin
+from `MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `%MagnumMeshImporter`
+component of `%Magnum` package in CMake and link to
+`${MAGNUM_MAGNUMMESHIMPORTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+Only the header and array table is validated on opening. Files opened with
+@ref openFile() are memory-mapped and data passed to @ref openPersistentData()
+are referenced directly (if they are aligned to @ref MagnumMeshAlignment
+bytes, otherwise they are copied), data passed to @ref openData() are copied
+first. The arrays can be then accessed
+directly in the mapped memory through @ref indexData(), @ref positionData(),
+@ref normalData() and @ref textureCoords2DData(), e.g. for uploading them to
+@ref Buffer without any intermediate copy. @ref mesh3D() copies each array
+into the returned @ref MeshData3D with single @ref std::memcpy().
+
+The data are expected to be in machine byte order, files created on machine
+with different endianness are refused.
+*/
+class MAGNUM_TRADE_MAGNUMMESHIMPORTER_EXPORT MagnumMeshImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit MagnumMeshImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit MagnumMeshImporter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        ~MagnumMeshImporter();
+
+        /**
+         * @brief Index data
+         *
+         * Returns view on index data of opened mesh, empty if the mesh is not
+         * indexed. The data are valid until the file is closed.
+         */
+        Containers::ArrayReference<const UnsignedInt> indexData() const;
+
+        /**
+         * @brief Position data
+         * @param id    Position array ID
+         *
+         * Returns view on given position array of opened mesh. The data are
+         * valid until the file is closed.
+         */
+        Containers::ArrayReference<const Vector3> positionData(UnsignedInt id) const;
+
+        /**
+         * @brief Normal data
+         * @param id    Normal array ID
+         *
+         * Returns view on given normal array of opened mesh. The data are
+         * valid until the file is closed.
+         */
+        Containers::ArrayReference<const Vector3> normalData(UnsignedInt id) const;
+
+        /**
+         * @brief 2D texture coordinate data
+         * @param id    Texture coordinate array ID
+         *
+         * Returns view on given texture coordinate array of opened mesh. The
+         * data are valid until the file is closed.
+         */
+        Containers::ArrayReference<const Vector2> textureCoords2DData(UnsignedInt id) const;
+
+    private:
+        Features MAGNUM_TRADE_MAGNUMMESHIMPORTER_LOCAL doFeatures() const override;
+        bool MAGNUM_TRADE_MAGNUMMESHIMPORTER_LOCAL doIsOpened() const override;
+        void MAGNUM_TRADE_MAGNUMMESHIMPORTER_LOCAL doOpenData(Containers::ArrayReference<const unsigned char> data) override;
+        void MAGNUM_TRADE_MAGNUMMESHIMPORTER_LOCAL doClose() override;
+        UnsignedInt MAGNUM_TRADE_MAGNUMMESHIMPORTER_LOCAL doMesh3DCount() const override;
+        std::optional<MeshData3D> MAGNUM_TRADE_MAGNUMMESHIMPORTER_LOCAL doMesh3D(UnsignedInt id) override;
+
+        template<class T> Containers::ArrayReference<const T> MAGNUM_TRADE_MAGNUMMESHIMPORTER_LOCAL arrayData(UnsignedInt id) const;
+
+        Containers::Array<unsigned char> _storage;
+        Containers::ArrayReference<const unsigned char> _in;
+        const MagnumMeshHeader* _header;
+};
+
+}}
+
+#endif
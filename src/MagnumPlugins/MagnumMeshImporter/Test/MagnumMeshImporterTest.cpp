@@ -0,0 +1,304 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshHeader.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MagnumMeshImporterTest: public TestSuite::Tester {
+    public:
+        explicit MagnumMeshImporterTest();
+
+        void openShort();
+        void invalidSignature();
+        void unsupportedVersion();
+        void differentByteOrder();
+        void invalidPrimitive();
+        void truncated();
+        void arrayTableOutOfBounds();
+        void indicesOutOfBounds();
+        void arrayMisaligned();
+
+        void mesh();
+        void notIndexed();
+        void notIndexedInvalidOffset();
+        void persistentData();
+        void persistentDataMisaligned();
+        void file();
+};
+
+MagnumMeshImporterTest::MagnumMeshImporterTest() {
+    addTests({&MagnumMeshImporterTest::openShort,
+              &MagnumMeshImporterTest::invalidSignature,
+              &MagnumMeshImporterTest::unsupportedVersion,
+              &MagnumMeshImporterTest::differentByteOrder,
+              &MagnumMeshImporterTest::invalidPrimitive,
+              &MagnumMeshImporterTest::truncated,
+              &MagnumMeshImporterTest::arrayTableOutOfBounds,
+              &MagnumMeshImporterTest::indicesOutOfBounds,
+              &MagnumMeshImporterTest::arrayMisaligned,
+
+              &MagnumMeshImporterTest::mesh,
+              &MagnumMeshImporterTest::notIndexed,
+              &MagnumMeshImporterTest::notIndexedInvalidOffset,
+              &MagnumMeshImporterTest::persistentData,
+              &MagnumMeshImporterTest::persistentDataMisaligned,
+              &MagnumMeshImporterTest::file});
+}
+
+namespace {
+    /* Mesh with one index array, two position arrays, one normal array and
+       one texture coordinate array */
+    const UnsignedInt indices[] = {0, 1, 2, 2, 1, 0};
+    const Vector3 positions0[] = {{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}};
+    const Vector3 positions1[] = {{-1.0f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}};
+    const Vector3 normals[] = {{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}};
+    const Vector2 textureCoords[] = {{0.0f, 0.5f}, {1.0f, 0.25f}, {0.75f, 1.0f}};
+
+    /* Header at 0, array table at 48, indices at 128, positions at 160 and
+       208, normals at 240 and texture coordinates at 288 */
+    Containers::Array<unsigned char> meshFile(const bool indexed = true) {
+        MagnumMeshHeader header;
+        std::memcpy(header.magic, "MGNMESH", 7);
+        header.version = 1;
+        header.byteOrder = 0x01020304;
+        header.primitive = UnsignedInt(MeshPrimitive::Triangles);
+        header.indexCount = indexed ? 6 : 0;
+        header.positionArrayCount = 2;
+        header.normalArrayCount = 1;
+        header.textureCoords2DArrayCount = 1;
+        header.indexOffset = 128;
+        header.dataSize = 320;
+
+        const MagnumMeshArray arrays[] = {
+            {160, 3, 0},
+            {208, 2, 0},
+            {240, 3, 0},
+            {288, 3, 0}
+        };
+
+        auto data = Containers::Array<unsigned char>::zeroInitialized(320);
+        std::memcpy(data.begin(), &header, sizeof(header));
+        std::memcpy(data.begin() + 48, arrays, sizeof(arrays));
+        std::memcpy(data.begin() + 128, indices, sizeof(indices));
+        std::memcpy(data.begin() + 160, positions0, sizeof(positions0));
+        std::memcpy(data.begin() + 208, positions1, sizeof(positions1));
+        std::memcpy(data.begin() + 240, normals, sizeof(normals));
+        std::memcpy(data.begin() + 288, textureCoords, sizeof(textureCoords));
+        return data;
+    }
+
+    template<class T> void patch(Containers::Array<unsigned char>& data, const std::size_t offset, const T value) {
+        std::memcpy(data.begin() + offset, &value, sizeof(T));
+    }
+
+    std::string openError(const Containers::Array<unsigned char>& data) {
+        std::ostringstream out;
+        Error::setOutput(&out);
+
+        MagnumMeshImporter importer;
+        if(importer.openData(data)) return "opened";
+        return out.str();
+    }
+}
+
+void MagnumMeshImporterTest::openShort() {
+    CORRADE_COMPARE(openError(Containers::Array<unsigned char>(47)),
+        "Trade::MagnumMeshImporter::openData(): the file is too short: 47 bytes\n");
+}
+
+void MagnumMeshImporterTest::invalidSignature() {
+    auto data = meshFile();
+    data[2] = 'M';
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): invalid file signature\n");
+}
+
+void MagnumMeshImporterTest::unsupportedVersion() {
+    auto data = meshFile();
+    data[7] = 2;
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): unsupported file version 2\n");
+}
+
+void MagnumMeshImporterTest::differentByteOrder() {
+    auto data = meshFile();
+    patch<UnsignedInt>(data, 8, 0x04030201);
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): the file has different byte order\n");
+
+    patch<UnsignedInt>(data, 8, 0xdeadbeef);
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): invalid byte order mark\n");
+}
+
+void MagnumMeshImporterTest::invalidPrimitive() {
+    auto data = meshFile();
+    patch<UnsignedInt>(data, 12, 0xdead);
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): invalid primitive 57005\n");
+}
+
+void MagnumMeshImporterTest::truncated() {
+    auto data = meshFile();
+    Containers::Array<unsigned char> truncated(319);
+    std::copy(data.begin(), data.begin() + 319, truncated.begin());
+    CORRADE_COMPARE(openError(truncated), "Trade::MagnumMeshImporter::openData(): the file is too short: expected 320 bytes but got 319\n");
+}
+
+void MagnumMeshImporterTest::arrayTableOutOfBounds() {
+    auto data = meshFile();
+    patch<UnsignedInt>(data, 24, 0x7fffffff);
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): array table is out of bounds\n");
+}
+
+void MagnumMeshImporterTest::indicesOutOfBounds() {
+    auto data = meshFile();
+    patch<UnsignedInt>(data, 16, 49);
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): index data are misaligned or out of bounds\n");
+}
+
+void MagnumMeshImporterTest::arrayMisaligned() {
+    auto data = meshFile();
+    patch<UnsignedLong>(data, 48 + 2*16, 244);
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): array 2 is misaligned or out of bounds\n");
+
+    /* Offset past the end, shouldn't overflow */
+    patch<UnsignedLong>(data, 48 + 2*16, 0xfffffffffffffff0ull);
+    CORRADE_COMPARE(openError(data), "Trade::MagnumMeshImporter::openData(): array 2 is misaligned or out of bounds\n");
+}
+
+void MagnumMeshImporterTest::mesh() {
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(meshFile()));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+
+    std::optional<MeshData3D> data = importer.mesh3D(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data->indices(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 0}));
+    CORRADE_COMPARE(data->positionArrayCount(), 2);
+    CORRADE_COMPARE(data->positions(0), (std::vector<Vector3>{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}}));
+    CORRADE_COMPARE(data->positions(1), (std::vector<Vector3>{{-1.0f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}}));
+    CORRADE_COMPARE(data->normalArrayCount(), 1);
+    CORRADE_COMPARE(data->normals(0), (std::vector<Vector3>{{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}));
+    CORRADE_COMPARE(data->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(data->textureCoords2D(0), (std::vector<Vector2>{{0.0f, 0.5f}, {1.0f, 0.25f}, {0.75f, 1.0f}}));
+}
+
+void MagnumMeshImporterTest::notIndexed() {
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(meshFile(false)));
+    CORRADE_COMPARE(importer.indexData().size(), 0);
+
+    std::optional<MeshData3D> data = importer.mesh3D(0);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(!data->isIndexed());
+    CORRADE_COMPARE(data->positions(0).size(), 3);
+}
+
+void MagnumMeshImporterTest::notIndexedInvalidOffset() {
+    /* Index offset is ignored for non-indexed meshes, no pointer out of
+       bounds should be formed from it */
+    auto data = meshFile(false);
+    const UnsignedLong indexOffset = ~UnsignedLong{};
+    std::memcpy(data.begin() + offsetof(MagnumMeshHeader, indexOffset), &indexOffset, sizeof(UnsignedLong));
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_VERIFY(!importer.indexData().data());
+    CORRADE_COMPARE(importer.indexData().size(), 0);
+
+    std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_VERIFY(!mesh->isIndexed());
+}
+
+void MagnumMeshImporterTest::persistentData() {
+    const auto data = meshFile();
+
+    /* The arrays should point directly into the data */
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openPersistentData(data));
+    CORRADE_VERIFY(importer.indexData().data() == reinterpret_cast<const UnsignedInt*>(data.begin() + 128));
+    CORRADE_VERIFY(importer.positionData(1).data() == reinterpret_cast<const Vector3*>(data.begin() + 208));
+    CORRADE_COMPARE(importer.positionData(1).size(), 2);
+    CORRADE_VERIFY(importer.normalData(0).data() == reinterpret_cast<const Vector3*>(data.begin() + 240));
+    CORRADE_VERIFY(importer.textureCoords2DData(0).data() == reinterpret_cast<const Vector2*>(data.begin() + 288));
+    CORRADE_COMPARE(importer.textureCoords2DData(0)[2], (Vector2{0.75f, 1.0f}));
+
+    /* Non-persistent data are copied */
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_VERIFY(importer.indexData().data() != reinterpret_cast<const UnsignedInt*>(data.begin() + 128));
+    CORRADE_COMPARE(importer.indexData()[3], 2);
+}
+
+void MagnumMeshImporterTest::persistentDataMisaligned() {
+    const auto data = meshFile();
+
+    /* Place the file at an address that is aligned to four but not to eight
+       bytes, so the 64-bit header fields can't be accessed in place */
+    Containers::Array<unsigned char> storage(data.size() + MagnumMeshAlignment);
+    unsigned char* const misaligned = storage.begin() + (MagnumMeshAlignment + 4 - reinterpret_cast<std::uintptr_t>(storage.begin()) % MagnumMeshAlignment) % MagnumMeshAlignment;
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(misaligned) % 8, 4);
+    std::copy(data.begin(), data.end(), misaligned);
+
+    /* The data should be copied */
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openPersistentData({misaligned, data.size()}));
+    CORRADE_VERIFY(importer.indexData().data() != reinterpret_cast<const UnsignedInt*>(misaligned + 128));
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(importer.indexData().data()) % MagnumMeshAlignment, 0);
+    CORRADE_COMPARE(importer.indexData()[3], 2);
+    CORRADE_COMPARE(importer.positionData(0)[1], (Vector3{4.0f, 5.0f, 6.0f}));
+
+    std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->textureCoords2D(0)[2], (Vector2{0.75f, 1.0f}));
+}
+
+void MagnumMeshImporterTest::file() {
+    const std::string filename = Utility::Directory::join(MAGNUMMESHIMPORTER_TEST_OUTPUT_DIR, "mesh.mesh");
+    CORRADE_VERIFY(Utility::Directory::write(filename, meshFile()));
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openFile(filename));
+    CORRADE_COMPARE(importer.positionData(0)[1], (Vector3{4.0f, 5.0f, 6.0f}));
+
+    std::optional<MeshData3D> data = importer.mesh3D(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->textureCoords2D(0)[1], (Vector2{1.0f, 0.25f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumMeshImporterTest)
@@ -25,8 +25,7 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
-#include <limits>
+#include <algorithm>
 #include <sstream>
 #include <unordered_map>
 #include <Corrade/Containers/Array.h>
@@ -38,25 +37,65 @@
 #include <Magnum/MeshTools/CombineIndexedArrays.h>
 #include <Magnum/MeshTools/Duplicate.h>
 
+#if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#define MAGNUM_OBJIMPORTER_THREADS
+#include <thread>
+#endif
+
 namespace Magnum { namespace Trade {
 
 struct ObjImporter::File {
     std::unordered_map<std::string, UnsignedInt> meshesForName;
     std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    std::unique_ptr<std::istream> in;
+    std::vector<std::tuple<std::size_t, std::size_t, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
+
+    /* Copy of the data, if the original ones are not guaranteed to stay valid
+       until the file is closed */
+    Containers::Array<char> storage;
+    Containers::ArrayReference<const char> data;
 };
 
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+/* Chunks smaller than this are not worth the thread creation overhead */
+constexpr std::size_t MinimalChunkSize = 16*1024;
+
+/* Data parsed from one line-aligned part of the mesh */
+struct Chunk {
+    const char* begin;
+    const char* end;
+
+    /* Primitive and beginning of the first line specifying it */
+    std::optional<MeshPrimitive> primitive;
+    const char* primitivePosition{};
+
+    std::vector<Vector3> positions;
+    std::vector<Vector2> textureCoordinates;
+    std::vector<Vector3> normals;
+    std::vector<UnsignedInt> positionIndices;
+    std::vector<UnsignedInt> textureCoordinateIndices;
+    std::vector<UnsignedInt> normalIndices;
+
+    /* Error message and beginning of the line where it happened */
+    std::string error;
+    const char* errorPosition{};
+};
+
+std::size_t chunkCount(UnsignedInt threadCount, std::size_t size) {
+    #ifdef MAGNUM_OBJIMPORTER_THREADS
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::max(std::min(std::size_t(threadCount), size/MinimalChunkSize), std::size_t(1));
+    #else
+    static_cast<void>(threadCount);
+    static_cast<void>(size);
+    return 1;
+    #endif
 }
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(std::string str, Float* extra = nullptr) {
+template<std::size_t size> Math::Vector<size, Float> extractFloatData(const std::string& str, std::ostream& errorOutput, Float* extra = nullptr) {
     std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
     if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
+        Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): invalid float array size";
         throw 0;
     }
 
@@ -69,6 +108,145 @@ template<std::size_t size> Math::Vector<size, Float> extractFloatData(std::strin
     return output;
 }
 
+void parseChunk(Chunk& chunk, const UnsignedInt positionIndexOffset, const UnsignedInt textureCoordinateIndexOffset, const UnsignedInt normalIndexOffset) {
+    /* Errors are collected and printed after all chunks are parsed, so the
+       output is deterministic */
+    std::ostringstream errorOutput;
+    const char* lineBegin = chunk.begin;
+    auto fail = [&]() {
+        chunk.error = errorOutput.str();
+        chunk.errorPosition = lineBegin;
+    };
+
+    try { for(const char* next; lineBegin != chunk.end; lineBegin = next) {
+        const char* const lineEnd = std::find(lineBegin, chunk.end, '\n');
+        next = lineEnd == chunk.end ? lineEnd : lineEnd + 1;
+
+        /* Ignore comments */
+        if(*lineBegin == '#') continue;
+
+        /* Get the line */
+        const std::string line = Utility::String::trim({lineBegin, lineEnd});
+
+        /* Ignore empty lines */
+        if(line.empty()) continue;
+
+        /* Split the line into keyword and contents, any whitespace can be
+           used as a separator. Tabs are converted to spaces so the contents
+           can be split on spaces only. */
+        const std::size_t keywordEnd = line.find_first_of(" \t");
+        const std::string keyword = line.substr(0, keywordEnd);
+        std::string contents = keywordEnd != std::string::npos ?
+            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+        std::replace(contents.begin(), contents.end(), '\t', ' ');
+
+        /* Vertex position */
+        if(keyword == "v") {
+            Float extra{1.0f};
+            const Vector3 data = extractFloatData<3>(contents, errorOutput, &extra);
+            if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
+                Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
+                return fail();
+            }
+
+            chunk.positions.push_back(data);
+
+        /* Texture coordinate */
+        } else if(keyword == "vt") {
+            Float extra{0.0f};
+            const auto data = extractFloatData<2>(contents, errorOutput, &extra);
+            if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
+                Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
+                return fail();
+            }
+
+            chunk.textureCoordinates.push_back(data);
+
+        /* Normal */
+        } else if(keyword == "vn") {
+            chunk.normals.push_back(extractFloatData<3>(contents, errorOutput));
+
+        /* Indices */
+        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
+            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+
+            const MeshPrimitive primitive = keyword == "p" ? MeshPrimitive::Points :
+                keyword == "l" ? MeshPrimitive::Lines : MeshPrimitive::Triangles;
+
+            /* Check that we don't mix the primitives in one mesh. The first
+               primitive is remembered together with its position so the
+               check can be done also across chunk boundaries. */
+            if(!chunk.primitive) {
+                chunk.primitive = primitive;
+                chunk.primitivePosition = lineBegin;
+            } else if(chunk.primitive != primitive) {
+                Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): mixed primitive" << *chunk.primitive << "and" << primitive;
+                return fail();
+            }
+
+            /* Check vertex count per primitive */
+            if(primitive == MeshPrimitive::Points) {
+                if(indexTuples.size() != 1) {
+                    Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): wrong index count for point";
+                    return fail();
+                }
+
+            } else if(primitive == MeshPrimitive::Lines) {
+                if(indexTuples.size() != 2) {
+                    Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): wrong index count for line";
+                    return fail();
+                }
+
+            } else if(primitive == MeshPrimitive::Triangles) {
+                if(indexTuples.size() < 3) {
+                    Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
+                    return fail();
+                } else if(indexTuples.size() != 3) {
+                    Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): polygons are not supported";
+                    return fail();
+                }
+
+            } else CORRADE_ASSERT_UNREACHABLE();
+
+            for(const std::string& indexTuple: indexTuples) {
+                std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
+                if(indices.size() > 3) {
+                    Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): invalid index data";
+                    return fail();
+                }
+
+                /* Position indices */
+                chunk.positionIndices.push_back(std::stoul(indices[0]) - positionIndexOffset);
+
+                /* Texture coordinates */
+                if(indices.size() == 2 || (indices.size() == 3 && !indices[1].empty()))
+                    chunk.textureCoordinateIndices.push_back(std::stoul(indices[1]) - textureCoordinateIndexOffset);
+
+                /* Normal indices */
+                if(indices.size() == 3)
+                    chunk.normalIndices.push_back(std::stoul(indices[2]) - normalIndexOffset);
+            }
+
+        /* Ignore unsupported keywords, error out on unknown keywords */
+        } else if(![&keyword](){
+            /* Using lambda to emulate for-else construct like in Python */
+            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
+                if(keyword == expected) return true;
+            return false;
+        }()) {
+            Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): unknown keyword" << keyword;
+            return fail();
+        }
+
+    }} catch(std::exception) {
+        Error(&errorOutput) << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+        return fail();
+    } catch(...) {
+        /* Error message already printed */
+        return fail();
+    }
+}
+
 template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
     /* Check that indices are in range */
     for(UnsignedInt i: indices) if(i >= data.size()) {
@@ -81,35 +259,30 @@ template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vec
 
 }
 
-ObjImporter::ObjImporter() = default;
+ObjImporter::ObjImporter(): _threadCount{1} {}
 
-ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
+ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), _threadCount{1} {}
 
 ObjImporter::~ObjImporter() = default;
 
-auto ObjImporter::doFeatures() const -> Features { return Feature::OpenData; }
+auto ObjImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ThreadSafe; }
 
 void ObjImporter::doClose() { _file.reset(); }
 
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
-void ObjImporter::doOpenFile(const std::string& filename) {
-    /* Open file in *text* mode (to avoid \r handling) */
-    std::unique_ptr<std::istream> in{new std::ifstream{filename}};
-    if(!in->good()) {
-        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
-        return;
-    }
-
-    _file.reset(new File);
-    _file->in = std::move(in);
-    parseMeshNames();
-}
-
 void ObjImporter::doOpenData(Containers::ArrayReference<const unsigned char> data) {
-    /* Open file in *text* mode (to avoid \r handling) */
     _file.reset(new File);
-    _file->in.reset(new std::istringstream{{reinterpret_cast<const char*>(data.begin()), data.size()}});
+
+    /* Parse the data in place if they stay valid until the file is closed
+       (e.g. memory-mapped file), otherwise make a copy */
+    if(isDataPersistent())
+        _file->data = {reinterpret_cast<const char*>(data.data()), data.size()};
+    else {
+        _file->storage = Containers::Array<char>(data.size());
+        std::copy(data.begin(), data.end(), _file->storage.begin());
+        _file->data = _file->storage;
+    }
 
     parseMeshNames();
 }
@@ -127,25 +300,25 @@ void ObjImporter::parseMeshNames() {
     bool thisIsFirstMeshAndItHasNoData = true;
     _file->meshNames.emplace_back();
 
-    while(_file->in->good()) {
+    const char* const begin = _file->data.begin();
+    const char* const end = _file->data.end();
+    for(const char* lineBegin = begin, *next; lineBegin != end; lineBegin = next) {
         /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+        const char* const lineEnd = std::find(lineBegin, end, '\n');
+        next = lineEnd == end ? lineEnd : lineEnd + 1;
 
         /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
+        if(*lineBegin == '#') continue;
 
         /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
+        const std::string line = Utility::String::trim({lineBegin, lineEnd});
+        const std::size_t keywordEnd = line.find_first_of(" \t");
+        const std::string keyword = line.substr(0, keywordEnd);
 
         /* Mesh name */
         if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+            std::string name = keywordEnd != std::string::npos ?
+                Utility::String::trim(line.substr(keywordEnd+1)) : "";
 
             /* This is the name of first mesh */
             if(thisIsFirstMeshAndItHasNoData) {
@@ -161,12 +334,12 @@ void ObjImporter::parseMeshNames() {
                 _file->meshNames.back() = std::move(name);
 
                 /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+                std::get<0>(_file->meshes.back()) = next - begin;
 
             /* Otherwise this is a name of new mesh */
             } else {
                 /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+                std::get<1>(_file->meshes.back()) = lineBegin - begin;
 
                 /* Save name and offset of the new one. The end offset will be
                    updated later. */
@@ -177,11 +350,9 @@ void ObjImporter::parseMeshNames() {
                     _file->meshesForName.insert({name, _file->meshes.size()});
                     #endif
                 _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+                _file->meshes.emplace_back(next - begin, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
             }
 
-            continue;
-
         /* If there are any data/indices before the first name, it means that
            the first object is unnamed. We need to check for them. */
 
@@ -204,15 +375,10 @@ void ObjImporter::parseMeshNames() {
                 break;
             }
         }
-
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    std::get<1>(_file->meshes.back()) = _file->data.size();
 }
 
 UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
@@ -227,11 +393,45 @@ std::string ObjImporter::doMesh3DName(UnsignedInt id) {
 }
 
 std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
+    /* Get mesh data range, set mesh parsing parameters */
+    std::size_t begin, end;
     UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
     std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+
+    /* Split the data into line-aligned chunks and parse them in parallel. The
+       indices are global for the whole file, so the chunks need no index
+       fix-up, they just need to be concatenated in order. */
+    const std::size_t size = end - begin;
+    std::vector<Chunk> chunks(chunkCount(_threadCount, size));
+    const char* const data = _file->data.data() + begin;
+    chunks.front().begin = data;
+    chunks.back().end = data + size;
+    for(std::size_t i = 1; i != chunks.size(); ++i) {
+        const char* boundary = std::max(chunks[i - 1].begin, data + i*size/chunks.size());
+        boundary = std::find(boundary, chunks.back().end, '\n');
+        if(boundary != chunks.back().end) ++boundary;
+        chunks[i - 1].end = chunks[i].begin = boundary;
+    }
+
+    #ifdef MAGNUM_OBJIMPORTER_THREADS
+    std::vector<std::thread> threads;
+    threads.reserve(chunks.size() - 1);
+    for(std::size_t i = 1; i != chunks.size(); ++i)
+        threads.emplace_back(parseChunk, std::ref(chunks[i]), positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+    #endif
+    parseChunk(chunks.front(), positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+    #ifdef MAGNUM_OBJIMPORTER_THREADS
+    for(std::thread& thread: threads) thread.join();
+    #endif
+
+    /* Reserve memory for the concatenated data */
+    std::size_t positionCount = 0, textureCoordinateCount = 0, normalCount = 0, indexCount = 0;
+    for(const Chunk& chunk: chunks) {
+        positionCount += chunk.positions.size();
+        textureCoordinateCount += chunk.textureCoordinates.size();
+        normalCount += chunk.normals.size();
+        indexCount += chunk.positionIndices.size();
+    }
 
     std::optional<MeshPrimitive> primitive;
     std::vector<Vector3> positions;
@@ -240,149 +440,41 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
     std::vector<UnsignedInt> positionIndices;
     std::vector<UnsignedInt> textureCoordinateIndices;
     std::vector<UnsignedInt> normalIndices;
-
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
+    positions.reserve(positionCount);
+    if(textureCoordinateCount) {
+        textureCoordinates.emplace_back();
+        textureCoordinates.front().reserve(textureCoordinateCount);
+    }
+    if(normalCount) {
+        normals.emplace_back();
+        normals.front().reserve(normalCount);
+    }
+    positionIndices.reserve(indexCount);
+
+    /* Stitch the chunks together, reporting the first error in file order so
+       the output is the same as when parsing serially */
+    for(Chunk& chunk: chunks) {
+        /* Check that we don't mix the primitives across chunk boundaries, if
+           the first primitive in the chunk is before any error in it */
+        if(primitive && chunk.primitivePosition && (!chunk.errorPosition || chunk.primitivePosition <= chunk.errorPosition) && *chunk.primitive != *primitive) {
+            Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << *chunk.primitive;
+            return std::nullopt;
         }
 
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
-
-        /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
-
-        /* Vertex position */
-        if(keyword == "v") {
-            Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
-            if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
-                return std::nullopt;
-            }
-
-            positions.push_back(data);
-
-        /* Texture coordinate */
-        } else if(keyword == "vt") {
-            Float extra{0.0f};
-            const auto data = extractFloatData<2>(contents, &extra);
-            if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
-                return std::nullopt;
-            }
-
-            if(textureCoordinates.empty()) textureCoordinates.push_back({});
-            textureCoordinates.front().push_back(data);
-
-        /* Normal */
-        } else if(keyword == "vn") {
-            if(normals.empty()) normals.push_back({});
-            normals.front().push_back(extractFloatData<3>(contents));
-
-        /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
-
-            /* Points */
-            if(keyword == "p") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for point";
-                    return std::nullopt;
-                }
-
-                primitive = MeshPrimitive::Points;
-
-            /* Lines */
-            } else if(keyword == "l") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for line";
-                    return std::nullopt;
-                }
-
-                primitive = MeshPrimitive::Lines;
-
-            /* Faces */
-            } else if(keyword == "f") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
-                    return std::nullopt;
-                } else if(indexTuples.size() != 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): polygons are not supported";
-                    return std::nullopt;
-                }
-
-                primitive = MeshPrimitive::Triangles;
-
-            } else CORRADE_ASSERT_UNREACHABLE();
-
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
-                if(indices.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
-                    return std::nullopt;
-                }
-
-                /* Position indices */
-                positionIndices.push_back(std::stoul(indices[0]) - positionIndexOffset);
-
-                /* Texture coordinates */
-                if(indices.size() == 2 || (indices.size() == 3 && !indices[1].empty()))
-                    textureCoordinateIndices.push_back(std::stoul(indices[1]) - textureCoordinateIndexOffset);
-
-                /* Normal indices */
-                if(indices.size() == 3)
-                    normalIndices.push_back(std::stoul(indices[2]) - normalIndexOffset);
-            }
-
-        /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
-            return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << keyword;
+        if(chunk.errorPosition) {
+            Error() << Utility::String::rtrim(chunk.error);
             return std::nullopt;
         }
 
-    }} catch(std::exception) {
-        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
-        return std::nullopt;
-    } catch(...) {
-        /* Error message already printed */
-        return std::nullopt;
+        if(!primitive) primitive = chunk.primitive;
+        positions.insert(positions.end(), chunk.positions.begin(), chunk.positions.end());
+        if(!chunk.textureCoordinates.empty())
+            textureCoordinates.front().insert(textureCoordinates.front().end(), chunk.textureCoordinates.begin(), chunk.textureCoordinates.end());
+        if(!chunk.normals.empty())
+            normals.front().insert(normals.front().end(), chunk.normals.begin(), chunk.normals.end());
+        positionIndices.insert(positionIndices.end(), chunk.positionIndices.begin(), chunk.positionIndices.end());
+        textureCoordinateIndices.insert(textureCoordinateIndices.end(), chunk.textureCoordinateIndices.begin(), chunk.textureCoordinateIndices.end());
+        normalIndices.insert(normalIndices.end(), chunk.normalIndices.begin(), chunk.normalIndices.end());
     }
 
     /* There should be at least indexed position data */
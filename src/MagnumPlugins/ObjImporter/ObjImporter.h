@@ -44,6 +44,16 @@ Supported features:
 Polygons (quads etc.), automatic normal generation and material properties are
 currently not supported.
 
+Files opened using @ref openFile() are memory-mapped and parsed in place, data
+passed to @ref openData() are copied first.
+
+@section ObjImporter-parallel Parallel parsing
+
+Large meshes can be parsed on more threads, see @ref setThreadCount(). The
+mesh data are split into line-aligned chunks, each chunk is parsed separately
+and the results are then concatenated in original order, so the output
+(including any error messages) is the same as when parsing on single thread.
+
 This plugin is built if `WITH_OBJIMPORTER` is enabled when building %Magnum. To
 use dynamic plugin, you need to load `%ObjImporter` plugin from
 `MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a dependency
@@ -61,6 +71,23 @@ class ObjImporter: public AbstractImporter {
 
         ~ObjImporter();
 
+        /** @brief Count of threads used for parsing */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set count of threads used for parsing
+         * @return Reference to self (for method chaining)
+         *
+         * If set to `0`, the count is equal to count of hardware threads. Each
+         * thread parses at least 16 kB of data, so small meshes are always
+         * parsed on single thread. On platforms without thread support the
+         * value is ignored. Default is `1`.
+         */
+        ObjImporter& setThreadCount(UnsignedInt count) {
+            _threadCount = count;
+            return *this;
+        }
+
     private:
         struct File;
 
@@ -68,7 +95,6 @@ class ObjImporter: public AbstractImporter {
 
         bool doIsOpened() const override;
         void doOpenData(Containers::ArrayReference<const unsigned char> data) override;
-        void doOpenFile(const std::string& filename) override;
         void doClose() override;
 
         UnsignedInt doMesh3DCount() const override;
@@ -79,6 +105,7 @@ class ObjImporter: public AbstractImporter {
         void parseMeshNames();
 
         std::unique_ptr<File> _file;
+        UnsignedInt _threadCount;
 };
 
 }}
@@ -30,6 +30,9 @@
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/MeshData3D.h"
+#if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include "Magnum/Trade/AsyncImporter.h"
+#endif
 #include "MagnumPlugins/ObjImporter/ObjImporter.h"
 
 #include "configure.h"
@@ -55,6 +58,7 @@ class ObjImporterTest: public TestSuite::Tester {
         void namedMesh();
         void moreMeshes();
         void unnamedFirstMesh();
+        void tabSeparated();
 
         void wrongFloat();
         void wrongInteger();
@@ -89,6 +93,14 @@ class ObjImporterTest: public TestSuite::Tester {
 
         void unsupportedKeyword();
         void unknownKeyword();
+
+        void parallel();
+        void parallelMixedPrimitives();
+        void parallelError();
+
+        #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+        void async();
+        #endif
 };
 
 ObjImporterTest::ObjImporterTest() {
@@ -107,6 +119,7 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::namedMesh,
               &ObjImporterTest::moreMeshes,
               &ObjImporterTest::unnamedFirstMesh,
+              &ObjImporterTest::tabSeparated,
 
               &ObjImporterTest::wrongFloat,
               &ObjImporterTest::wrongInteger,
@@ -139,7 +152,41 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::wrongNormalIndexCount,
 
               &ObjImporterTest::unsupportedKeyword,
-              &ObjImporterTest::unknownKeyword});
+              &ObjImporterTest::unknownKeyword,
+
+              &ObjImporterTest::parallel,
+              &ObjImporterTest::parallelMixedPrimitives,
+              &ObjImporterTest::parallelError});
+
+    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    addTests({&ObjImporterTest::async});
+    #endif
+}
+
+namespace {
+    /* Large enough to be split into more chunks */
+    std::string generatedMesh(const std::string& indexData) {
+        std::ostringstream out;
+        for(std::size_t i = 0; i != 3000; ++i) out
+            << "v " << i*0.5f << " " << i*0.25f << " " << i*0.125f << '\n'
+            << "vt " << i*0.75f << " " << i*0.375f << '\n'
+            << "vn " << i*0.25f << " " << i*0.5f << " 1.5\n";
+        out << indexData;
+        return out.str();
+    }
+
+    std::string generatedTriangles() {
+        std::ostringstream out;
+        for(std::size_t i = 1; i != 2999; ++i) out
+            << "f " << i << '/' << i << '/' << i << ' '
+            << i + 1 << '/' << i + 1 << '/' << i + 1 << ' '
+            << i + 2 << '/' << i + 1 << '/' << i << '\n';
+        return out.str();
+    }
+
+    Containers::ArrayReference<const unsigned char> asData(const std::string& data) {
+        return {reinterpret_cast<const unsigned char*>(data.data()), data.size()};
+    }
 }
 
 void ObjImporterTest::pointMesh() {
@@ -399,6 +446,25 @@ void ObjImporterTest::unnamedFirstMesh() {
     CORRADE_COMPARE(importer.mesh3DForName("SecondMesh"), 1);
 }
 
+void ObjImporterTest::tabSeparated() {
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "tabSeparated.obj")));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+    CORRADE_COMPARE(importer.mesh3DName(0), "TabMesh");
+
+    const std::optional<MeshData3D> data = importer.mesh3D(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data->positions(0), (std::vector<Vector3>{
+        {0.5f, 2.0f, 3.0f},
+        {0.0f, 1.5f, 1.0f},
+        {2.0f, 3.0f, 5.5f}
+    }));
+    CORRADE_COMPARE(data->indices(), (std::vector<UnsignedInt>{
+        0, 1, 2
+    }));
+}
+
 void ObjImporterTest::wrongFloat() {
     ObjImporter importer;
     CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
@@ -732,6 +798,93 @@ void ObjImporterTest::unknownKeyword() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): unknown keyword bleh\n");
 }
 
+void ObjImporterTest::parallel() {
+    const std::string data = generatedMesh(generatedTriangles());
+
+    ObjImporter serialImporter;
+    CORRADE_VERIFY(serialImporter.openData(asData(data)));
+    const std::optional<MeshData3D> serial = serialImporter.mesh3D(0);
+    CORRADE_VERIFY(serial);
+
+    ObjImporter parallelImporter;
+    parallelImporter.setThreadCount(4);
+    CORRADE_VERIFY(parallelImporter.openData(asData(data)));
+    const std::optional<MeshData3D> parallel = parallelImporter.mesh3D(0);
+    CORRADE_VERIFY(parallel);
+
+    CORRADE_COMPARE(parallel->primitive(), serial->primitive());
+    CORRADE_COMPARE(parallel->indices(), serial->indices());
+    CORRADE_COMPARE(parallel->positions(0), serial->positions(0));
+    CORRADE_COMPARE(parallel->normals(0), serial->normals(0));
+    CORRADE_COMPARE(parallel->textureCoords2D(0), serial->textureCoords2D(0));
+}
+
+void ObjImporterTest::parallelMixedPrimitives() {
+    /* The triangles are in other chunks than the point */
+    const std::string data = "p 1\n" + generatedMesh(generatedTriangles());
+
+    ObjImporter importer;
+    importer.setThreadCount(4);
+    CORRADE_VERIFY(importer.openData(asData(data)));
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): mixed primitive MeshPrimitive::Points and MeshPrimitive::Triangles\n");
+}
+
+void ObjImporterTest::parallelError() {
+    /* Only the first error in file order should be reported */
+    const std::string data = "v 1 2\n" + generatedMesh(generatedTriangles() + "bleh\n");
+
+    ObjImporter importer;
+    importer.setThreadCount(4);
+    CORRADE_VERIFY(importer.openData(asData(data)));
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): invalid float array size\n");
+}
+
+#if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+void ObjImporterTest::async() {
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.features() & AbstractImporter::Feature::ThreadSafe);
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+
+    /* Import all meshes in parallel, the triangle mesh first */
+    AsyncImporter async(importer, 3);
+    AsyncResult<std::optional<MeshData3D>> points = async.mesh3D(0);
+    AsyncResult<std::optional<MeshData3D>> triangles = async.mesh3D(2, AsyncPriority::High);
+    std::optional<MeshData3D> lines;
+    async.mesh3D(1, [&lines](std::optional<MeshData3D> data) {
+        lines = std::move(data);
+    });
+
+    const std::optional<MeshData3D> data = points.get();
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(data->indices(), (std::vector<UnsignedInt>{
+        0, 1
+    }));
+
+    const std::optional<MeshData3D> data2 = triangles.get();
+    CORRADE_VERIFY(data2);
+    CORRADE_COMPARE(data2->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data2->indices(), (std::vector<UnsignedInt>{
+        0, 1, 2, 2, 1, 0
+    }));
+
+    async.wait();
+    CORRADE_VERIFY(lines);
+    CORRADE_COMPARE(lines->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(lines->indices(), (std::vector<UnsignedInt>{
+        0, 1, 1, 0
+    }));
+}
+#endif
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterTest)
@@ -0,0 +1,323 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ObjMeshConverter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Implementation/meshView.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+using MeshTools::Implementation::MeshView;
+using MeshTools::Implementation::meshView;
+
+/* Longest formatted float is -0.0000123456789, longest formatted index is
+   4294967295 */
+constexpr std::size_t MaxFloatSize = 16;
+constexpr std::size_t MaxIndexSize = 10;
+
+constexpr char DigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+template<std::size_t size> char* writeString(char* out, const char(&string)[size]) {
+    std::memcpy(out, string, size - 1);
+    return out + size - 1;
+}
+
+/* Writes exactly `count` digits of the value, including leading zeros */
+void writeDigits(char* const out, UnsignedLong value, const std::size_t count) {
+    char* it = out + count;
+    while(it - out >= 2) {
+        it -= 2;
+        std::memcpy(it, DigitPairs + (value % 100)*2, 2);
+        value /= 100;
+    }
+    if(it != out) *out = '0' + value % 10;
+}
+
+char* writeUnsigned(char* const out, const UnsignedInt value) {
+    std::size_t count = 1;
+    for(UnsignedInt i = value; i >= 10; i /= 10) ++count;
+    writeDigits(out, value, count);
+    return out + count;
+}
+
+/* Multiplies the value by power of ten. Powers up to 10^22 are exact in double
+   and dividing by them is correctly rounded, thus the error stays well below
+   float precision even for the smallest denormals. */
+Double scaleByPowerOfTen(Double value, Int exponent) {
+    static const Double powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    for(; exponent > 22; exponent -= 22) value *= powers[22];
+    for(; exponent < -22; exponent += 22) value /= powers[22];
+    return exponent >= 0 ? value*powers[exponent] : value/powers[-exponent];
+}
+
+/* Prints the shortest representation with six to nine significant digits
+   that reads back as the same value (nine digits are always enough) and strips
+   trailing zeros. Values between 1e-5 and 1e9 are printed in fixed notation,
+   the others in scientific notation. */
+char* writeFloat(char* out, const Float value) {
+    if(value != value) return writeString(out, "nan");
+
+    Double d = value;
+    if(d < 0.0) {
+        *out++ = '-';
+        d = -d;
+    }
+    if(d == 0.0) {
+        *out++ = '0';
+        return out;
+    }
+    if(d > std::numeric_limits<Float>::max()) return writeString(out, "inf");
+
+    /* Decimal exponent, fix it if log10() was imprecise */
+    Int exponent = Int(std::floor(std::log10(d)));
+    if(d >= scaleByPowerOfTen(1.0, exponent + 1)) ++exponent;
+    else if(d < scaleByPowerOfTen(1.0, exponent)) --exponent;
+
+    /* Find the shortest mantissa that round-trips */
+    static const UnsignedLong limits[] = {1000000ull, 10000000ull, 100000000ull, 1000000000ull};
+    UnsignedLong mantissa = 0;
+    Int precision = 6;
+    Int mantissaExponent = exponent;
+    for(; precision <= 9; ++precision) {
+        mantissaExponent = exponent;
+        mantissa = UnsignedLong(scaleByPowerOfTen(d, precision - 1 - exponent) + 0.5);
+        if(mantissa == limits[precision - 6]) {
+            mantissa /= 10;
+            ++mantissaExponent;
+        }
+
+        if(Float(scaleByPowerOfTen(Double(mantissa), mantissaExponent - precision + 1)) == Float(d))
+            break;
+    }
+    if(precision == 10) precision = 9;
+    exponent = mantissaExponent;
+
+    char digits[9];
+    writeDigits(digits, mantissa, precision);
+    Int digitCount = precision;
+    while(digits[digitCount - 1] == '0') --digitCount;
+
+    /* Fixed notation */
+    if(exponent >= -5 && exponent < 9) {
+        if(exponent < 0) {
+            *out++ = '0';
+            *out++ = '.';
+            for(Int i = 1; i != -exponent; ++i) *out++ = '0';
+            std::memcpy(out, digits, digitCount);
+            return out + digitCount;
+        }
+
+        const Int integerDigitCount = exponent + 1;
+        if(digitCount <= integerDigitCount) {
+            std::memcpy(out, digits, digitCount);
+            out += digitCount;
+            for(Int i = digitCount; i != integerDigitCount; ++i) *out++ = '0';
+            return out;
+        }
+
+        std::memcpy(out, digits, integerDigitCount);
+        out += integerDigitCount;
+        *out++ = '.';
+        std::memcpy(out, digits + integerDigitCount, digitCount - integerDigitCount);
+        return out + digitCount - integerDigitCount;
+    }
+
+    /* Scientific notation */
+    *out++ = digits[0];
+    if(digitCount > 1) {
+        *out++ = '.';
+        std::memcpy(out, digits + 1, digitCount - 1);
+        out += digitCount - 1;
+    }
+    *out++ = 'e';
+    if(exponent < 0) {
+        *out++ = '-';
+        exponent = -exponent;
+    }
+    return writeUnsigned(out, exponent);
+}
+
+Containers::Array<unsigned char> exportObj(const MeshView& mesh) {
+    UnsignedInt primitiveSize;
+    char keyword;
+    switch(mesh.primitive) {
+        case MeshPrimitive::Points: primitiveSize = 1; keyword = 'p'; break;
+        case MeshPrimitive::Lines: primitiveSize = 2; keyword = 'l'; break;
+        case MeshPrimitive::Triangles: primitiveSize = 3; keyword = 'f'; break;
+        default:
+            Error() << "Trade::ObjMeshConverter::exportToData(): unsupported primitive" << mesh.primitive;
+            return nullptr;
+    }
+
+    if(!mesh.positions || !mesh.vertexCount) {
+        Error() << "Trade::ObjMeshConverter::exportToData(): the mesh has no positions";
+        return nullptr;
+    }
+    if(mesh.normals && mesh.normalCount != mesh.vertexCount) {
+        Error() << "Trade::ObjMeshConverter::exportToData(): expected" << mesh.vertexCount << "normals but got" << mesh.normalCount;
+        return nullptr;
+    }
+    if(mesh.textureCoords && mesh.textureCoordCount != mesh.vertexCount) {
+        Error() << "Trade::ObjMeshConverter::exportToData(): expected" << mesh.vertexCount << "texture coordinates but got" << mesh.textureCoordCount;
+        return nullptr;
+    }
+    if(mesh.vertexCount > std::numeric_limits<UnsignedInt>::max()) {
+        Error() << "Trade::ObjMeshConverter::exportToData(): too many vertices";
+        return nullptr;
+    }
+
+    const std::size_t indexCount = mesh.indices ? mesh.indices->size() : mesh.vertexCount;
+    if(indexCount % primitiveSize) {
+        Error() << "Trade::ObjMeshConverter::exportToData(): index count" << indexCount << "is not divisible by" << primitiveSize;
+        return nullptr;
+    }
+    if(mesh.indices) {
+        const UnsignedInt maxIndex = *std::max_element(mesh.indices->begin(), mesh.indices->end());
+        if(maxIndex >= mesh.vertexCount) {
+            Error() << "Trade::ObjMeshConverter::exportToData(): index" << maxIndex << "out of bounds for" << mesh.vertexCount << "vertices";
+            return nullptr;
+        }
+    }
+
+    /* Lines can reference only texture coordinates, points nothing */
+    const bool textureCoords = mesh.textureCoords && mesh.primitive != MeshPrimitive::Points;
+    const bool normals = mesh.normals && mesh.primitive == MeshPrimitive::Triangles;
+
+    /* Upper bound of output size, each line is keyword, values separated by
+       spaces and a newline */
+    const std::size_t vertexLineSize = 3 + 3*(MaxFloatSize + 1);
+    const std::size_t indexSize = 1 + MaxIndexSize + (textureCoords || normals ? 2*(MaxIndexSize + 1) : 0);
+    const std::size_t capacity =
+        mesh.vertexCount*vertexLineSize*(1 + textureCoords + normals) +
+        indexCount/primitiveSize*(2 + primitiveSize*indexSize);
+    Containers::Array<unsigned char> buffer(capacity);
+    char* const begin = reinterpret_cast<char*>(buffer.begin());
+    char* out = begin;
+
+    /* Vertex data */
+    for(std::size_t i = 0; i != mesh.vertexCount; ++i) {
+        const Float* const position = mesh.positions + i*mesh.positionSize;
+        *out++ = 'v';
+        *out++ = ' ';
+        out = writeFloat(out, position[0]);
+        *out++ = ' ';
+        out = writeFloat(out, position[1]);
+        *out++ = ' ';
+        if(mesh.positionSize == 3) out = writeFloat(out, position[2]);
+        else *out++ = '0';
+        *out++ = '\n';
+    }
+    if(textureCoords) for(std::size_t i = 0; i != mesh.vertexCount; ++i) {
+        out = writeString(out, "vt ");
+        out = writeFloat(out, mesh.textureCoords[i].x());
+        *out++ = ' ';
+        out = writeFloat(out, mesh.textureCoords[i].y());
+        *out++ = '\n';
+    }
+    if(normals) for(std::size_t i = 0; i != mesh.vertexCount; ++i) {
+        out = writeString(out, "vn ");
+        out = writeFloat(out, mesh.normals[i].x());
+        *out++ = ' ';
+        out = writeFloat(out, mesh.normals[i].y());
+        *out++ = ' ';
+        out = writeFloat(out, mesh.normals[i].z());
+        *out++ = '\n';
+    }
+
+    /* Faces, indices are one-based and the same for all attributes */
+    for(std::size_t i = 0; i != indexCount; i += primitiveSize) {
+        *out++ = keyword;
+        for(std::size_t j = 0; j != primitiveSize; ++j) {
+            const UnsignedInt index = (mesh.indices ? (*mesh.indices)[i + j] : UnsignedInt(i + j)) + 1;
+            *out++ = ' ';
+            char* const indexBegin = out;
+            out = writeUnsigned(out, index);
+            const std::size_t indexSize = out - indexBegin;
+            if(textureCoords || normals) {
+                *out++ = '/';
+                if(textureCoords) {
+                    std::memcpy(out, indexBegin, indexSize);
+                    out += indexSize;
+                }
+                if(normals) {
+                    *out++ = '/';
+                    std::memcpy(out, indexBegin, indexSize);
+                    out += indexSize;
+                }
+            }
+        }
+        *out++ = '\n';
+    }
+
+    /* Shrink the output to the used part in place, without copying. The
+       unused tail stays allocated until the output is destroyed. */
+    CORRADE_INTERNAL_ASSERT(std::size_t(out - begin) <= capacity);
+    return Containers::Array<unsigned char>{buffer.release(), std::size_t(out - begin)};
+}
+
+}
+
+ObjMeshConverter::ObjMeshConverter() = default;
+
+ObjMeshConverter::ObjMeshConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractMeshConverter(manager, std::move(plugin)) {}
+
+auto ObjMeshConverter::doFeatures() const -> Features { return Feature::ConvertData2D|Feature::ConvertData3D; }
+
+Containers::Array<unsigned char> ObjMeshConverter::doExportToData(const MeshData2D& mesh) const {
+    return exportObj(meshView(mesh));
+}
+
+Containers::Array<unsigned char> ObjMeshConverter::doExportToData(const MeshData3D& mesh) const {
+    return exportObj(meshView(mesh));
+}
+
+}}
@@ -0,0 +1,91 @@
+#ifndef Magnum_Trade_ObjMeshConverter_h
+#define Magnum_Trade_ObjMeshConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ObjMeshConverter
+ */
+
+#include "Magnum/Trade/AbstractMeshConverter.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BUILD_STATIC
+    #if defined(ObjMeshConverter_EXPORTS) || defined(ObjMeshConverterObjects_EXPORTS)
+        #define MAGNUM_TRADE_OBJMESHCONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_TRADE_OBJMESHCONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_TRADE_OBJMESHCONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_TRADE_OBJMESHCONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief OBJ mesh converter plugin
+
+Exports two- and three-dimensional meshes with @ref MeshPrimitive::Points,
+@ref MeshPrimitive::Lines or @ref MeshPrimitive::Triangles to OBJ files which
+can be imported back using @ref ObjImporter. Only the first position, normal
+and texture coordinate array is exported, two-dimensional positions are
+exported with zero Z coordinate. Normals are referenced only from triangle
+faces and texture coordinates only from line and triangle faces, as the format
+doesn't allow anything else. Non-indexed meshes are exported as if they had
+trivial index buffer.
+
+This plugin is built if `WITH_OBJMESHCONVERTER` is enabled when building
+%Magnum. To use dynamic plugin, you need to load `%ObjMeshConverter` plugin
+from `MAGNUM_PLUGINS_MESHCONVERTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `%ObjMeshConverter`
+component of `%Magnum` package in CMake and link to
+`${MAGNUM_OBJMESHCONVERTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+Floating-point values are printed in the shortest form that reads back as the
+exact same value (with at most nine significant digits) using a
+locale-independent formatter that is several times faster than
+@ref std::snprintf(). Size of the output is estimated upfront, so the text is
+written to a single preallocated buffer.
+*/
+class MAGNUM_TRADE_OBJMESHCONVERTER_EXPORT ObjMeshConverter: public AbstractMeshConverter {
+    public:
+        /** @brief Default constructor */
+        explicit ObjMeshConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit ObjMeshConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+    private:
+        Features MAGNUM_TRADE_OBJMESHCONVERTER_LOCAL doFeatures() const override;
+        Containers::Array<unsigned char> MAGNUM_TRADE_OBJMESHCONVERTER_LOCAL doExportToData(const MeshData2D& mesh) const override;
+        Containers::Array<unsigned char> MAGNUM_TRADE_OBJMESHCONVERTER_LOCAL doExportToData(const MeshData3D& mesh) const override;
+};
+
+}}
+
+#endif
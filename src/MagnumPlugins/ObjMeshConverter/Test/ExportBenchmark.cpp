@@ -0,0 +1,145 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Test/Benchmark.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/ObjMeshConverter/ObjMeshConverter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class ExportBenchmark: public TestSuite::Tester {
+    public:
+        explicit ExportBenchmark();
+
+        void roundTrip();
+        void throughput();
+};
+
+namespace {
+
+constexpr Int Size = 512;
+constexpr std::size_t Repeats = 5;
+
+/* Wavy grid with normals and texture coordinates, similar to a terrain
+   patch */
+MeshData3D gridMesh() {
+    std::vector<Vector3> positions;
+    std::vector<Vector3> normals;
+    std::vector<Vector2> textureCoords;
+    positions.reserve(Size*Size);
+    normals.reserve(Size*Size);
+    textureCoords.reserve(Size*Size);
+    for(Int y = 0; y != Size; ++y) for(Int x = 0; x != Size; ++x) {
+        const Float u = Float(x)/(Size - 1);
+        const Float v = Float(y)/(Size - 1);
+        positions.push_back({u*100.0f - 50.0f, std::sin(u*17.0f)*std::cos(v*13.0f)*3.7f, v*100.0f - 50.0f});
+        normals.push_back(Vector3{std::cos(u*17.0f)*0.3f, 1.0f, std::sin(v*13.0f)*0.3f}.normalized());
+        textureCoords.push_back({u, v});
+    }
+
+    std::vector<UnsignedInt> indices;
+    indices.reserve((Size - 1)*(Size - 1)*6);
+    for(Int y = 0; y != Size - 1; ++y) for(Int x = 0; x != Size - 1; ++x) {
+        const UnsignedInt i = y*Size + x;
+        indices.insert(indices.end(), {i, i + 1, i + Size, i + Size, i + 1, i + Size + 1});
+    }
+
+    return MeshData3D(MeshPrimitive::Triangles, std::move(indices), {std::move(positions)}, {std::move(normals)}, {std::move(textureCoords)});
+}
+
+/* Straightforward implementation using std::snprintf() for comparison */
+std::string exportSnprintf(const MeshData3D& mesh) {
+    std::string out;
+    char buffer[128];
+    for(const Vector3& v: mesh.positions(0)) {
+        out.append(buffer, std::snprintf(buffer, sizeof(buffer), "v %.9g %.9g %.9g\n", v.x(), v.y(), v.z()));
+    }
+    for(const Vector2& v: mesh.textureCoords2D(0)) {
+        out.append(buffer, std::snprintf(buffer, sizeof(buffer), "vt %.9g %.9g\n", v.x(), v.y()));
+    }
+    for(const Vector3& v: mesh.normals(0)) {
+        out.append(buffer, std::snprintf(buffer, sizeof(buffer), "vn %.9g %.9g %.9g\n", v.x(), v.y(), v.z()));
+    }
+    const std::vector<UnsignedInt>& indices = mesh.indices();
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt a = indices[i] + 1, b = indices[i + 1] + 1, c = indices[i + 2] + 1;
+        out.append(buffer, std::snprintf(buffer, sizeof(buffer), "f %u/%u/%u %u/%u/%u %u/%u/%u\n", a, a, a, b, b, b, c, c, c));
+    }
+    return out;
+}
+
+}
+
+ExportBenchmark::ExportBenchmark() {
+    addTests({&ExportBenchmark::roundTrip,
+              &ExportBenchmark::throughput});
+}
+
+void ExportBenchmark::roundTrip() {
+    const MeshData3D mesh = gridMesh();
+    const Containers::Array<unsigned char> data = ObjMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+
+    /* All positions should read back exactly, they're written first */
+    const std::string string(reinterpret_cast<const char*>(data.begin()), data.size());
+    const char* position = string.data();
+    for(const Vector3& v: mesh.positions(0)) {
+        CORRADE_VERIFY(position[0] == 'v' && position[1] == ' ');
+        char* end;
+        const Float x = std::strtof(position + 2, &end);
+        const Float y = std::strtof(end, &end);
+        const Float z = std::strtof(end, &end);
+        CORRADE_VERIFY(*end == '\n');
+        if(x != v.x() || y != v.y() || z != v.z()) CORRADE_COMPARE(Vector3(x, y, z), v);
+        position = end + 1;
+    }
+}
+
+void ExportBenchmark::throughput() {
+    const MeshData3D mesh = gridMesh();
+    ObjMeshConverter converter;
+
+    Containers::Array<unsigned char> data;
+    std::string reference;
+    const Double fast = Magnum::Test::averageDuration(Repeats, [&]() { data = converter.exportToData(mesh); });
+    const Double naive = Magnum::Test::averageDuration(Repeats, [&]() { reference = exportSnprintf(mesh); });
+    CORRADE_VERIFY(data);
+
+    Debug() << "Output size:" << Double(data.size())/(1024*1024) << "MB, snprintf():" << Double(reference.size())/(1024*1024) << "MB";
+    Debug() << "ObjMeshConverter:" << fast << "ms," << Double(data.size())/(1024*1024)*1000/fast << "MB/s";
+    Debug() << "snprintf():" << naive << "ms," << Double(reference.size())/(1024*1024)*1000/naive << "MB/s";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ExportBenchmark)
@@ -0,0 +1,251 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/ObjMeshConverter/ObjMeshConverter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class ObjMeshConverterTest: public TestSuite::Tester {
+    public:
+        explicit ObjMeshConverterTest();
+
+        void floats();
+        void triangles();
+        void trianglesNotIndexed();
+        void lines2D();
+        void points();
+
+        void unsupportedPrimitive();
+        void noPositions();
+        void wrongNormalCount();
+        void wrongTextureCoordinateCount();
+        void wrongIndexCount();
+        void indexOutOfBounds();
+};
+
+ObjMeshConverterTest::ObjMeshConverterTest() {
+    addTests({&ObjMeshConverterTest::floats,
+              &ObjMeshConverterTest::triangles,
+              &ObjMeshConverterTest::trianglesNotIndexed,
+              &ObjMeshConverterTest::lines2D,
+              &ObjMeshConverterTest::points,
+
+              &ObjMeshConverterTest::unsupportedPrimitive,
+              &ObjMeshConverterTest::noPositions,
+              &ObjMeshConverterTest::wrongNormalCount,
+              &ObjMeshConverterTest::wrongTextureCoordinateCount,
+              &ObjMeshConverterTest::wrongIndexCount,
+              &ObjMeshConverterTest::indexOutOfBounds});
+}
+
+namespace {
+    std::string toString(const Containers::Array<unsigned char>& data) {
+        return std::string(reinterpret_cast<const char*>(data.begin()), data.size());
+    }
+}
+
+void ObjMeshConverterTest::floats() {
+    const MeshData3D mesh(MeshPrimitive::Points, {}, {{
+        {0.0f, -0.0f, 1.0f},
+        {-0.5f, 0.1f, 100.0f},
+        {123456789.0f, 1.0e9f, 1.0e-5f},
+        {0.000012345f, 2.0f/3.0f, -1.5e-20f},
+        {3.4028235e38f, 1.0e-45f, 99999.99f}}}, {}, {});
+
+    const auto data = ObjMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(toString(data),
+        "v 0 0 1\n"
+        "v -0.5 0.1 100\n"
+        "v 123456790 1e9 0.00001\n"
+        "v 0.000012345 0.6666667 -1.5e-20\n"
+        "v 3.4028235e38 1.4013e-45 99999.99\n"
+        "p 1\n"
+        "p 2\n"
+        "p 3\n"
+        "p 4\n"
+        "p 5\n");
+}
+
+void ObjMeshConverterTest::triangles() {
+    const MeshData3D mesh(MeshPrimitive::Triangles, {0, 1, 2, 2, 1, 3}, {{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f}}}, {{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f}}}, {{
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {0.0f, 1.0f},
+        {1.0f, 1.0f}}});
+
+    const auto data = ObjMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(toString(data),
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 0 1 0\n"
+        "v 1 1 0\n"
+        "vt 0 0\n"
+        "vt 1 0\n"
+        "vt 0 1\n"
+        "vt 1 1\n"
+        "vn 0 0 1\n"
+        "vn 0 0 1\n"
+        "vn 0 0 1\n"
+        "vn 0 0 1\n"
+        "f 1/1/1 2/2/2 3/3/3\n"
+        "f 3/3/3 2/2/2 4/4/4\n");
+}
+
+void ObjMeshConverterTest::trianglesNotIndexed() {
+    const MeshData3D mesh(MeshPrimitive::Triangles, {}, {{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}}}, {{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f}}}, {});
+
+    const auto data = ObjMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(toString(data),
+        "v 0 0 0\n"
+        "v 1 0 0\n"
+        "v 0 1 0\n"
+        "vn 0 0 1\n"
+        "vn 0 0 1\n"
+        "vn 0 0 1\n"
+        "f 1//1 2//2 3//3\n");
+}
+
+void ObjMeshConverterTest::lines2D() {
+    const MeshData2D mesh(MeshPrimitive::Lines, {1, 0, 0, 2}, {{
+        {0.5f, 1.5f},
+        {-1.0f, 2.0f},
+        {0.25f, 0.75f}}}, {{
+        {0.0f, 0.5f},
+        {1.0f, 0.5f},
+        {0.5f, 1.0f}}});
+
+    /* Texture coordinates are referenced from lines */
+    const auto data = ObjMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(toString(data),
+        "v 0.5 1.5 0\n"
+        "v -1 2 0\n"
+        "v 0.25 0.75 0\n"
+        "vt 0 0.5\n"
+        "vt 1 0.5\n"
+        "vt 0.5 1\n"
+        "l 2/2 1/1\n"
+        "l 1/1 3/3\n");
+}
+
+void ObjMeshConverterTest::points() {
+    const MeshData3D mesh(MeshPrimitive::Points, {1, 0}, {{
+        {0.5f, 1.5f, 2.5f},
+        {-1.0f, 2.0f, -3.0f}}}, {{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f}}}, {});
+
+    /* Points can't reference anything else than positions */
+    const auto data = ObjMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(toString(data),
+        "v 0.5 1.5 2.5\n"
+        "v -1 2 -3\n"
+        "p 2\n"
+        "p 1\n");
+}
+
+void ObjMeshConverterTest::unsupportedPrimitive() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh(MeshPrimitive::TriangleStrip, {}, {{{}, {}, {}}}, {}, {});
+    CORRADE_VERIFY(!ObjMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::ObjMeshConverter::exportToData(): unsupported primitive MeshPrimitive::TriangleStrip\n");
+}
+
+void ObjMeshConverterTest::noPositions() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh(MeshPrimitive::Triangles, {}, {{}}, {}, {});
+    CORRADE_VERIFY(!ObjMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::ObjMeshConverter::exportToData(): the mesh has no positions\n");
+}
+
+void ObjMeshConverterTest::wrongNormalCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh(MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {{{}, {}}}, {});
+    CORRADE_VERIFY(!ObjMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::ObjMeshConverter::exportToData(): expected 3 normals but got 2\n");
+}
+
+void ObjMeshConverterTest::wrongTextureCoordinateCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData2D mesh(MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {{{}, {}, {}, {}}});
+    CORRADE_VERIFY(!ObjMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::ObjMeshConverter::exportToData(): expected 3 texture coordinates but got 4\n");
+}
+
+void ObjMeshConverterTest::wrongIndexCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh(MeshPrimitive::Lines, {0, 1, 2}, {{{}, {}, {}}}, {}, {});
+    CORRADE_VERIFY(!ObjMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::ObjMeshConverter::exportToData(): index count 3 is not divisible by 2\n");
+}
+
+void ObjMeshConverterTest::indexOutOfBounds() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh(MeshPrimitive::Triangles, {0, 3, 1}, {{{}, {}, {}}}, {}, {});
+    CORRADE_VERIFY(!ObjMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::ObjMeshConverter::exportToData(): index 3 out of bounds for 3 vertices\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjMeshConverterTest)
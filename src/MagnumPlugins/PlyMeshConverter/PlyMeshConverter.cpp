@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PlyMeshConverter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Implementation/meshView.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+using MeshTools::Implementation::MeshView;
+using MeshTools::Implementation::meshView;
+
+template<class T> unsigned char* write(unsigned char* const out, const T& value) {
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+}
+
+unsigned char* writeVertex(unsigned char* out, const MeshView& mesh, const UnsignedInt id) {
+    std::memcpy(out, mesh.positions + id*mesh.positionSize, mesh.positionSize*sizeof(Float));
+    out += mesh.positionSize*sizeof(Float);
+    if(mesh.normals) out = write(out, mesh.normals[id]);
+    if(mesh.textureCoords) out = write(out, mesh.textureCoords[id]);
+    return out;
+}
+
+Containers::Array<unsigned char> exportPly(const MeshView& mesh) {
+    UnsignedInt primitiveSize;
+    switch(mesh.primitive) {
+        case MeshPrimitive::Points: primitiveSize = 1; break;
+        case MeshPrimitive::Lines: primitiveSize = 2; break;
+        case MeshPrimitive::Triangles: primitiveSize = 3; break;
+        default:
+            Error() << "Trade::PlyMeshConverter::exportToData(): unsupported primitive" << mesh.primitive;
+            return nullptr;
+    }
+
+    if(!mesh.positions || !mesh.vertexCount) {
+        Error() << "Trade::PlyMeshConverter::exportToData(): the mesh has no positions";
+        return nullptr;
+    }
+    if(mesh.normals && mesh.normalCount != mesh.vertexCount) {
+        Error() << "Trade::PlyMeshConverter::exportToData(): expected" << mesh.vertexCount << "normals but got" << mesh.normalCount;
+        return nullptr;
+    }
+    if(mesh.textureCoords && mesh.textureCoordCount != mesh.vertexCount) {
+        Error() << "Trade::PlyMeshConverter::exportToData(): expected" << mesh.vertexCount << "texture coordinates but got" << mesh.textureCoordCount;
+        return nullptr;
+    }
+    if(mesh.vertexCount > std::numeric_limits<UnsignedInt>::max()) {
+        Error() << "Trade::PlyMeshConverter::exportToData(): too many vertices";
+        return nullptr;
+    }
+
+    const std::size_t indexCount = mesh.indices ? mesh.indices->size() : mesh.vertexCount;
+    if(indexCount % primitiveSize) {
+        Error() << "Trade::PlyMeshConverter::exportToData(): index count" << indexCount << "is not divisible by" << primitiveSize;
+        return nullptr;
+    }
+    if(mesh.indices) {
+        const UnsignedInt maxIndex = *std::max_element(mesh.indices->begin(), mesh.indices->end());
+        if(maxIndex >= mesh.vertexCount) {
+            Error() << "Trade::PlyMeshConverter::exportToData(): index" << maxIndex << "out of bounds for" << mesh.vertexCount << "vertices";
+            return nullptr;
+        }
+    }
+
+    /* Points have no connectivity, indexed points are saved in index order */
+    const bool points = mesh.primitive == MeshPrimitive::Points;
+    const std::size_t vertexCount = points ? indexCount : mesh.vertexCount;
+    const std::size_t primitiveCount = points ? 0 : indexCount/primitiveSize;
+
+    /* Header */
+    std::ostringstream header;
+    header << "ply\nformat " << (Utility::Endianness::isBigEndian() ? "binary_big_endian" : "binary_little_endian") << " 1.0\n"
+        << "element vertex " << vertexCount << "\n"
+        << "property float x\nproperty float y\n";
+    if(mesh.positionSize == 3) header << "property float z\n";
+    if(mesh.normals) header << "property float nx\nproperty float ny\nproperty float nz\n";
+    if(mesh.textureCoords) header << "property float s\nproperty float t\n";
+    if(mesh.primitive == MeshPrimitive::Triangles)
+        header << "element face " << primitiveCount << "\nproperty list uchar uint vertex_indices\n";
+    else if(mesh.primitive == MeshPrimitive::Lines)
+        header << "element edge " << primitiveCount << "\nproperty uint vertex1\nproperty uint vertex2\n";
+    header << "end_header\n";
+    const std::string headerString = header.str();
+
+    /* Calculate output size */
+    const std::size_t vertexSize = sizeof(Float)*(mesh.positionSize + (mesh.normals ? 3 : 0) + (mesh.textureCoords ? 2 : 0));
+    const std::size_t primitiveRecordSize = mesh.primitive == MeshPrimitive::Triangles ? 1 + 3*sizeof(UnsignedInt) : primitiveSize*sizeof(UnsignedInt);
+    Containers::Array<unsigned char> data(headerString.size() + vertexCount*vertexSize + primitiveCount*primitiveRecordSize);
+    unsigned char* out = data.begin();
+    std::memcpy(out, headerString.data(), headerString.size());
+    out += headerString.size();
+
+    /* Vertices */
+    if(points && mesh.indices) for(const UnsignedInt index: *mesh.indices)
+        out = writeVertex(out, mesh, index);
+    else for(std::size_t i = 0; i != mesh.vertexCount; ++i)
+        out = writeVertex(out, mesh, i);
+
+    /* Faces or edges */
+    if(!points) for(std::size_t i = 0; i != indexCount; i += primitiveSize) {
+        if(primitiveSize == 3) *out++ = 3;
+        if(mesh.indices) {
+            std::memcpy(out, mesh.indices->data() + i, primitiveSize*sizeof(UnsignedInt));
+            out += primitiveSize*sizeof(UnsignedInt);
+        } else for(std::size_t j = 0; j != primitiveSize; ++j)
+            out = write(out, UnsignedInt(i + j));
+    }
+
+    CORRADE_INTERNAL_ASSERT(out == data.end());
+    return data;
+}
+
+}
+
+PlyMeshConverter::PlyMeshConverter() = default;
+
+PlyMeshConverter::PlyMeshConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractMeshConverter(manager, std::move(plugin)) {}
+
+auto PlyMeshConverter::doFeatures() const -> Features { return Feature::ConvertData2D|Feature::ConvertData3D; }
+
+Containers::Array<unsigned char> PlyMeshConverter::doExportToData(const MeshData2D& mesh) const {
+    return exportPly(meshView(mesh));
+}
+
+Containers::Array<unsigned char> PlyMeshConverter::doExportToData(const MeshData3D& mesh) const {
+    return exportPly(meshView(mesh));
+}
+
+}}
@@ -0,0 +1,88 @@
+#ifndef Magnum_Trade_PlyMeshConverter_h
+#define Magnum_Trade_PlyMeshConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::PlyMeshConverter
+ */
+
+#include "Magnum/Trade/AbstractMeshConverter.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BUILD_STATIC
+    #if defined(PlyMeshConverter_EXPORTS) || defined(PlyMeshConverterObjects_EXPORTS)
+        #define MAGNUM_TRADE_PLYMESHCONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_TRADE_PLYMESHCONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_TRADE_PLYMESHCONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_TRADE_PLYMESHCONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief PLY mesh converter plugin
+
+Exports two- and three-dimensional meshes with @ref MeshPrimitive::Points,
+@ref MeshPrimitive::Lines or @ref MeshPrimitive::Triangles to binary PLY
+files. Positions, normals and texture coordinates from the first array of each
+are saved as interleaved `x`, `y`, `z`, `nx`, `ny`, `nz`, `s` and `t` float
+vertex properties, with `z` omitted for two-dimensional meshes. Triangles are
+saved as `face` elements, lines as `edge` elements. Points have no
+connectivity, so for indexed point meshes the vertices are saved in index
+order. The data are saved in machine byte order.
+
+This plugin is built if `WITH_PLYMESHCONVERTER` is enabled when building
+%Magnum. To use dynamic plugin, you need to load `%PlyMeshConverter` plugin
+from `MAGNUM_PLUGINS_MESHCONVERTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `%PlyMeshConverter`
+component of `%Magnum` package in CMake and link to
+`${MAGNUM_PLYMESHCONVERTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+Size of the output is calculated upfront and the data are written to it
+directly without any intermediate buffering.
+*/
+class MAGNUM_TRADE_PLYMESHCONVERTER_EXPORT PlyMeshConverter: public AbstractMeshConverter {
+    public:
+        /** @brief Default constructor */
+        explicit PlyMeshConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit PlyMeshConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+    private:
+        Features MAGNUM_TRADE_PLYMESHCONVERTER_LOCAL doFeatures() const override;
+        Containers::Array<unsigned char> MAGNUM_TRADE_PLYMESHCONVERTER_LOCAL doExportToData(const MeshData2D& mesh) const override;
+        Containers::Array<unsigned char> MAGNUM_TRADE_PLYMESHCONVERTER_LOCAL doExportToData(const MeshData3D& mesh) const override;
+};
+
+}}
+
+#endif
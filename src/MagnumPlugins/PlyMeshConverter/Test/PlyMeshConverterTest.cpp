@@ -0,0 +1,235 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/PlyMeshConverter/PlyMeshConverter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class PlyMeshConverterTest: public TestSuite::Tester {
+    public:
+        explicit PlyMeshConverterTest();
+
+        void triangles();
+        void trianglesNotIndexed();
+        void lines2D();
+        void points();
+
+        void unsupportedPrimitive();
+        void wrongNormalCount();
+        void indexOutOfBounds();
+};
+
+PlyMeshConverterTest::PlyMeshConverterTest() {
+    addTests({&PlyMeshConverterTest::triangles,
+              &PlyMeshConverterTest::trianglesNotIndexed,
+              &PlyMeshConverterTest::lines2D,
+              &PlyMeshConverterTest::points,
+
+              &PlyMeshConverterTest::unsupportedPrimitive,
+              &PlyMeshConverterTest::wrongNormalCount,
+              &PlyMeshConverterTest::indexOutOfBounds});
+}
+
+namespace {
+    const std::string format = Utility::Endianness::isBigEndian() ?
+        "format binary_big_endian 1.0\n" : "format binary_little_endian 1.0\n";
+
+    /* Splits the output into header and binary data */
+    std::pair<std::string, std::string> split(const Containers::Array<unsigned char>& data) {
+        const std::string string(reinterpret_cast<const char*>(data.begin()), data.size());
+        const std::size_t end = string.find("end_header\n") + 11;
+        return {string.substr(0, end), string.substr(end)};
+    }
+
+    template<class T> std::string binary(std::initializer_list<T> values) {
+        std::string out(values.size()*sizeof(T), '\0');
+        std::memcpy(&out[0], values.begin(), out.size());
+        return out;
+    }
+}
+
+void PlyMeshConverterTest::triangles() {
+    const MeshData3D mesh(MeshPrimitive::Triangles, {0, 1, 2, 2, 1, 3}, {{
+        {0.0f, 0.5f, 1.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f}}}, {{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, -1.0f}}}, {{
+        {0.0f, 0.25f},
+        {1.0f, 0.0f},
+        {0.0f, 1.0f},
+        {1.0f, 0.75f}}});
+
+    const auto data = PlyMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+
+    const auto out = split(data);
+    CORRADE_COMPARE(out.first, "ply\n" + format +
+        "element vertex 4\n"
+        "property float x\n"
+        "property float y\n"
+        "property float z\n"
+        "property float nx\n"
+        "property float ny\n"
+        "property float nz\n"
+        "property float s\n"
+        "property float t\n"
+        "element face 2\n"
+        "property list uchar uint vertex_indices\n"
+        "end_header\n");
+
+    std::string expected = binary<Float>({
+        0.0f, 0.5f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.25f,
+        1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+        1.0f, 1.0f, 0.0f, 0.0f, 0.0f, -1.0f, 1.0f, 0.75f});
+    expected += '\x03' + binary<UnsignedInt>({0, 1, 2});
+    expected += '\x03' + binary<UnsignedInt>({2, 1, 3});
+    CORRADE_COMPARE(out.second.size(), expected.size());
+    CORRADE_VERIFY(out.second == expected);
+}
+
+void PlyMeshConverterTest::trianglesNotIndexed() {
+    const MeshData3D mesh(MeshPrimitive::Triangles, {}, {{
+        {0.0f, 0.5f, 1.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}}}, {}, {});
+
+    const auto data = PlyMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+
+    const auto out = split(data);
+    CORRADE_COMPARE(out.first, "ply\n" + format +
+        "element vertex 3\n"
+        "property float x\n"
+        "property float y\n"
+        "property float z\n"
+        "element face 1\n"
+        "property list uchar uint vertex_indices\n"
+        "end_header\n");
+
+    std::string expected = binary<Float>({
+        0.0f, 0.5f, 1.0f,
+        1.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f});
+    expected += '\x03' + binary<UnsignedInt>({0, 1, 2});
+    CORRADE_VERIFY(out.second == expected);
+}
+
+void PlyMeshConverterTest::lines2D() {
+    const MeshData2D mesh(MeshPrimitive::Lines, {1, 0, 0, 2}, {{
+        {0.5f, 1.5f},
+        {-1.0f, 2.0f},
+        {0.25f, 0.75f}}}, {});
+
+    const auto data = PlyMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+
+    const auto out = split(data);
+    CORRADE_COMPARE(out.first, "ply\n" + format +
+        "element vertex 3\n"
+        "property float x\n"
+        "property float y\n"
+        "element edge 2\n"
+        "property uint vertex1\n"
+        "property uint vertex2\n"
+        "end_header\n");
+
+    std::string expected = binary<Float>({
+        0.5f, 1.5f,
+        -1.0f, 2.0f,
+        0.25f, 0.75f});
+    expected += binary<UnsignedInt>({1, 0, 0, 2});
+    CORRADE_VERIFY(out.second == expected);
+}
+
+void PlyMeshConverterTest::points() {
+    const MeshData2D mesh(MeshPrimitive::Points, {1, 0, 1}, {{
+        {0.5f, 1.5f},
+        {-1.0f, 2.0f}}}, {{
+        {0.0f, 1.0f},
+        {1.0f, 0.0f}}});
+
+    /* Indexed points are saved in index order */
+    const auto data = PlyMeshConverter().exportToData(mesh);
+    CORRADE_VERIFY(data);
+
+    const auto out = split(data);
+    CORRADE_COMPARE(out.first, "ply\n" + format +
+        "element vertex 3\n"
+        "property float x\n"
+        "property float y\n"
+        "property float s\n"
+        "property float t\n"
+        "end_header\n");
+    CORRADE_VERIFY(out.second == binary<Float>({
+        -1.0f, 2.0f, 1.0f, 0.0f,
+        0.5f, 1.5f, 0.0f, 1.0f,
+        -1.0f, 2.0f, 1.0f, 0.0f}));
+}
+
+void PlyMeshConverterTest::unsupportedPrimitive() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh(MeshPrimitive::TriangleStrip, {}, {{{}, {}, {}}}, {}, {});
+    CORRADE_VERIFY(!PlyMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::PlyMeshConverter::exportToData(): unsupported primitive MeshPrimitive::TriangleStrip\n");
+}
+
+void PlyMeshConverterTest::wrongNormalCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh(MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {{{}, {}}}, {});
+    CORRADE_VERIFY(!PlyMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::PlyMeshConverter::exportToData(): expected 3 normals but got 2\n");
+}
+
+void PlyMeshConverterTest::indexOutOfBounds() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const MeshData3D mesh(MeshPrimitive::Triangles, {0, 3, 1}, {{{}, {}, {}}}, {}, {});
+    CORRADE_VERIFY(!PlyMeshConverter().exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::PlyMeshConverter::exportToData(): index 3 out of bounds for 3 vertices\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::PlyMeshConverterTest)
@@ -0,0 +1,126 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Image.h"
+#include "Magnum/Test/Benchmark.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
+#include "MagnumPlugins/TgaImporter/TgaImporter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class RleBenchmark: public TestSuite::Tester {
+    public:
+        explicit RleBenchmark();
+
+        void roundTrip();
+        void throughput();
+};
+
+namespace {
+
+constexpr Int Size = 1024;
+constexpr std::size_t Repeats = 10;
+
+/* Mostly empty grayscale image with scattered glyph-like blocks, similar to
+   font atlases produced by MagnumFontConverter */
+Containers::Array<char> atlasData() {
+    Containers::Array<char> data = Containers::Array<char>::zeroInitialized(Size*Size);
+    UnsignedInt seed = 17;
+    for(Int block = 0; block != 400; ++block) {
+        seed = seed*1103515245 + 12345;
+        const Int x = (seed >> 8) % (Size - 24);
+        seed = seed*1103515245 + 12345;
+        const Int y = (seed >> 8) % (Size - 24);
+        for(Int j = 0; j != 24; ++j) for(Int i = 0; i != 24; ++i)
+            data[(y + j)*Size + x + i] = char((i*j + block) % 256);
+    }
+
+    return data;
+}
+
+}
+
+RleBenchmark::RleBenchmark() {
+    addTests({&RleBenchmark::roundTrip,
+              &RleBenchmark::throughput});
+}
+
+void RleBenchmark::roundTrip() {
+    const Containers::Array<char> original = atlasData();
+    const ImageReference2D image(ColorFormat::Red, ColorType::UnsignedByte, {Size, Size}, original);
+
+    TgaImageConverter converter;
+    converter.setRleCompression(true);
+    const Containers::Array<unsigned char> data = converter.exportToData(image);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(data.size() < original.size()/4);
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<ImageData2D> imported = importer.image2D(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->size(), Vector2i(Size));
+    CORRADE_VERIFY(std::equal(original.begin(), original.end(), reinterpret_cast<const char*>(imported->data())));
+}
+
+void RleBenchmark::throughput() {
+    const Containers::Array<char> original = atlasData();
+    const ImageReference2D image(ColorFormat::Red, ColorType::UnsignedByte, {Size, Size}, original);
+    const Double megabytes = Double(original.size())/(1024*1024);
+
+    TgaImageConverter rawConverter;
+    TgaImageConverter rleConverter;
+    rleConverter.setRleCompression(true);
+
+    Containers::Array<unsigned char> raw, rle;
+    const Double rawEncode = Magnum::Test::averageDuration(Repeats, [&]() { raw = rawConverter.exportToData(image); });
+    const Double rleEncode = Magnum::Test::averageDuration(Repeats, [&]() { rle = rleConverter.exportToData(image); });
+    CORRADE_VERIFY(raw && rle);
+
+    TgaImporter importer;
+    const Double rawDecode = Magnum::Test::averageDuration(Repeats, [&]() {
+        importer.openPersistentData(raw);
+        importer.image2D(0);
+    });
+    const Double rleDecode = Magnum::Test::averageDuration(Repeats, [&]() {
+        importer.openPersistentData(rle);
+        importer.image2D(0);
+    });
+
+    Debug() << "Compression ratio:" << Double(raw.size())/rle.size();
+    Debug() << "Raw encode:" << rawEncode << "ms," << megabytes*1000/rawEncode << "MB/s";
+    Debug() << "RLE encode:" << rleEncode << "ms," << megabytes*1000/rleEncode << "MB/s";
+    Debug() << "Raw decode:" << rawDecode << "ms," << megabytes*1000/rawDecode << "MB/s";
+    Debug() << "RLE decode:" << rleDecode << "ms," << megabytes*1000/rleDecode << "MB/s";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::RleBenchmark)
@@ -47,6 +47,9 @@ class TgaImageConverterTest: public TestSuite::Tester {
         void wrongType();
 
         void data();
+        void dataRle();
+        void dataRleGrayscale();
+        void dataRleLongRuns();
 };
 
 namespace {
@@ -67,7 +70,10 @@ TgaImageConverterTest::TgaImageConverterTest() {
     addTests({&TgaImageConverterTest::wrongFormat,
               &TgaImageConverterTest::wrongType,
 
-              &TgaImageConverterTest::data});
+              &TgaImageConverterTest::data,
+              &TgaImageConverterTest::dataRle,
+              &TgaImageConverterTest::dataRleGrayscale,
+              &TgaImageConverterTest::dataRleLongRuns});
 }
 
 void TgaImageConverterTest::wrongFormat() {
@@ -111,6 +117,95 @@ void TgaImageConverterTest::data() {
                     std::string(reinterpret_cast<const char*>(original.data()), 2*3*3));
 }
 
+void TgaImageConverterTest::dataRle() {
+    constexpr char originalData[] = {
+        1, 2, 3, 1, 2, 3, 1, 2, 3,
+        1, 2, 3, 2, 3, 4, 3, 4, 5,
+        5, 6, 7, 5, 6, 7, 6, 7, 8
+    };
+    #ifndef MAGNUM_TARGET_GLES
+    const ImageReference2D original(ColorFormat::BGR, ColorType::UnsignedByte, {3, 3}, originalData);
+    #else
+    const ImageReference2D original(ColorFormat::RGB, ColorType::UnsignedByte, {3, 3}, originalData);
+    #endif
+
+    TgaImageConverter converter;
+    converter.setRleCompression(true);
+    const auto data = converter.exportToData(original);
+    CORRADE_VERIFY(data);
+
+    /* Run of three; raw packet of three; run of two and raw packet of one */
+    CORRADE_COMPARE(data.size(), 18 + 4 + 10 + (4 + 4));
+    CORRADE_COMPARE(data[2], 10);
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<Trade::ImageData2D> converted = importer.image2D(0);
+    CORRADE_VERIFY(converted);
+
+    CORRADE_COMPARE(converted->size(), Vector2i(3, 3));
+    CORRADE_COMPARE(converted->format(), original.format());
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(converted->data()), 3*3*3),
+                    std::string(originalData, 3*3*3));
+}
+
+void TgaImageConverterTest::dataRleGrayscale() {
+    constexpr char originalData[] = {
+        7, 7, 7, 7,
+        1, 1, 2, 3,
+        4, 4, 4, 5
+    };
+    const ImageReference2D original(ColorFormat::Red, ColorType::UnsignedByte, {4, 3}, originalData);
+
+    TgaImageConverter converter;
+    converter.setRleCompression(true);
+    const auto data = converter.exportToData(original);
+    CORRADE_VERIFY(data);
+
+    /* Run of four; two-pixel runs are kept in raw packets; run of three and
+       raw packet of one */
+    CORRADE_COMPARE(data.size(), 18 + 2 + 5 + (2 + 2));
+    CORRADE_COMPARE(data[2], 11);
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<Trade::ImageData2D> converted = importer.image2D(0);
+    CORRADE_VERIFY(converted);
+
+    CORRADE_COMPARE(converted->size(), Vector2i(4, 3));
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(converted->data()), 4*3),
+                    std::string(originalData, 4*3));
+}
+
+void TgaImageConverterTest::dataRleLongRuns() {
+    /* Runs and raw packets longer than 128 pixels need to be split */
+    Containers::Array<char> originalData(300*2*4);
+    for(std::size_t i = 0; i != 300*4; ++i) originalData[i] = char(i/4 % 251);
+    for(std::size_t i = 300*4; i != 300*2*4; ++i) originalData[i] = char(i % 4);
+    #ifndef MAGNUM_TARGET_GLES
+    const ImageReference2D original(ColorFormat::BGRA, ColorType::UnsignedByte, {300, 2}, originalData);
+    #else
+    const ImageReference2D original(ColorFormat::RGBA, ColorType::UnsignedByte, {300, 2}, originalData);
+    #endif
+
+    TgaImageConverter converter;
+    converter.setRleCompression(true);
+    const auto data = converter.exportToData(original);
+    CORRADE_VERIFY(data);
+
+    /* 128 + 128 + 44 pixels in raw packets, 128 + 128 + 44 pixels in runs */
+    CORRADE_COMPARE(data.size(), 18 + 3 + 300*4 + 3*5);
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<Trade::ImageData2D> converted = importer.image2D(0);
+    CORRADE_VERIFY(converted);
+
+    CORRADE_COMPARE(converted->size(), Vector2i(300, 2));
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(converted->data()), 300*2*4),
+                    std::string(originalData, 300*2*4));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImageConverterTest)
@@ -25,8 +25,8 @@
 
 #include "TgaImageConverter.h"
 
-#include <fstream>
-#include <tuple>
+#include <algorithm>
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Endianness.h>
 
@@ -34,17 +34,130 @@
 #include "Magnum/Image.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
-#ifdef MAGNUM_TARGET_GLES
-#include <algorithm>
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
-#endif
-
 namespace Magnum { namespace Trade {
 
-TgaImageConverter::TgaImageConverter() = default;
+namespace {
+
+/* Copies the pixels, swapping red and blue channel of RGB and RGBA pixels on
+   ES */
+template<std::size_t pixelSize> void copyPixels(const unsigned char* const in, unsigned char* const out, const std::size_t count) {
+    #ifdef MAGNUM_TARGET_GLES
+    if(pixelSize != 1) {
+        for(std::size_t i = 0; i != count*pixelSize; i += pixelSize) {
+            out[i + 0] = in[i + 2];
+            out[i + 1] = in[i + 1];
+            out[i + 2] = in[i + 0];
+            if(pixelSize == 4) out[i + 3] = in[i + 3];
+        }
+        return;
+    }
+    #endif
+
+    std::memcpy(out, in, count*pixelSize);
+}
+
+/* Length of common prefix of two byte ranges, compared eight bytes at a
+   time */
+std::size_t equalPrefix(const unsigned char* const a, const unsigned char* const b, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        UnsignedLong x, y;
+        std::memcpy(&x, a + i, 8);
+        std::memcpy(&y, b + i, 8);
+        if(x != y) break;
+    }
+
+    while(i != size && a[i] == b[i]) ++i;
+    return i;
+}
+
+/* Count of identical pixels starting at given pixel, at most `max`. The
+   pixels are identical if each byte is equal to the byte one pixel further,
+   so the whole run can be found with single range comparison. */
+template<std::size_t pixelSize> std::size_t runLength(const unsigned char* const pixel, const std::size_t max) {
+    return 1 + equalPrefix(pixel, pixel + pixelSize, (max - 1)*pixelSize)/pixelSize;
+}
+
+/* Encodes one scanline into RLE packets and returns encoded size. If `out`
+   is nullptr, only the size is calculated. Packets don't cross scanlines, as
+   required by the specification. */
+template<std::size_t pixelSize> std::size_t encodeRle(const unsigned char* const in, const std::size_t pixelCount, unsigned char* const out) {
+    /* Two-pixel run of grayscale pixels has the same size as raw packet, so
+       it's better to keep it in a raw packet and don't split it */
+    constexpr std::size_t minRun = pixelSize == 1 ? 3 : 2;
+
+    std::size_t size = 0;
+    std::size_t i = 0;
+    while(i != pixelCount) {
+        std::size_t run = runLength<pixelSize>(in + i*pixelSize, std::min(pixelCount - i, std::size_t(128)));
+
+        /* Run packet */
+        if(run >= minRun) {
+            if(out) {
+                out[size] = UnsignedByte(0x80|(run - 1));
+                copyPixels<pixelSize>(in + i*pixelSize, out + size + 1, 1);
+            }
+
+            size += 1 + pixelSize;
+            i += run;
+            continue;
+        }
+
+        /* Raw packet until next long enough run or until it is full */
+        std::size_t count = 0;
+        while(run < minRun) {
+            count += run;
+            if(count >= 128 || i + count == pixelCount) break;
+            run = runLength<pixelSize>(in + (i + count)*pixelSize, std::min(pixelCount - i - count, std::size_t(128)));
+        }
+        count = std::min(count, std::size_t(128));
+
+        if(out) {
+            out[size] = UnsignedByte(count - 1);
+            copyPixels<pixelSize>(in + i*pixelSize, out + size + 1, count);
+        }
+
+        size += 1 + count*pixelSize;
+        i += count;
+    }
+
+    return size;
+}
+
+template<std::size_t pixelSize> Containers::Array<unsigned char> exportRle(const ImageReference2D& image, TgaHeader header) {
+    const auto in = reinterpret_cast<const unsigned char*>(image.data());
+    const std::size_t width = image.size().x();
+    const std::size_t height = image.size().y();
 
-TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImageConverter(manager, std::move(plugin)) {}
+    /* Calculate the size first so the output is allocated just once */
+    std::size_t size = sizeof(TgaHeader);
+    for(std::size_t y = 0; y != height; ++y)
+        size += encodeRle<pixelSize>(in + y*width*pixelSize, width, nullptr);
+
+    Containers::Array<unsigned char> data(size);
+    std::memcpy(data.begin(), &header, sizeof(TgaHeader));
+
+    unsigned char* out = data.begin() + sizeof(TgaHeader);
+    for(std::size_t y = 0; y != height; ++y)
+        out += encodeRle<pixelSize>(in + y*width*pixelSize, width, out);
+
+    CORRADE_INTERNAL_ASSERT(out == data.end());
+    return std::move(data);
+}
+
+template<std::size_t pixelSize> Containers::Array<unsigned char> exportRaw(const ImageReference2D& image, const TgaHeader& header) {
+    const std::size_t pixelCount = image.size().product();
+    Containers::Array<unsigned char> data(sizeof(TgaHeader) + pixelSize*pixelCount);
+    std::memcpy(data.begin(), &header, sizeof(TgaHeader));
+    copyPixels<pixelSize>(reinterpret_cast<const unsigned char*>(image.data()), data.begin() + sizeof(TgaHeader), pixelCount);
+    return std::move(data);
+}
+
+}
+
+TgaImageConverter::TgaImageConverter(): _rleCompression(false) {}
+
+TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImageConverter(manager, std::move(plugin)), _rleCompression(false) {}
 
 auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
 
@@ -68,33 +181,22 @@ Containers::Array<unsigned char> TgaImageConverter::doExportToData(const ImageRe
         return nullptr;
     }
 
-    /* Initialize data buffer */
-    const auto pixelSize = UnsignedByte(image.pixelSize());
-    auto data = Containers::Array<unsigned char>::zeroInitialized(sizeof(TgaHeader) + pixelSize*image.size().product());
-
     /* Fill header */
-    auto header = reinterpret_cast<TgaHeader*>(data.begin());
-    header->imageType = image.format() == ColorFormat::Red ? 3 : 2;
-    header->bpp = pixelSize*8;
-    header->width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
-    header->height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
+    const auto pixelSize = UnsignedByte(image.pixelSize());
+    TgaHeader header{};
+    header.imageType = (image.format() == ColorFormat::Red ? 3 : 2)|(_rleCompression ? 8 : 0);
+    header.bpp = pixelSize*8;
+    header.width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
+    header.height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
 
     /* Fill data */
-    std::copy(image.data(), image.data()+pixelSize*image.size().product(), data.begin()+sizeof(TgaHeader));
-
-    #ifdef MAGNUM_TARGET_GLES
-    if(image.format() == ColorFormat::RGB) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.begin()+sizeof(TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(image.format() == ColorFormat::RGBA) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.begin()+sizeof(TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    switch(pixelSize) {
+        case 1: return _rleCompression ? exportRle<1>(image, header) : exportRaw<1>(image, header);
+        case 3: return _rleCompression ? exportRle<3>(image, header) : exportRaw<3>(image, header);
+        case 4: return _rleCompression ? exportRle<4>(image, header) : exportRaw<4>(image, header);
     }
-    #endif
 
-    return std::move(data);
+    CORRADE_ASSERT_UNREACHABLE();
 }
 
 }}
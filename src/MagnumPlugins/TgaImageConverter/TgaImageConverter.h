@@ -59,6 +59,12 @@ dependency of another plugin, you need to request `%TgaImageConverter`
 component of `%Magnum` package in CMake and link to
 `${MAGNUM_TGAIMAGECONVERTER_LIBRARIES}`. See @ref building, @ref cmake and
 @ref plugins for more information.
+
+The images are saved uncompressed by default. If @ref setRleCompression() is
+enabled, the data are compressed using run-length encoding, which greatly
+reduces size of images with large areas of the same color, such as font or UI
+atlases. Runs are detected by comparing whole ranges of memory at once and
+size of the output is calculated upfront so it is allocated just once.
 */
 class MAGNUM_TRADE_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractImageConverter {
     public:
@@ -68,9 +74,21 @@ class MAGNUM_TRADE_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractIm
         /** @brief Plugin manager constructor */
         explicit TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin);
 
+        /** @brief Whether RLE compression is enabled */
+        bool rleCompression() const { return _rleCompression; }
+
+        /**
+         * @brief Enable or disable RLE compression
+         *
+         * Disabled by default.
+         */
+        void setRleCompression(bool enabled) { _rleCompression = enabled; }
+
     private:
         Features MAGNUM_TRADE_TGAIMAGECONVERTER_LOCAL doFeatures() const override;
         Containers::Array<unsigned char> MAGNUM_TRADE_TGAIMAGECONVERTER_LOCAL doExportToData(const ImageReference2D& image) const override;
+
+        bool _rleCompression;
 };
 
 }}
@@ -30,6 +30,9 @@
 
 #include "Magnum/ColorFormat.h"
 #include "Magnum/Trade/ImageData.h"
+#if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include "Magnum/Trade/AsyncImporter.h"
+#endif
 #include "MagnumPlugins/TgaImporter/TgaImporter.h"
 
 #include "configure.h"
@@ -42,8 +45,10 @@ class TgaImporterTest: public TestSuite::Tester {
 
         void openNonexistent();
         void openShort();
+        void openShortPixels();
+        void openPersistent();
         void paletted();
-        void compressed();
+        void unsupportedType();
 
         void colorBits16();
         void colorBits24();
@@ -52,14 +57,25 @@ class TgaImporterTest: public TestSuite::Tester {
         void grayscaleBits8();
         void grayscaleBits16();
 
+        void colorRle24();
+        void colorRle32();
+        void grayscaleRle8();
+        void rleTruncated();
+        void rleOverflow();
+
         void file();
+        #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+        void fileAsync();
+        #endif
 };
 
 TgaImporterTest::TgaImporterTest() {
     addTests({&TgaImporterTest::openNonexistent,
               &TgaImporterTest::openShort,
+              &TgaImporterTest::openShortPixels,
+              &TgaImporterTest::openPersistent,
               &TgaImporterTest::paletted,
-              &TgaImporterTest::compressed,
+              &TgaImporterTest::unsupportedType,
 
               &TgaImporterTest::colorBits16,
               &TgaImporterTest::colorBits24,
@@ -68,7 +84,17 @@ TgaImporterTest::TgaImporterTest() {
               &TgaImporterTest::grayscaleBits8,
               &TgaImporterTest::grayscaleBits16,
 
+              &TgaImporterTest::colorRle24,
+              &TgaImporterTest::colorRle32,
+              &TgaImporterTest::grayscaleRle8,
+              &TgaImporterTest::rleTruncated,
+              &TgaImporterTest::rleOverflow,
+
               &TgaImporterTest::file});
+
+    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    addTests({&TgaImporterTest::fileAsync});
+    #endif
 }
 
 void TgaImporterTest::openNonexistent() {
@@ -77,7 +103,7 @@ void TgaImporterTest::openNonexistent() {
 
     TgaImporter importer;
     CORRADE_VERIFY(!importer.openFile("nonexistent.file"));
-    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::openFile(): cannot open file nonexistent.file\n");
+    CORRADE_COMPARE(debug.str(), "Trade::AbstractImporter::openFile(): cannot open file nonexistent.file\n");
 }
 
 void TgaImporterTest::openShort() {
@@ -91,6 +117,38 @@ void TgaImporterTest::openShort() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the file is too short: 17 bytes\n");
 }
 
+void TgaImporterTest::openShortPixels() {
+    TgaImporter importer;
+    const unsigned char data[] = {
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        1, 2, 3, 2, 3, 4,
+        3, 4, 5, 4, 5, 6
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the file is too short: expected 36 bytes but got 30\n");
+}
+
+void TgaImporterTest::openPersistent() {
+    TgaImporter importer;
+    const unsigned char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 8, 0,
+        1, 2
+    };
+    CORRADE_VERIFY(importer.openPersistentData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 1));
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(image->data()), 2), std::string(reinterpret_cast<const char*>(data) + 18, 2));
+
+    /* The pixel data are a copy, not a reference to the input */
+    CORRADE_VERIFY(image->data() != data + 18);
+}
+
 void TgaImporterTest::paletted() {
     TgaImporter importer;
     const unsigned char data[] = { 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -102,7 +160,7 @@ void TgaImporterTest::paletted() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): paletted files are not supported\n");
 }
 
-void TgaImporterTest::compressed() {
+void TgaImporterTest::unsupportedType() {
     TgaImporter importer;
     const unsigned char data[] = { 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
     CORRADE_VERIFY(importer.openData(data));
@@ -110,7 +168,7 @@ void TgaImporterTest::compressed() {
     std::ostringstream debug;
     Error::setOutput(&debug);
     CORRADE_VERIFY(!importer.image2D(0));
-    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported (compressed?) image type: 9\n");
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported image type: 9\n");
 }
 
 void TgaImporterTest::colorBits16() {
@@ -220,6 +278,131 @@ void TgaImporterTest::grayscaleBits16() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel: 16\n");
 }
 
+void TgaImporterTest::colorRle24() {
+    TgaImporter importer;
+    const unsigned char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        /* Run of three pixels, raw packet of two pixels, run of one pixel */
+        0x82, 1, 2, 3,
+        0x01, 3, 4, 5, 4, 5, 6,
+        0x80, 5, 6, 7
+    };
+    #ifndef MAGNUM_TARGET_GLES
+    const char pixels[] = {
+        1, 2, 3, 1, 2, 3,
+        1, 2, 3, 3, 4, 5,
+        4, 5, 6, 5, 6, 7
+    };
+    #else
+    const char pixels[] = {
+        3, 2, 1, 3, 2, 1,
+        3, 2, 1, 5, 4, 3,
+        6, 5, 4, 7, 6, 5
+    };
+    #endif
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(image->format(), ColorFormat::BGR);
+    #else
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(image->data()), 2*3*3), std::string(pixels, 2*3*3));
+}
+
+void TgaImporterTest::colorRle32() {
+    TgaImporter importer;
+    const unsigned char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 32, 0,
+        /* Raw packet of one pixel, run of five pixels */
+        0x00, 1, 2, 3, 4,
+        0x84, 5, 6, 7, 8
+    };
+    #ifndef MAGNUM_TARGET_GLES
+    const char pixels[] = {
+        1, 2, 3, 4, 5, 6, 7, 8,
+        5, 6, 7, 8, 5, 6, 7, 8,
+        5, 6, 7, 8, 5, 6, 7, 8
+    };
+    #else
+    const char pixels[] = {
+        3, 2, 1, 4, 7, 6, 5, 8,
+        7, 6, 5, 8, 7, 6, 5, 8,
+        7, 6, 5, 8, 7, 6, 5, 8
+    };
+    #endif
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(image->format(), ColorFormat::BGRA);
+    #else
+    CORRADE_COMPARE(image->format(), ColorFormat::RGBA);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(image->data()), 2*3*4), std::string(pixels, 2*3*4));
+}
+
+void TgaImporterTest::grayscaleRle8() {
+    TgaImporter importer;
+    const unsigned char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        /* Run of four pixels, raw packet of two pixels */
+        0x83, 1,
+        0x01, 2, 3
+    };
+    const char pixels[] = {
+        1, 1,
+        1, 1,
+        2, 3
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(image->format(), ColorFormat::Red);
+    #else
+    CORRADE_COMPARE(image->format(), ColorFormat::Luminance);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(image->data()), 2*3), std::string(pixels, 2*3));
+}
+
+void TgaImporterTest::rleTruncated() {
+    TgaImporter importer;
+    const unsigned char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        0x83, 1,
+        0x01, 2
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): RLE data are truncated or don't match the image size\n");
+}
+
+void TgaImporterTest::rleOverflow() {
+    TgaImporter importer;
+    const unsigned char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        0x86, 1
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): RLE data are truncated or don't match the image size\n");
+}
+
 void TgaImporterTest::file() {
     TgaImporter importer;
     const unsigned char data[] = {
@@ -243,6 +426,28 @@ void TgaImporterTest::file() {
                     std::string(reinterpret_cast<const char*>(data) + 18, 2*3));
 }
 
+#if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+void TgaImporterTest::fileAsync() {
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.features() & AbstractImporter::Feature::ThreadSafe);
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "file.tga")));
+
+    /* The same image imported on more threads at once */
+    AsyncImporter async(importer, 4);
+    std::vector<AsyncResult<std::optional<Trade::ImageData2D>>> results;
+    for(std::size_t i = 0; i != 8; ++i) results.push_back(async.image2D(0));
+
+    const char data[] = { 1, 2, 3, 4, 5, 6 };
+    for(AsyncResult<std::optional<Trade::ImageData2D>>& result: results) {
+        std::optional<Trade::ImageData2D> image = result.get();
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+        CORRADE_COMPARE(std::string(reinterpret_cast<const char*>(image->data()), 2*3),
+                        std::string(data, 2*3));
+    }
+}
+#endif
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImporterTest)
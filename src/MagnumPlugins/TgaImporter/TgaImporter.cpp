@@ -25,21 +25,14 @@
 
 #include "TgaImporter.h"
 
-#include <fstream>
-#include <sstream>
+#include <algorithm>
+#include <cstring>
 #include <Corrade/Utility/Endianness.h>
-#include <Corrade/Containers/Array.h>
 
 #include "Magnum/ColorFormat.h"
 #include "Magnum/Trade/ImageData.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
-#ifdef MAGNUM_TARGET_GLES
-#include <algorithm>
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
-#endif
-
 #ifdef MAGNUM_TARGET_GLES2
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
@@ -47,47 +40,106 @@
 
 namespace Magnum { namespace Trade {
 
-TgaImporter::TgaImporter(): in(nullptr) {}
+namespace {
+
+/* Decodes RLE packets into preallocated output. Runs are filled with memset()
+   or by doubling the already written part with memcpy(), raw packets are
+   copied with single memcpy(). Returns false if the input is too short or the
+   packets don't match the image size. */
+template<std::size_t pixelSize> bool decodeRle(const unsigned char* in, const unsigned char* const inEnd, unsigned char* out, unsigned char* const outEnd) {
+    while(out != outEnd) {
+        if(in == inEnd) return false;
+        const bool repeated = *in & 0x80;
+        const std::size_t size = ((*in & 0x7f) + 1)*pixelSize;
+        ++in;
+
+        if(std::size_t(outEnd - out) < size) return false;
+
+        /* Run packet, replicate single pixel */
+        if(repeated) {
+            if(std::size_t(inEnd - in) < pixelSize) return false;
+            if(pixelSize == 1) std::memset(out, *in, size);
+            else {
+                std::memcpy(out, in, pixelSize);
+                for(std::size_t filled = pixelSize; filled < size; filled *= 2)
+                    std::memcpy(out + filled, out, std::min(filled, size - filled));
+            }
+            in += pixelSize;
+
+        /* Raw packet */
+        } else {
+            if(std::size_t(inEnd - in) < size) return false;
+            std::memcpy(out, in, size);
+            in += size;
+        }
+
+        out += size;
+    }
+
+    return true;
+}
+
+#ifdef MAGNUM_TARGET_GLES
+/* Copies the pixels and swaps the blue and red channel in single pass. Fixed
+   channel count and plain byte accesses allow the compiler to vectorize the
+   loop with byte shuffles. The input and output can be the same. */
+template<std::size_t channels> void copyBgrToRgb(const unsigned char* const in, unsigned char* const out, const std::size_t pixelCount) {
+    for(std::size_t i = 0; i != pixelCount*channels; i += channels) {
+        const unsigned char b = in[i + 0];
+        const unsigned char r = in[i + 2];
+        out[i + 0] = r;
+        out[i + 1] = in[i + 1];
+        out[i + 2] = b;
+        if(channels == 4) out[i + 3] = in[i + 3];
+    }
+}
+#endif
+
+}
+
+TgaImporter::TgaImporter(): _opened(false) {}
 
-TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), in(nullptr) {}
+TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), _opened(false) {}
 
 TgaImporter::~TgaImporter() { close(); }
 
-auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData; }
+auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ThreadSafe; }
 
-bool TgaImporter::doIsOpened() const { return in; }
+bool TgaImporter::doIsOpened() const { return _opened; }
 
 void TgaImporter::doOpenData(const Containers::ArrayReference<const unsigned char> data) {
-    in = new std::istringstream(std::string(reinterpret_cast<const char*>(data.begin()), data.size()));
-}
-
-void TgaImporter::doOpenFile(const std::string& filename) {
-    in = new std::ifstream(filename);
-    if(in->good()) return;
+    /* Reference the data directly if they stay valid until the file is
+       closed, otherwise make a copy. The pixels are then copied second time
+       in doImage2D(), decoding them here instead would make the importer
+       stateful, as the output image can be handed out only once. */
+    if(isDataPersistent()) _in = data;
+    else {
+        _storage = Containers::Array<unsigned char>(data.size());
+        std::copy(data.begin(), data.end(), _storage.begin());
+        _in = _storage;
+    }
 
-    Error() << "Trade::TgaImporter::openFile(): cannot open file" << filename;
-    close();
+    _opened = true;
 }
 
 void TgaImporter::doClose() {
-    delete in;
-    in = nullptr;
+    _storage = nullptr;
+    _in = nullptr;
+    _opened = false;
 }
 
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
 
 std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
     /* Check if the file is long enough */
-    in->seekg(0, std::istream::end);
-    std::streampos filesize = in->tellg();
-    in->seekg(0, std::istream::beg);
-    if(filesize < std::streampos(sizeof(TgaHeader))) {
-        Error() << "Trade::TgaImporter::image2D(): the file is too short:" << filesize << "bytes";
+    if(_in.size() < sizeof(TgaHeader)) {
+        Error() << "Trade::TgaImporter::image2D(): the file is too short:" << _in.size() << "bytes";
         return std::nullopt;
     }
 
+    /* Copy the header out as the data might not be properly aligned */
     TgaHeader header;
-    in->read(reinterpret_cast<char*>(&header), sizeof(TgaHeader));
+    std::memcpy(&header, _in.data(), sizeof(TgaHeader));
 
     /* Convert to machine endian */
     header.width = Utility::Endianness::littleEndian(header.width);
@@ -100,8 +152,12 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
         return std::nullopt;
     }
 
+    /* Bit 3 of image type denotes RLE compression */
+    const bool compressed = header.imageType & 8;
+    const UnsignedByte imageType = header.imageType & ~8;
+
     /* Color */
-    if(header.imageType == 2) {
+    if(imageType == 2) {
         switch(header.bpp) {
             case 24:
                 #ifndef MAGNUM_TARGET_GLES
@@ -123,7 +179,7 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
         }
 
     /* Grayscale */
-    } else if(header.imageType == 3) {
+    } else if(imageType == 3) {
         #ifdef MAGNUM_TARGET_GLES2
         format = Context::current() && Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
             ColorFormat::Red : ColorFormat::Luminance;
@@ -135,29 +191,63 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
             return std::nullopt;
         }
 
-    /* Compressed files */
+    /* Unknown types */
     } else {
-        Error() << "Trade::TgaImporter::image2D(): unsupported (compressed?) image type:" << header.imageType;
+        Error() << "Trade::TgaImporter::image2D(): unsupported image type:" << header.imageType;
         return std::nullopt;
     }
 
-    const std::size_t dataSize = header.width*header.height*header.bpp/8;
-    char* const data = new char[dataSize];
-    in->read(data, dataSize);
-
-    Vector2i size(header.width, header.height);
-
-    #ifdef MAGNUM_TARGET_GLES
-    if(format == ColorFormat::RGB) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data);
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(format == ColorFormat::RGBA) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data);
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    const Vector2i size(header.width, header.height);
+    const std::size_t pixelSize = header.bpp/8;
+    const std::size_t dataSize = std::size_t(size.product())*pixelSize;
+    const unsigned char* const pixels = _in.data() + sizeof(TgaHeader);
+    unsigned char* data;
+
+    /* Decode compressed data directly into the output */
+    if(compressed) {
+        data = new unsigned char[dataSize];
+
+        bool decoded = false;
+        switch(pixelSize) {
+            case 1: decoded = decodeRle<1>(pixels, _in.end(), data, data + dataSize); break;
+            case 3: decoded = decodeRle<3>(pixels, _in.end(), data, data + dataSize); break;
+            case 4: decoded = decodeRle<4>(pixels, _in.end(), data, data + dataSize); break;
+        }
+
+        if(!decoded) {
+            delete[] data;
+            Error() << "Trade::TgaImporter::image2D(): RLE data are truncated or don't match the image size";
+            return std::nullopt;
+        }
+
+        #ifdef MAGNUM_TARGET_GLES
+        if(format == ColorFormat::RGB)
+            copyBgrToRgb<3>(data, data, size.product());
+        else if(format == ColorFormat::RGBA)
+            copyBgrToRgb<4>(data, data, size.product());
+        #endif
+
+    /* Copy uncompressed pixels directly from the input, converting them on
+       the way on ES */
+    } else {
+        if(_in.size() < sizeof(TgaHeader) + dataSize) {
+            Error() << "Trade::TgaImporter::image2D(): the file is too short: expected" << sizeof(TgaHeader) + dataSize << "bytes but got" << _in.size();
+            return std::nullopt;
+        }
+
+        data = new unsigned char[dataSize];
+
+        #ifdef MAGNUM_TARGET_GLES
+        if(format == ColorFormat::RGB)
+            copyBgrToRgb<3>(pixels, data, size.product());
+        else if(format == ColorFormat::RGBA)
+            copyBgrToRgb<4>(pixels, data, size.product());
+        else
+        #endif
+        {
+            std::copy(pixels, pixels + dataSize, data);
+        }
     }
-    #endif
 
     return ImageData2D(format, ColorType::UnsignedByte, size, data);
 }
@@ -29,6 +29,7 @@
  * @brief Class Magnum::Trade::TgaImporter
  */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/VisibilityMacros.h>
 
 #include "Magnum/Trade/AbstractImporter.h"
@@ -51,7 +52,8 @@ namespace Magnum { namespace Trade {
 /**
 @brief TGA importer plugin
 
-Supports uncompressed BGR, BGRA or grayscale images with 8 bits per channel.
+Supports uncompressed and RLE-compressed BGR, BGRA or grayscale images with 8
+bits per channel. Paletted images are not supported.
 
 This plugin is built if `WITH_TGAIMPORTER` is enabled when building %Magnum. To
 use dynamic plugin, you need to load `%TgaImporter` plugin from
@@ -68,6 +70,13 @@ In OpenGL ES BGR and BGRA images are converted to @ref ColorFormat::RGB
 and @ref ColorFormat::RGBA. In OpenGL ES 2.0, if @es_extension{EXT,texture_rg}
 is not supported, grayscale images use @ref ColorFormat::Luminance instead of
 @ref ColorFormat::Red.
+
+The header is parsed directly from the input. Files opened with
+@ref openFile() or data passed to @ref openPersistentData() are referenced
+directly, so the pixel data are copied only once, when calling
+@ref image2D(). Data passed to @ref openData() are copied on opening, so in
+that case the pixel data are copied twice. Each call to @ref image2D() makes
+a new copy. RLE-compressed data are decoded directly into the output image.
 */
 class MAGNUM_TRADE_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public:
@@ -83,12 +92,13 @@ class MAGNUM_TRADE_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         Features MAGNUM_TRADE_TGAIMPORTER_LOCAL doFeatures() const override;
         bool MAGNUM_TRADE_TGAIMPORTER_LOCAL doIsOpened() const override;
         void MAGNUM_TRADE_TGAIMPORTER_LOCAL doOpenData(Containers::ArrayReference<const unsigned char> data) override;
-        void MAGNUM_TRADE_TGAIMPORTER_LOCAL doOpenFile(const std::string& filename) override;
         void MAGNUM_TRADE_TGAIMPORTER_LOCAL doClose() override;
         UnsignedInt MAGNUM_TRADE_TGAIMPORTER_LOCAL doImage2DCount() const override;
         std::optional<ImageData2D> MAGNUM_TRADE_TGAIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
 
-        std::istream* in;
+        Containers::Array<unsigned char> _storage;
+        Containers::ArrayReference<const unsigned char> _in;
+        bool _opened;
 };
 
 }}
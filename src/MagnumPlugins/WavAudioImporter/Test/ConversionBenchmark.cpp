@@ -0,0 +1,124 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Test/Benchmark.h"
+#include "MagnumPlugins/WavAudioImporter/WavConversion.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+class ConversionBenchmark: public TestSuite::Tester {
+    public:
+        explicit ConversionBenchmark();
+
+        void copy();
+        void int24Stereo();
+        void floatStereo();
+        void downmix51();
+        void downmix71Float();
+};
+
+namespace {
+
+/* Ten seconds at 48 kHz */
+constexpr std::size_t FrameCount = 480000;
+constexpr std::size_t Repeats = 10;
+
+std::vector<unsigned char> input(Implementation::WavSampleType type, UnsignedInt channelCount) {
+    std::vector<unsigned char> data(FrameCount*channelCount*Implementation::wavSampleSize(type));
+
+    /* Floats need to be in range to not measure just saturation */
+    if(type == Implementation::WavSampleType::Float) {
+        for(std::size_t i = 0; i != data.size()/4; ++i) {
+            const Float value = ((i*7919) % 2001)/1000.0f - 1.0f;
+            std::memcpy(data.data() + i*4, &value, 4);
+        }
+    } else for(std::size_t i = 0; i != data.size(); ++i) data[i] = (i*31) & 0xff;
+
+    return data;
+}
+
+/* Prints throughput of given conversion in input megabytes and frames per
+   second */
+template<class F> void measure(const char* name, const std::size_t inputSize, F f) {
+    const Double seconds = Magnum::Test::averageDuration<std::ratio<1>>(Repeats, f);
+
+    Debug() << name << seconds*1000 << "ms," << inputSize/seconds/(1024*1024) << "MB/s,"
+            << FrameCount/seconds/1000000 << "Mframes/s";
+}
+
+void benchmark(const char* name, Implementation::WavSampleType type, UnsignedInt channelCount) {
+    const std::vector<unsigned char> in = input(type, channelCount);
+    const Implementation::WavConversion conversion = Implementation::wavConversion(type, channelCount, 0);
+    std::vector<Short> out(FrameCount*conversion.outputChannelCount);
+
+    measure(name, in.size(), [&]() {
+        Implementation::convertWav(conversion, in.data(), out.data(), FrameCount);
+    });
+}
+
+}
+
+ConversionBenchmark::ConversionBenchmark() {
+    addTests({&ConversionBenchmark::copy,
+              &ConversionBenchmark::int24Stereo,
+              &ConversionBenchmark::floatStereo,
+              &ConversionBenchmark::downmix51,
+              &ConversionBenchmark::downmix71Float});
+}
+
+void ConversionBenchmark::copy() {
+    /* Baseline: 16-bit stereo, which is used as-is */
+    const std::vector<unsigned char> in = input(Implementation::WavSampleType::Short, 2);
+    std::vector<unsigned char> out(in.size());
+    measure("16-bit stereo copy:", in.size(), [&]() {
+        std::memcpy(out.data(), in.data(), in.size());
+    });
+    CORRADE_VERIFY(in == out);
+}
+
+void ConversionBenchmark::int24Stereo() {
+    benchmark("24-bit stereo:", Implementation::WavSampleType::Int24, 2);
+}
+
+void ConversionBenchmark::floatStereo() {
+    benchmark("Float stereo:", Implementation::WavSampleType::Float, 2);
+}
+
+void ConversionBenchmark::downmix51() {
+    benchmark("16-bit 5.1 downmix:", Implementation::WavSampleType::Short, 6);
+}
+
+void ConversionBenchmark::downmix71Float() {
+    benchmark("Float 7.1 downmix:", Implementation::WavSampleType::Float, 8);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::ConversionBenchmark)
@@ -23,7 +23,11 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <sstream>
+#include <vector>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
@@ -42,17 +46,139 @@ class WavImporterTest: public TestSuite::Tester {
         void wrongSignature();
         void unsupportedFormat();
         void unsupportedChannelCount();
+        void unsupportedBitsPerSample();
+        void truncatedChunk();
+        void noDataChunk();
         void mono16();
         void stereo8();
+
+        void extraChunks();
+        void int24();
+        void int32();
+        void float32();
+        void float64();
+        void extensible();
+        void surround8();
+        void downmix51();
+
+        void stream();
+        void streamPersistent();
+        void streamFile();
+        void streamConverted();
 };
 
+namespace {
+
+/* Builds WAV files chunk by chunk */
+struct WavFile {
+    explicit WavFile(): data{'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E'} {}
+
+    WavFile& chunk(const char* id, const std::vector<unsigned char>& contents) {
+        data.insert(data.end(), id, id + 4);
+        write32(contents.size());
+        data.insert(data.end(), contents.begin(), contents.end());
+        if(contents.size() & 1) data.push_back(0);
+        return *this;
+    }
+
+    WavFile& format(UnsignedShort audioFormat, UnsignedShort channelCount, UnsignedShort bitsPerSample, UnsignedInt channelMask = 0, UnsignedShort subFormat = 0) {
+        WavFile contents;
+        contents.data.clear();
+        contents.write16(audioFormat);
+        contents.write16(channelCount);
+        contents.write32(22050);
+        contents.write32(22050*channelCount*bitsPerSample/8);
+        contents.write16(channelCount*bitsPerSample/8);
+        contents.write16(bitsPerSample);
+        if(audioFormat == 0xfffe) {
+            contents.write16(22);
+            contents.write16(bitsPerSample);
+            contents.write32(channelMask);
+            contents.write16(subFormat);
+            contents.data.resize(contents.data.size() + 14);
+        }
+        return chunk("fmt ", contents.data);
+    }
+
+    std::vector<unsigned char> finish() {
+        const UnsignedInt size = data.size() - 8;
+        for(std::size_t i = 0; i != 4; ++i) data[4 + i] = (size >> i*8) & 0xff;
+        return data;
+    }
+
+    void write16(UnsignedShort value) {
+        data.push_back(value & 0xff);
+        data.push_back(value >> 8);
+    }
+
+    void write32(UnsignedInt value) {
+        for(std::size_t i = 0; i != 4; ++i) data.push_back((value >> i*8) & 0xff);
+    }
+
+    std::vector<unsigned char> data;
+};
+
+/* Generates 16-bit stereo file with given count of frames */
+std::vector<unsigned char> stereo16(const std::size_t frameCount) {
+    std::vector<unsigned char> samples(frameCount*4);
+    for(std::size_t i = 0; i != samples.size(); ++i) samples[i] = (i*7) & 0xff;
+    return WavFile().format(1, 2, 16).chunk("data", samples).finish();
+}
+
+/* Converts samples to little-endian bytes */
+template<class T> std::vector<unsigned char> bytes(std::initializer_list<T> values, std::size_t size = sizeof(T)) {
+    std::vector<unsigned char> out;
+    for(const T value: values) {
+        unsigned char data[sizeof(T)];
+        std::memcpy(data, &value, sizeof(T));
+        out.insert(out.end(), data + sizeof(T) - size, data + sizeof(T));
+    }
+    return out;
+}
+
+/* Imports the data as 16-bit samples */
+std::vector<Short> shorts(AbstractImporter& importer) {
+    Containers::Array<unsigned char> data = importer.data();
+    std::vector<Short> out(data.size()/2);
+    std::memcpy(out.data(), data.begin(), data.size());
+    return out;
+}
+
+/* Reads the whole stream in blocks of given size */
+std::vector<unsigned char> readAll(AbstractImporter& importer, const std::size_t blockSize) {
+    std::vector<unsigned char> out;
+    Containers::Array<unsigned char> block(blockSize);
+    while(const std::size_t size = importer.readData(block))
+        out.insert(out.end(), block.begin(), block.begin() + size);
+    return out;
+}
+
+}
+
 WavImporterTest::WavImporterTest() {
     addTests({&WavImporterTest::wrongSize,
               &WavImporterTest::wrongSignature,
               &WavImporterTest::unsupportedFormat,
               &WavImporterTest::unsupportedChannelCount,
+              &WavImporterTest::unsupportedBitsPerSample,
+              &WavImporterTest::truncatedChunk,
+              &WavImporterTest::noDataChunk,
               &WavImporterTest::mono16,
-              &WavImporterTest::stereo8});
+              &WavImporterTest::stereo8,
+
+              &WavImporterTest::extraChunks,
+              &WavImporterTest::int24,
+              &WavImporterTest::int32,
+              &WavImporterTest::float32,
+              &WavImporterTest::float64,
+              &WavImporterTest::extensible,
+              &WavImporterTest::surround8,
+              &WavImporterTest::downmix51,
+
+              &WavImporterTest::stream,
+              &WavImporterTest::streamPersistent,
+              &WavImporterTest::streamFile,
+              &WavImporterTest::streamConverted});
 }
 
 void WavImporterTest::wrongSize() {
@@ -86,9 +212,41 @@ void WavImporterTest::unsupportedChannelCount() {
     std::ostringstream out;
     Error::setOutput(&out);
 
+    const std::vector<unsigned char> file = WavFile().format(1, 19, 16).chunk("data", {}).finish();
+    WavImporter importer;
+    CORRADE_VERIFY(!importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported channel count 19 with 16 bits per sample\n");
+}
+
+void WavImporterTest::unsupportedBitsPerSample() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const std::vector<unsigned char> file = WavFile().format(3, 2, 16).chunk("data", {}).finish();
     WavImporter importer;
-    CORRADE_VERIFY(!importer.openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "unsupportedChannelCount.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported channel count 6 with 8 bits per sample\n");
+    CORRADE_VERIFY(!importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported channel count 2 with 16 bits per sample\n");
+}
+
+void WavImporterTest::truncatedChunk() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<unsigned char> file = WavFile().format(1, 1, 16).chunk("data", {1, 2, 3, 4}).finish();
+    file.resize(file.size() - 1);
+    WavImporter importer;
+    CORRADE_VERIFY(!importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): chunk data is truncated, expected 4 bytes but got 3\n");
+}
+
+void WavImporterTest::noDataChunk() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const std::vector<unsigned char> file = WavFile().format(1, 1, 16).chunk("LIST", {1, 2, 3, 4, 5, 6, 7, 8}).finish();
+    WavImporter importer;
+    CORRADE_VERIFY(!importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): the file has no data chunk\n");
 }
 
 void WavImporterTest::mono16() {
@@ -119,6 +277,170 @@ void WavImporterTest::stereo8() {
     CORRADE_COMPARE(data[3], 0x7e);
 }
 
+void WavImporterTest::extraChunks() {
+    /* Odd-sized chunk before the format, chunk between format and data */
+    const std::vector<unsigned char> file = WavFile()
+        .chunk("LIST", {'I', 'N', 'F', 'O', 'x'})
+        .format(1, 1, 16)
+        .chunk("fact", {2, 0, 0, 0})
+        .chunk("data", bytes<Short>({1234, -4321}))
+        .finish();
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.format(), Buffer::Format::Mono16);
+    CORRADE_COMPARE(importer.frequency(), 22050);
+    CORRADE_VERIFY(shorts(importer) == (std::vector<Short>{1234, -4321}));
+}
+
+void WavImporterTest::int24() {
+    /* Only the upper three bytes of each 32-bit value are used */
+    const std::vector<unsigned char> file = WavFile().format(1, 2, 24)
+        .chunk("data", bytes<Int>({0x12345600, -0x12345600, 0x7fffff00, Int(0x80000000)}, 3))
+        .finish();
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.format(), Buffer::Format::Stereo16);
+    CORRADE_COMPARE(importer.dataSize(), 8);
+    CORRADE_VERIFY(shorts(importer) == (std::vector<Short>{0x1234, -0x1235, 0x7fff, -0x8000}));
+}
+
+void WavImporterTest::int32() {
+    const std::vector<unsigned char> file = WavFile().format(1, 1, 32)
+        .chunk("data", bytes<Int>({0x12345678, -0x12345678}))
+        .finish();
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.format(), Buffer::Format::Mono16);
+    CORRADE_VERIFY(shorts(importer) == (std::vector<Short>{0x1234, -0x1235}));
+}
+
+void WavImporterTest::float32() {
+    /* Out-of-range values are saturated, NaN is converted to zero */
+    const std::vector<unsigned char> file = WavFile().format(3, 2, 32)
+        .chunk("data", bytes<Float>({0.5f, -0.25f, 1.5f, -1.0f, std::numeric_limits<Float>::quiet_NaN(), -3.0f}))
+        .finish();
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.format(), Buffer::Format::Stereo16);
+    CORRADE_VERIFY(shorts(importer) == (std::vector<Short>{16384, -8192, 32767, -32767, 0, -32768}));
+}
+
+void WavImporterTest::float64() {
+    const std::vector<unsigned char> file = WavFile().format(3, 1, 64)
+        .chunk("data", bytes<Double>({-0.5, 0.0, std::numeric_limits<Double>::quiet_NaN()}))
+        .finish();
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.format(), Buffer::Format::Mono16);
+    CORRADE_VERIFY(shorts(importer) == (std::vector<Short>{-16384, 0, 0}));
+}
+
+void WavImporterTest::extensible() {
+    /* Three channels with front left, front right and low-frequency
+       speaker, which is dropped */
+    const std::vector<unsigned char> file = WavFile().format(0xfffe, 3, 16, 0x1|0x2|0x8, 1)
+        .chunk("data", bytes<Short>({1000, 2000, 30000}))
+        .finish();
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.format(), Buffer::Format::Stereo16);
+    CORRADE_VERIFY(shorts(importer) == (std::vector<Short>{1000, 2000}));
+}
+
+void WavImporterTest::surround8() {
+    /* Six channels with 8 bits per sample and no data */
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "unsupportedChannelCount.wav")));
+    CORRADE_COMPARE(importer.format(), Buffer::Format::Stereo16);
+    CORRADE_COMPARE(importer.dataSize(), 0);
+}
+
+void WavImporterTest::downmix51() {
+    /* Default 5.1 layout: front left, front right, center, low frequency,
+       back left, back right. First frame has the same value in all channels
+       except low frequency, which results in the same value in the output,
+       second frame has only front left. */
+    const std::vector<unsigned char> file = WavFile().format(1, 6, 16)
+        .chunk("data", bytes<Short>({
+            8192, 8192, 8192, -32768, 8192, 8192,
+            10000, 0, 0, 0, 0, 0}))
+        .finish();
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.format(), Buffer::Format::Stereo16);
+    const std::vector<Short> data = shorts(importer);
+    CORRADE_COMPARE(data.size(), 4);
+    CORRADE_COMPARE(data[0], 8192);
+    CORRADE_COMPARE(data[1], 8192);
+    CORRADE_COMPARE(data[2], 4142);
+    CORRADE_COMPARE(data[3], 0);
+}
+
+void WavImporterTest::stream() {
+    const std::vector<unsigned char> file = stereo16(1000);
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.features() & AbstractImporter::Feature::Streaming);
+    CORRADE_VERIFY(importer.openData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.frameSize(), 4);
+    CORRADE_COMPARE(importer.dataSize(), 4000);
+
+    const Containers::Array<unsigned char> data = importer.data();
+    const std::vector<unsigned char> full(data.begin(), data.end());
+
+    /* Block size not divisible by frame size, only whole frames are read */
+    CORRADE_VERIFY(readAll(importer, 255) == full);
+    CORRADE_COMPARE(importer.dataPosition(), 4000);
+
+    /* Seek back and read rest in one block */
+    importer.seekData(3000);
+    std::vector<unsigned char> rest = readAll(importer, 65536);
+    CORRADE_COMPARE(rest.size(), 1000);
+    CORRADE_VERIFY(std::equal(rest.begin(), rest.end(), full.begin() + 3000));
+}
+
+void WavImporterTest::streamPersistent() {
+    const std::vector<unsigned char> file = stereo16(1000);
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openPersistentData({file.data(), file.size()}));
+
+    const Containers::Array<unsigned char> data = importer.data();
+    CORRADE_VERIFY(readAll(importer, 1024) == std::vector<unsigned char>(data.begin(), data.end()));
+    CORRADE_VERIFY(std::equal(data.begin(), data.end(), file.begin() + 44));
+}
+
+void WavImporterTest::streamFile() {
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav")));
+    CORRADE_COMPARE(importer.dataSize(), 4);
+
+    const std::vector<unsigned char> streamed = readAll(importer, 2);
+    CORRADE_COMPARE(streamed.size(), 4);
+    CORRADE_COMPARE(streamed[0], 0x1d);
+    CORRADE_COMPARE(streamed[3], 0xC5);
+}
+
+void WavImporterTest::streamConverted() {
+    std::vector<unsigned char> samples(3*6*1000);
+    for(std::size_t i = 0; i != samples.size(); ++i) samples[i] = (i*13) & 0xff;
+    const std::vector<unsigned char> file = WavFile().format(1, 6, 24).chunk("data", samples).finish();
+
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openPersistentData({file.data(), file.size()}));
+    CORRADE_COMPARE(importer.dataSize(), 4000);
+
+    const Containers::Array<unsigned char> data = importer.data();
+    CORRADE_VERIFY(readAll(importer, 255) == std::vector<unsigned char>(data.begin(), data.end()));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterTest)
@@ -0,0 +1,247 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "WavConversion.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace Audio { namespace Implementation {
+
+namespace {
+
+/* Converts float in range [-1, 1] to 16-bit integer with rounding and
+   saturation, NaN is converted to zero. Written without library calls so the
+   loops using it can be vectorized. */
+inline Short floatToShort(Float value) {
+    value *= 32767.0f;
+    /* NaN fails all comparisons, so it would pass through the clamping below
+       and the conversion to integer would be undefined */
+    value = value == value ? value : 0.0f;
+    value = value < -32768.0f ? -32768.0f : (value > 32767.0f ? 32767.0f : value);
+    return Short(value + (value < 0.0f ? -0.5f : 0.5f));
+}
+
+/* Readers of particular sample types. The integer paths to 16-bit integer
+   only shuffle bytes, the float paths normalize into [-1, 1]. */
+template<WavSampleType> struct Sample;
+template<> struct Sample<WavSampleType::UnsignedByte> {
+    enum: std::size_t { Size = 1 };
+    static Short toShort(const unsigned char* in) { return Short((in[0] - 128)*256); }
+    static Float toFloat(const unsigned char* in) { return (in[0] - 128)/128.0f; }
+};
+template<> struct Sample<WavSampleType::Short> {
+    enum: std::size_t { Size = 2 };
+    static Short toShort(const unsigned char* in) { return Short(in[0]|(in[1] << 8)); }
+    static Float toFloat(const unsigned char* in) { return toShort(in)/32768.0f; }
+};
+template<> struct Sample<WavSampleType::Int24> {
+    enum: std::size_t { Size = 3 };
+    static Short toShort(const unsigned char* in) { return Short(in[1]|(in[2] << 8)); }
+    static Float toFloat(const unsigned char* in) {
+        return Int(UnsignedInt(in[0] << 8)|UnsignedInt(in[1] << 16)|UnsignedInt(in[2]) << 24)/2147483648.0f;
+    }
+};
+template<> struct Sample<WavSampleType::Int> {
+    enum: std::size_t { Size = 4 };
+    static Short toShort(const unsigned char* in) { return Short(in[2]|(in[3] << 8)); }
+    static Float toFloat(const unsigned char* in) {
+        return Int(UnsignedInt(in[0])|UnsignedInt(in[1] << 8)|UnsignedInt(in[2] << 16)|UnsignedInt(in[3]) << 24)/2147483648.0f;
+    }
+};
+template<> struct Sample<WavSampleType::Float> {
+    enum: std::size_t { Size = 4 };
+    static Float toFloat(const unsigned char* in) {
+        Float value;
+        std::memcpy(&value, in, sizeof(Float));
+        return value;
+    }
+    static Short toShort(const unsigned char* in) { return floatToShort(toFloat(in)); }
+};
+template<> struct Sample<WavSampleType::Double> {
+    enum: std::size_t { Size = 8 };
+    static Float toFloat(const unsigned char* in) {
+        Double value;
+        std::memcpy(&value, in, sizeof(Double));
+        return Float(value);
+    }
+    static Short toShort(const unsigned char* in) { return floatToShort(toFloat(in)); }
+};
+
+/* Mono and stereo, converting each sample separately */
+template<WavSampleType type> void convert(const unsigned char* const in, Short* const out, const std::size_t sampleCount) {
+    for(std::size_t i = 0; i != sampleCount; ++i)
+        out[i] = Sample<type>::toShort(in + i*Sample<type>::Size);
+}
+
+/* Downmix to stereo. Fixed channel count allows the compiler to unroll the
+   inner loop, zero means the count is known only at runtime. */
+template<WavSampleType type, std::size_t channels> void downmix(const WavConversion& conversion, const unsigned char* const in, Short* const out, const std::size_t frameCount) {
+    const std::size_t channelCount = channels ? channels : conversion.channelCount;
+    const std::size_t frameSize = channelCount*Sample<type>::Size;
+
+    Float left[WavMaxChannelCount], right[WavMaxChannelCount];
+    std::memcpy(left, conversion.weights[0], sizeof(left));
+    std::memcpy(right, conversion.weights[1], sizeof(right));
+
+    for(std::size_t i = 0; i != frameCount; ++i) {
+        const unsigned char* const frame = in + i*frameSize;
+        Float l = 0.0f, r = 0.0f;
+        for(std::size_t j = 0; j != channelCount; ++j) {
+            const Float sample = Sample<type>::toFloat(frame + j*Sample<type>::Size);
+            l += left[j]*sample;
+            r += right[j]*sample;
+        }
+
+        out[i*2 + 0] = floatToShort(l);
+        out[i*2 + 1] = floatToShort(r);
+    }
+}
+
+template<WavSampleType type> void convertOrDownmix(const WavConversion& conversion, const unsigned char* const in, Short* const out, const std::size_t frameCount) {
+    switch(conversion.channelCount) {
+        case 1:
+        case 2: return convert<type>(in, out, frameCount*conversion.channelCount);
+        case 6: return downmix<type, 6>(conversion, in, out, frameCount);
+        case 8: return downmix<type, 8>(conversion, in, out, frameCount);
+    }
+
+    downmix<type, 0>(conversion, in, out, frameCount);
+}
+
+/* Speaker positions in order of channel mask bits */
+enum: UnsignedInt {
+    FrontLeft = 1 << 0,
+    FrontRight = 1 << 1,
+    FrontCenter = 1 << 2,
+    BackLeft = 1 << 4,
+    BackRight = 1 << 5,
+    BackCenter = 1 << 8,
+    SideLeft = 1 << 9,
+    SideRight = 1 << 10
+};
+
+/* Left and right weight of each speaker position. Low-frequency channel
+   is dropped, center channels are split between both sides. */
+constexpr Float SpeakerWeights[WavMaxChannelCount][2] = {
+    {1.0f, 0.0f},           /* front left */
+    {0.0f, 1.0f},           /* front right */
+    {0.7071f, 0.7071f},     /* front center */
+    {0.0f, 0.0f},           /* low frequency */
+    {0.7071f, 0.0f},        /* back left */
+    {0.0f, 0.7071f},        /* back right */
+    {1.0f, 0.0f},           /* front left of center */
+    {0.0f, 1.0f},           /* front right of center */
+    {0.5f, 0.5f},           /* back center */
+    {0.7071f, 0.0f},        /* side left */
+    {0.0f, 0.7071f},        /* side right */
+    {0.5f, 0.5f},           /* top center */
+    {0.7071f, 0.0f},        /* top front left */
+    {0.5f, 0.5f},           /* top front center */
+    {0.0f, 0.7071f},        /* top front right */
+    {0.7071f, 0.0f},        /* top back left */
+    {0.5f, 0.5f},           /* top back center */
+    {0.0f, 0.7071f}         /* top back right */
+};
+
+UnsignedInt defaultChannelMask(const UnsignedInt channelCount) {
+    switch(channelCount) {
+        case 3: return FrontLeft|FrontRight|FrontCenter;
+        case 4: return FrontLeft|FrontRight|BackLeft|BackRight;
+        case 5: return FrontLeft|FrontRight|FrontCenter|BackLeft|BackRight;
+        case 6: return 0x3f;
+        case 7: return 0x3f|BackCenter;
+        case 8: return 0x3f|SideLeft|SideRight;
+    }
+
+    return (1 << channelCount) - 1;
+}
+
+}
+
+std::size_t wavSampleSize(const WavSampleType type) {
+    switch(type) {
+        case WavSampleType::UnsignedByte: return 1;
+        case WavSampleType::Short: return 2;
+        case WavSampleType::Int24: return 3;
+        case WavSampleType::Int: return 4;
+        case WavSampleType::Float: return 4;
+        case WavSampleType::Double: return 8;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+WavConversion wavConversion(const WavSampleType type, const UnsignedInt channelCount, UnsignedInt channelMask) {
+    CORRADE_INTERNAL_ASSERT(channelCount && channelCount <= WavMaxChannelCount);
+
+    WavConversion conversion{};
+    conversion.type = type;
+    conversion.channelCount = channelCount;
+    conversion.outputChannelCount = channelCount == 1 ? 1 : 2;
+    if(channelCount <= 2) return conversion;
+
+    /* Assign speaker positions to channels in order of mask bits, channels
+       without position are split between both sides */
+    if(!channelMask) channelMask = defaultChannelMask(channelCount);
+    Float sum[2]{};
+    std::size_t speaker = 0;
+    for(std::size_t channel = 0; channel != channelCount; ++channel) {
+        while(speaker != WavMaxChannelCount && !(channelMask & (1 << speaker))) ++speaker;
+        const bool positioned = speaker != WavMaxChannelCount;
+
+        for(std::size_t side = 0; side != 2; ++side) {
+            const Float weight = positioned ? SpeakerWeights[speaker][side] : 0.5f;
+            conversion.weights[side][channel] = weight;
+            sum[side] += weight;
+        }
+
+        if(positioned) ++speaker;
+    }
+
+    /* Normalize the weights so the output doesn't clip */
+    for(std::size_t side = 0; side != 2; ++side) {
+        if(sum[side] == 0.0f) continue;
+        for(std::size_t channel = 0; channel != channelCount; ++channel)
+            conversion.weights[side][channel] /= sum[side];
+    }
+
+    return conversion;
+}
+
+void convertWav(const WavConversion& conversion, const unsigned char* const in, Short* const out, const std::size_t frameCount) {
+    switch(conversion.type) {
+        case WavSampleType::UnsignedByte: return convertOrDownmix<WavSampleType::UnsignedByte>(conversion, in, out, frameCount);
+        case WavSampleType::Short: return convertOrDownmix<WavSampleType::Short>(conversion, in, out, frameCount);
+        case WavSampleType::Int24: return convertOrDownmix<WavSampleType::Int24>(conversion, in, out, frameCount);
+        case WavSampleType::Int: return convertOrDownmix<WavSampleType::Int>(conversion, in, out, frameCount);
+        case WavSampleType::Float: return convertOrDownmix<WavSampleType::Float>(conversion, in, out, frameCount);
+        case WavSampleType::Double: return convertOrDownmix<WavSampleType::Double>(conversion, in, out, frameCount);
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+}}}
@@ -0,0 +1,71 @@
+#ifndef Magnum_Audio_WavConversion_h
+#define Magnum_Audio_WavConversion_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Audio { namespace Implementation {
+
+/* Sample types supported by WavImporter */
+enum class WavSampleType: UnsignedByte {
+    UnsignedByte,       /* 8-bit unsigned PCM */
+    Short,              /* 16-bit signed PCM */
+    Int24,              /* 24-bit signed PCM */
+    Int,                /* 32-bit signed PCM */
+    Float,              /* 32-bit IEEE float */
+    Double              /* 64-bit IEEE float */
+};
+
+/* Size of one sample of given type in bytes */
+std::size_t wavSampleSize(WavSampleType type);
+
+/* Count of speaker positions in WAVE_FORMAT_EXTENSIBLE channel mask */
+constexpr std::size_t WavMaxChannelCount = 18;
+
+/* Conversion of interleaved samples to 16-bit mono or stereo. More than two
+   channels are downmixed to stereo. */
+struct WavConversion {
+    WavSampleType type;
+    UnsignedInt channelCount;
+    UnsignedInt outputChannelCount;
+
+    /* Weights of input channels in left and right output channel, used only
+       for downmixing. Sum of weights for each output channel is 1. */
+    Float weights[2][WavMaxChannelCount];
+};
+
+/* Sets up the conversion. If the channel mask is zero, default speaker
+   layout for given channel count is used. */
+WavConversion wavConversion(WavSampleType type, UnsignedInt channelCount, UnsignedInt channelMask);
+
+/* Converts given count of frames. Input is expected to be little-endian. */
+void convertWav(const WavConversion& conversion, const unsigned char* in, Short* out, std::size_t frameCount);
+
+}}}
+
+#endif
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Struct Magnum::Audio::WavHeader
+ * @brief Struct Magnum::Audio::WavRiffHeader, Magnum::Audio::WavChunkHeader, Magnum::Audio::WavFormatChunk, Magnum::Audio::WavFormatChunkExtension
  */
 
 #include "Magnum/Types.h"
@@ -35,26 +35,42 @@ namespace Magnum { namespace Audio {
 
 #pragma pack(1)
 /** @brief WAV file header */
-struct WavHeader {
+struct WavRiffHeader {
     char chunkId[4];                /**< @brief `RIFF` characters */
     UnsignedInt chunkSize;          /**< @brief Size of the rest of the file */
     char format[4];                 /**< @brief `WAVE` characters */
+};
+
+/** @brief WAV chunk header */
+struct WavChunkHeader {
+    char chunkId[4];                /**< @brief Chunk ID, e.g. `fmt ` or `data` */
+    UnsignedInt chunkSize;          /**< @brief Size of the chunk data without padding */
+};
 
-    char subChunk1Id[4];            /**< @brief `fmt ` characters */
-    UnsignedInt subChunk1Size;      /**< @brief 16 for PCM */
-    UnsignedShort audioFormat;      /**< @brief 1 = PCM */
+/** @brief WAV format chunk */
+struct WavFormatChunk {
+    UnsignedShort audioFormat;      /**< @brief 1 = PCM, 3 = IEEE float, 0xFFFE = extensible */
     UnsignedShort numChannels;      /**< @brief 1 = Mono, 2 = Stereo */
     UnsignedInt sampleRate;         /**< @brief Sample rate in Hz */
     UnsignedInt byteRate;           /**< @brief Bytes per second */
     UnsignedShort blockAlign;       /**< @brief Bytes per sample (all channels) */
     UnsignedShort bitsPerSample;    /**< @brief Bits per sample (one channel) */
+};
 
-    char subChunk2Id[4];            /**< @brief `data` characters */
-    UnsignedInt subChunk2Size;      /**< @brief Size of the following data */
+/** @brief Extension of WAV format chunk for extensible format */
+struct WavFormatChunkExtension {
+    UnsignedShort extensionSize;    /**< @brief Size of the extension (22) */
+    UnsignedShort validBitsPerSample; /**< @brief Valid bits per sample */
+    UnsignedInt channelMask;        /**< @brief Speaker position mask */
+    UnsignedShort subFormat;        /**< @brief Actual audio format, first two bytes of format GUID */
+    char subFormatGuid[14];         /**< @brief Rest of the format GUID */
 };
 #pragma pack()
 
-static_assert(sizeof(WavHeader) == 44, "WavHeader size is not 44 bytes");
+static_assert(sizeof(WavRiffHeader) == 12, "WavRiffHeader size is not 12 bytes");
+static_assert(sizeof(WavChunkHeader) == 8, "WavChunkHeader size is not 8 bytes");
+static_assert(sizeof(WavFormatChunk) == 16, "WavFormatChunk size is not 16 bytes");
+static_assert(sizeof(WavFormatChunkExtension) == 24, "WavFormatChunkExtension size is not 24 bytes");
 
 }}
 
@@ -25,6 +25,8 @@
 
 #include "WavImporter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/Endianness.h>
@@ -33,99 +35,196 @@
 
 namespace Magnum { namespace Audio {
 
-WavImporter::WavImporter() = default;
+WavImporter::WavImporter(): _opened(false) {}
 
-WavImporter::WavImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
+WavImporter::WavImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), _opened(false) {}
 
 WavImporter::~WavImporter() { close(); }
 
-auto WavImporter::doFeatures() const -> Features { return Feature::OpenData; }
+auto WavImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::Streaming; }
 
-bool WavImporter::doIsOpened() const { return _data; }
+bool WavImporter::doIsOpened() const { return _opened; }
 
 void WavImporter::doOpenData(Containers::ArrayReference<const unsigned char> data) {
-    /* Check file size */
-    if(data.size() < sizeof(WavHeader)) {
+    /* Check file size, the smallest valid file consists of the RIFF header,
+       format chunk and empty data chunk */
+    if(data.size() < sizeof(WavRiffHeader) + 2*sizeof(WavChunkHeader) + sizeof(WavFormatChunk)) {
         Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
         return;
     }
 
-    /* Get header contents and fix endianness */
-    WavHeader header(*reinterpret_cast<const WavHeader*>(data.begin()));
-    Utility::Endianness::littleEndianInPlace(header.chunkSize,
-        header.subChunk1Size, header.audioFormat, header.numChannels,
-        header.sampleRate, header.byteRate, header.blockAlign,
-        header.bitsPerSample, header.subChunk2Size);
+    /** @todo Convert the data from little endian too */
+    CORRADE_INTERNAL_ASSERT(!Utility::Endianness::isBigEndian());
 
     /* Check file signature */
+    WavRiffHeader header;
+    std::memcpy(&header, data.begin(), sizeof(WavRiffHeader));
     if(std::strncmp(header.chunkId, "RIFF", 4) != 0 ||
-       std::strncmp(header.format, "WAVE", 4) != 0 ||
-       std::strncmp(header.subChunk1Id, "fmt ", 4) != 0 ||
-       std::strncmp(header.subChunk2Id, "data", 4) != 0) {
+       std::strncmp(header.format, "WAVE", 4) != 0) {
         Error() << "Audio::WavImporter::openData(): the file signature is invalid";
         return;
     }
 
-    /* Check file size */
-    if(header.chunkSize + 8 != data.size()) {
-        Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
-                << header.chunkSize + 8 << "but got" << data.size();
+    /* Walk through the chunks and find the format and data chunk. Some
+       writers put wrong size into the RIFF header, so stop also at the actual
+       end of the file. Other chunks such as LIST or fact are skipped. */
+    const std::size_t end = std::min(data.size(), std::size_t(Utility::Endianness::littleEndian(header.chunkSize)) + 8);
+    const unsigned char* formatChunk = nullptr;
+    std::size_t formatChunkSize = 0;
+    const unsigned char* dataChunk = nullptr;
+    std::size_t dataChunkSize = 0;
+    for(std::size_t offset = sizeof(WavRiffHeader); offset + sizeof(WavChunkHeader) <= end; ) {
+        WavChunkHeader chunk;
+        std::memcpy(&chunk, data.begin() + offset, sizeof(WavChunkHeader));
+        const std::size_t chunkSize = Utility::Endianness::littleEndian(chunk.chunkSize);
+        offset += sizeof(WavChunkHeader);
+
+        if(chunkSize > end - offset) {
+            Error() << "Audio::WavImporter::openData(): chunk" << std::string(chunk.chunkId, 4)
+                    << "is truncated, expected" << chunkSize << "bytes but got" << end - offset;
+            return;
+        }
+
+        if(std::strncmp(chunk.chunkId, "fmt ", 4) == 0) {
+            formatChunk = data.begin() + offset;
+            formatChunkSize = chunkSize;
+        } else if(std::strncmp(chunk.chunkId, "data", 4) == 0) {
+            dataChunk = data.begin() + offset;
+            dataChunkSize = chunkSize;
+        }
+
+        /* Chunks are padded to even size */
+        offset += chunkSize + (chunkSize & 1);
+    }
+
+    if(!formatChunk || !dataChunk) {
+        Error() << "Audio::WavImporter::openData(): the file has no" << (formatChunk ? "data" : "format") << "chunk";
         return;
     }
 
-    /* Check PCM format */
-    if(header.audioFormat != 1) {
-        Error() << "Audio::WavImporter::openData(): unsupported audio format" << header.audioFormat;
+    /* Get format contents and fix endianness */
+    if(formatChunkSize < sizeof(WavFormatChunk)) {
+        Error() << "Audio::WavImporter::openData(): the file is corrupted";
+        return;
+    }
+    WavFormatChunk format;
+    std::memcpy(&format, formatChunk, sizeof(WavFormatChunk));
+    Utility::Endianness::littleEndianInPlace(format.audioFormat,
+        format.numChannels, format.sampleRate, format.byteRate,
+        format.blockAlign, format.bitsPerSample);
+
+    /* Extensible format has the actual format and speaker positions in the
+       extension */
+    UnsignedShort audioFormat = format.audioFormat;
+    UnsignedInt channelMask = 0;
+    if(audioFormat == 0xfffe) {
+        if(formatChunkSize < sizeof(WavFormatChunk) + sizeof(WavFormatChunkExtension)) {
+            Error() << "Audio::WavImporter::openData(): the file is corrupted";
+            return;
+        }
+
+        WavFormatChunkExtension extension;
+        std::memcpy(&extension, formatChunk + sizeof(WavFormatChunk), sizeof(WavFormatChunkExtension));
+        audioFormat = Utility::Endianness::littleEndian(extension.subFormat);
+        channelMask = Utility::Endianness::littleEndian(extension.channelMask);
+    }
+
+    /* Check PCM or float format */
+    if(audioFormat != 1 && audioFormat != 3) {
+        Error() << "Audio::WavImporter::openData(): unsupported audio format" << audioFormat;
         return;
     }
 
     /* Verify more things */
-    if(header.subChunk1Size != 16 ||
-       header.subChunk2Size + 44 != data.size() ||
-       header.blockAlign != header.numChannels*header.bitsPerSample/8 ||
-       header.byteRate != header.sampleRate*header.blockAlign) {
+    if(format.blockAlign != format.numChannels*format.bitsPerSample/8 ||
+       format.byteRate != format.sampleRate*format.blockAlign) {
         Error() << "Audio::WavImporter::openData(): the file is corrupted";
         return;
     }
 
-    /* Decide about format */
-    if(header.numChannels == 1 && header.bitsPerSample == 8)
-        _format = Buffer::Format::Mono8;
-    else if(header.numChannels == 1 && header.bitsPerSample == 16)
-        _format = Buffer::Format::Mono16;
-    else if(header.numChannels == 2 && header.bitsPerSample == 8)
-        _format = Buffer::Format::Stereo8;
-    else if(header.numChannels == 2 && header.bitsPerSample == 16)
-        _format = Buffer::Format::Stereo16;
-    else {
+    /* Decide about sample type */
+    Implementation::WavSampleType type{};
+    bool supported = format.numChannels && format.numChannels <= Implementation::WavMaxChannelCount;
+    if(audioFormat == 1 && format.bitsPerSample == 8)
+        type = Implementation::WavSampleType::UnsignedByte;
+    else if(audioFormat == 1 && format.bitsPerSample == 16)
+        type = Implementation::WavSampleType::Short;
+    else if(audioFormat == 1 && format.bitsPerSample == 24)
+        type = Implementation::WavSampleType::Int24;
+    else if(audioFormat == 1 && format.bitsPerSample == 32)
+        type = Implementation::WavSampleType::Int;
+    else if(audioFormat == 3 && format.bitsPerSample == 32)
+        type = Implementation::WavSampleType::Float;
+    else if(audioFormat == 3 && format.bitsPerSample == 64)
+        type = Implementation::WavSampleType::Double;
+    else supported = false;
+
+    if(!supported) {
         Error() << "Audio::WavImporter::openData(): unsupported channel count"
-                << header.numChannels << "with" << header.bitsPerSample
+                << format.numChannels << "with" << format.bitsPerSample
                 << "bits per sample";
         return;
     }
 
-    /* Save frequency */
-    _frequency = header.sampleRate;
-
-    /** @todo Convert the data from little endian too */
-    CORRADE_INTERNAL_ASSERT(!Utility::Endianness::isBigEndian());
+    /* Mono and stereo 8- and 16-bit PCM is used as-is, everything else is
+       converted to 16-bit mono or stereo */
+    _conversion = Implementation::wavConversion(type, format.numChannels, channelMask);
+    _converted = format.numChannels > 2 || (type != Implementation::WavSampleType::UnsignedByte && type != Implementation::WavSampleType::Short);
+    if(type == Implementation::WavSampleType::UnsignedByte && !_converted)
+        _format = format.numChannels == 1 ? Buffer::Format::Mono8 : Buffer::Format::Stereo8;
+    else
+        _format = _conversion.outputChannelCount == 1 ? Buffer::Format::Mono16 : Buffer::Format::Stereo16;
+
+    /* Save frequency and frame sizes */
+    _frequency = format.sampleRate;
+    _frameSize = format.blockAlign;
+    _outputFrameSize = _converted ? _conversion.outputChannelCount*sizeof(Short) : _frameSize;
+
+    /* Reference the data directly if they stay valid until the file is
+       closed, so long files can be streamed without being loaded into
+       memory. Copy the data otherwise. Incomplete trailing frame is
+       ignored. */
+    const Containers::ArrayReference<const unsigned char> samples{dataChunk, dataChunkSize/_frameSize*_frameSize};
+    if(isDataPersistent()) _data = samples;
+    else {
+        _storage = Containers::Array<unsigned char>(samples.size());
+        std::copy(samples.begin(), samples.end(), _storage.begin());
+        _data = _storage;
+    }
 
-    /* Copy the data */
-    _data = Containers::Array<unsigned char>(header.subChunk2Size);
-    std::copy(data.begin()+sizeof(WavHeader), data.end(), _data.begin());
-    return;
+    _opened = true;
 }
 
-void WavImporter::doClose() { _data = nullptr; }
+void WavImporter::doClose() {
+    _storage = nullptr;
+    _data = nullptr;
+    _opened = false;
+}
 
 Buffer::Format WavImporter::doFormat() const { return _format; }
 
 UnsignedInt WavImporter::doFrequency() const { return _frequency; }
 
 Containers::Array<unsigned char> WavImporter::doData() {
-    Containers::Array<unsigned char> copy(_data.size());
-    std::copy(_data.begin(), _data.end(), copy.begin());
-    return copy;
+    Containers::Array<unsigned char> out(doDataSize());
+    doReadData(0, out);
+    return out;
+}
+
+std::size_t WavImporter::doDataSize() const { return _data.size()/_frameSize*_outputFrameSize; }
+
+std::size_t WavImporter::doReadData(const std::size_t offset, const Containers::ArrayReference<unsigned char> destination) {
+    /* Decode only whole frames */
+    const std::size_t frame = offset/_outputFrameSize;
+    const std::size_t frameCount = std::min(destination.size()/_outputFrameSize, _data.size()/_frameSize - frame);
+    const unsigned char* const in = _data.data() + frame*_frameSize;
+
+    if(_converted)
+        Implementation::convertWav(_conversion, in, reinterpret_cast<Short*>(destination.data()), frameCount);
+    else
+        std::memcpy(destination.data(), in, frameCount*_frameSize);
+
+    return frameCount*_outputFrameSize;
 }
 
 }}
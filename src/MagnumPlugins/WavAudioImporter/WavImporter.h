@@ -32,15 +32,25 @@
 #include <Corrade/Containers/Array.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
+#include "MagnumPlugins/WavAudioImporter/WavConversion.h"
 
 namespace Magnum { namespace Audio {
 
 /**
 @brief WAV importer plugin
 
-Supports mono and stereo PCM files with 8 or 16 bits per channel. The files are
-imported with @ref Buffer::Format::Mono8, @ref Buffer::Format::Mono16,
+Supports PCM files with 8, 16, 24 or 32 bits per channel and IEEE float files
+with 32 or 64 bits per channel, including files in extensible format. Chunks
+other than `fmt ` and `data` (such as `LIST` or `fact`) are skipped.
+
+Mono and stereo files with 8 or 16 bits per channel are imported as-is with
+@ref Buffer::Format::Mono8, @ref Buffer::Format::Mono16,
 @ref Buffer::Format::Stereo8 or @ref Buffer::Format::Stereo16, respectively.
+Other sample types are converted to @ref Buffer::Format::Mono16 or
+@ref Buffer::Format::Stereo16. Files with more than two channels are
+downmixed to @ref Buffer::Format::Stereo16 in the same pass, using speaker
+positions from the channel mask of extensible format or default speaker
+layout for given channel count. The low-frequency channel is dropped.
 
 This plugin is built if `WITH_WAVAUDIOIMPORTER` is enabled when building
 %Magnum. To use dynamic plugin, you need to load `%WavAudioImporter` plugin
@@ -48,6 +58,11 @@ from `MAGNUM_PLUGINS_AUDIOIMPORTER_DIR`. To use static plugin or use this as a
 dependency of another plugin, you need to request `%WavAudioImporter` component
 of `%Magnum` package in CMake and link to `${MAGNUM_WAVAUDIOIMPORTER_LIBRARIES}`.
 See @ref building, @ref cmake and @ref plugins for more information.
+
+The plugin supports @ref Feature::Streaming. When the file is opened using
+@ref openFile() or @ref openPersistentData(), the sample data are referenced
+directly and @ref readData() copies or converts them in blocks, so the
+memory usage is bounded by the size of the blocks requested.
 */
 class WavImporter: public AbstractImporter {
     public:
@@ -68,10 +83,16 @@ class WavImporter: public AbstractImporter {
         Buffer::Format doFormat() const override;
         UnsignedInt doFrequency() const override;
         Containers::Array<unsigned char> doData() override;
+        std::size_t doDataSize() const override;
+        std::size_t doReadData(std::size_t offset, Containers::ArrayReference<unsigned char> destination) override;
 
-        Containers::Array<unsigned char> _data;
+        Containers::Array<unsigned char> _storage;
+        Containers::ArrayReference<const unsigned char> _data;
         Buffer::Format _format;
         UnsignedInt _frequency;
+        Implementation::WavConversion _conversion;
+        std::size_t _frameSize, _outputFrameSize;
+        bool _converted, _opened;
 };
 
 }}
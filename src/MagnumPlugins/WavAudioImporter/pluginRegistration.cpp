@@ -26,4 +26,4 @@
 #include "MagnumPlugins/WavAudioImporter/WavImporter.h"
 
 CORRADE_PLUGIN_REGISTER(WavAudioImporter, Magnum::Audio::WavImporter,
-    "cz.mosra.magnum.Audio.AbstractImporter/0.1")
+    "cz.mosra.magnum.Audio.AbstractImporter/0.2")